@@ -141,6 +141,9 @@ const AP_Scheduler::Task Copter::scheduler_tasks[] = {
     SCHED_TASK(ekf_check,             10,     75),
     SCHED_TASK(check_vibration,       10,     50),
     SCHED_TASK(gpsglitch_check,       10,     50),
+#if LOGGING_ENABLED == ENABLED
+    SCHED_TASK(Log_Sensor_Health,     10,     75),
+#endif
     SCHED_TASK(landinggear_update,    10,     75),
     SCHED_TASK(standby_update,        100,    75),
     SCHED_TASK(lost_vehicle_check,    10,     50),
@@ -259,10 +262,8 @@ void Copter::fast_loop()
     camera_mount.update_fast();
 #endif
 
-    // log sensor health
-    if (should_log(MASK_LOG_ANY)) {
-        Log_Sensor_Health();
-    }
+    // high-rate PID burst capture for tuning
+    pid_burst_update();
 
     AP_Vehicle::fast_loop();
 }
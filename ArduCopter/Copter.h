@@ -785,6 +785,31 @@ private:
     void Log_Write_Vehicle_Startup_Messages();
     void log_init(void);
 
+    // high-rate PID burst capture for tuning (see Log.cpp).  rate
+    // controller PID state is captured into a circular RAM buffer at
+    // loop rate and flushed to the logger after an aux switch
+    // trigger, giving loop-rate PIDR/PIDP/PIDY records without
+    // paying the logging bandwidth continuously
+    struct pid_burst_sample {
+        uint64_t time_us;               // timestamp of the sample
+        AP_Logger::PID_Info roll;
+        AP_Logger::PID_Info pitch;
+        AP_Logger::PID_Info yaw;
+    };
+    struct {
+        pid_burst_sample *samples;      // circular buffer, allocated when the aux function is configured
+        uint16_t capacity;              // total number of slots in the buffer
+        uint16_t head;                  // next slot to be written
+        uint16_t count;                 // number of valid samples held
+        uint16_t post_trigger_remaining; // samples still to capture after the trigger
+        uint16_t flush_next;            // next sample to be written to the logger
+        bool triggered;                 // trigger seen, filling the post-trigger half
+        bool flushing;                  // draining the buffer to the logger
+    } pid_burst;
+    void pid_burst_init();
+    void pid_burst_trigger();
+    void pid_burst_update();
+
     // mode.cpp
     bool set_mode(Mode::Number mode, ModeReason reason);
     bool set_mode(const uint8_t new_mode, const ModeReason reason) override;
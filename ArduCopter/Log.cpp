@@ -79,6 +79,92 @@ void Copter::Log_Write_Attitude()
     }
 }
 
+// number of slots in the PID burst capture buffer.  half are kept as
+// pre-trigger history, half are filled after the trigger
+#define PID_BURST_CAPACITY 512
+// samples written to the logger per loop while draining a capture,
+// chosen to stay within the backend's sustained write rate
+#define PID_BURST_FLUSH_PER_LOOP 1
+
+// allocate the PID burst capture buffer.  called when the aux
+// function is configured so pre-trigger history is recorded from boot
+void Copter::pid_burst_init()
+{
+    if (pid_burst.samples != nullptr) {
+        return;
+    }
+    pid_burst.samples = (pid_burst_sample *)calloc(PID_BURST_CAPACITY, sizeof(pid_burst_sample));
+    if (pid_burst.samples == nullptr) {
+        gcs().send_text(MAV_SEVERITY_WARNING, "PID burst: buffer allocation failed");
+        return;
+    }
+    pid_burst.capacity = PID_BURST_CAPACITY;
+}
+
+// trigger a burst capture.  the pre-trigger half of the buffer is
+// already populated; capture continues until the post-trigger half is
+// filled and the whole buffer is then flushed to the logger
+void Copter::pid_burst_trigger()
+{
+    if (pid_burst.samples == nullptr || pid_burst.triggered || pid_burst.flushing) {
+        return;
+    }
+    pid_burst.triggered = true;
+    pid_burst.post_trigger_remaining = pid_burst.capacity / 2;
+    gcs().send_text(MAV_SEVERITY_INFO, "PID burst: triggered");
+}
+
+// capture rate controller PID state at loop rate.  called from
+// fast_loop after the rate controllers have run
+void Copter::pid_burst_update()
+{
+    if (pid_burst.samples == nullptr) {
+        return;
+    }
+
+    if (pid_burst.flushing) {
+        // drain a few samples per loop so a capture does not swamp
+        // the logger's buffer
+        for (uint8_t i=0; i<PID_BURST_FLUSH_PER_LOOP && pid_burst.count > 0; i++) {
+            const pid_burst_sample &s = pid_burst.samples[pid_burst.flush_next];
+            logger.Write_PID(LOG_PIDR_MSG, s.roll, s.time_us);
+            logger.Write_PID(LOG_PIDP_MSG, s.pitch, s.time_us);
+            logger.Write_PID(LOG_PIDY_MSG, s.yaw, s.time_us);
+            pid_burst.flush_next = (pid_burst.flush_next+1) % pid_burst.capacity;
+            pid_burst.count--;
+        }
+        if (pid_burst.count == 0) {
+            pid_burst.flushing = false;
+            pid_burst.triggered = false;
+            gcs().send_text(MAV_SEVERITY_INFO, "PID burst: capture complete");
+        }
+        return;
+    }
+
+    // record into the circular buffer
+    pid_burst_sample &s = pid_burst.samples[pid_burst.head];
+    s.time_us = AP_HAL::micros64();
+    s.roll = attitude_control->get_rate_roll_pid().get_pid_info();
+    s.pitch = attitude_control->get_rate_pitch_pid().get_pid_info();
+    s.yaw = attitude_control->get_rate_yaw_pid().get_pid_info();
+    pid_burst.head = (pid_burst.head+1) % pid_burst.capacity;
+    if (pid_burst.count < pid_burst.capacity) {
+        pid_burst.count++;
+    }
+
+    if (pid_burst.triggered) {
+        if (pid_burst.post_trigger_remaining > 0) {
+            pid_burst.post_trigger_remaining--;
+        }
+        if (pid_burst.post_trigger_remaining == 0) {
+            // post-trigger half is full; start draining from the
+            // oldest sample held
+            pid_burst.flushing = true;
+            pid_burst.flush_next = (pid_burst.head + pid_burst.capacity - pid_burst.count) % pid_burst.capacity;
+        }
+    }
+}
+
 // Write an EKF and POS packet
 void Copter::Log_Write_EKF_POS()
 {
@@ -247,8 +333,16 @@ void Copter::Log_Write_Parameter_Tuning(uint8_t param, float tuning_val, float t
 }
 
 // logs when baro or compass becomes unhealthy
+// check sensor health and log transitions.  scheduled at 10Hz: the
+// per-sensor healthy() calls (notably the compass consistency math)
+// are too expensive to re-evaluate every loop and the states they
+// track change on a timescale of seconds
 void Copter::Log_Sensor_Health()
 {
+    if (!should_log(MASK_LOG_ANY)) {
+        return;
+    }
+
     // check baro
     if (sensor_health.baro != barometer.healthy()) {
         sensor_health.baro = barometer.healthy();
@@ -647,6 +741,9 @@ void Copter::Log_Write_GuidedTarget(uint8_t target_type, const Vector3f& pos_tar
 void Copter::Log_Write_SysID_Setup(uint8_t systemID_axis, float waveform_magnitude, float frequency_start, float frequency_stop, float time_fade_in, float time_const_freq, float time_record, float time_fade_out) {}
 void Copter::Log_Write_SysID_Data(float waveform_time, float waveform_sample, float waveform_freq, float angle_x, float angle_y, float angle_z, float accel_x, float accel_y, float accel_z) {}
 void Copter::Log_Write_Vehicle_Startup_Messages() {}
+void Copter::pid_burst_init() {}
+void Copter::pid_burst_trigger() {}
+void Copter::pid_burst_update() {}
 
 #if FRAME_CONFIG == HELI_FRAME
 void Copter::Log_Write_Heli() {}
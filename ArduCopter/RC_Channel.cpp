@@ -118,6 +118,11 @@ void RC_Channel_Copter::init_aux_function(const aux_func_t ch_option, const AuxS
     case AUX_FUNC::AIRMODE:
         do_aux_function_change_air_mode(ch_flag);
         break;
+    case AUX_FUNC::PID_BURST:
+        // allocate the capture buffer at boot so the pre-trigger
+        // history is already being recorded when the pilot triggers
+        copter.pid_burst_init();
+        break;
     default:
         RC_Channel::init_aux_function(ch_option, ch_flag);
         break;
@@ -579,7 +584,15 @@ void RC_Channel_Copter::do_aux_function(const aux_func_t ch_option, const AuxSwi
             copter.mode_acro.air_mode_aux_changed();
 #endif
             break;
-            
+
+        case AUX_FUNC::PID_BURST:
+            // trigger a high-rate PID burst capture for tuning
+            if (ch_flag == AuxSwitchPos::HIGH) {
+                copter.pid_burst_trigger();
+            }
+            break;
+
+
     default:
         RC_Channel::do_aux_function(ch_option, ch_flag);
         break;
@@ -184,6 +184,26 @@ void LR_MsgHandler_RWA3::process_message(uint8_t *msgbytes)
     }
 }
 
+void LR_MsgHandler_RSH3::process_message(uint8_t *msgbytes)
+{
+    if (!replay_apply_snapshots) {
+        // applying snapshots would mask divergence between the
+        // replayed filter and the one that flew, so they are opt-in
+        return;
+    }
+    MSG_CREATE(RSH3, msgbytes);
+    ekf3.handleSnapshotHeader(msg.core, msg.num_chunks);
+}
+
+void LR_MsgHandler_RSC3::process_message(uint8_t *msgbytes)
+{
+    if (!replay_apply_snapshots) {
+        return;
+    }
+    MSG_CREATE(RSC3, msgbytes);
+    ekf3.handleSnapshotChunk(msg.core, msg.index, msg.data);
+}
+
 void LR_MsgHandler_REY3::process_message(uint8_t *msgbytes)
 {
     MSG_CREATE(REY3, msgbytes);
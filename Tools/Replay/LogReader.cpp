@@ -80,6 +80,10 @@ bool LogReader::handle_log_format_msg(const struct log_Format &f)
         msgparser[f.type] = new LR_MsgHandler_RSO3(formats[f.type], ekf2, ekf3);
 	} else if (streq(name, "RWA3")) {
         msgparser[f.type] = new LR_MsgHandler_RWA3(formats[f.type], ekf2, ekf3);
+	} else if (streq(name, "RSH3")) {
+        msgparser[f.type] = new LR_MsgHandler_RSH3(formats[f.type], ekf2, ekf3);
+	} else if (streq(name, "RSC3")) {
+        msgparser[f.type] = new LR_MsgHandler_RSC3(formats[f.type], ekf2, ekf3);
 	} else if (streq(name, "REY3")) {
         msgparser[f.type] = new LR_MsgHandler_REY3(formats[f.type], ekf2, ekf3);
 	} else if (streq(name, "RISH")) {
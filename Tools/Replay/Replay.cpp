@@ -38,6 +38,7 @@ static ReplayVehicle replayvehicle;
 user_parameter *user_parameters;
 bool replay_force_ekf2;
 bool replay_force_ekf3;
+bool replay_apply_snapshots;
 
 #define GSCALAR(v, name, def) { replayvehicle.g.v.vtype, name, Parameters::k_param_ ## v, &replayvehicle.g.v, {def_value : def} }
 #define GOBJECT(v, name, class) { AP_PARAM_GROUP, name, Parameters::k_param_ ## v, &replayvehicle.v, {group_info : class::var_info} }
@@ -131,11 +132,13 @@ void Replay::usage(void)
     ::printf("\t--param-file FILENAME  load parameters from a file\n");
     ::printf("\t--force-ekf2 force enable EKF2\n");
     ::printf("\t--force-ekf3 force enable EKF3\n");
+    ::printf("\t--apply-snapshots restore EKF3 state snapshots found in the log; used with a log trimmed to start at a snapshot to seek into a flight\n");
 }
 
 enum param_key : uint8_t {
     FORCE_EKF2 = 1,
     FORCE_EKF3,
+    APPLY_SNAPSHOTS,
 };
 
 void Replay::_parse_command_line(uint8_t argc, char * const argv[])
@@ -147,6 +150,7 @@ void Replay::_parse_command_line(uint8_t argc, char * const argv[])
         {"param-file",      true,   0, 'F'},
         {"force-ekf2",      false,  0, param_key::FORCE_EKF2},
         {"force-ekf3",      false,  0, param_key::FORCE_EKF3},
+        {"apply-snapshots", false,  0, param_key::APPLY_SNAPSHOTS},
         {"help",            false,  0, 'h'},
         {0, false, 0, 0}
     };
@@ -182,6 +186,10 @@ void Replay::_parse_command_line(uint8_t argc, char * const argv[])
             replay_force_ekf3 = true;
             break;
 
+        case param_key::APPLY_SNAPSHOTS:
+            replay_apply_snapshots = true;
+            break;
+
         case 'h':
         default:
             usage();
@@ -26,6 +26,7 @@ struct user_parameter {
 extern user_parameter *user_parameters;
 extern bool replay_force_ekf2;
 extern bool replay_force_ekf3;
+extern bool replay_apply_snapshots;
 
 class ReplayVehicle : public AP_Vehicle {
 public:
@@ -0,0 +1,184 @@
+#!/usr/bin/env python
+
+'''
+run Replay over many logs in parallel and aggregate EKF innovation statistics
+
+Each log is replayed in its own working directory so the output logs do
+not collide, sharded across worker processes. For every replayed log the
+EKF innovation test ratios (NKF4/XKF4 SV/SP/SH/SM) are summarised and
+optionally the check_replay.py consistency check is run. Results are
+written to a JSON file for regression tracking.
+'''
+
+from __future__ import print_function
+
+import glob
+import json
+import multiprocessing
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import check_replay
+
+# innovation test ratio fields common to NKF4 (EKF2) and XKF4 (EKF3)
+INNOVATION_FIELDS = ['SV', 'SP', 'SH', 'SM']
+
+
+def progress(message):
+    print("BatchReplay: %s" % message)
+
+
+def innovation_stats(logfile_path, ekf2_only=False, ekf3_only=False):
+    '''summarise innovation test ratios from a replay output log'''
+    from pymavlink import mavutil
+
+    if ekf2_only:
+        mlist = ['NKF4']
+    elif ekf3_only:
+        mlist = ['XKF4']
+    else:
+        mlist = ['NKF4', 'XKF4']
+
+    stats = {}
+    mlog = mavutil.mavlink_connection(logfile_path)
+    while True:
+        m = mlog.recv_match(type=mlist)
+        if m is None:
+            break
+        core = getattr(m, 'C', 0)
+        key = "%s[%u]" % (m.get_type(), core)
+        if key not in stats:
+            stats[key] = dict((f, {'sum': 0.0, 'max': 0.0, 'count': 0}) for f in INNOVATION_FIELDS)
+        for f in INNOVATION_FIELDS:
+            value = getattr(m, f, None)
+            if value is None:
+                continue
+            s = stats[key][f]
+            s['sum'] += value
+            s['max'] = max(s['max'], value)
+            s['count'] += 1
+
+    # reduce to mean/max per field
+    result = {}
+    for key in sorted(stats.keys()):
+        result[key] = {}
+        for f in INNOVATION_FIELDS:
+            s = stats[key][f]
+            if s['count'] == 0:
+                continue
+            result[key][f] = {
+                'mean': s['sum'] / s['count'],
+                'max': s['max'],
+                'count': s['count'],
+            }
+    return result
+
+
+def replay_one_log(job):
+    '''replay a single log in a private working directory, returns a result dict'''
+    (replay_bin, logfile_path, run_check, ekf2_only, ekf3_only) = job
+
+    result = {
+        'log': logfile_path,
+        'success': False,
+    }
+
+    workdir = tempfile.mkdtemp(prefix='batch_replay_')
+    try:
+        os.mkdir(os.path.join(workdir, 'logs'))
+        ret = subprocess.call([replay_bin, logfile_path], cwd=workdir,
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        if ret != 0:
+            result['error'] = "Replay exited with status %d" % ret
+            return result
+
+        new_logs = sorted(glob.glob(os.path.join(workdir, 'logs', '*.BIN')))
+        if len(new_logs) != 1:
+            result['error'] = "Expected a single output log, found %u" % len(new_logs)
+            return result
+        output_log = new_logs[0]
+
+        result['innovations'] = innovation_stats(output_log, ekf2_only, ekf3_only)
+        if run_check:
+            result['check_passed'] = check_replay.check_log(
+                output_log, progress=lambda x: None,
+                ekf2_only=ekf2_only, ekf3_only=ekf3_only)
+            result['success'] = result['check_passed']
+        else:
+            result['success'] = True
+    except Exception as ex:
+        result['error'] = str(ex)
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    return result
+
+
+def get_log_list(paths):
+    '''expand files and directories into a list of logs'''
+    file_list = []
+    for path in paths:
+        if os.path.isdir(path):
+            file_list.extend(sorted(glob.glob(os.path.join(path, '*.BIN'))))
+            file_list.extend(sorted(glob.glob(os.path.join(path, '*.bin'))))
+        else:
+            file_list.append(path)
+    return [os.path.abspath(p) for p in file_list]
+
+
+def run_batch(replay_bin, logs, jobs, run_check, ekf2_only, ekf3_only):
+    '''shard logs across worker processes, returns the list of result dicts'''
+    job_list = [(os.path.abspath(replay_bin), log, run_check, ekf2_only, ekf3_only)
+                for log in logs]
+    pool = multiprocessing.Pool(processes=jobs)
+    try:
+        results = pool.map(replay_one_log, job_list)
+    finally:
+        pool.close()
+        pool.join()
+    return results
+
+
+if __name__ == '__main__':
+    from argparse import ArgumentParser
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument("--replay", default="build/sitl/tools/Replay", help="path to Replay binary")
+    parser.add_argument("--jobs", "-j", type=int, default=multiprocessing.cpu_count(), help="number of parallel workers")
+    parser.add_argument("--output", default="batch_replay_results.json", help="JSON results file")
+    parser.add_argument("--check", action='store_true', help="also run the check_replay consistency check")
+    parser.add_argument("--ekf2-only", action='store_true', help="only consider EKF2")
+    parser.add_argument("--ekf3-only", action='store_true', help="only consider EKF3")
+    parser.add_argument("logs", metavar="LOG", nargs="+", help="log files or directories of logs")
+
+    args = parser.parse_args()
+
+    log_list = get_log_list(args.logs)
+    if len(log_list) == 0:
+        progress("No logs to process")
+        sys.exit(1)
+    progress("Replaying %u logs on %u workers" % (len(log_list), args.jobs))
+
+    results = run_batch(args.replay, log_list, args.jobs,
+                        args.check, args.ekf2_only, args.ekf3_only)
+
+    failed = 0
+    for result in results:
+        if result['success']:
+            status = "OK"
+        else:
+            status = "FAILED (%s)" % result.get('error', 'check_replay mismatch')
+            failed += 1
+        progress("%s: %s" % (result['log'], status))
+
+    with open(args.output, 'w') as f:
+        json.dump({'results': results}, f, indent=2, sort_keys=True)
+    progress("Wrote %s" % args.output)
+
+    if failed:
+        progress("%u of %u logs failed" % (failed, len(results)))
+        sys.exit(1)
+    progress("All %u logs passed" % len(results))
+    sys.exit(0)
@@ -0,0 +1,147 @@
+#!/usr/bin/env python
+# encoding: utf-8
+
+# This file is free software: you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This file is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program.  If not, see <http://www.gnu.org/licenses/>.
+'''
+Waf tool emitting a per-library flash/RAM attribution report, run as
+
+    waf size_report
+
+Object files are grouped by their source library (the directory under
+libraries/, or the vehicle directory) and their text/data/bss sizes
+are summed with the toolchain size tool. Flash is text+data, RAM is
+data+bss. The report is written as JSON to size_report.json in the
+build directory so it can be diffed by machines as well as humans.
+
+If a baseline exists at Tools/size_baseline/<board>.json the report is
+compared against it, the per-library deltas are printed, and the diff
+is written to size_report_diff.json. Refresh the baseline by copying
+the build's size_report.json over it.
+'''
+import json
+import os
+
+from waflib import Context, Logs
+from waflib.Configure import conf
+
+# how many object files to pass to one size invocation
+SIZE_BATCH = 200
+
+
+def _library_for_node(bld, node):
+    rel = node.path_from(bld.bldnode)
+    parts = rel.split(os.sep)
+    if parts[0] == 'libraries' and len(parts) > 1:
+        return parts[1]
+    # vehicle and tool objects are grouped by their top directory
+    return parts[0]
+
+
+def _sum_sizes(bld, groups):
+    totals = {}
+    size_tool = bld.env.get_flat('SIZE')
+    for lib, nodes in groups.items():
+        t = dict(text=0, data=0, bss=0)
+        paths = [n.path_from(bld.bldnode) for n in nodes]
+        for i in range(0, len(paths), SIZE_BATCH):
+            out = bld.cmd_and_log(
+                [size_tool] + paths[i:i+SIZE_BATCH],
+                cwd=bld.bldnode.abspath(),
+                quiet=Context.BOTH,
+            )
+            for line in out.splitlines()[1:]:
+                row = line.strip().split()
+                t['text'] += int(row[0])
+                t['data'] += int(row[1])
+                t['bss'] += int(row[2])
+        t['flash'] = t['text'] + t['data']
+        t['ram'] = t['data'] + t['bss']
+        totals[lib] = t
+    return totals
+
+
+def _baseline_path(bld):
+    return os.path.join(bld.srcnode.abspath(),
+                        'Tools', 'size_baseline',
+                        bld.env.BOARD + '.json')
+
+
+def _print_report(totals, diff):
+    Logs.info('')
+    Logs.info('%sPer-library size report (flash = text+data, ram = data+bss)' %
+              Logs.colors.BOLD)
+    fmt = '%-28s %10s %10s'
+    Logs.info(fmt % ('Library', 'Flash', 'RAM'))
+    for lib in sorted(totals, key=lambda k: -totals[k]['flash']):
+        t = totals[lib]
+        if t['flash'] == 0 and t['ram'] == 0:
+            continue
+        line = fmt % (lib, t['flash'], t['ram'])
+        if diff is not None and lib in diff:
+            d = diff[lib]
+            line += '   (%+d flash, %+d ram)' % (d['flash'], d['ram'])
+        Logs.info(line)
+
+
+def _size_report(bld):
+    if not bld.env.SIZE:
+        Logs.warn('size_report: no size tool found, skipping')
+        return
+
+    groups = {}
+    for node in bld.bldnode.ant_glob('**/*.o', quiet=True):
+        lib = _library_for_node(bld, node)
+        groups.setdefault(lib, []).append(node)
+    if not groups:
+        Logs.warn('size_report: no object files found')
+        return
+
+    totals = _sum_sizes(bld, groups)
+
+    report_node = bld.bldnode.make_node('size_report.json')
+    report_node.write(json.dumps(totals, indent=2, sort_keys=True) + '\n')
+
+    diff = None
+    baseline_path = _baseline_path(bld)
+    if os.path.exists(baseline_path):
+        with open(baseline_path) as f:
+            baseline = json.load(f)
+        diff = {}
+        for lib in sorted(set(totals) | set(baseline)):
+            new = totals.get(lib, dict(flash=0, ram=0))
+            old = baseline.get(lib, dict(flash=0, ram=0))
+            d_flash = new['flash'] - old.get('flash', 0)
+            d_ram = new['ram'] - old.get('ram', 0)
+            if d_flash != 0 or d_ram != 0:
+                diff[lib] = dict(flash=d_flash, ram=d_ram)
+        diff_node = bld.bldnode.make_node('size_report_diff.json')
+        diff_node.write(json.dumps(diff, indent=2, sort_keys=True) + '\n')
+
+    _print_report(totals, diff)
+
+    if diff is not None:
+        total_flash = sum(d['flash'] for d in diff.values())
+        total_ram = sum(d['ram'] for d in diff.values())
+        Logs.info('%sTotal vs baseline: %+d flash, %+d ram' %
+                  (Logs.colors.BOLD, total_flash, total_ram))
+        Logs.info('diff written to %s' %
+                  bld.bldnode.make_node('size_report_diff.json').path_from(bld.path))
+    else:
+        Logs.info('no baseline at %s, report only' %
+                  os.path.relpath(baseline_path, bld.srcnode.abspath()))
+
+
+@conf
+def size_report_post_fun(bld):
+    bld.add_post_fun(_size_report)
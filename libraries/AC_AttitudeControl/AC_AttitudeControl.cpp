@@ -144,6 +144,13 @@ const AP_Param::GroupInfo AC_AttitudeControl::var_info[] = {
     // @User: Standard
     AP_GROUPINFO("INPUT_TC", 20, AC_AttitudeControl, _input_tc, AC_ATTITUDE_CONTROL_INPUT_TC_DEFAULT),
 
+    // @Param: ANG_DECIM
+    // @DisplayName: Angle controller decimation
+    // @Description: Run the quaternion angle controller every Nth loop iteration, with the rate controller running every iteration on the held targets. The angle loop gains nothing above a few hundred hertz, so this reduces CPU load when running very high loop rates. 0 or 1 disables decimation. Only set this when SCHED_LOOP_RATE is well above 400.
+    // @Range: 0 8
+    // @User: Advanced
+    AP_GROUPINFO("ANG_DECIM", 21, AC_AttitudeControl, _angle_decimation, 0),
+
     AP_GROUPEND
 };
 
@@ -536,6 +543,25 @@ void AC_AttitudeControl::input_angle_step_bf_roll_pitch_yaw(float roll_angle_ste
 // Calculates the body frame angular velocities to follow the target attitude
 void AC_AttitudeControl::attitude_controller_run_quat()
 {
+    // optionally run the full quaternion calculation at a reduced
+    // rate. On skipped calls the target attitude keeps integrating at
+    // the feedforward rate so the next full pass sees an up to date
+    // target, while the rate controller keeps running every loop on
+    // the held rate targets
+    if (_angle_decimation > 1) {
+        _angle_dec_count++;
+        if (_angle_dec_count < (uint8_t)_angle_decimation) {
+            if (_rate_bf_ff_enabled) {
+                Quaternion attitude_target_update_quat;
+                attitude_target_update_quat.from_axis_angle(Vector3f(_attitude_target_ang_vel.x * _dt, _attitude_target_ang_vel.y * _dt, _attitude_target_ang_vel.z * _dt));
+                _attitude_target_quat = _attitude_target_quat * attitude_target_update_quat;
+                _attitude_target_quat.normalize();
+            }
+            return;
+        }
+        _angle_dec_count = 0;
+    }
+
     // Retrieve quaternion vehicle attitude
     Quaternion attitude_vehicle_quat;
     _ahrs.get_quat_body_to_ned(attitude_vehicle_quat);
@@ -602,14 +628,15 @@ void AC_AttitudeControl::thrust_heading_rotation_angles(Quaternion& att_to_quat,
     att_from_quat.rotation_matrix(att_from_rot_matrix);
     Vector3f att_from_thrust_vec = att_from_rot_matrix * Vector3f(0.0f, 0.0f, 1.0f);
 
-    // the dot product is used to calculate the current lean angle for use of external functions
-    _thrust_angle = acosf(constrain_float(Vector3f(0.0f,0.0f,1.0f) * att_from_thrust_vec,-1.0f,1.0f));
+    // the dot product is used to calculate the current lean angle for use of external functions.
+    // fast_acosf costs at most 7e-5 radians when the board enables AP_FAST_MATH
+    _thrust_angle = fast_acosf(constrain_float(Vector3f(0.0f,0.0f,1.0f) * att_from_thrust_vec,-1.0f,1.0f));
 
     // the cross product of the desired and target thrust vector defines the rotation vector
     Vector3f thrust_vec_cross = att_from_thrust_vec % att_to_thrust_vec;
 
     // the dot product is used to calculate the angle between the target and desired thrust vectors
-    thrust_vec_dot = acosf(constrain_float(att_from_thrust_vec * att_to_thrust_vec, -1.0f, 1.0f));
+    thrust_vec_dot = fast_acosf(constrain_float(att_from_thrust_vec * att_to_thrust_vec, -1.0f, 1.0f));
 
     // Normalize the thrust rotation vector
     float thrust_vector_length = thrust_vec_cross.length();
@@ -378,6 +378,13 @@ protected:
     // rate controller input smoothing time constant
     AP_Float            _input_tc;
 
+    // run the quaternion angle controller every Nth call, holding the
+    // rate targets between passes. 0 or 1 runs it every call
+    AP_Int8             _angle_decimation;
+
+    // count of calls since the angle controller last ran
+    uint8_t             _angle_dec_count;
+
     // Intersampling period in seconds
     float               _dt;
 
@@ -839,6 +839,9 @@ void AC_PosControl::init_xy_controller()
     _flags.reset_desired_vel_to_pos = true;
     _flags.reset_accel_to_lean_xy = true;
 
+    // make sure the position-to-velocity stage runs on the first call
+    _xy_control_count = 0;
+
     // initialise ekf xy reset handler
     init_ekf_xy_reset();
 }
@@ -1017,32 +1020,41 @@ void AC_PosControl::run_xy_controller(float dt)
     float ekfGndSpdLimit, ekfNavVelGainScaler;
     AP::ahrs_navekf().getEkfControlLimits(ekfGndSpdLimit, ekfNavVelGainScaler);
 
-    Vector3f curr_pos = _inav.get_position();
-    float kP = ekfNavVelGainScaler * _p_pos_xy.kP(); // scale gains to compensate for noisy optical flow measurement in the EKF
-
-    // avoid divide by zero
-    if (kP <= 0.0f) {
-        _vel_target.x = 0.0f;
-        _vel_target.y = 0.0f;
-    } else {
-        // calculate distance error
-        _pos_error.x = _pos_target.x - curr_pos.x;
-        _pos_error.y = _pos_target.y - curr_pos.y;
-
-        // Constrain _pos_error and target position
-        // Constrain the maximum length of _vel_target to the maximum position correction velocity
-        // TODO: replace the leash length with a user definable maximum position correction
-        if (limit_vector_length(_pos_error.x, _pos_error.y, _leash)) {
-            _pos_target.x = curr_pos.x + _pos_error.x;
-            _pos_target.y = curr_pos.y + _pos_error.y;
+    // the position-to-velocity stage is decimated; the position error
+    // dynamics are slow compared to the call rate so the correction
+    // velocity is close to constant between updates, while the
+    // velocity-to-acceleration stage below runs at the full rate
+    if (_xy_control_count == 0) {
+        Vector3f curr_pos = _inav.get_position();
+        float kP = ekfNavVelGainScaler * _p_pos_xy.kP(); // scale gains to compensate for noisy optical flow measurement in the EKF
+
+        // avoid divide by zero
+        if (kP <= 0.0f) {
+            _vel_target_correction.zero();
+        } else {
+            // calculate distance error
+            _pos_error.x = _pos_target.x - curr_pos.x;
+            _pos_error.y = _pos_target.y - curr_pos.y;
+
+            // Constrain _pos_error and target position
+            // Constrain the maximum length of _vel_target to the maximum position correction velocity
+            // TODO: replace the leash length with a user definable maximum position correction
+            if (limit_vector_length(_pos_error.x, _pos_error.y, _leash)) {
+                _pos_target.x = curr_pos.x + _pos_error.x;
+                _pos_target.y = curr_pos.y + _pos_error.y;
+            }
+
+            const Vector3f vel_correction = sqrt_controller_3D(_pos_error, kP, _accel_cms);
+            _vel_target_correction.x = vel_correction.x;
+            _vel_target_correction.y = vel_correction.y;
         }
-
-        _vel_target = sqrt_controller_3D(_pos_error, kP, _accel_cms);
     }
+    _xy_control_count = (_xy_control_count + 1) % POSCONTROL_POS_XY_STAGE_DECIMATION;
 
-    // add velocity feed-forward
-    _vel_target.x += _vel_desired.x;
-    _vel_target.y += _vel_desired.y;
+    // hold the position correction between stage updates and add the
+    // velocity feed-forward at the full rate
+    _vel_target.x = _vel_target_correction.x + _vel_desired.x;
+    _vel_target.y = _vel_target_correction.y + _vel_desired.y;
 
     // the following section converts desired velocities in lat/lon directions to accelerations in lat/lon frame
 
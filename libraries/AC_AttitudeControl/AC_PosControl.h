@@ -33,6 +33,8 @@
 
 #define POSCONTROL_ACTIVE_TIMEOUT_US            200000  // position controller is considered active if it has been called within the past 0.2 seconds
 
+#define POSCONTROL_POS_XY_STAGE_DECIMATION      4       // position-to-velocity stage runs at 1/4 of the controller call rate
+
 #define POSCONTROL_VEL_ERROR_CUTOFF_FREQ        4.0f    // low-pass filter on velocity error (unit: hz)
 #define POSCONTROL_THROTTLE_CUTOFF_FREQ         2.0f    // low-pass filter on accel error (unit: hz)
 #define POSCONTROL_ACCEL_FILTER_HZ              2.0f    // low-pass filter on acceleration (unit: hz)
@@ -410,6 +412,8 @@ protected:
     Vector3f    _pos_error;             // error between desired and actual position in cm
     Vector3f    _vel_desired;           // desired velocity in cm/s
     Vector3f    _vel_target;            // velocity target in cm/s calculated by pos_to_rate step
+    Vector2f    _vel_target_correction; // velocity correction from the decimated position-to-velocity stage in cm/s
+    uint8_t     _xy_control_count;      // calls since the position-to-velocity stage last ran
     Vector3f    _vel_error;             // error between desired and actual acceleration in cm/s
     Vector3f    _vel_last;              // previous iterations velocity in cm/s
     Vector3f    _accel_desired;         // desired acceleration in cm/s/s (feed forward)
@@ -952,11 +952,14 @@ void AC_Avoid::adjust_velocity_polygon(float kP, float accel_cmss, Vector2f &des
         Vector2f start = boundary[j];
         Vector2f end = boundary[i];
         Vector2f vector_to_boundary = Vector2f::closest_point(position_xy, start, end) - position_xy;
+        // compare squared distances for the breach check so edges
+        // outside the margin don't cost a square root
+        const float dist_to_boundary_sq = vector_to_boundary.length_squared();
         // back away if vehicle has breached margin
-        if (is_negative(vector_to_boundary.length() - margin_cm)) {
-            calc_backup_velocity(kP, accel_cmss, quad_1_back_vel, quad_2_back_vel, quad_3_back_vel, quad_4_back_vel, margin_cm-vector_to_boundary.length(), vector_to_boundary, dt);
+        if (dist_to_boundary_sq < sq(margin_cm)) {
+            calc_backup_velocity(kP, accel_cmss, quad_1_back_vel, quad_2_back_vel, quad_3_back_vel, quad_4_back_vel, margin_cm-sqrtf(dist_to_boundary_sq), vector_to_boundary, dt);
         }
-        
+
         // exit immediately if no desired velocity
         if (desired_vel_cms.is_zero()) {
             continue;
@@ -966,7 +969,7 @@ void AC_Avoid::adjust_velocity_polygon(float kP, float accel_cmss, Vector2f &des
             // vector from current position to closest point on current edge
             Vector2f limit_direction = vector_to_boundary;
             // distance to closest point
-            const float limit_distance_cm = limit_direction.length();
+            const float limit_distance_cm = sqrtf(dist_to_boundary_sq);
             if (!is_zero(limit_distance_cm)) {
                 // We are strictly inside the given edge.
                 // Adjust velocity to not violate this edge.
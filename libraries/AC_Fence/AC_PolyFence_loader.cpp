@@ -178,6 +178,28 @@ bool AC_PolyFence_loader::load_point_from_eeprom(uint16_t i, Vector2l& point)
     return true;
 }
 
+// compute the axis-aligned bounding box of a polygon, used to cheaply
+// reject positions before paying for a full Polygon_outside ray cast
+static void calc_poly_bounds(const Vector2f *points, uint8_t count, Vector2f &bounds_min, Vector2f &bounds_max)
+{
+    bounds_min = points[0];
+    bounds_max = points[0];
+    for (uint8_t i=1; i<count; i++) {
+        bounds_min.x = MIN(bounds_min.x, points[i].x);
+        bounds_min.y = MIN(bounds_min.y, points[i].y);
+        bounds_max.x = MAX(bounds_max.x, points[i].x);
+        bounds_max.y = MAX(bounds_max.y, points[i].y);
+    }
+}
+
+// returns true if pos is outside the bounding box; a position outside
+// the bounding box is certainly outside the polygon it encloses
+static bool outside_poly_bounds(const Vector2f &pos, const Vector2f &bounds_min, const Vector2f &bounds_max)
+{
+    return (pos.x < bounds_min.x || pos.x > bounds_max.x ||
+            pos.y < bounds_min.y || pos.y > bounds_max.y);
+}
+
 bool AC_PolyFence_loader::breached() const
 {
     // check if vehicle is outside the polygon fence
@@ -212,7 +234,8 @@ bool AC_PolyFence_loader::breached(const Vector2f& pos_cm) const
     // check we are inside each inclusion zone:
     for (uint8_t i=0; i<_num_loaded_inclusion_boundaries; i++) {
         const InclusionBoundary &boundary = _loaded_inclusion_boundary[i];
-        if (Polygon_outside(pos_cm, boundary.points, boundary.count)) {
+        if (outside_poly_bounds(pos_cm, boundary.bounds_min, boundary.bounds_max) ||
+            Polygon_outside(pos_cm, boundary.points, boundary.count)) {
             return true;
         }
     }
@@ -220,6 +243,10 @@ bool AC_PolyFence_loader::breached(const Vector2f& pos_cm) const
     // check we are outside each exclusion zone:
     for (uint8_t i=0; i<_num_loaded_exclusion_boundaries; i++) {
         const ExclusionBoundary &boundary = _loaded_exclusion_boundary[i];
+        if (outside_poly_bounds(pos_cm, boundary.bounds_min, boundary.bounds_max)) {
+            // outside the bounding box is certainly outside the exclusion zone
+            continue;
+        }
         if (!Polygon_outside(pos_cm, boundary.points, boundary.count)) {
             return true;
         }
@@ -728,6 +755,7 @@ bool AC_PolyFence_loader::load_from_eeprom()
                 storage_valid = false;
                 break;
             }
+            calc_poly_bounds(boundary.points, boundary.count, boundary.bounds_min, boundary.bounds_max);
             _num_loaded_inclusion_boundaries++;
             break;
         }
@@ -746,6 +774,7 @@ bool AC_PolyFence_loader::load_from_eeprom()
                 storage_valid = false;
                 break;
             }
+            calc_poly_bounds(boundary.points, boundary.count, boundary.bounds_min, boundary.bounds_max);
             _num_loaded_exclusion_boundaries++;
             break;
         }
@@ -1090,6 +1119,216 @@ bool AC_PolyFence_loader::write_fence(const AC_PolyFenceItem *new_items, uint16_
     return true;
 }
 
+bool AC_PolyFence_loader::start_fence_upload(const uint16_t count)
+{
+    if (_upload.active) {
+        return false;
+    }
+    if (count > max_items()) {
+        return false;
+    }
+    // write the format header.  We deliberately do not void the index
+    // here - the in-memory fence (and breach checking) stays valid
+    // until the upload completes, and downloads are denied by the
+    // mission item protocol while an upload is in progress
+    uint16_t offset = 0;
+    fence_storage.write_uint32(offset, 0);
+    fence_storage.write_uint8(offset, new_fence_storage_magic);
+
+    _upload = {};
+    _upload.active = true;
+    _upload.offset = 4; // skipping magic
+    _upload.items_remaining = count;
+    _upload.expecting_type = AC_PolyFenceType::END_OF_STORAGE;
+    return true;
+}
+
+bool AC_PolyFence_loader::upload_fence_item(const AC_PolyFenceItem &item)
+{
+    if (!_upload.active || _upload.items_remaining == 0) {
+        INTERNAL_ERROR(AP_InternalError::error_t::flow_of_control);
+        return false;
+    }
+
+    // validation, mirroring validate_fence:
+    bool validate_latlon = false;
+    uint8_t space_required = 1; // one byte for type
+    switch (item.type) {
+    case AC_PolyFenceType::END_OF_STORAGE:
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
+        AP_HAL::panic("passed in an END_OF_STORAGE");
+#endif
+        return false;
+
+    case AC_PolyFenceType::POLYGON_INCLUSION:
+    case AC_PolyFenceType::POLYGON_EXCLUSION:
+        if (item.vertex_count < 3) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Invalid vertex count (%u)", item.vertex_count);
+            return false;
+        }
+        if (_upload.expected_type_count == 0) {
+            _upload.expected_type_count = item.vertex_count;
+            _upload.orig_expected_type_count = item.vertex_count;
+            _upload.expecting_type = item.type;
+            space_required += 1; // for the count byte
+        } else {
+            if (item.type != _upload.expecting_type) {
+                gcs().send_text(MAV_SEVERITY_WARNING, "Received incorrect vertex type (want=%u got=%u)", (unsigned)_upload.expecting_type, (unsigned)item.type);
+                return false;
+            } else if (item.vertex_count != _upload.orig_expected_type_count) {
+                gcs().send_text(MAV_SEVERITY_WARNING, "Unexpected vertex count want=%u got=%u\n", _upload.orig_expected_type_count, item.vertex_count);
+                return false;
+            }
+            space_required -= 1; // type byte was written with the first vertex
+        }
+        _upload.expected_type_count--;
+        space_required += 8; // 4 lat, 4 lon
+        validate_latlon = true;
+        break;
+
+    case AC_PolyFenceType::CIRCLE_INCLUSION:
+    case AC_PolyFenceType::CIRCLE_EXCLUSION:
+        if (_upload.expected_type_count) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Received incorrect type (want=%u got=%u)", (unsigned)_upload.expecting_type, (unsigned)item.type);
+            return false;
+        }
+        if (item.radius <= 0) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Non-positive circle radius");
+            return false;
+        }
+        space_required += 12; // 4 radius, 4 lat, 4 lon
+        validate_latlon = true;
+        break;
+
+    case AC_PolyFenceType::RETURN_POINT:
+        if (_upload.expected_type_count) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Received incorrect type (want=%u got=%u)", (unsigned)_upload.expecting_type, (unsigned)item.type);
+            return false;
+        }
+        // spec says only one return point allowed
+        if (_upload.seen_return_point) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Multiple return points");
+            return false;
+        }
+        _upload.seen_return_point = true;
+        space_required += 8; // 4 lat, 4 lon
+        validate_latlon = true;
+        break;
+    }
+
+    if (validate_latlon) {
+        if (!check_latlng(item.loc[0], item.loc[1])) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Bad lat or lon");
+            return false;
+        }
+    }
+
+    // one byte must remain for the end-of-storage marker:
+    if (_upload.offset + space_required + 1 > fence_storage.size()) {
+        gcs().send_text(MAV_SEVERITY_WARNING, "Fence exceeds storage size");
+        return false;
+    }
+
+    // storage writes, mirroring write_fence:
+    switch (item.type) {
+    case AC_PolyFenceType::POLYGON_INCLUSION:
+    case AC_PolyFenceType::POLYGON_EXCLUSION:
+        if (_upload.vertex_count == 0) {
+            // write out new polygon count
+            _upload.vertex_count = item.vertex_count;
+            _upload.total_vertex_count += _upload.vertex_count;
+            if (!write_type_to_storage(_upload.offset, item.type)) {
+                return false;
+            }
+            fence_storage.write_uint8(_upload.offset, _upload.vertex_count);
+            _upload.offset++;
+        }
+        _upload.vertex_count--;
+        if (!write_latlon_to_storage(_upload.offset, item.loc)) {
+            return false;
+        }
+        break;
+    case AC_PolyFenceType::END_OF_STORAGE:
+        // caught by validation above
+        return false;
+    case AC_PolyFenceType::CIRCLE_INCLUSION:
+    case AC_PolyFenceType::CIRCLE_EXCLUSION:
+        _upload.total_vertex_count++; // useful to make number of lines in QGC file match FENCE_TOTAL
+        if (!write_type_to_storage(_upload.offset, item.type)) {
+            return false;
+        }
+        if (!write_latlon_to_storage(_upload.offset, item.loc)) {
+            return false;
+        }
+        // store the radius
+        fence_storage.write_uint32(_upload.offset, item.radius);
+        _upload.offset += 4;
+        break;
+    case AC_PolyFenceType::RETURN_POINT:
+        if (!write_type_to_storage(_upload.offset, item.type)) {
+            return false;
+        }
+        if (!write_latlon_to_storage(_upload.offset, item.loc)) {
+            return false;
+        }
+        break;
+    }
+
+    _upload.items_remaining--;
+    return true;
+}
+
+bool AC_PolyFence_loader::complete_fence_upload()
+{
+    if (!_upload.active) {
+        INTERNAL_ERROR(AP_InternalError::error_t::flow_of_control);
+        return false;
+    }
+    if (_upload.items_remaining != 0 || _upload.expected_type_count != 0) {
+        gcs().send_text(MAV_SEVERITY_INFO, "Incorrect item count");
+        abort_fence_upload();
+        return false;
+    }
+    if (!write_eos_to_storage(_upload.offset)) {
+        abort_fence_upload();
+        return false;
+    }
+    _upload.active = false;
+
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
+    // sanity-check the EEPROM in SITL to make sure we can read what
+    // we've just written.
+    if (!index_eeprom()) {
+        AP_HAL::panic("Failed to index eeprom");
+    }
+    gcs().send_text(MAV_SEVERITY_DEBUG, "Fence Indexed OK");
+#endif
+
+    void_index();
+
+    // see write_fence for why this total may be completely bogus
+    uint16_t new_total = 0;
+    if (_upload.total_vertex_count >= 3) {
+        new_total = _upload.total_vertex_count+2;
+    }
+    _total.set_and_save(new_total);
+
+    return true;
+}
+
+void AC_PolyFence_loader::abort_fence_upload()
+{
+    if (!_upload.active) {
+        return;
+    }
+    _upload.active = false;
+    // storage has been partially overwritten; the old fence cannot be
+    // recovered so leave the storage formatted but empty
+    if (!format()) {
+        gcs().send_text(MAV_SEVERITY_WARNING, "Fence storage format failed");
+    }
+}
+
 
 #if AC_POLYFENCE_FENCE_POINT_PROTOCOL_SUPPORT
 bool AC_PolyFence_loader::get_return_point(Vector2l &ret)
@@ -141,6 +141,22 @@ public:
     // write_fence - validate and write count new_items to permanent storage
     bool write_fence(const AC_PolyFenceItem *new_items, uint16_t count)  WARN_IF_UNUSED;
 
+    /*
+     * streaming upload support.  Items are validated and written to
+     * permanent storage one at a time as they arrive from the GCS, so
+     * no RAM copy of the fence is required during transfer.  The
+     * in-memory fence remains usable until the upload completes; an
+     * aborted upload leaves storage formatted-but-empty
+     */
+    // start_fence_upload - begin a streaming upload of count items
+    bool start_fence_upload(uint16_t count) WARN_IF_UNUSED;
+    // upload_fence_item - validate and store the next item in sequence
+    bool upload_fence_item(const AC_PolyFenceItem &item) WARN_IF_UNUSED;
+    // complete_fence_upload - finalise storage and make the new fence live
+    bool complete_fence_upload() WARN_IF_UNUSED;
+    // abort_fence_upload - abandon a streaming upload, formatting storage
+    void abort_fence_upload();
+
     /*
      * Loaded Fence functionality
      *
@@ -228,6 +244,21 @@ private:
     // extend storage
     uint16_t _eos_offset;
 
+    // state for a streaming upload.  The validation fields mirror the
+    // locals used by validate_fence so the same checks can be applied
+    // incrementally as items arrive
+    struct {
+        bool active;
+        uint16_t offset;           // next write offset in storage
+        uint16_t items_remaining;
+        AC_PolyFenceType expecting_type;
+        uint16_t expected_type_count;
+        uint16_t orig_expected_type_count;
+        bool seen_return_point;
+        uint8_t vertex_count;      // vertices left in the polygon being written
+        uint8_t total_vertex_count;
+    } _upload;
+
     // formatted - returns true if the fence storage space seems to be
     // formatted for new-style fence storage
     bool formatted() const WARN_IF_UNUSED;
@@ -255,6 +286,8 @@ private:
     public:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         uint8_t count; // count of points in the boundary
+        Vector2f bounds_min; // bounding box of the boundary, precomputed at load time
+        Vector2f bounds_max; // so breach checks can reject without a full ray cast
     };
     InclusionBoundary *_loaded_inclusion_boundary;
     uint8_t _num_loaded_inclusion_boundaries;
@@ -263,6 +296,8 @@ private:
     public:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         uint8_t count; // count of points in the boundary
+        Vector2f bounds_min; // bounding box of the boundary, precomputed at load time
+        Vector2f bounds_max; // so breach checks can reject without a full ray cast
     };
     ExclusionBoundary *_loaded_exclusion_boundary;
     uint8_t _num_loaded_exclusion_boundaries;
@@ -92,9 +92,33 @@ AC_PID::AC_PID(float initial_p, float initial_i, float initial_d, float initial_
     // reset input filter to first value received
     _flags._reset_filter = true;
 
+    // force the cached filter alphas to be computed on first use
+    _alpha_dt = -1.0f;
+
     memset(&_pid_info, 0, sizeof(_pid_info));
 }
 
+// recompute the cached filter alphas if dt or a filter frequency
+// parameter has changed. This keeps the per-loop cost of the filters
+// to a few compares, with the divisions only re-done when a parameter
+// is updated
+void AC_PID::update_filt_alphas()
+{
+    if (_dt == _alpha_dt &&
+        _filt_T_hz == _alpha_T_hz &&
+        _filt_E_hz == _alpha_E_hz &&
+        _filt_D_hz == _alpha_D_hz) {
+        return;
+    }
+    _alpha_dt = _dt;
+    _alpha_T_hz = _filt_T_hz;
+    _alpha_E_hz = _filt_E_hz;
+    _alpha_D_hz = _filt_D_hz;
+    _filt_T_alpha = get_filt_alpha(_alpha_T_hz);
+    _filt_E_alpha = get_filt_alpha(_alpha_E_hz);
+    _filt_D_alpha = get_filt_alpha(_alpha_D_hz);
+}
+
 // set_dt - set time step in seconds
 void AC_PID::set_dt(float dt)
 {
@@ -131,6 +155,8 @@ float AC_PID::update_all(float target, float measurement, bool limit)
         return 0.0f;
     }
 
+    update_filt_alphas();
+
     // reset input filter to value received
     if (_flags._reset_filter) {
         _flags._reset_filter = false;
@@ -139,13 +165,13 @@ float AC_PID::update_all(float target, float measurement, bool limit)
         _derivative = 0.0f;
     } else {
         float error_last = _error;
-        _target += get_filt_T_alpha() * (target - _target);
-        _error += get_filt_E_alpha() * ((_target - measurement) - _error);
+        _target += _filt_T_alpha * (target - _target);
+        _error += _filt_E_alpha * ((_target - measurement) - _error);
 
         // calculate and filter derivative
         if (_dt > 0.0f) {
             float derivative = (_error - error_last) / _dt;
-            _derivative += get_filt_D_alpha() * (derivative - _derivative);
+            _derivative += _filt_D_alpha * (derivative - _derivative);
         }
     }
 
@@ -185,6 +211,8 @@ float AC_PID::update_error(float error, bool limit)
 
     _target = 0.0f;
 
+    update_filt_alphas();
+
     // reset input filter to value received
     if (_flags._reset_filter) {
         _flags._reset_filter = false;
@@ -192,12 +220,12 @@ float AC_PID::update_error(float error, bool limit)
         _derivative = 0.0f;
     } else {
         float error_last = _error;
-        _error += get_filt_E_alpha() * (error - _error);
+        _error += _filt_E_alpha * (error - _error);
 
         // calculate and filter derivative
         if (_dt > 0.0f) {
             float derivative = (_error - error_last) / _dt;
-            _derivative += get_filt_D_alpha() * (derivative - _derivative);
+            _derivative += _filt_D_alpha * (derivative - _derivative);
         }
     }
 
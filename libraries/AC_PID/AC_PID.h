@@ -137,9 +137,20 @@ protected:
         bool _reset_filter :1; // true when input filter should be reset during next call to set_input
     } _flags;
 
+    // recompute the cached filter alphas if dt or a filter frequency
+    // parameter has changed
+    void update_filt_alphas();
+
     // internal variables
     float _dt;                // timestep in seconds
     float _integrator;        // integrator value
+    float _filt_T_alpha;      // cached target filter alpha
+    float _filt_E_alpha;      // cached error filter alpha
+    float _filt_D_alpha;      // cached derivative filter alpha
+    float _alpha_dt;          // dt the cached alphas were computed for
+    float _alpha_T_hz;        // filter frequencies the cached alphas
+    float _alpha_E_hz;        // were computed for
+    float _alpha_D_hz;
     float _target;            // target value to enable filtering
     float _error;             // error value to enable filtering
     float _derivative;        // derivative value to enable filtering
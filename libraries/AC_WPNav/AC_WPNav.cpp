@@ -876,6 +876,12 @@ void AC_WPNav::update_spline_solution(const Vector3f& origin, const Vector3f& de
     _hermite_spline_solution[1] = origin_vel;
     _hermite_spline_solution[2] = -origin*3.0f -origin_vel*2.0f + dest*3.0f - dest_vel;
     _hermite_spline_solution[3] = origin*2.0f + origin_vel -dest*2.0f + dest_vel;
+
+    // precompute the derivative coefficients so velocity evaluation does
+    // not scale the position coefficients on every call
+    _hermite_spline_derivative[0] = _hermite_spline_solution[1];
+    _hermite_spline_derivative[1] = _hermite_spline_solution[2] * 2.0f;
+    _hermite_spline_derivative[2] = _hermite_spline_solution[3] * 3.0f;
  }
 
 /// advance_spline_target_along_track - move target location along track from origin to destination
@@ -990,17 +996,15 @@ bool AC_WPNav::advance_spline_target_along_track(float dt)
 /// 	relies on update_spline_solution being called when the segment's origin and destination were set
 void AC_WPNav::calc_spline_pos_vel(float spline_time, Vector3f& position, Vector3f& velocity)
 {
-    float spline_time_sqrd = spline_time * spline_time;
-    float spline_time_cubed = spline_time_sqrd * spline_time;
-
-    position = _hermite_spline_solution[0] + \
-               _hermite_spline_solution[1] * spline_time + \
-               _hermite_spline_solution[2] * spline_time_sqrd + \
-               _hermite_spline_solution[3] * spline_time_cubed;
-
-    velocity = _hermite_spline_solution[1] + \
-               _hermite_spline_solution[2] * 2.0f * spline_time + \
-               _hermite_spline_solution[3] * 3.0f * spline_time_sqrd;
+    // evaluate in Horner form to minimise per-call multiplies
+    position = ((_hermite_spline_solution[3] * spline_time +
+                 _hermite_spline_solution[2]) * spline_time +
+                _hermite_spline_solution[1]) * spline_time +
+               _hermite_spline_solution[0];
+
+    velocity = (_hermite_spline_derivative[2] * spline_time +
+                _hermite_spline_derivative[1]) * spline_time +
+               _hermite_spline_derivative[0];
 }
 
 // get terrain's altitude (in cm above the ekf origin) at the current position (+ve means terrain below vehicle is above ekf origin's altitude)
@@ -327,6 +327,7 @@ protected:
     Vector3f    _spline_origin_vel;     // the target velocity vector at the origin of the spline segment
     Vector3f    _spline_destination_vel;// the target velocity vector at the destination point of the spline segment
     Vector3f    _hermite_spline_solution[4]; // array describing spline path between origin and destination
+    Vector3f    _hermite_spline_derivative[3]; // derivative of the spline solution, precomputed when the segment is set
     float       _spline_vel_scaler;	    //
     float       _yaw;                   // heading according to yaw
 
@@ -194,6 +194,18 @@ void AP_ADSB::init(void)
             return;
         }
         in_state.list_size_allocated = in_state.list_size_param;
+
+        // hash index sized to the next power of two at least twice the list so
+        // probe chains stay short. ArduPilot's new zeroes the memory, which is
+        // the empty marker. If this fails we simply fall back to linear search
+        uint16_t index_size = 2;
+        while (index_size < 2U*in_state.list_size_allocated && index_size < 0x8000) {
+            index_size <<= 1;
+        }
+        in_state.icao_index = new uint16_t[index_size];
+        if (in_state.icao_index != nullptr) {
+            in_state.icao_index_size = index_size;
+        }
     }
 
     if (detected_num_instances == 0) {
@@ -417,14 +429,84 @@ void AP_ADSB::delete_vehicle(const uint16_t index)
         in_state.furthest_vehicle_distance = 0;
         in_state.furthest_vehicle_index = 0;
     }
+    icao_index_remove(in_state.vehicle_list[index].info.ICAO_address, index);
     if (index != (in_state.vehicle_count-1)) {
+        // the last vehicle moves into the hole so its hash entry must follow it
+        const uint32_t moved_icao = in_state.vehicle_list[in_state.vehicle_count-1].info.ICAO_address;
+        icao_index_remove(moved_icao, in_state.vehicle_count-1);
         in_state.vehicle_list[index] = in_state.vehicle_list[in_state.vehicle_count-1];
+        icao_index_insert(moved_icao, index);
     }
     // TODO: is memset needed? When we decrement the index we essentially forget about it
     memset(&in_state.vehicle_list[in_state.vehicle_count-1], 0, sizeof(adsb_vehicle_t));
     in_state.vehicle_count--;
 }
 
+// multiplicative hash of a 24 bit ICAO address
+static uint32_t icao_hash(const uint32_t icao)
+{
+    return icao * 2654435761UL;
+}
+
+/*
+ * record that the vehicle with the given ICAO is stored at index,
+ * probing linearly for a free slot
+ */
+void AP_ADSB::icao_index_insert(const uint32_t icao, const uint16_t index)
+{
+    if (in_state.icao_index == nullptr) {
+        return;
+    }
+    const uint16_t mask = in_state.icao_index_size - 1;
+    uint16_t slot = icao_hash(icao) & mask;
+    uint16_t probes = 0;
+    while (in_state.icao_index[slot] != 0) {
+        if (++probes > mask) {
+            // table full, should not happen at our load factor
+            return;
+        }
+        slot = (slot+1) & mask;
+    }
+    in_state.icao_index[slot] = index + 1;
+}
+
+/*
+ * remove the hash entry mapping the given ICAO to index, closing the
+ * probe chain with backward-shift deletion so later lookups stay correct
+ */
+void AP_ADSB::icao_index_remove(const uint32_t icao, const uint16_t index)
+{
+    if (in_state.icao_index == nullptr) {
+        return;
+    }
+    const uint16_t mask = in_state.icao_index_size - 1;
+    uint16_t slot = icao_hash(icao) & mask;
+    uint16_t probes = 0;
+    while (in_state.icao_index[slot] != index + 1) {
+        if (in_state.icao_index[slot] == 0 || ++probes > mask) {
+            // not present
+            return;
+        }
+        slot = (slot+1) & mask;
+    }
+    uint16_t hole = slot;
+    uint16_t next = (slot+1) & mask;
+    while (in_state.icao_index[next] != 0) {
+        const uint16_t entry = in_state.icao_index[next] - 1;
+        const uint16_t ideal = icao_hash(in_state.vehicle_list[entry].info.ICAO_address) & mask;
+        // move the entry into the hole if its ideal slot is not cyclically
+        // between the hole and its current slot
+        const bool movable = (next >= hole) ? (ideal <= hole || ideal > next)
+                                            : (ideal <= hole && ideal > next);
+        if (movable) {
+            in_state.icao_index[hole] = in_state.icao_index[next];
+            hole = next;
+        }
+        next = (next+1) & mask;
+    }
+    in_state.icao_index[hole] = 0;
+}
+
 /*
  * Search _vehicle_list for the given vehicle. A match
  * depends on ICAO_address. Returns true if match found
@@ -432,6 +514,26 @@ void AP_ADSB::delete_vehicle(const uint16_t index)
  */
 bool AP_ADSB::find_index(const adsb_vehicle_t &vehicle, uint16_t *index) const
 {
+    if (in_state.icao_index != nullptr) {
+        const uint16_t mask = in_state.icao_index_size - 1;
+        uint16_t slot = icao_hash(vehicle.info.ICAO_address) & mask;
+        uint16_t probes = 0;
+        while (in_state.icao_index[slot] != 0) {
+            const uint16_t i = in_state.icao_index[slot] - 1;
+            if (i < in_state.vehicle_count &&
+                in_state.vehicle_list[i].info.ICAO_address == vehicle.info.ICAO_address) {
+                *index = i;
+                return true;
+            }
+            if (++probes > mask) {
+                break;
+            }
+            slot = (slot+1) & mask;
+        }
+        return false;
+    }
+
+    // fall back to a linear scan when the index failed to allocate
     for (uint16_t i = 0; i < in_state.vehicle_count; i++) {
         if (in_state.vehicle_list[i].info.ICAO_address == vehicle.info.ICAO_address) {
             *index = i;
@@ -535,6 +637,14 @@ void AP_ADSB::set_vehicle(const uint16_t index, const adsb_vehicle_t &vehicle)
         // out of range
         return;
     }
+    if (index == in_state.vehicle_count) {
+        // appending a new vehicle to the end of the list
+        icao_index_insert(vehicle.info.ICAO_address, index);
+    } else if (in_state.vehicle_list[index].info.ICAO_address != vehicle.info.ICAO_address) {
+        // overwriting a slot with a different vehicle (bumping the furthest)
+        icao_index_remove(in_state.vehicle_list[index].info.ICAO_address, index);
+        icao_index_insert(vehicle.info.ICAO_address, index);
+    }
     in_state.vehicle_list[index] = vehicle;
 
     write_log(vehicle);
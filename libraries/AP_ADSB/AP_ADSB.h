@@ -180,6 +180,10 @@ private:
 
     bool _init_failed;
 
+    // maintain the ICAO hash index when a vehicle is added, moved or removed
+    void icao_index_insert(const uint32_t icao, const uint16_t index);
+    void icao_index_remove(const uint32_t icao, const uint16_t index);
+
     // ADSB-IN state. Maintains list of external vehicles
     struct {
         // list management
@@ -187,6 +191,13 @@ private:
         uint16_t    list_size_allocated;
         adsb_vehicle_t *vehicle_list;
         uint16_t    vehicle_count;
+
+        // open-addressing hash of ICAO address to vehicle_list index+1 (0 means
+        // empty) so find_index() costs O(1) per ADSB_VEHICLE message instead of
+        // scanning the whole list. nullptr when allocation failed, in which
+        // case find_index() falls back to a linear scan
+        uint16_t    *icao_index;
+        uint16_t    icao_index_size;
         AP_Int32    list_radius;
         AP_Int16    list_altitude;
 
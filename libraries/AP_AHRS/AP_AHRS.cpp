@@ -355,6 +355,11 @@ void AP_AHRS::update_trig(void)
     calc_trig(get_rotation_body_to_ned(),
               _cos_roll, _cos_pitch, _cos_yaw,
               _sin_roll, _sin_pitch, _sin_yaw);
+
+    // refresh the cached quaternion form of the attitude at the same
+    // time, so get_quat_body_to_ned() is a copy rather than a
+    // conversion
+    _quat_body_to_ned.from_rotation_matrix(get_rotation_body_to_ned());
 }
 
 /*
@@ -508,14 +513,106 @@ Vector3f AP_AHRS::get_vibration(void) const
     return AP::ins().get_vibration_levels();
 }
 
-// singleton instance
-AP_AHRS *AP_AHRS::_singleton;
+// expand a quantized history entry back to a unit quaternion
+void AP_AHRS::unpack_att_history(const att_history_entry &e, Quaternion &q)
+{
+    const float scale = 1.0f / 32767.0f;
+    q.q1 = e.q[0] * scale;
+    q.q2 = e.q[1] * scale;
+    q.q3 = e.q[2] * scale;
+    q.q4 = e.q[3] * scale;
+    q.normalize();
+}
 
-namespace AP {
+/*
+  record the current attitude in the history ring. Called from
+  update() at loop rate and decimated to 50Hz here, giving ~2 seconds
+  of history
+ */
+void AP_AHRS::update_attitude_history(void)
+{
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _att_history_last_ms < 20) {
+        return;
+    }
+    Quaternion q;
+    if (!get_quaternion(q)) {
+        return;
+    }
+    _att_history_last_ms = now_ms;
+    att_history_entry &e = _att_history[_att_history_next];
+    e.time_ms = now_ms;
+    e.q[0] = int16_t(constrain_float(q.q1, -1.0f, 1.0f) * 32767);
+    e.q[1] = int16_t(constrain_float(q.q2, -1.0f, 1.0f) * 32767);
+    e.q[2] = int16_t(constrain_float(q.q3, -1.0f, 1.0f) * 32767);
+    e.q[3] = int16_t(constrain_float(q.q4, -1.0f, 1.0f) * 32767);
+    _att_history_next = (_att_history_next + 1) % ATT_HISTORY_LEN;
+    if (_att_history_count < ATT_HISTORY_LEN) {
+        _att_history_count++;
+    }
+}
 
-AP_AHRS &ahrs()
+/*
+  retrieve the vehicle attitude at a past system time by
+  interpolating between the two bracketing history samples. Returns
+  false if time_ms is outside the recorded history
+ */
+bool AP_AHRS::get_attitude_at_time(uint32_t time_ms, Quaternion &att) const
 {
-    return *AP_AHRS::get_singleton();
+    if (_att_history_count == 0) {
+        return false;
+    }
+    // walk backwards from the newest entry
+    uint16_t idx = (_att_history_next + ATT_HISTORY_LEN - 1) % ATT_HISTORY_LEN;
+    const att_history_entry *newer = &_att_history[idx];
+    if (time_ms >= newer->time_ms) {
+        // at or beyond the newest sample; allow a small window of
+        // extrapolation by returning the newest attitude
+        unpack_att_history(*newer, att);
+        return (time_ms - newer->time_ms) < 100;
+    }
+    for (uint16_t i = 1; i < _att_history_count; i++) {
+        idx = (idx + ATT_HISTORY_LEN - 1) % ATT_HISTORY_LEN;
+        const att_history_entry *older = &_att_history[idx];
+        if (time_ms >= older->time_ms) {
+            Quaternion qa, qb;
+            unpack_att_history(*older, qa);
+            unpack_att_history(*newer, qb);
+            // take the shortest path between the two samples
+            if (qa.q1*qb.q1 + qa.q2*qb.q2 + qa.q3*qb.q3 + qa.q4*qb.q4 < 0) {
+                qb.q1 = -qb.q1;
+                qb.q2 = -qb.q2;
+                qb.q3 = -qb.q3;
+                qb.q4 = -qb.q4;
+            }
+            // nlerp; the 20ms sample spacing makes the angular steps
+            // small enough that normalized linear interpolation is
+            // indistinguishable from slerp
+            const float dt = newer->time_ms - older->time_ms;
+            const float f = is_positive(dt) ? (time_ms - older->time_ms) / dt : 1.0f;
+            att.q1 = qa.q1 + (qb.q1 - qa.q1) * f;
+            att.q2 = qa.q2 + (qb.q2 - qa.q2) * f;
+            att.q3 = qa.q3 + (qb.q3 - qa.q3) * f;
+            att.q4 = qa.q4 + (qb.q4 - qa.q4) * f;
+            att.normalize();
+            return true;
+        }
+        newer = older;
+    }
+    // older than anything we have
+    return false;
 }
 
+// euler angle (radians) variant of get_attitude_at_time, used by scripting
+bool AP_AHRS::get_euler_at_time(uint32_t time_ms, float &roll, float &pitch, float &yaw) const
+{
+    Quaternion att;
+    if (!get_attitude_at_time(time_ms, att)) {
+        return false;
+    }
+    att.to_euler(roll, pitch, yaw);
+    return true;
 }
+
+// singleton instance
+AP_AHRS *AP_AHRS::_singleton;
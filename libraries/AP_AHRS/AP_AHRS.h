@@ -230,9 +230,13 @@ public:
     // return a DCM rotation matrix representing our current attitude in NED frame
     virtual const Matrix3f &get_rotation_body_to_ned(void) const = 0;
 
-    // return a Quaternion representing our current attitude in NED frame
+    // return a Quaternion representing our current attitude in NED
+    // frame. This is refreshed once per update_trig() call, along
+    // with the rotation matrix and the sin/cos accessors below, so
+    // consumers can use whichever attitude form suits them without
+    // paying for euler or matrix conversions each call
     void get_quat_body_to_ned(Quaternion &quat) const {
-        quat.from_rotation_matrix(get_rotation_body_to_ned());
+        quat = _quat_body_to_ned;
     }
 
     const Matrix3f& get_rotation_autopilot_body_to_vehicle_body(void) const { return _rotation_autopilot_body_to_vehicle_body; }
@@ -593,6 +597,17 @@ public:
     // Write velocity data from an external navigation system
     virtual void writeExtNavVelData(const Vector3f &vel, float err, uint32_t timeStamp_ms, uint16_t delay_ms) { }
 
+    // retrieve the vehicle attitude at a past system time by
+    // interpolating the attitude history ring. Allows attitude at
+    // exposure time to be recovered for camera and gimbal users
+    // whose queries arrive 50-100ms late. Returns false if time_ms
+    // is outside the recorded history
+    bool get_attitude_at_time(uint32_t time_ms, Quaternion &att) const WARN_IF_UNUSED;
+
+    // euler angle (radians) variant of get_attitude_at_time, used by
+    // scripting
+    bool get_euler_at_time(uint32_t time_ms, float &roll, float &pitch, float &yaw) const WARN_IF_UNUSED;
+
     // return current vibration vector for primary IMU
     Vector3f get_vibration(void) const;
 
@@ -620,6 +635,10 @@ public:
 protected:
     void update_nmea_out();
 
+    // record the current attitude in the history ring, called from
+    // update() at loop rate and decimated internally to 50Hz
+    void update_attitude_history(void);
+
     // multi-thread access support
     HAL_Semaphore _rsem;
 
@@ -706,6 +725,11 @@ protected:
     float _cos_roll, _cos_pitch, _cos_yaw;
     float _sin_roll, _sin_pitch, _sin_yaw;
 
+    // attitude as a quaternion, cached in update_trig() so that
+    // quaternion-native consumers avoid a per-call conversion from
+    // the rotation matrix
+    Quaternion _quat_body_to_ned;
+
     // which accelerometer instance is active
     uint8_t _active_accel_instance;
 
@@ -720,13 +744,31 @@ private:
     static AP_AHRS *_singleton;
 
     AP_NMEA_Output* _nmea_out;
+
+    // attitude history ring. quaternions are quantized to 16 bits
+    // per component; at 50Hz sampling 100 entries give ~2 seconds of
+    // history for ~1.2k of memory
+    static const uint16_t ATT_HISTORY_LEN = 100;
+    struct att_history_entry {
+        uint32_t time_ms;
+        int16_t q[4];
+    };
+    att_history_entry _att_history[ATT_HISTORY_LEN];
+    uint16_t _att_history_count;
+    uint16_t _att_history_next;
+    uint32_t _att_history_last_ms;
+
+    // expand a quantized history entry back to a unit quaternion
+    static void unpack_att_history(const att_history_entry &e, Quaternion &q);
 };
 
 #include "AP_AHRS_DCM.h"
 #include "AP_AHRS_NavEKF.h"
 
 namespace AP {
-    AP_AHRS &ahrs();
+    inline AP_AHRS &ahrs() {
+        return *AP_AHRS::get_singleton();
+    }
 
     // use ahrs_navekf() only where the AHRS interface doesn't expose the
     // functionality you require:
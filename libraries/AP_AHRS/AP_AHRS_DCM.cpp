@@ -957,6 +957,14 @@ void AP_AHRS_DCM::estimate_wind(void)
     if (!_flags.wind_estimation) {
         return;
     }
+    const uint32_t now = AP_HAL::millis();
+    if (_standby && now - _last_wind_run_ms < 900) {
+        // while another estimator is active we only run the vector
+        // math at around 1Hz, keeping the estimate warm for a takeover
+        return;
+    }
+    _last_wind_run_ms = now;
+
     const Vector3f &velocity = _last_velocity;
 
     // this is based on the wind speed estimation code from MatrixPilot by
@@ -964,7 +972,6 @@ void AP_AHRS_DCM::estimate_wind(void)
     // See http://gentlenav.googlecode.com/files/WindEstimation.pdf
     const Vector3f fuselageDirection = _dcm_matrix.colx();
     const Vector3f fuselageDirectionDiff = fuselageDirection - _last_fuse;
-    const uint32_t now = AP_HAL::millis();
 
     // scrap our data and start over if we're taking too long to get a direction change
     if (now - _last_wind_time > 10000) {
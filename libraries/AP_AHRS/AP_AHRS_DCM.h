@@ -115,6 +115,13 @@ public:
     bool set_home(const Location &loc) override WARN_IF_UNUSED;
     void estimate_wind(void);
 
+    // mark DCM as a standby estimator. While another estimator is
+    // active the background wind estimation runs at heavily reduced
+    // rate, with state kept warm for an instant takeover
+    void set_standby(bool standby) {
+        _standby = standby;
+    }
+
     // is the AHRS subsystem healthy?
     bool healthy() const override;
 
@@ -201,6 +208,11 @@ private:
     Vector3f _last_fuse;
     Vector3f _last_vel;
     uint32_t _last_wind_time;
+    uint32_t _last_wind_run_ms;
+
+    // true when another estimator is active and we only need to keep
+    // our state warm as a fallback
+    bool _standby;
     float _last_airspeed;
     uint32_t _last_consistent_heading;
 
@@ -173,6 +173,9 @@ void AP_AHRS_NavEKF::update(bool skip_ins_update)
         _view->update(skip_ins_update);
     }
 
+    // record attitude for latency-corrected queries
+    update_attitude_history();
+
 #if !HAL_MINIMIZE_FEATURES && AP_AHRS_NAVEKF_AVAILABLE
     // update NMEA output
     update_nmea_out();
@@ -221,6 +224,10 @@ void AP_AHRS_NavEKF::update_DCM(bool skip_ins_update)
     yaw = _dcm_attitude.z;
     update_cd_values();
 
+    // while an EKF is the active estimator DCM is only a fallback,
+    // so its background estimation can run at reduced rate
+    set_standby(active_EKF_type() != EKFType::NONE);
+
     AP_AHRS_DCM::update(skip_ins_update);
 
     // keep DCM attitude available for get_secondary_attitude()
@@ -245,7 +252,11 @@ void AP_AHRS_NavEKF::update_EKF2(void)
             }
         }
 
-        if (AP_HAL::millis() - start_time_ms > startup_delay_ms) {
+        // after a watchdog reset we skip the startup delay; the gyros
+        // have not moved far since the last update and waiting a
+        // second for DCM only extends the outage mid-flight
+        if (hal.util->was_watchdog_reset() ||
+            AP_HAL::millis() - start_time_ms > startup_delay_ms) {
             _ekf2_started = EKF2.InitialiseFilter();
         }
     }
@@ -325,7 +336,9 @@ void AP_AHRS_NavEKF::update_EKF3(void)
                 }
             }
         }
-        if (AP_HAL::millis() - start_time_ms > startup_delay_ms) {
+        // skip the startup delay after a watchdog reset, as for EKF2
+        if (hal.util->was_watchdog_reset() ||
+            AP_HAL::millis() - start_time_ms > startup_delay_ms) {
             _ekf3_started = EKF3.InitialiseFilter();
         }
     }
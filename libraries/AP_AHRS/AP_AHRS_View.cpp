@@ -69,6 +69,7 @@ void AP_AHRS_View::update(bool skip_ins_update)
     }
 
     rot_body_to_ned.to_euler(&roll, &pitch, &yaw);
+    quat_body_to_ned.from_rotation_matrix(rot_body_to_ned);
 
     roll_sensor  = degrees(roll) * 100;
     pitch_sensor = degrees(pitch) * 100;
@@ -52,9 +52,11 @@ public:
         return rot_body_to_ned;
     }
 
-    // return a Quaternion representing our current attitude in this view
+    // return a Quaternion representing our current attitude in this
+    // view. Cached in update() alongside the rotation matrix and trig
+    // terms so per-loop consumers avoid repeated matrix conversions
     void get_quat_body_to_ned(Quaternion &quat) const {
-        quat.from_rotation_matrix(rot_body_to_ned);
+        quat = quat_body_to_ned;
     }
 
     // apply pitch trim
@@ -198,6 +200,7 @@ private:
     // transpose of rot_view
     Matrix3f rot_view_T;
     Matrix3f rot_body_to_ned;
+    Quaternion quat_body_to_ned;
     Vector3f gyro;
 
     struct {
@@ -355,7 +355,19 @@ void AccelCalibrator::run_fit(uint8_t max_iterations, float& fitness)
             }
         }
 
-        if (!mat_inverse(JTJ, JTJ, get_num_params())) {
+        // the fit dimension follows from the fit type, so the
+        // stack-scratch inverse can be used to avoid heap allocation
+        // on every iteration
+        bool inverse_ok = false;
+        switch (get_num_params()) {
+        case 6:
+            inverse_ok = mat_inverse<float, 6>(JTJ, JTJ);
+            break;
+        case 9:
+            inverse_ok = mat_inverse<float, 9>(JTJ, JTJ);
+            break;
+        }
+        if (!inverse_ok) {
             return;
         }
 
@@ -684,13 +684,30 @@ bool AP_Arming::mission_checks(bool report)
           {MIS_ITEM_CHECK_TAKEOFF,       MAV_CMD_NAV_TAKEOFF,        "takeoff"},
           {MIS_ITEM_CHECK_VTOL_TAKEOFF,  MAV_CMD_NAV_VTOL_TAKEOFF,   "vtol takeoff"},
         };
-        for (uint8_t i = 0; i < ARRAY_SIZE(misChecks); i++) {
-            if (_required_mission_items & misChecks[i].check) {
-                if (!mission->contains_item(misChecks[i].mis_item_type)) {
-                    check_failed(ARMING_CHECK_MISSION, report, "Missing mission item: %s", misChecks[i].type);
-                    return false;
+        // scanning for required items walks every mission command in
+        // storage, so cache the result keyed on the mission change
+        // time and only re-scan after an upload
+        if (!mission_scan_cache.checked ||
+            mission_scan_cache.change_time_ms != mission->last_change_time_ms() ||
+            mission_scan_cache.required_items != (uint32_t)_required_mission_items) {
+            mission_scan_cache.result = true;
+            mission_scan_cache.failed_type = nullptr;
+            for (uint8_t i = 0; i < ARRAY_SIZE(misChecks); i++) {
+                if (_required_mission_items & misChecks[i].check) {
+                    if (!mission->contains_item(misChecks[i].mis_item_type)) {
+                        mission_scan_cache.result = false;
+                        mission_scan_cache.failed_type = misChecks[i].type;
+                        break;
+                    }
                 }
             }
+            mission_scan_cache.change_time_ms = mission->last_change_time_ms();
+            mission_scan_cache.required_items = _required_mission_items;
+            mission_scan_cache.checked = true;
+        }
+        if (!mission_scan_cache.result) {
+            check_failed(ARMING_CHECK_MISSION, report, "Missing mission item: %s", mission_scan_cache.failed_type);
+            return false;
         }
         if (_required_mission_items & MIS_ITEM_CHECK_RALLY) {
             Location ahrs_loc;
@@ -1201,6 +1218,9 @@ bool AP_Arming::arm(AP_Arming::Method method, const bool do_arming_checks)
 
         Log_Write_Arm(!do_arming_checks, method); // note Log_Write_Armed takes forced not do_arming_checks
 
+        // record boot stage timings now that logging is running
+        AP_BoardConfig::write_boot_log();
+
     } else {
         AP::logger().arming_failure();
         armed = false;
@@ -137,6 +137,16 @@ protected:
     uint32_t                last_accel_pass_ms[INS_MAX_INSTANCES];
     uint32_t                last_gyro_pass_ms[INS_MAX_INSTANCES];
 
+    // cached result of the required mission item scan, keyed on the
+    // mission change time so the scan only re-runs after an upload
+    struct {
+        uint32_t change_time_ms;
+        uint32_t required_items;
+        bool checked;
+        bool result;
+        const char *failed_type;
+    } mission_scan_cache;
+
     virtual bool barometer_checks(bool report);
 
     bool airspeed_checks(bool report);
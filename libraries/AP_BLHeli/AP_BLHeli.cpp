@@ -1339,6 +1339,27 @@ bool AP_BLHeli::get_telem_data(uint8_t esc_index, struct telem_data &td)
     return true;
 }
 
+/*
+  return the frequency of a single motor in Hz based on bi-directional
+  dshot eRPM or BLHeli telemetry, negative if no recent data. All motor
+  frequency consumers share this so the validity rules and pole
+  conversion live in one place
+ */
+float AP_BLHeli::motor_frequency_hz(uint8_t motor, uint32_t now) const
+{
+    if (has_bidir_dshot(motor)) {
+        const uint16_t erpm = hal.rcout->get_erpm(motor);
+        if (erpm > 0 && erpm < 0xFFFF) {
+            return (erpm * 200 / motor_poles) / 60.f;
+        }
+    } else if (last_telem[motor].timestamp_ms && (now - last_telem[motor].timestamp_ms < 1000)) {
+        // slew the update
+        const float slew = MIN(1.0f, (now - last_telem[motor].timestamp_ms) * telem_rate / 1000.0f);
+        return (prev_motor_rpm[motor] + (last_telem[motor].rpm - prev_motor_rpm[motor]) * slew) / 60.0f;
+    }
+    return -1.0f;
+}
+
 // return the average motor frequency in Hz for dynamic filtering
 float AP_BLHeli::get_average_motor_frequency_hz() const
 {
@@ -1347,17 +1368,10 @@ float AP_BLHeli::get_average_motor_frequency_hz() const
     uint8_t valid_escs = 0;
     // average the rpm of each motor as reported by BLHeli and convert to Hz
     for (uint8_t i = 0; i < num_motors; i++) {
-        if (has_bidir_dshot(i)) {
-            uint16_t erpm = hal.rcout->get_erpm(i);
-            if (erpm > 0 && erpm < 0xFFFF) {
-                valid_escs++;
-                motor_freq += (erpm * 200 / motor_poles) / 60.f;
-            }
-        } else if (last_telem[i].timestamp_ms && (now - last_telem[i].timestamp_ms < 1000)) {
+        const float freq = motor_frequency_hz(i, now);
+        if (freq >= 0) {
             valid_escs++;
-            // slew the update
-            const float slew = MIN(1.0f, (now - last_telem[i].timestamp_ms) * telem_rate / 1000.0f);
-            motor_freq += (prev_motor_rpm[i] + (last_telem[i].rpm - prev_motor_rpm[i]) * slew) / 60.0f;
+            motor_freq += freq;
         }
     }
     if (valid_escs > 0) {
@@ -1373,21 +1387,14 @@ uint8_t AP_BLHeli::get_motor_frequencies_hz(uint8_t nfreqs, float* freqs) const
     const uint32_t now = AP_HAL::millis();
     uint8_t valid_escs = 0;
 
-    // average the rpm of each motor as reported by BLHeli and convert to Hz
-    for (uint8_t i = 0; i < num_motors && i < nfreqs; i++) {
-        if (has_bidir_dshot(i)) {
-            uint16_t erpm = hal.rcout->get_erpm(i);
-            if (erpm > 0 && erpm < 0xFFFF) {
-                freqs[valid_escs++] = (erpm * 200 / motor_poles) / 60.f;
-            }
-        } else if (last_telem[i].timestamp_ms && (now - last_telem[i].timestamp_ms < 1000)) {
-            // slew the update
-            const float slew = MIN(1.0f, (now - last_telem[i].timestamp_ms) * telem_rate / 1000.0f);
-            freqs[valid_escs++] = (prev_motor_rpm[i] + (last_telem[i].rpm - prev_motor_rpm[i]) * slew) / 60.0f;
+    for (uint8_t i = 0; i < num_motors && valid_escs < nfreqs; i++) {
+        const float freq = motor_frequency_hz(i, now);
+        if (freq >= 0) {
+            freqs[valid_escs++] = freq;
         }
     }
 
-    return MIN(valid_escs, nfreqs);
+    return valid_escs;
 }
 
 /*
@@ -249,6 +249,10 @@ private:
     // previous motor rpm so that changes can be slewed
     float prev_motor_rpm[max_motors];
 
+    // return the frequency of a single motor in Hz, negative if no
+    // recent telemetry for that motor
+    float motor_frequency_hz(uint8_t motor, uint32_t now) const;
+
     // have we initialised the interface?
     bool initialised;
 
@@ -375,6 +375,35 @@ float AP_Baro::get_altitude_difference(float base_pressure, float pressure) cons
     return ret;
 }
 
+/*
+  as get_altitude_difference(), but served from a model linearized
+  about the last anchor point. The anchor is recomputed with the exact
+  calculation when any input has moved far enough for the linear model
+  to drift, so the expf/logf pair only runs on a pressure change of
+  300 Pa (about 25m) rather than per sample, at a linearization error
+  of a few centimetres
+ */
+float AP_Baro::get_altitude_difference_cached(uint8_t instance, float base_pressure, float pressure)
+{
+    sensor &s = sensors[instance];
+    const float temp = get_ground_temperature() + C_TO_KELVIN;
+
+    if (is_zero(s.alt_model.anchor_pressure) ||
+        !is_equal(base_pressure, s.alt_model.base_pressure) ||
+        fabsf(temp - s.alt_model.temperature) > 1.0f ||
+        fabsf(pressure - s.alt_model.anchor_pressure) > 300.0f) {
+        const float scaling = pressure / base_pressure;
+        const float p_ratio = expf(0.190259f * logf(scaling));
+        s.alt_model.base_pressure = base_pressure;
+        s.alt_model.temperature = temp;
+        s.alt_model.anchor_pressure = pressure;
+        s.alt_model.anchor_alt = 153.8462f * temp * (1.0f - p_ratio);
+        // d/dP of (P/Pb)^k is k * (P/Pb)^k / P
+        s.alt_model.slope = -153.8462f * temp * 0.190259f * p_ratio / pressure;
+    }
+    return s.alt_model.anchor_alt + s.alt_model.slope * (pressure - s.alt_model.anchor_pressure);
+}
+
 
 // return current scale factor that converts from equivalent to true airspeed
 // valid for altitudes up to 10km AMSL
@@ -841,6 +870,12 @@ void AP_Baro::update(void)
         }
     }
 
+#if HAL_BARO_WIND_COMP_ENABLED
+    // compute the instance-independent terms of the wind correction
+    // once rather than per instance in the loop below
+    update_wind_comp_state();
+#endif
+
     for (uint8_t i=0; i<_num_sensors; i++) {
         if (sensors[i].healthy) {
             // update altitude calculation
@@ -854,7 +889,7 @@ void AP_Baro::update(void)
 #if HAL_BARO_WIND_COMP_ENABLED
                 corrected_pressure -= wind_pressure_correction(i);
 #endif
-                altitude = get_altitude_difference(sensors[i].ground_pressure, corrected_pressure);
+                altitude = get_altitude_difference_cached(i, sensors[i].ground_pressure, corrected_pressure);
             } else if (sensors[i].type == BARO_TYPE_WATER) {
                 //101325Pa is sea level air pressure, 9800 Pascal/ m depth in water.
                 //No temperature or depth compensation for density of water.
@@ -275,11 +275,25 @@ private:
         bool alt_ok;                    // true if calculated altitude is ok
         bool calibrated;                // true if calculated calibrated successfully
         AP_Int32 bus_id;
+        // locally-linearized altitude model anchored on the exact
+        // atmosphere calculation, re-anchored when any input drifts.
+        // Avoids the expf/logf pair per sample in update()
+        struct {
+            float base_pressure;        // ground pressure the anchor was computed with
+            float temperature;          // ground temperature in Kelvin at the anchor
+            float anchor_pressure;      // pressure at the anchor point
+            float anchor_alt;           // exact altitude difference at the anchor
+            float slope;                // metres per Pascal at the anchor
+        } alt_model;
 #if HAL_BARO_WIND_COMP_ENABLED
         WindCoeff wind_coeff;
 #endif
     } sensors[BARO_MAX_INSTANCES];
 
+    // as get_altitude_difference(), but served from the instance's
+    // linearized model to avoid the transcendentals per update
+    float get_altitude_difference_cached(uint8_t instance, float base_pressure, float pressure);
+
     AP_Float                            _alt_offset;
     float                               _alt_offset_active;
     AP_Int8                             _primary_baro; // primary chosen by user
@@ -306,6 +320,22 @@ private:
     HAL_Semaphore                      _rsem;
 
 #if HAL_BARO_WIND_COMP_ENABLED
+    // terms of the wind correction which are common to all instances.
+    // Computed once per update() so each instance correction is just
+    // four multiply-accumulates against its own coefficients
+    struct {
+        bool  valid;         // true if an airspeed vector was available this update
+        float xsq;           // squared body-frame relative airspeed components
+        float ysq;
+        bool  x_positive;
+        bool  y_positive;
+        float dyn_pressure_scale; // 0.5 * air density as flown
+    } _wind_comp_state;
+
+    // refresh _wind_comp_state; called once per update() before the
+    // per-instance corrections are applied
+    void update_wind_comp_state(void);
+
     /*
       return pressure correction for wind based on GND_WCOEF parameters
     */
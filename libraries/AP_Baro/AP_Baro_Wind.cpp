@@ -50,37 +50,66 @@ const AP_Param::GroupInfo AP_Baro::WindCoeff::var_info[] = {
 
 
 /*
-  return pressure correction for wind based on GND_WCOEF parameters
+  compute the terms of the wind correction which do not depend on the
+  instance coefficients.  Called once per update() so multiple
+  barometers share one AHRS airspeed vector fetch and one air density
+  calculation
  */
-float AP_Baro::wind_pressure_correction(uint8_t instance)
+void AP_Baro::update_wind_comp_state(void)
 {
-    const WindCoeff &wcoef = sensors[instance].wind_coeff;
+    _wind_comp_state.valid = false;
 
-    if (!wcoef.enable) {
-        return 0;
+    // only pay for the airspeed vector if at least one instance has
+    // compensation enabled
+    bool enabled = false;
+    for (uint8_t i=0; i<_num_sensors; i++) {
+        if (sensors[i].wind_coeff.enable) {
+            enabled = true;
+            break;
+        }
+    }
+    if (!enabled) {
+        return;
     }
 
-    // correct for static pressure position errors
     Vector3f airspeed_vec_bf;
     if (!AP::ahrs().airspeed_vector_true(airspeed_vec_bf)) {
+        return;
+    }
+
+    _wind_comp_state.xsq = sq(airspeed_vec_bf.x);
+    _wind_comp_state.ysq = sq(airspeed_vec_bf.y);
+    _wind_comp_state.x_positive = is_positive(airspeed_vec_bf.x);
+    _wind_comp_state.y_positive = is_positive(airspeed_vec_bf.y);
+    _wind_comp_state.dyn_pressure_scale = 0.5 * SSL_AIR_DENSITY * get_air_density_ratio();
+    _wind_comp_state.valid = true;
+}
+
+/*
+  return pressure correction for wind based on GND_WCOEF parameters
+ */
+float AP_Baro::wind_pressure_correction(uint8_t instance)
+{
+    const WindCoeff &wcoef = sensors[instance].wind_coeff;
+
+    if (!wcoef.enable || !_wind_comp_state.valid) {
         return 0;
     }
 
+    // correct for static pressure position errors
     float error = 0.0;
-    const float sqx = sq(airspeed_vec_bf.x);
-    const float sqy = sq(airspeed_vec_bf.y);
 
-    if (is_positive(airspeed_vec_bf.x)) {
-        error += wcoef.xp * sqx;
+    if (_wind_comp_state.x_positive) {
+        error += wcoef.xp * _wind_comp_state.xsq;
     } else {
-        error += wcoef.xn * sqx;
+        error += wcoef.xn * _wind_comp_state.xsq;
     }
-    if (is_positive(airspeed_vec_bf.y)) {
-        error += wcoef.yp * sqy;
+    if (_wind_comp_state.y_positive) {
+        error += wcoef.yp * _wind_comp_state.ysq;
     } else {
-        error += wcoef.yn * sqy;
+        error += wcoef.yn * _wind_comp_state.ysq;
     }
 
-    return error * 0.5 * SSL_AIR_DENSITY * get_air_density_ratio();
+    return error * _wind_comp_state.dyn_pressure_scale;
 }
 #endif // HAL_BARO_WIND_COMP_ENABLED
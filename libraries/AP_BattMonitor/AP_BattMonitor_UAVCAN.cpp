@@ -50,6 +50,19 @@ AP_BattMonitor_UAVCAN* AP_BattMonitor_UAVCAN::get_uavcan_backend(AP_UAVCAN* ap_u
     if (ap_uavcan == nullptr) {
         return nullptr;
     }
+    // check the instance that resolved the last message first; all
+    // callers hold the registry semaphore and consecutive messages
+    // almost always come from the same monitor. The keys are always
+    // re-checked so a stale index is simply a miss
+    static uint8_t last_hit;
+    if (last_hit < AP::battery()._num_instances &&
+        AP::battery().drivers[last_hit] != nullptr &&
+        AP::battery().get_type(last_hit) == AP_BattMonitor::Type::UAVCAN_BatteryInfo) {
+        AP_BattMonitor_UAVCAN* driver = (AP_BattMonitor_UAVCAN*)AP::battery().drivers[last_hit];
+        if (driver->_ap_uavcan == ap_uavcan && driver->_node_id == node_id && match_battery_id(last_hit, battery_id)) {
+            return driver;
+        }
+    }
     for (uint8_t i = 0; i < AP::battery()._num_instances; i++) {
         if (AP::battery().drivers[i] == nullptr ||
             AP::battery().get_type(i) != AP_BattMonitor::Type::UAVCAN_BatteryInfo) {
@@ -57,6 +70,7 @@ AP_BattMonitor_UAVCAN* AP_BattMonitor_UAVCAN::get_uavcan_backend(AP_UAVCAN* ap_u
         }
         AP_BattMonitor_UAVCAN* driver = (AP_BattMonitor_UAVCAN*)AP::battery().drivers[i];
         if (driver->_ap_uavcan == ap_uavcan && driver->_node_id == node_id && match_battery_id(i, battery_id)) {
+            last_hit = i;
             return driver;
         }
     }
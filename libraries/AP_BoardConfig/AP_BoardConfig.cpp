@@ -24,6 +24,8 @@
 #include <AP_Vehicle/AP_Vehicle.h>
 #include <GCS_MAVLink/GCS.h>
 #include <AP_Filesystem/AP_Filesystem.h>
+#include <AP_Common/ExpandingString.h>
+#include <AP_Logger/AP_Logger.h>
 
 #include <stdio.h>
 
@@ -407,6 +409,64 @@ void AP_BoardConfig::config_error(const char *fmt, ...)
     }
 }
 
+AP_BoardConfig::BootStage AP_BoardConfig::boot_stages[16];
+uint8_t AP_BoardConfig::num_boot_stages;
+
+/*
+  record a named boot stage with a timestamp. Only the string pointer
+  is stored, so callers must pass compile-time strings
+ */
+void AP_BoardConfig::boot_stage(const char *name)
+{
+    if (num_boot_stages >= ARRAY_SIZE(boot_stages)) {
+        return;
+    }
+    boot_stages[num_boot_stages].name = name;
+    boot_stages[num_boot_stages].time_us = AP_HAL::micros();
+    num_boot_stages++;
+}
+
+/*
+  generate @SYS/boot.txt, showing the time of each boot stage and the
+  time spent between stages
+ */
+void AP_BoardConfig::boot_info(ExpandingString &str)
+{
+    str.printf("%-16s %10s %10s\n", "STAGE", "TIME_US", "DELTA_US");
+    uint32_t last_us = 0;
+    for (uint8_t i = 0; i < num_boot_stages; i++) {
+        str.printf("%-16s %10u %10u\n",
+                   boot_stages[i].name,
+                   unsigned(boot_stages[i].time_us),
+                   unsigned(boot_stages[i].time_us - last_us));
+        last_us = boot_stages[i].time_us;
+    }
+}
+
+/*
+  write the boot stage breakdown to the log. Called once we are armed
+  and logging is certain to be running
+ */
+void AP_BoardConfig::write_boot_log(void)
+{
+#if !defined(HAL_BUILD_AP_PERIPH)
+    // only write the breakdown once per boot
+    static bool done_boot_log;
+    if (done_boot_log) {
+        return;
+    }
+    done_boot_log = true;
+    uint32_t last_us = 0;
+    for (uint8_t i = 0; i < num_boot_stages; i++) {
+        AP::logger().Write_MessageF("boot: %s at %uus (+%uus)",
+                                    boot_stages[i].name,
+                                    unsigned(boot_stages[i].time_us),
+                                    unsigned(boot_stages[i].time_us - last_us));
+        last_us = boot_stages[i].time_us;
+    }
+#endif
+}
+
 /*
   handle logic for safety state button press. This should be called at
   10Hz when the button is pressed. The button can either be directly
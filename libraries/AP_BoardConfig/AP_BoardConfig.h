@@ -32,6 +32,8 @@
 
 extern "C" typedef int (*main_fn_t)(int argc, char **);
 
+class ExpandingString;
+
 class AP_BoardConfig {
 public:
     AP_BoardConfig() {
@@ -53,9 +55,19 @@ public:
 
     static const struct AP_Param::GroupInfo var_info[];
 
-    // notify user of a fatal startup error related to available sensors. 
+    // notify user of a fatal startup error related to available sensors.
     static void config_error(const char *reason, ...);
 
+    // record a named boot stage with a timestamp. name must be a
+    // compile-time string as only the pointer is stored
+    static void boot_stage(const char *name);
+
+    // generate @SYS/boot.txt with the boot stage timing breakdown
+    static void boot_info(ExpandingString &str);
+
+    // write the boot stage breakdown to the log, called on arming
+    static void write_boot_log(void);
+
     // permit other libraries (in particular, GCS_MAVLink) to detect
     // that we're never going to boot properly:
     static bool in_config_error(void) { return _in_sensor_config_error; }
@@ -189,11 +201,24 @@ public:
 
 #if HAL_HAVE_IMU_HEATER
     void set_imu_temp(float current_temp_c);
+
+    // true when the IMU heater has reached and is holding its target
+    // temperature. Lets startup consumers overlap warmup with other
+    // work instead of waiting a fixed time
+    bool imu_heater_settled(void) const { return heater.settled; }
 #endif
 
 private:
     static AP_BoardConfig *_singleton;
-    
+
+    // boot stage timing table, filled by boot_stage()
+    struct BootStage {
+        const char *name;
+        uint32_t time_us;
+    };
+    static BootStage boot_stages[16];
+    static uint8_t num_boot_stages;
+
     AP_Int16 vehicleSerialNumber;
     AP_Int8 pwm_count;
 
@@ -238,6 +263,12 @@ private:
         float sum;
         float output;
         uint32_t last_log_ms;
+        // learned first-order thermal response and settling state
+        float temp_slope;
+        float last_temp;
+        bool last_temp_valid;
+        uint32_t settle_start_ms;
+        bool settled;
     } heater;
 #endif
 
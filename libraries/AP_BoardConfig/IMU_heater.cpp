@@ -47,9 +47,11 @@ void AP_BoardConfig::set_imu_temp(float current)
     heater.count++;
     heater.sum += current;
 
-    // update at 10Hz
+    // update at 10Hz while converging, dropping to 1Hz once the
+    // temperature has settled at the target
     uint32_t now = AP_HAL::millis();
-    if (now - heater.last_update_ms < 100) {
+    const uint32_t update_period_ms = heater.settled ? 1000 : 100;
+    if (now - heater.last_update_ms < update_period_ms) {
 #if defined(HAL_HEATER_GPIO_PIN)
         // output as duty cycle to local pin. Use a random sequence to
         // prevent a periodic change to magnetic field
@@ -59,7 +61,7 @@ void AP_BoardConfig::set_imu_temp(float current)
         return;
     }
     float dt = (now - heater.last_update_ms) * 0.001;
-    dt = constrain_float(dt, 0, 0.5);
+    dt = constrain_float(dt, 0, 1.5);
 
     heater.last_update_ms = now;
 
@@ -67,6 +69,42 @@ void AP_BoardConfig::set_imu_temp(float current)
     heater.sum = 0;
     heater.count = 0;
 
+    // learn a first-order estimate of the thermal response. The
+    // filtered slope gives a settling prediction and drives the
+    // control-rate reduction once the temperature has converged
+    if (heater.last_temp_valid && is_positive(dt)) {
+        const float slope = (avg - heater.last_temp) / dt;
+        heater.temp_slope = 0.9f * heater.temp_slope + 0.1f * slope;
+    }
+    heater.last_temp = avg;
+    heater.last_temp_valid = true;
+
+    // predicted seconds until the target is reached at the current
+    // learned heating rate, for operator feedback in the log
+    float predict_s = 0;
+    if (target > 0 && avg < target && heater.temp_slope > 0.01f) {
+        predict_s = (target - avg) / heater.temp_slope;
+    }
+
+    // declare the heater settled after holding close to the target
+    // with little movement for 10s. Hysteresis on the error keeps a
+    // short gust of cold air from toggling the state
+    if (target > 0 && fabsf(target - avg) < 2.0f && fabsf(heater.temp_slope) < 0.2f) {
+        if (heater.settle_start_ms == 0) {
+            heater.settle_start_ms = now;
+        } else if (!heater.settled && now - heater.settle_start_ms > 10000) {
+            heater.settled = true;
+            gcs().send_text(MAV_SEVERITY_INFO, "IMU heater settled");
+        }
+    } else {
+        heater.settle_start_ms = 0;
+        if (heater.settled && fabsf(target - avg) > 4.0f) {
+            // disturbed well away from the target, return to the
+            // fast control rate
+            heater.settled = false;
+        }
+    }
+
     if (target < 0) {
         heater.output = 0;
     } else {
@@ -83,12 +121,16 @@ void AP_BoardConfig::set_imu_temp(float current)
 // @Field: P: Proportional portion of response
 // @Field: I: Integral portion of response
 // @Field: Out: Controller output to heating element
-        AP::logger().Write("HEAT", "TimeUS,Temp,Targ,P,I,Out", "Qfbfff",
+// @Field: Pred: Predicted seconds until target temperature is reached
+// @Field: Stl: True if the temperature has settled at the target
+        AP::logger().Write("HEAT", "TimeUS,Temp,Targ,P,I,Out,Pred,Stl", "QfbffffB",
                            AP_HAL::micros64(),
                            avg, target,
                            heater.pi_controller.get_P(),
                            heater.pi_controller.get_I(),
-                           heater.output);
+                           heater.output,
+                           predict_s,
+                           (uint8_t)heater.settled);
         heater.last_log_ms = now;
     }
 #if 0
@@ -40,9 +40,13 @@
 #endif
 
 #include <AP_Common/ExpandingString.h>
+#include <AP_Logger/AP_Logger.h>
 
 #define LOG_TAG "CANMGR"
 #define LOG_BUFFER_SIZE 1024
+// queue depth for raw frame capture, sized to absorb a full-rate
+// burst between IO thread drains
+#define FRAME_LOG_QUEUE_SIZE 128
 
 extern const AP_HAL::HAL& hal;
 
@@ -97,6 +101,14 @@ const AP_Param::GroupInfo AP_CANManager::var_info[] = {
     // @User: Advanced
     AP_GROUPINFO("LOGLEVEL", 8, AP_CANManager, _loglevel, AP_CANManager::LOG_NONE),
 
+    // @Param: FRMLOG
+    // @DisplayName: CAN frame logging bus mask
+    // @Description: Bitmask of CAN interfaces to capture received frames from into CANF log messages. Frames are queued from the bus threads with their hardware receive timestamps preserved and written out in the logging IO thread, so capture keeps up under high bus load
+    // @Bitmask: 0:FirstInterface,1:SecondInterface,2:ThirdInterface
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("FRMLOG", 9, AP_CANManager, _frame_log, 0),
+
     AP_GROUPEND
 };
 
@@ -126,9 +138,10 @@ void AP_CANManager::init()
         AP_HAL::panic("CANManager: SITL not initialised!");
     }
 #endif
-    // We only allocate log buffer only when under debug
+    // We only allocate log buffer only when under debug. It lives for
+    // the life of the boot, so it comes from the permanent arena
     if (_loglevel != AP_CANManager::LOG_NONE) {
-        _log_buf = new char[LOG_BUFFER_SIZE];
+        _log_buf = (char *)hal.util->malloc_type(LOG_BUFFER_SIZE, AP_HAL::Util::MEM_PERMANENT);
         _log_pos = 0;
     }
 
@@ -278,6 +291,53 @@ void AP_CANManager::init()
         // to find and reference protocol drivers
         _driver_type_cache[drv_num] = drv_type[drv_num];
     }
+
+    // setup raw frame capture if enabled
+    if (_frame_log != 0) {
+        _frame_buffer = new ObjectBuffer_TS<BusFrame>(FRAME_LOG_QUEUE_SIZE);
+        if (_frame_buffer != nullptr) {
+            AP_HAL::CANIface::set_frame_capture([](uint8_t bus, const AP_HAL::CANIface::CanRxItem &item) {
+                AP::can().capture_frame(bus, item);
+            });
+            hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_CANManager::frame_log_update, void));
+        }
+    }
+}
+
+// queue a received frame for raw frame logging. Called from the CAN
+// rx threads via the HAL frame capture hook; must not block
+void AP_CANManager::capture_frame(uint8_t bus, const AP_HAL::CANIface::CanRxItem &item)
+{
+    if (_frame_buffer == nullptr || (_frame_log & (1U << bus)) == 0) {
+        return;
+    }
+    BusFrame frm {};
+    frm.timestamp_us = item.timestamp_us;
+    frm.id = item.frame.id;
+    frm.bus = bus;
+    frm.dlc = item.frame.dlc;
+    memcpy(frm.data, item.frame.data, sizeof(frm.data));
+    _frame_buffer->push(frm);
+}
+
+// drain the frame capture queue to the log. Runs in the IO thread so
+// bus load bursts are absorbed by the queue rather than dropped
+void AP_CANManager::frame_log_update(void)
+{
+    BusFrame frm;
+    while (_frame_buffer->pop(frm)) {
+        uint64_t data;
+        memcpy(&data, frm.data, sizeof(data));
+        struct log_CANF pkt {
+            LOG_PACKET_HEADER_INIT(LOG_CANF_MSG),
+            time_us : frm.timestamp_us,
+            bus     : frm.bus,
+            id      : frm.id,
+            dlc     : frm.dlc,
+            data    : data
+        };
+        AP::logger().WriteBlock(&pkt, sizeof(pkt));
+    }
 }
 
 /*
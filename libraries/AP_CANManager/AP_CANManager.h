@@ -22,6 +22,7 @@
 #if HAL_MAX_CAN_PROTOCOL_DRIVERS
 
 #include <AP_Param/AP_Param.h>
+#include <AP_HAL/utility/RingBuffer.h>
 #include "AP_SLCANIface.h"
 #include "AP_CANDriver.h"
 
@@ -92,6 +93,10 @@ public:
 
     void log_retrieve(ExpandingString &str) const;
 
+    // queue a received frame for raw frame logging. Called from the
+    // CAN rx threads via the HAL frame capture hook; must not block
+    void capture_frame(uint8_t bus, const AP_HAL::CANIface::CanRxItem &item);
+
     // return driver type index i
     Driver_Type get_driver_type(uint8_t i) const
     {
@@ -156,6 +161,21 @@ private:
     char* _log_buf;
     uint32_t _log_pos;
 
+    // raw frame logging. Frames are queued with their hardware rx
+    // timestamps and drained to the logger in the IO thread
+    struct BusFrame {
+        uint64_t timestamp_us;
+        uint32_t id;
+        uint8_t bus;
+        uint8_t dlc;
+        uint8_t data[8];
+    };
+    ObjectBuffer_TS<BusFrame> *_frame_buffer;
+    AP_Int8 _frame_log;
+
+    // write out queued frames in the IO thread
+    void frame_log_update(void);
+
     HAL_Semaphore _sem;
 };
 
@@ -4,6 +4,8 @@
 
 #include "Location.h"
 
+#include <atomic>
+
 #include <AP_AHRS/AP_AHRS.h>
 #include <AP_Terrain/AP_Terrain.h>
 
@@ -278,8 +280,29 @@ void Location::offset_bearing_and_pitch(float bearing, float pitch, float distan
 
 float Location::longitude_scale() const
 {
-    float scale = cosf(lat * (1.0e-7f * DEG_TO_RAD));
-    return MAX(scale, 0.01f);
+    // the navigation stack calls this against the same origin
+    // thousands of times per second, so cache the cosine.  0.01
+    // degrees of latitude changes the scale by less than 2e-6, far
+    // below the accuracy of the flat-earth approximation itself.
+    // Callers include the scripting thread, so the latitude and scale
+    // are packed into a single atomically exchanged word; a reader
+    // can never pair one entry's latitude with another's scale. The
+    // initial latitude is a sentinel no real location can match
+    static std::atomic<uint64_t> last{uint64_t(uint32_t(INT32_MIN)) << 32};
+
+    const uint64_t cached = last.load(std::memory_order_relaxed);
+    const int32_t cached_lat = int32_t(uint32_t(cached >> 32));
+    if (llabs(int64_t(cached_lat) - lat) < 100000) {
+        float cached_scale;
+        const uint32_t scale_bits = uint32_t(cached);
+        memcpy(&cached_scale, &scale_bits, sizeof(cached_scale));
+        return cached_scale;
+    }
+    const float scale = MAX(cosf(lat * (1.0e-7f * DEG_TO_RAD)), 0.01f);
+    uint32_t scale_bits;
+    memcpy(&scale_bits, &scale, sizeof(scale_bits));
+    last.store((uint64_t(uint32_t(lat)) << 32) | scale_bits, std::memory_order_relaxed);
+    return scale;
 }
 
 /*
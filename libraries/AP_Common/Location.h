@@ -77,6 +77,13 @@ public:
     // extrapolate latitude/longitude given bearing, pitch and distance
     void offset_bearing_and_pitch(float bearing, float pitch, float distance);
 
+    // double precision variants of get_distance_NE and offset, used
+    // for origin-relative conversions where single precision loses
+    // accuracy at long range.  Implemented in
+    // AP_Math/location_double.cpp where double math is permitted
+    Vector2f get_distance_NE_double(const Location &loc2) const;
+    void offset_double(double ofs_north, double ofs_east);
+
     // longitude_scale - returns the scaler to compensate for
     // shrinking longitude as you move north or south from the equator
     // Note: this does not include the scaling to convert
@@ -995,6 +995,38 @@ bool Compass::_have_i2c_driver(uint8_t bus, uint8_t address) const
     return false;
 }
 
+/*
+  see if anything ACKs at an i2c bus address. A failed driver probe
+  costs several register transfers with retries and bus timeouts, but
+  a missing device fails a single address ACK in microseconds, so
+  boards with a sparse sensor fit don't pay a bus timeout for every
+  possible compass. The result is cached so addresses shared by
+  several drivers are only tested once per boot
+ */
+bool Compass::_i2c_address_acked(uint8_t bus, uint8_t address)
+{
+    if (bus >= ARRAY_SIZE(_i2c_acked_mask) || address >= 64) {
+        // outside the cache, let the driver probe decide
+        return true;
+    }
+    const uint64_t abit = (uint64_t)1U << address;
+    if (!(_i2c_scanned_mask[bus] & abit)) {
+        _i2c_scanned_mask[bus] |= abit;
+        AP_HAL::OwnPtr<AP_HAL::I2CDevice> dev = hal.i2c_mgr->get_device(bus, address);
+        if (!dev) {
+            return true;
+        }
+        dev->get_semaphore()->take_blocking();
+        dev->set_retries(1);
+        uint8_t v;
+        if (dev->transfer(nullptr, 0, &v, 1)) {
+            _i2c_acked_mask[bus] |= abit;
+        }
+        dev->get_semaphore()->give();
+    }
+    return (_i2c_acked_mask[bus] & abit) != 0;
+}
+
 #if COMPASS_MAX_UNREG_DEV > 0
 #define CHECK_UNREG_LIMIT_RETURN  if (_unreg_compass_count == COMPASS_MAX_UNREG_DEV) return
 #else
@@ -1010,7 +1042,7 @@ bool Compass::_have_i2c_driver(uint8_t bus, uint8_t address) const
         CHECK_UNREG_LIMIT_RETURN; \
     } while (0)
 
-#define GET_I2C_DEVICE(bus, address) _have_i2c_driver(bus, address)?nullptr:hal.i2c_mgr->get_device(bus, address)
+#define GET_I2C_DEVICE(bus, address) (_have_i2c_driver(bus, address) || !_i2c_address_acked(bus, address))?nullptr:hal.i2c_mgr->get_device(bus, address)
 
 /*
   look for compasses on external i2c buses
@@ -393,6 +393,15 @@ private:
     // see if we already have probed a i2c driver by bus number and address
     bool _have_i2c_driver(uint8_t bus_num, uint8_t address) const;
 
+    // see if anything ACKs at an i2c bus address, caching the answer
+    // so each address is only tested once per boot
+    bool _i2c_address_acked(uint8_t bus_num, uint8_t address);
+
+    // one scanned/acked bit per 7-bit address below 64 on the first 8
+    // buses, filled in by _i2c_address_acked
+    uint64_t _i2c_scanned_mask[8];
+    uint64_t _i2c_acked_mask[8];
+
     /*
       get mag field with the effects of offsets, diagonals and
       off-diagonals removed
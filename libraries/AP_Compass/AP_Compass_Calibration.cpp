@@ -93,7 +93,9 @@ bool Compass::_start_calibration(uint8_t i, bool retry, float delay)
     }
     if (!_cal_thread_started) {
         _cal_requires_reboot = true;
-        if (!hal.scheduler->thread_create(FUNCTOR_BIND(this, &Compass::_update_calibration_trampoline, void), "compasscal", 2048, AP_HAL::Scheduler::PRIORITY_IO, 0)) {
+        // the ellipsoid fit uses stack scratch for its 9x9 matrix
+        // inverse, so this needs more than the old 2048 byte stack
+        if (!hal.scheduler->thread_create(FUNCTOR_BIND(this, &Compass::_update_calibration_trampoline, void), "compasscal", 3072, AP_HAL::Scheduler::PRIORITY_IO, 0)) {
             gcs().send_text(MAV_SEVERITY_CRITICAL, "CompassCalibrator: Cannot start compass thread.");
             return false;
         }
@@ -111,11 +111,25 @@ AP_Compass_UAVCAN* AP_Compass_UAVCAN::get_uavcan_backend(AP_UAVCAN* ap_uavcan, u
     if (ap_uavcan == nullptr) {
         return nullptr;
     }
+    // check the slot that resolved the last message first; all callers
+    // hold the registry semaphore, and at sensor message rates the same
+    // backend is resolved many thousands of times in a row. The keys
+    // are always re-checked so a stale index after re-registration is
+    // simply a miss
+    static uint8_t last_hit;
+    if (last_hit < COMPASS_MAX_BACKEND &&
+        _detected_modules[last_hit].driver &&
+        _detected_modules[last_hit].ap_uavcan == ap_uavcan &&
+        _detected_modules[last_hit].node_id == node_id &&
+        _detected_modules[last_hit].sensor_id == sensor_id) {
+        return _detected_modules[last_hit].driver;
+    }
     for (uint8_t i=0; i<COMPASS_MAX_BACKEND; i++) {
         if (_detected_modules[i].driver &&
             _detected_modules[i].ap_uavcan == ap_uavcan &&
             _detected_modules[i].node_id == node_id &&
             _detected_modules[i].sensor_id == sensor_id) {
+            last_hit = i;
             return _detected_modules[i].driver;
         }
     }
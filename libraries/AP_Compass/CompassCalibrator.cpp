@@ -655,11 +655,11 @@ void CompassCalibrator::run_sphere_fit()
         JTJ2[i*COMPASS_CAL_NUM_SPHERE_PARAMS+i] += _sphere_lambda/lma_damping;
     }
 
-    if (!mat_inverse(JTJ, JTJ, 4)) {
+    if (!mat_inverse<float, COMPASS_CAL_NUM_SPHERE_PARAMS>(JTJ, JTJ)) {
         return;
     }
 
-    if (!mat_inverse(JTJ2, JTJ2, 4)) {
+    if (!mat_inverse<float, COMPASS_CAL_NUM_SPHERE_PARAMS>(JTJ2, JTJ2)) {
         return;
     }
 
@@ -771,11 +771,11 @@ void CompassCalibrator::run_ellipsoid_fit()
         JTJ2[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+i] += _ellipsoid_lambda/lma_damping;
     }
 
-    if (!mat_inverse(JTJ, JTJ, 9)) {
+    if (!mat_inverse<float, COMPASS_CAL_NUM_ELLIPSOID_PARAMS>(JTJ, JTJ)) {
         return;
     }
 
-    if (!mat_inverse(JTJ2, JTJ2, 9)) {
+    if (!mat_inverse<float, COMPASS_CAL_NUM_ELLIPSOID_PARAMS>(JTJ2, JTJ2)) {
         return;
     }
 
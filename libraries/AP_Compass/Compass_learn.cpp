@@ -81,29 +81,29 @@ void CompassLearn::update(void)
 
     AP_Notify::flags.compass_cal_running = true;
 
-    if (sample_available) {
-        // last sample still being processed by IO thread
-        return;
-    }
-
     Vector3f field = compass.get_field(0);
     Vector3f field_change = field - last_field;
     if (field_change.length() < min_field_change) {
         return;
     }
 
+    bool queued = false;
     {
         WITH_SEMAPHORE(sem);
-        // give a sample to the backend to process
-        new_sample.field = field;
-        new_sample.offsets = compass.get_offsets(0);
-        new_sample.attitude = Vector3f(ahrs.roll, ahrs.pitch, ahrs.yaw);
-        sample_available = true;
-        last_field = field;
-        num_samples++;
+        // queue a sample for the IO thread to process.  If the queue is
+        // full the sample is dropped, the IO thread will catch up
+        struct sample s;
+        s.field = field;
+        s.offsets = compass.get_offsets(0);
+        s.attitude = Vector3f(ahrs.roll, ahrs.pitch, ahrs.yaw);
+        if (sample_queue.push(s)) {
+            queued = true;
+            last_field = field;
+            num_samples++;
+        }
     }
 
-    if (sample_available) {
+    if (queued) {
 // @LoggerMessage: COFS
 // @Description: Current compass learn offsets
 // @Field: TimeUS: Time since system startup
@@ -155,7 +155,7 @@ void CompassLearn::update(void)
             compass.set_learn_type(Compass::LEARN_NONE, true);
             // setup so use can trigger it again
             converged = false;
-            sample_available = false;
+            sample_queue.clear();
             num_samples = 0;
             have_earth_field = false;
             memset(predicted_offsets, 0, sizeof(predicted_offsets));
@@ -175,19 +175,12 @@ void CompassLearn::update(void)
  */
 void CompassLearn::io_timer(void)
 {
-    if (!sample_available) {
-        return;
-    }
-
+    // drain the queue, batching however many samples have accumulated
+    // into one pass
     struct sample s;
-
-    {
-        WITH_SEMAPHORE(sem);
-        s = new_sample;
-        sample_available = false;
+    while (sample_queue.pop(s)) {
+        process_sample(s);
     }
-
-    process_sample(s);
 }
 
 /*
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <AP_AHRS/AP_AHRS.h>
+#include <AP_HAL/utility/RingBuffer.h>
 
 /*
   compass learning using magnetic field tables from AP_Declination
@@ -40,9 +41,11 @@ private:
     };
 
     Matrix3f mat;
-    
-    struct sample new_sample;
-    bool sample_available;
+
+    // queue of samples waiting for the IO thread, so several samples can
+    // be batched into one solver pass rather than dropped while one is
+    // in flight
+    ObjectBuffer<struct sample> sample_queue{8};
     Vector3f last_field;
     static const uint32_t min_field_change = 60;
 
@@ -37,7 +37,9 @@
     LOG_REPH_MSG, \
     LOG_REVH_MSG, \
     LOG_RWOH_MSG, \
-    LOG_RBOH_MSG
+    LOG_RBOH_MSG, \
+    LOG_RSH3_MSG, \
+    LOG_RSC3_MSG
 
 // Replay Data Structures
 struct log_RFRH {
@@ -133,6 +135,23 @@ struct log_REY3 {
     uint8_t _end;
 };
 
+// @LoggerMessage: RSH3
+// @Description: Replay EKF3 state snapshot header
+struct log_RSH3 {
+    uint16_t num_chunks;
+    uint8_t core;
+    uint8_t _end;
+};
+
+// @LoggerMessage: RSC3
+// @Description: Replay EKF3 state snapshot chunk
+struct log_RSC3 {
+    float data[6];
+    uint16_t index;
+    uint8_t core;
+    uint8_t _end;
+};
+
 // @LoggerMessage: RBRH
 // @Description: Replay Data Barometer Header
 struct log_RBRH {
@@ -415,4 +434,8 @@ struct log_RBOH {
     { LOG_RWOH_MSG, RLOG_SIZE(RWOH),                                   \
       "RWOH", "ffIffff", "DA,DT,TS,PX,PY,PZ,R", "-------", "-------" }, \
     { LOG_RBOH_MSG, RLOG_SIZE(RBOH),                                   \
-      "RBOH", "ffffffffIfffH", "Q,DPX,DPY,DPZ,DAX,DAY,DAZ,DT,TS,OX,OY,OZ,D", "-------------", "-------------" },
+      "RBOH", "ffffffffIfffH", "Q,DPX,DPY,DPZ,DAX,DAY,DAZ,DT,TS,OX,OY,OZ,D", "-------------", "-------------" }, \
+    { LOG_RSH3_MSG, RLOG_SIZE(RSH3),                                   \
+      "RSH3", "HB", "NChunk,C", "-#", "--" }, \
+    { LOG_RSC3_MSG, RLOG_SIZE(RSC3),                                   \
+      "RSC3", "ffffffHB", "V0,V1,V2,V3,V4,V5,Idx,C", "-------#", "--------" },
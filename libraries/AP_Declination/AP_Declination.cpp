@@ -27,6 +27,7 @@
 #include <cmath>
 
 #include <AP_Common/AP_Common.h>
+#include <AP_HAL/AP_HAL.h>
 #include <AP_Math/AP_Math.h>
 
 /*
@@ -34,6 +35,34 @@
 */
 bool AP_Declination::get_mag_field_ef(float latitude_deg, float longitude_deg, float &intensity_gauss, float &declination_deg, float &inclination_deg)
 {
+    /*
+      cache the last result. The EKF and scripting tend to ask for the
+      field at the same position many times over (eg. on every mag
+      fusion reset), so an exact-position hit skips the table walk
+      while returning bit-identical results
+     */
+    static HAL_Semaphore sem;
+    static struct {
+        float latitude_deg;
+        float longitude_deg;
+        float intensity_gauss;
+        float declination_deg;
+        float inclination_deg;
+        bool valid_input;
+        bool filled;
+    } cache;
+
+    WITH_SEMAPHORE(sem);
+
+    if (cache.filled &&
+        is_equal(latitude_deg, cache.latitude_deg) &&
+        is_equal(longitude_deg, cache.longitude_deg)) {
+        intensity_gauss = cache.intensity_gauss;
+        declination_deg = cache.declination_deg;
+        inclination_deg = cache.inclination_deg;
+        return cache.valid_input;
+    }
+
     bool valid_input_data = true;
 
     /* round down to nearest sampling resolution */
@@ -111,6 +140,14 @@ bool AP_Declination::get_mag_field_ef(float latitude_deg, float longitude_deg, f
 
     inclination_deg = ((latitude_deg - min_lat) / SAMPLING_RES) * (data_max - data_min) + data_min;
 
+    cache.latitude_deg = latitude_deg;
+    cache.longitude_deg = longitude_deg;
+    cache.intensity_gauss = intensity_gauss;
+    cache.declination_deg = declination_deg;
+    cache.inclination_deg = inclination_deg;
+    cache.valid_input = valid_input_data;
+    cache.filled = true;
+
     return valid_input_data;
 }
 
@@ -132,6 +169,28 @@ float AP_Declination::get_declination(float latitude_deg, float longitude_deg)
 */
 Vector3f AP_Declination::get_earth_field_ga(const Location &loc)
 {
+    // cache on the location, which also skips the rotation
+    // trigonometry on a repeated query.  The tolerance of 0.01
+    // degrees (roughly 1km) lets a cache warmed from an early, still
+    // jittering GPS fix serve the later queries at EKF origin set;
+    // the field changes by well under the table interpolation error
+    // over that distance
+    static HAL_Semaphore sem;
+    static struct {
+        int32_t lat;
+        int32_t lng;
+        Vector3f field;
+        bool filled;
+    } cache;
+
+    WITH_SEMAPHORE(sem);
+
+    if (cache.filled &&
+        labs(loc.lat - cache.lat) < 100000 &&
+        labs(loc.lng - cache.lng) < 100000) {
+        return cache.field;
+    }
+
     float declination_deg=0, inclination_deg=0, intensity_gauss=0;
     get_mag_field_ef(loc.lat*1.0e-7f, loc.lng*1.0e-7f, intensity_gauss, declination_deg, inclination_deg);
 
@@ -141,5 +200,11 @@ Vector3f AP_Declination::get_earth_field_ga(const Location &loc)
 
     R.from_euler(0.0f, -ToRad(inclination_deg), ToRad(declination_deg));
     mag_ef = R * mag_ef;
+
+    cache.lat = loc.lat;
+    cache.lng = loc.lng;
+    cache.field = mag_ef;
+    cache.filled = true;
+
     return mag_ef;
 }
@@ -206,6 +206,13 @@ int64_t AP_Filesystem::disk_space(const char *path)
     return backend.fs.disk_space(path);
 }
 
+// return the filesystem allocation unit size in bytes
+uint32_t AP_Filesystem::alloc_unit_size(const char *path)
+{
+    const Backend &backend = backend_by_path(path);
+    return backend.fs.alloc_unit_size(path);
+}
+
 
 /*
   set mtime on a file
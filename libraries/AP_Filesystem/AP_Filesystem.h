@@ -80,6 +80,9 @@ public:
     // return total disk space in bytes, -1 on error
     int64_t disk_space(const char *path);
 
+    // return the filesystem allocation unit size in bytes, 0 if unknown
+    uint32_t alloc_unit_size(const char *path);
+
     // set modification time on a file
     bool set_mtime(const char *filename, const uint32_t mtime_sec);
 
@@ -782,6 +782,27 @@ int64_t AP_Filesystem_FATFS::disk_space(const char *path)
     return (int64_t)(tot_sect)*512;
 }
 
+// return the cluster size in bytes. Writers can use this to align
+// their writes with the card allocation unit
+uint32_t AP_Filesystem_FATFS::alloc_unit_size(const char *path)
+{
+    WITH_SEMAPHORE(sem);
+
+    if (remount_needed && !remount_file_system()) {
+        return 0;
+    }
+
+    FATFS *fs;
+    DWORD fre_clust;
+
+    FRESULT res = f_getfree("/", &fre_clust, &fs);
+    if (res) {
+        return 0;
+    }
+
+    return uint32_t(fs->csize)*512U;
+}
+
 /*
   convert unix time_t to FATFS timestamp
  */
@@ -46,6 +46,9 @@ public:
     // return total disk space in bytes, -1 on error
     int64_t disk_space(const char *path) override;
 
+    // return the cluster size in bytes
+    uint32_t alloc_unit_size(const char *path) override;
+
     // set modification time on a file
     bool set_mtime(const char *filename, const uint32_t mtime_sec) override;
 
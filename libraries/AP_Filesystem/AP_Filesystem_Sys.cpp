@@ -21,7 +21,12 @@
 #include "AP_Filesystem_Sys.h"
 #include <AP_Math/AP_Math.h>
 #include <AP_CANManager/AP_CANManager.h>
+#include <AP_UAVCAN/AP_UAVCAN.h>
 #include <AP_Scheduler/AP_Scheduler.h>
+#include <AP_BoardConfig/AP_BoardConfig.h>
+#include <AP_Terrain/AP_Terrain.h>
+#include <GCS_MAVLink/GCS.h>
+#include <AP_Logger/AP_Logger.h>
 #include <AP_Common/ExpandingString.h>
 
 extern const AP_HAL::HAL& hal;
@@ -33,11 +38,28 @@ struct SysFileList {
 static const SysFileList sysfs_file_list[] = {
     {"threads.txt"},
     {"tasks.txt"},
+    {"tasks.bin"},
     {"dma.txt"},
+    {"memory.txt"},
+    {"profile.bin"},
+    {"boot.txt"},
+    {"statustext.txt"},
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    {"locks.txt"},
+#endif
+    {"log_latency.txt"},
+    {"param_journal.txt"},
+    {"crash_dump.bin"},
+#if AP_TERRAIN_AVAILABLE
+    {"terrain.txt"},
+#endif
 #if HAL_MAX_CAN_PROTOCOL_DRIVERS
     {"can_log.txt"},
     {"can0_stats.txt"},
     {"can1_stats.txt"},
+#if HAL_ENABLE_LIBUAVCAN_DRIVERS
+    {"uavcan_stats.txt"},
+#endif
 #endif
 #if !defined(HAL_BOOTLOADER_BUILD) && (defined(STM32F7) || defined(STM32H7))
     {"persistent.parm"},
@@ -91,9 +113,47 @@ int AP_Filesystem_Sys::open(const char *fname, int flags)
     if (strcmp(fname, "tasks.txt") == 0) {
         AP::scheduler().task_info(*r.str);
     }
+    if (strcmp(fname, "tasks.bin") == 0) {
+        AP::scheduler().task_info_bin(*r.str);
+    }
     if (strcmp(fname, "dma.txt") == 0) {
         hal.util->dma_info(*r.str);
     }
+    if (strcmp(fname, "memory.txt") == 0) {
+        hal.util->mem_info(*r.str);
+    }
+    if (strcmp(fname, "profile.bin") == 0) {
+        // first open starts the PC sampler, later opens return samples
+        hal.util->profile_info(*r.str);
+    }
+    if (strcmp(fname, "boot.txt") == 0) {
+        AP_BoardConfig::boot_info(*r.str);
+    }
+    if (strcmp(fname, "statustext.txt") == 0) {
+        gcs().statustext_history(*r.str);
+    }
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    if (strcmp(fname, "locks.txt") == 0) {
+        WithSemaphore::lock_info(*r.str);
+    }
+#endif
+    if (strcmp(fname, "log_latency.txt") == 0) {
+        AP::logger().write_latency_info(*r.str);
+    }
+    if (strcmp(fname, "param_journal.txt") == 0) {
+        AP_Param::journal_info(*r.str);
+    }
+    if (strcmp(fname, "crash_dump.bin") == 0) {
+        hal.util->crash_dump(*r.str);
+    }
+#if AP_TERRAIN_AVAILABLE
+    if (strcmp(fname, "terrain.txt") == 0) {
+        AP_Terrain *terrain = AP_Terrain::get_singleton();
+        if (terrain != nullptr) {
+            terrain->tile_manifest(*r.str);
+        }
+    }
+#endif
 #if HAL_MAX_CAN_PROTOCOL_DRIVERS
     int8_t can_stats_num = -1;
     if (strcmp(fname, "can_log.txt") == 0) {
@@ -108,6 +168,16 @@ int AP_Filesystem_Sys::open(const char *fname, int flags)
             hal.can[can_stats_num]->get_stats(*r.str);
         }
     }
+#if HAL_ENABLE_LIBUAVCAN_DRIVERS
+    if (strcmp(fname, "uavcan_stats.txt") == 0) {
+        for (uint8_t i=0; i<HAL_MAX_CAN_PROTOCOL_DRIVERS; i++) {
+            AP_UAVCAN *ap_uavcan = AP_UAVCAN::get_uavcan(i);
+            if (ap_uavcan != nullptr) {
+                ap_uavcan->get_pool_stats(*r.str);
+            }
+        }
+    }
+#endif
 #endif
     if (strcmp(fname, "persistent.parm") == 0) {
         hal.util->load_persistent_params(*r.str);
@@ -62,6 +62,9 @@ public:
     // return total disk space in bytes, -1 on error
     virtual int64_t disk_space(const char *path) { return 0; }
 
+    // return the filesystem allocation unit size in bytes, 0 if unknown
+    virtual uint32_t alloc_unit_size(const char *path) { return 0; }
+
     // set modification time on a file
     virtual bool set_mtime(const char *filename, const uint32_t mtime_sec) { return false; }
 
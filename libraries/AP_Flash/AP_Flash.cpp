@@ -0,0 +1,168 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AP_Flash.h"
+
+#include <AP_Math/AP_Math.h>
+#include <AP_Math/crc.h>
+
+#include <string.h>
+
+extern const AP_HAL::HAL& hal;
+
+/*
+  start a new update for an image of the given size. The image is
+  streamed into the upper half of the flash page map, which on
+  dual-bank MCUs addresses the bank that is not currently aliased at
+  the boot address
+ */
+bool AP_Flash::start_update(uint32_t total_size)
+{
+    if (hal.flash == nullptr || in_progress) {
+        return false;
+    }
+    const uint32_t numpages = hal.flash->getnumpages();
+    if (numpages < 2 || (numpages & 1)) {
+        // no inactive bank to stream into
+        return false;
+    }
+    first_page = numpages / 2;
+    num_pages = numpages - first_page;
+    if (num_pages > 32) {
+        // erased_mask is 32 bits wide
+        return false;
+    }
+    bank_base = hal.flash->getpageaddr(first_page);
+
+    uint32_t bank_size = 0;
+    for (uint32_t i = first_page; i < numpages; i++) {
+        bank_size += hal.flash->getpagesize(i);
+    }
+    if (total_size == 0 || total_size > bank_size) {
+        return false;
+    }
+
+    image_size = total_size;
+    bytes_written = 0;
+    erased_mask = 0;
+    buf_len = 0;
+    in_progress = true;
+    return true;
+}
+
+/*
+  erase any not-yet-erased pages covering the given address range
+ */
+bool AP_Flash::erase_range(uint32_t addr, uint32_t len)
+{
+    for (uint32_t i = 0; i < num_pages; i++) {
+        const uint32_t page_addr = hal.flash->getpageaddr(first_page + i);
+        const uint32_t page_size = hal.flash->getpagesize(first_page + i);
+        if (page_addr + page_size <= addr || page_addr >= addr + len) {
+            continue;
+        }
+        if (erased_mask & (1U << i)) {
+            continue;
+        }
+        EXPECT_DELAY_MS(3000);
+        if (!hal.flash->erasepage(first_page + i)) {
+            return false;
+        }
+        erased_mask |= (1U << i);
+    }
+    return true;
+}
+
+/*
+  flush the alignment buffer, padding with 0xff. Padding bytes beyond
+  the image are left erased so they do not affect the CRC check
+ */
+bool AP_Flash::flush(void)
+{
+    if (buf_len == 0) {
+        return true;
+    }
+    memset(&buf[buf_len], 0xff, WRITE_ALIGN - buf_len);
+    const uint32_t addr = bank_base + (bytes_written - buf_len);
+    if (!erase_range(addr, WRITE_ALIGN)) {
+        return false;
+    }
+    if (!hal.flash->write(addr, buf, WRITE_ALIGN)) {
+        return false;
+    }
+    buf_len = 0;
+    return true;
+}
+
+bool AP_Flash::write(const uint8_t *data, uint32_t len)
+{
+    if (!in_progress || bytes_written + len > image_size) {
+        abort_update();
+        return false;
+    }
+    while (len > 0) {
+        if (buf_len != 0 || len < WRITE_ALIGN) {
+            // accumulate into the alignment buffer
+            const uint32_t n = MIN(uint32_t(WRITE_ALIGN - buf_len), len);
+            memcpy(&buf[buf_len], data, n);
+            buf_len += n;
+            bytes_written += n;
+            data += n;
+            len -= n;
+            if (buf_len == WRITE_ALIGN && !flush()) {
+                abort_update();
+                return false;
+            }
+            continue;
+        }
+        // write as many aligned blocks as we can directly
+        const uint32_t n = len & ~uint32_t(WRITE_ALIGN - 1);
+        const uint32_t addr = bank_base + bytes_written;
+        if (!erase_range(addr, n) ||
+            !hal.flash->write(addr, data, n)) {
+            abort_update();
+            return false;
+        }
+        bytes_written += n;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+/*
+  flush any remaining data, verify the image CRC against the mapped
+  inactive bank and arm the bank swap for the next reset
+ */
+bool AP_Flash::finish_update(uint32_t expected_crc)
+{
+    if (!in_progress || bytes_written != image_size || !flush()) {
+        abort_update();
+        return false;
+    }
+    in_progress = false;
+
+    const uint32_t crc = crc_crc32(0, (const uint8_t *)(uintptr_t)bank_base, image_size);
+    if (crc != expected_crc) {
+        return false;
+    }
+    return hal.util->flash_swap_banks();
+}
+
+void AP_Flash::abort_update(void)
+{
+    in_progress = false;
+    buf_len = 0;
+}
@@ -0,0 +1,70 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+  streaming firmware update into the inactive flash bank of dual-bank
+  MCUs. The new image is written a chunk at a time while the current
+  firmware keeps running, verified against a CRC32, and the banks are
+  swapped at the next reset via hal.util->flash_swap_banks()
+ */
+#pragma once
+
+#include <AP_HAL/AP_HAL.h>
+
+class AP_Flash {
+public:
+    // start a new update for an image of the given size. Returns
+    // false if the flash layout has no inactive bank or the image
+    // does not fit
+    bool start_update(uint32_t image_size);
+
+    // append the next chunk of the image. Chunks must be supplied in
+    // order. Pages are erased lazily as the stream crosses into them,
+    // so this should be called from a thread that can tolerate flash
+    // erase delays
+    bool write(const uint8_t *data, uint32_t len);
+
+    // flush any buffered partial write, verify the streamed image
+    // against the expected CRC32 (crc_crc32 seeded with zero) and arm
+    // the bank swap for the next reset
+    bool finish_update(uint32_t expected_crc);
+
+    // abandon an in-progress update
+    void abort_update(void);
+
+    // true if an update has been started and not yet finished
+    bool updating(void) const {
+        return in_progress;
+    }
+
+private:
+    // number of bytes buffered to satisfy flash write alignment
+    static const uint8_t WRITE_ALIGN = 32;
+
+    // flush the alignment buffer, padding with 0xff
+    bool flush(void);
+
+    // erase any not-yet-erased pages covering the given address range
+    bool erase_range(uint32_t addr, uint32_t len);
+
+    uint32_t first_page;      // first page of the inactive bank
+    uint32_t num_pages;       // pages available for the image
+    uint32_t bank_base;       // mapped address of the inactive bank
+    uint32_t image_size;
+    uint32_t bytes_written;   // includes buffered bytes
+    uint32_t erased_mask;     // bitmask of pages already erased
+    uint8_t buf[WRITE_ALIGN];
+    uint8_t buf_len;
+    bool in_progress;
+};
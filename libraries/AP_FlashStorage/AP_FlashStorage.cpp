@@ -258,6 +258,39 @@ bool AP_FlashStorage::write(uint16_t offset, uint16_t length)
     return true;
 }
 
+/*
+  erase a full sector when it is safe to do so. After switch_sectors()
+  the old sector stays marked FULL and is only reclaimed when the new
+  sector also fills, which forces a write_all() and a sector erase in
+  the write path - tens of milliseconds at the worst possible time. By
+  erasing the full sector from idle time while erase is allowed, the
+  next sector switch becomes a cheap header update and the space
+  reservation for a full write out can be dropped
+ */
+bool AP_FlashStorage::process_erase(void)
+{
+    if (write_error || reserved_space == 0) {
+        // no full sector pending erase
+        return false;
+    }
+    if (!flash_erase_ok()) {
+        return false;
+    }
+    const uint8_t sector = current_sector ^ 1;
+    struct sector_header header;
+    if (!flash_read(sector, 0, (uint8_t *)&header, sizeof(header))) {
+        return false;
+    }
+    if (!header.signature_ok() || header.get_state() != SECTOR_STATE_FULL) {
+        return false;
+    }
+    if (!erase_sector(sector, true)) {
+        return false;
+    }
+    reserved_space = 0;
+    return true;
+}
+
 /*
   load all data from a flash sector into mem_buffer
  */
@@ -120,6 +120,11 @@ public:
     // write some data to storage from mem_buffer
     bool write(uint16_t offset, uint16_t length) WARN_IF_UNUSED;
 
+    // erase a full sector when it is safe to do so, so the next
+    // sector switch is a cheap header update rather than a write_all()
+    // and erase in the write path. Returns true if an erase was done
+    bool process_erase(void);
+
     // fixed storage size
     static const uint16_t storage_size = HAL_STORAGE_SIZE;
     
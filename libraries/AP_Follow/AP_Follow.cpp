@@ -164,10 +164,11 @@ bool AP_Follow::get_target_location_and_velocity(Location &loc, Vector3f &vel_ne
         return false;
     }
 
-    // project the vehicle position
+    // project the vehicle position, second order in dt
+    const Vector3f pos_delta = _target_velocity_ned * dt + _target_accel_ned * (0.5f * sq(dt));
     Location last_loc = _target_location;
-    last_loc.offset(vel_ned.x * dt, vel_ned.y * dt);
-    last_loc.alt -= vel_ned.z * 100.0f * dt; // convert m/s to cm/s, multiply by dt.  minus because NED
+    last_loc.offset(pos_delta.x, pos_delta.y);
+    last_loc.alt -= pos_delta.z * 100.0f; // convert m to cm.  minus because NED
 
     // return latest position estimate
     loc = last_loc;
@@ -311,6 +312,9 @@ void AP_Follow::handle_msg(const mavlink_message_t &msg)
 
         // get a local timestamp with correction for transport jitter
         _last_location_update_ms = _jitter.correct_offboard_timestamp_msec(packet.time_boot_ms, AP_HAL::millis());
+
+        // refresh the acceleration estimate from the velocity history
+        update_target_accel(_target_velocity_ned, _last_location_update_ms);
         if (packet.hdg <= 36000) {                  // heading (UINT16_MAX if unknown)
             _target_heading = packet.hdg * 0.01f;   // convert centi-degrees to degrees
             _last_heading_update_ms = _last_location_update_ms;
@@ -360,6 +364,39 @@ bool AP_Follow::get_velocity_ned(Vector3f &vel_ned, float dt) const
     return true;
 }
 
+// update the target acceleration estimate from a new velocity sample
+void AP_Follow::update_target_accel(const Vector3f &vel_ned, uint32_t time_ms)
+{
+    // discard the history if the newest sample has gone stale
+    if (_vel_history_count > 0) {
+        const uint8_t newest = (_vel_history_next + VEL_HISTORY_SIZE - 1) % VEL_HISTORY_SIZE;
+        if (time_ms - _vel_history[newest].time_ms > AP_FOLLOW_TIMEOUT_MS) {
+            _vel_history_count = 0;
+            _vel_history_next = 0;
+            _target_accel_ned.zero();
+        }
+    }
+
+    _vel_history[_vel_history_next].time_ms = time_ms;
+    _vel_history[_vel_history_next].vel_ned = vel_ned;
+    _vel_history_next = (_vel_history_next + 1) % VEL_HISTORY_SIZE;
+    if (_vel_history_count < VEL_HISTORY_SIZE) {
+        _vel_history_count++;
+    }
+    if (_vel_history_count < 2) {
+        return;
+    }
+
+    // difference across the whole ring rather than adjacent samples
+    // to smooth the velocity quantisation in GLOBAL_POSITION_INT
+    const uint8_t oldest = (_vel_history_next + VEL_HISTORY_SIZE - _vel_history_count) % VEL_HISTORY_SIZE;
+    const float dt = (time_ms - _vel_history[oldest].time_ms) * 0.001f;
+    if (dt < 0.05f || dt > 3.0f) {
+        return;
+    }
+    _target_accel_ned = (vel_ned - _vel_history[oldest].vel_ned) / dt;
+}
+
 // initialise offsets to provided distance vector to other vehicle (in meters in NED frame) if required
 void AP_Follow::init_offsets_if_required(const Vector3f &dist_vec_ned)
 {
@@ -106,6 +106,9 @@ private:
     // set recorded distance and bearing to target to zero
     void clear_dist_and_bearing_to_target();
 
+    // update the target acceleration estimate from a new velocity sample
+    void update_target_accel(const Vector3f &vel_ned, uint32_t time_ms);
+
     // parameters
     AP_Int8     _enabled;           // 1 if this subsystem is enabled
     AP_Int16    _sysid;             // target's mavlink system id (0 to use first sysid seen)
@@ -129,6 +132,18 @@ private:
     float _bearing_to_target;       // latest bearing to target in degrees (for reporting purposes)
     bool _offsets_were_zero;        // true if offsets were originally zero and then initialised to the offset from lead vehicle
 
+    // fixed ring of recent velocity samples.  Differencing across the
+    // ring gives a smoothed target acceleration estimate so the
+    // extrapolation between position updates is second order rather
+    // than constant velocity
+    static const uint8_t VEL_HISTORY_SIZE = 4;
+    struct {
+        uint32_t time_ms;           // timestamp of sample (jitter corrected)
+        Vector3f vel_ned;           // velocity in NED frame in m/s
+    } _vel_history[VEL_HISTORY_SIZE];
+    uint8_t _vel_history_next;      // ring index the next sample will be written to
+    uint8_t _vel_history_count;     // number of valid samples in the ring
+
     // setup jitter correction with max transport lag of 3s
     JitterCorrection _jitter{3000};
 };
@@ -57,6 +57,9 @@ for FrSky SPort Passthrough
 #define ATTIANDRNG_PITCH_LIMIT      0x3FF
 #define ATTIANDRNG_PITCH_OFFSET     11
 #define ATTIANDRNG_RNGFND_OFFSET    21
+// keepalive interval for packets gated on payload changes, guarantees
+// receivers joining late still get the slow changing values
+#define PAYLOAD_FILTER_TIMEOUT_MS   1000
 
 extern const AP_HAL::HAL& hal;
 
@@ -162,6 +165,34 @@ void AP_Frsky_SPort_Passthrough::adjust_packet_weight(bool queue_empty)
 #endif //HAL_WITH_FRSKY_TELEM_BIDIRECTIONAL
 }
 
+/*
+  return true if the candidate payload for the given entry should be sent,
+  i.e. it differs from the last sent payload or the keepalive timeout
+  expired. The candidate is saved so process_packet() can send it without
+  recomputing it
+ */
+bool AP_Frsky_SPort_Passthrough::is_payload_fresh(uint8_t idx, uint32_t packet)
+{
+    const uint32_t now = AP_HAL::millis();
+    _payload_filter[idx].packet = packet;
+    if (packet != _payload_filter[idx].last_packet || (now - _payload_filter[idx].last_sent_ms) >= PAYLOAD_FILTER_TIMEOUT_MS) {
+        return true;
+    }
+    // reset the WFQ delay so a suppressed packet is re-checked at its
+    // normal cadence rather than on every poll
+    _scheduler.packet_timer[idx] = now;
+    return false;
+}
+
+// send the payload saved by is_payload_fresh() and update the filter state
+void AP_Frsky_SPort_Passthrough::send_filtered_frame(uint8_t idx, uint16_t appid)
+{
+    const uint32_t packet = _payload_filter[idx].packet;
+    send_sport_frame(SPORT_DATA_FRAME, appid, packet);
+    _payload_filter[idx].last_packet = packet;
+    _payload_filter[idx].last_sent_ms = AP_HAL::millis();
+}
+
 // WFQ scheduler
 bool AP_Frsky_SPort_Passthrough::is_packet_ready(uint8_t idx, bool queue_empty)
 {
@@ -176,10 +207,19 @@ bool AP_Frsky_SPort_Passthrough::is_packet_ready(uint8_t idx, bool queue_empty)
         packet_ready = _use_external_data || (_passthrough.new_byte == SENSOR_ID_27);
         break;
     case AP_STATUS:
-        packet_ready = gcs().vehicle_initialised();
+        packet_ready = gcs().vehicle_initialised() && is_payload_fresh(idx, calc_ap_status());
+        break;
+    case GPS_STATUS:
+        packet_ready = is_payload_fresh(idx, calc_gps_status());
+        break;
+    case HOME:
+        packet_ready = is_payload_fresh(idx, calc_home());
         break;
     case BATT_2:
-        packet_ready = AP::battery().num_instances() > 1;
+        packet_ready = AP::battery().num_instances() > 1 && is_payload_fresh(idx, calc_batt(1));
+        break;
+    case BATT_1:
+        packet_ready = is_payload_fresh(idx, calc_batt(0));
         break;
 #if HAL_WITH_FRSKY_TELEM_BIDIRECTIONAL
         case MAV:
@@ -225,19 +265,19 @@ void AP_Frsky_SPort_Passthrough::process_packet(uint8_t idx)
         send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+5, calc_velandyaw());
         break;
     case AP_STATUS: // 0x5001 AP status
-        send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+1, calc_ap_status());
+        send_filtered_frame(idx, DIY_FIRST_ID+1);
         break;
     case GPS_STATUS: // 0x5002 GPS Status
-        send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+2, calc_gps_status());
+        send_filtered_frame(idx, DIY_FIRST_ID+2);
         break;
     case HOME: // 0x5004 Home
-        send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+4, calc_home());
+        send_filtered_frame(idx, DIY_FIRST_ID+4);
         break;
     case BATT_2: // 0x5008 Battery 2 status
-        send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+8, calc_batt(1));
+        send_filtered_frame(idx, DIY_FIRST_ID+8);
         break;
     case BATT_1: // 0x5003 Battery 1 status
-        send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+3, calc_batt(0));
+        send_filtered_frame(idx, DIY_FIRST_ID+3);
         break;
     case PARAM: // 0x5007 parameters
         send_sport_frame(SPORT_DATA_FRAME, DIY_FIRST_ID+7, calc_param());
@@ -150,6 +150,18 @@ private:
 
     uint8_t _paramID;
 
+    // change detection gating for slow changing packets: a packet is only
+    // sent when its payload changed or a keepalive timeout expired, so
+    // poll slots go to the dynamic items instead of repeating values
+    struct {
+        uint32_t packet;        // candidate payload saved by is_payload_fresh()
+        uint32_t last_packet;   // payload most recently sent
+        uint32_t last_sent_ms;  // time the payload was last sent
+    } _payload_filter[WFQ_LAST_ITEM];
+
+    bool is_payload_fresh(uint8_t idx, uint32_t packet);
+    void send_filtered_frame(uint8_t idx, uint16_t appid);
+
     uint32_t calc_gps_status(void);
     uint16_t prep_number(int32_t number, uint8_t digits, uint8_t power);
 
@@ -822,16 +822,33 @@ void AP_GPS::update_instance(uint8_t instance)
     if (drivers[instance] && _type[instance] == GPS_TYPE_UBLOX_RTK_BASE) {
         // see if a moving baseline base has some RTCMv3 data
         // which we need to pass along to the rover
-        const uint8_t *rtcm_data;
-        uint16_t rtcm_len;
-        if (drivers[instance]->get_RTCMV3(rtcm_data, rtcm_len)) {
-            for (uint8_t i=0; i< GPS_MAX_RECEIVERS; i++) {
-                if (i != instance && _type[i] == GPS_TYPE_UBLOX_RTK_ROVER) {
-                    // pass the data to the rover
-                    inject_data(i, rtcm_data, rtcm_len);
-                    drivers[instance]->clear_RTCMV3();
+        uint8_t rover = GPS_MAX_RECEIVERS;
+        for (uint8_t i=0; i< GPS_MAX_RECEIVERS; i++) {
+            if (i != instance && _type[i] == GPS_TYPE_UBLOX_RTK_ROVER) {
+                rover = i;
+                break;
+            }
+        }
+        if (rover < GPS_MAX_RECEIVERS) {
+            /*
+              the base backend stops parsing when it finds an RTCMv3 packet
+              so the packet can be relayed before its buffer is reused.
+              Relay and resume parsing until the receive buffer is drained,
+              otherwise a multi-message correction epoch pays one main-loop
+              iteration of latency per message
+             */
+            const uint8_t *rtcm_data;
+            uint16_t rtcm_len;
+            uint8_t relay_count = 0;
+            while (drivers[instance]->get_RTCMV3(rtcm_data, rtcm_len)) {
+                // pass the data to the rover
+                inject_data(rover, rtcm_data, rtcm_len);
+                drivers[instance]->clear_RTCMV3();
+                if (++relay_count >= 10) {
                     break;
                 }
+                // parse any further data already in the receive buffer
+                drivers[instance]->read();
             }
         }
     }
@@ -1175,6 +1192,42 @@ void AP_GPS::lock_port(uint8_t instance, bool lock)
 
 // Inject a packet of raw binary to a GPS
 void AP_GPS::inject_data(const uint8_t *data, uint16_t len)
+{
+    // stage the data for the IO thread so the backend UART writes are
+    // not paid in the main loop. RTCM corrections are a byte stream so
+    // staged blocks can simply be appended to each other
+    if (_inject.buf == nullptr) {
+        _inject.buf = (uint8_t *)calloc(1, AP_GPS_INJECT_BUFSIZE);
+    }
+    if (_inject.buf != nullptr) {
+        WITH_SEMAPHORE(_inject.sem);
+        if (!_inject.io_registered) {
+            hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_GPS::inject_data_pending, void));
+            _inject.io_registered = true;
+        }
+        if (len <= AP_GPS_INJECT_BUFSIZE - _inject.len) {
+            memcpy(&_inject.buf[_inject.len], data, len);
+            _inject.len += len;
+            return;
+        }
+        // no room; fall through to a synchronous write rather than
+        // dropping corrections
+    }
+    inject_data_to_backends(data, len);
+}
+
+// fan staged injection data out to the backends. called from the IO thread
+void AP_GPS::inject_data_pending(void)
+{
+    WITH_SEMAPHORE(_inject.sem);
+    if (_inject.len > 0) {
+        inject_data_to_backends(_inject.buf, _inject.len);
+        _inject.len = 0;
+    }
+}
+
+// write a packet of raw binary to the backends immediately
+void AP_GPS::inject_data_to_backends(const uint8_t *data, uint16_t len)
 {
     //Support broadcasting to all GPSes.
     if (_inject_to == GPS_RTK_INJECT_TO_ALL) {
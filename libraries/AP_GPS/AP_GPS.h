@@ -39,6 +39,9 @@
 #endif
 #define GPS_UNKNOWN_DOP UINT16_MAX // set unknown DOP's to maximum value, which is also correct for MAVLink
 
+// size of the staging buffer for RTCM data injected to the backends from the IO thread
+#define AP_GPS_INJECT_BUFSIZE (MAVLINK_MSG_GPS_RTCM_DATA_FIELD_DATA_LEN*8)
+
 // the number of GPS leap seconds
 #define GPS_LEAPSECONDS_MILLIS 18000ULL
 
@@ -633,6 +636,24 @@ private:
     void inject_data(const uint8_t *data, uint16_t len);
     void inject_data(uint8_t instance, const uint8_t *data, uint16_t len);
 
+    /*
+      staging buffer for data injected to the backends.  The main thread
+      appends assembled RTCM blocks here and the IO thread fans them out
+      to the backends so the UART writes are not paid in the main loop
+     */
+    struct {
+        uint8_t *buf;       // allocated on first injection
+        uint16_t len;       // number of staged bytes
+        HAL_Semaphore sem;
+        bool io_registered;
+    } _inject;
+
+    // fan staged injection data out to the backends. called from the IO thread
+    void inject_data_pending(void);
+
+    // write a packet of raw binary to the backends immediately
+    void inject_data_to_backends(const uint8_t *data, uint16_t len);
+
     // GPS blending and switching
     Vector3f _blended_antenna_offset; // blended antenna offset
     float _blended_lag_sec; // blended receiver lag in seconds
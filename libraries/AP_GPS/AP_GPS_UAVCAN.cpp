@@ -129,10 +129,23 @@ AP_GPS_UAVCAN* AP_GPS_UAVCAN::get_uavcan_backend(AP_UAVCAN* ap_uavcan, uint8_t n
         return nullptr;
     }
 
+    // check the slot that resolved the last message first; all callers
+    // hold the registry semaphore and consecutive messages almost always
+    // come from the same receiver. The keys are always re-checked so a
+    // stale index is simply a miss
+    static uint8_t last_hit;
+    if (last_hit < GPS_MAX_RECEIVERS &&
+        _detected_modules[last_hit].driver != nullptr &&
+        _detected_modules[last_hit].ap_uavcan == ap_uavcan &&
+        _detected_modules[last_hit].node_id == node_id) {
+        return _detected_modules[last_hit].driver;
+    }
+
     for (uint8_t i = 0; i < GPS_MAX_RECEIVERS; i++) {
         if (_detected_modules[i].driver != nullptr &&
-            _detected_modules[i].ap_uavcan == ap_uavcan && 
+            _detected_modules[i].ap_uavcan == ap_uavcan &&
             _detected_modules[i].node_id == node_id) {
+            last_hit = i;
             return _detected_modules[i].driver;
         }
     }
@@ -566,11 +566,26 @@ AP_GPS_UBLOX::read(void)
         }
     }
 
-    numc = port->available();
+    // scan the port's receive buffer in place where it supports zero-copy
+    // reads, avoiding a virtual read() call per byte
+    uint32_t pending_len;
+    const uint8_t *pending = port->read_peek(pending_len);
+    uint32_t consumed = 0;
+
+    if (pending != nullptr) {
+        numc = MIN(pending_len, (uint32_t)INT16_MAX);
+    } else {
+        numc = port->available();
+    }
     for (int16_t i = 0; i < numc; i++) {        // Process bytes received
 
         // read the next byte
-        data = port->read();
+        if (pending != nullptr) {
+            data = pending[i];
+            consumed++;
+        } else {
+            data = port->read();
+        }
 
 #if GPS_MOVING_BASELINE
         if (rtcm3_parser) {
@@ -694,6 +709,9 @@ AP_GPS_UBLOX::read(void)
             break;
         }
     }
+    if (pending != nullptr) {
+        port->read_consume(consumed);
+    }
     return parsed;
 }
 
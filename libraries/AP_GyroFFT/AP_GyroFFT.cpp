@@ -155,6 +155,14 @@ const AP_Param::GroupInfo AP_GyroFFT::var_info[] = {
     // @User: Advanced
     AP_GROUPINFO("HMNC_PEAK", 13, AP_GyroFFT, _harmonic_peak, 0),
 
+    // @Param: TRACK_DIV
+    // @DisplayName: FFT analysis cycles per full FFT
+    // @Description: Number of analysis cycles between full FFTs once the noise peaks have been identified. The intervening cycles re-estimate the tracked centre frequency with a much cheaper sliding DFT of the three bins around the tracked peak, reducing the steady-state CPU cost of the analysis while keeping the output rate. If the peak moves outside the tracked bin a full FFT is run immediately, so peak discovery is unaffected. A value of 0 or 1 runs a full FFT on every cycle.
+    // @Range: 0 8
+    // @User: Advanced
+    // @RebootRequired: True
+    AP_GROUPINFO("TRACK_DIV", 14, AP_GyroFFT, _track_div, 0),
+
     AP_GROUPEND
 };
 
@@ -244,8 +252,11 @@ void AP_GyroFFT::init(uint32_t target_looptime_us)
     }
 
     // make the gyro window match the window size plus a buffer to cope with the backend
-    // getting too far ahead.
-    if (!_ins->set_gyro_window_size(_window_size + _samples_per_frame)) {
+    // getting too far ahead. The INS windows are only read when sampling at
+    // the gyro rate; for loop-rate sampling the downsampled buffers above are
+    // used instead, so skip the allocation and the per-sample pushes at the
+    // gyro rate that would come with it
+    if (_sample_mode == 0 && !_ins->set_gyro_window_size(_window_size + _samples_per_frame)) {
         return;
     }
 
@@ -280,16 +291,32 @@ void AP_GyroFFT::init(uint32_t target_looptime_us)
         return;
     }
 
+    // scratch window for the sliding DFT tracker
+    if (_track_div > 1) {
+        _track_window = new float[_window_size];
+        if (_track_window == nullptr) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Failed to allocate window for AP_GyroFFT");
+            return;
+        }
+    }
+
     // per-axis frame time
     _frame_time_ms = _samples_per_frame * 1000 / _fft_sampling_rate_hz;
     // The update rate for the output, defaults are 1Khz / (1 - 0.5) * 32 == 62hz
     const float output_rate = _fft_sampling_rate_hz / _samples_per_frame;
-    // establish suitable defaults for the detected values
+    // establish suitable defaults for the detected values.  the hover
+    // frequency and bandwidth learned on the last flight are saved on
+    // disarm, so seed the estimator from them rather than FFT_MINHZ -
+    // repeated sorties then start with converged values instead of
+    // spending the first part of each flight re-converging
+    const float freq_seed = constrain_float(_freq_hover_hz, _fft_min_hz, _fft_max_hz);
+    const float bandwidth_seed = constrain_float(_bandwidth_hover_hz, 0, _fft_max_hz * 0.5f);
     for (uint8_t axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        _thread_state._center_freq_hz[axis] = _fft_min_hz;
+        _thread_state._center_freq_hz[axis] = freq_seed;
 
         for (uint8_t peak = 0; peak < FrequencyPeak::MAX_TRACKED_PEAKS; peak++) {
-            _thread_state._center_freq_hz_filtered[axis][peak] = _fft_min_hz;
+            _thread_state._center_freq_hz_filtered[axis][peak] = freq_seed;
+            _thread_state._center_bandwidth_hz_filtered[axis][peak] = bandwidth_seed;
         }
         // number of cycles to average over, two complete windows to be sure
         _noise_calibration_cycles[axis] = (_window_size / _samples_per_frame) * 2;
@@ -305,6 +332,12 @@ void AP_GyroFFT::init(uint32_t target_looptime_us)
         _center_freq_energy_filter[peak].set_cutoff_frequency(output_rate, output_rate * 0.25f);
         // smooth the bandwidth output more aggressively
         _center_bandwidth_filter[peak].set_cutoff_frequency(output_rate, output_rate * 0.25f);
+        // start the filters at the learned hover values so the first
+        // outputs do not slew up from zero
+        for (uint8_t axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            _center_freq_filter[peak].reset(axis, freq_seed);
+            _center_bandwidth_filter[peak].reset(axis, bandwidth_seed);
+        }
     }
 
     // the number of cycles required to have a proper noise reference
@@ -411,6 +444,22 @@ uint16_t AP_GyroFFT::run_cycle()
     if (gyro_buffer.available() > uint32_t(_state->_window_size + uint16_t(_samples_per_frame >> 1))) { // half the frame size is a heuristic
         gyro_buffer.advance(gyro_buffer.available() - _state->_window_size);
     }
+
+    // once the peaks have been identified most cycles only need to refresh the
+    // centre frequency estimate, which the sliding DFT can do at a fraction of
+    // the cost of a full FFT
+    if (run_sliding_dft(gyro_buffer, config)) {
+        gyro_buffer.advance(_samples_per_frame);
+
+        _thread_state._last_output_us[_update_axis] = AP_HAL::micros();
+        _output_cycle_micros = _thread_state._last_output_us[_update_axis] - now;
+
+        _update_axis = (_update_axis + 1) % XYZ_AXIS_COUNT;
+        _thread_state._analysis_started = false;
+
+        return get_available_samples(_update_axis);
+    }
+
     // let's go!
     hal.dsp->fft_start(_state, gyro_buffer, _samples_per_frame);
 
@@ -437,6 +486,83 @@ uint16_t AP_GyroFFT::run_cycle()
     return get_available_samples(_update_axis);
 }
 
+// refine the tracked centre frequency using a sliding DFT of the three bins
+// around the tracked peak instead of a full FFT. returns true if the estimate
+// was updated and the full FFT can be skipped this cycle
+// called from FFT thread
+bool AP_GyroFFT::run_sliding_dft(FloatBuffer& gyro_buffer, const EngineConfig& config)
+{
+    if (_track_div <= 1 || _track_window == nullptr) {
+        return false;
+    }
+    // noise calibration, the self-test and peak discovery all need the full spectrum
+    if (_thread_state._noise_needs_calibration || !_calibrated || _thread_state._health == 0) {
+        _track_cycles[_update_axis] = 0;
+        return false;
+    }
+    // run a full FFT every _track_div cycles so that new peaks can still be discovered
+    if (_track_cycles[_update_axis] >= uint8_t(_track_div) - 1) {
+        _track_cycles[_update_axis] = 0;
+        return false;
+    }
+    // interpolation needs both neighbours inside the detection window
+    const uint16_t bin = _thread_state._center_freq_bin[_update_axis];
+    if (bin <= config._fft_start_bin || bin >= config._fft_end_bin) {
+        return false;
+    }
+    const uint16_t n = _state->_window_size;
+    if (gyro_buffer.peek(_track_window, n) < n) {
+        return false;
+    }
+    // apply the same hanning window as the FFT so that leakage into the
+    // neighbouring bins matches the full analysis
+    for (uint16_t i = 0; i < n; i++) {
+        _track_window[i] *= _state->_hanning_window[i];
+    }
+
+    float energy[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        energy[i] = goertzel_energy(bin - 1 + i);
+    }
+    // if the peak has moved off the tracked bin fall back to a full FFT immediately
+    if (energy[1] < energy[0] || energy[1] < energy[2]) {
+        _track_cycles[_update_axis] = 0;
+        return false;
+    }
+    // parabolic interpolation of the true peak between bins
+    const float denom = energy[0] - 2.0f * energy[1] + energy[2];
+    float bin_fraction = 0.0f;
+    if (!is_zero(denom)) {
+        bin_fraction = constrain_float(0.5f * (energy[0] - energy[2]) / denom, -0.5f, 0.5f);
+    }
+    const float freq = constrain_float((bin + bin_fraction) * _state->_bin_resolution, config._fft_min_hz, config._fft_max_hz);
+
+    _thread_state._center_freq_hz[_update_axis] = freq;
+    update_tl_noise_center_freq_hz(FrequencyPeak::CENTER, _update_axis, freq);
+    // the shape check above confirmed the peak is still present, so the axis stays healthy
+    _thread_state._health_ms[_update_axis] = AP_HAL::millis();
+    _track_cycles[_update_axis]++;
+
+    return true;
+}
+
+// energy of a single frequency bin over the windowed scratch buffer using the
+// Goertzel recurrence. the absolute scale differs from the FFT output, but the
+// tracker only ever compares these values against each other
+// called from FFT thread
+float AP_GyroFFT::goertzel_energy(uint16_t bin) const
+{
+    const uint16_t n = _state->_window_size;
+    const float coeff = 2.0f * cosf(M_2PI * bin / n);
+    float s1 = 0.0f, s2 = 0.0f;
+    for (uint16_t i = 0; i < n; i++) {
+        const float s0 = _track_window[i] + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    return s1 * s1 + s2 * s2 - coeff * s1 * s2;
+}
+
 // whether analysis can be run again or not
 // called from FFT thread with the semaphore held
 bool AP_GyroFFT::start_analysis() {
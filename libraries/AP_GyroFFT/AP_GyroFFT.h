@@ -133,6 +133,8 @@ private:
 
         float apply(uint8_t axis, float sample);
         float get(uint8_t axis) const { return _lowpass_filter[axis].get(); }
+        // seed the filter output, for instance from a learned value
+        void reset(uint8_t axis, float value) { _lowpass_filter[axis].reset(value); }
 
         void set_cutoff_frequency(float sample_freq, float cutoff_freq) {
             for (uint8_t i = 0; i < XYZ_AXIS_COUNT; i++) {
@@ -203,6 +205,10 @@ private:
     bool analysis_enabled() const { return _initialized && _analysis_enabled && _thread_created; };
     // whether analysis can be run again or not
     bool start_analysis();
+    // refine the tracked center frequency using a sliding 3-bin DFT, returns true if the full FFT can be skipped
+    bool run_sliding_dft(FloatBuffer& gyro_buffer, const EngineConfig& config);
+    // energy of a single frequency bin over the windowed scratch buffer
+    float goertzel_energy(uint16_t bin) const;
     // return samples available in the gyro window
     uint16_t get_available_samples(uint8_t axis) {
         return _sample_mode == 0 ?_ins->get_raw_gyro_window(axis).available() : _downsampled_gyro_data[axis].available();
@@ -269,6 +275,10 @@ private:
     uint8_t _update_axis;
     // noise base of the gyros
     Vector3f* _ref_energy;
+    // scratch copy of the latest gyro window for the sliding DFT tracker
+    float* _track_window;
+    // analysis cycles run on each axis since the last full FFT
+    uint8_t _track_cycles[XYZ_AXIS_COUNT];
     // the number of cycles required to have a proper noise reference
     uint16_t _noise_cycles;
     // number of cycles over which to generate noise ensemble averages
@@ -334,6 +344,8 @@ private:
     AP_Int8 _harmonic_fit;
     // harmonic peak target
     AP_Int8 _harmonic_peak;
+    // number of analysis cycles between full FFTs when tracking with the sliding DFT
+    AP_Int8 _track_div;
     AP_InertialSensor* _ins;
 #if DEBUG_FFT
     uint32_t _last_output_ms;
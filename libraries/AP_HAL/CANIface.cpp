@@ -17,6 +17,8 @@
 
 #include "CANIface.h"
 
+AP_HAL::CANIface::FrameCapture AP_HAL::CANIface::_frame_cb;
+
 bool AP_HAL::CANFrame::priorityHigherThan(const CANFrame& rhs) const
 {
     const uint32_t clean_id     = id     & MaskExtID;
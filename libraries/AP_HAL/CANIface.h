@@ -208,7 +208,29 @@ public:
 
     // return true if init was called and successful
     virtual bool is_initialized() const = 0;
+
+    /*
+      hook for capturing received frames for bus logging. The callback
+      runs in the thread calling receive() once per popped frame, with
+      the hardware FIFO timestamp preserved in the item, and must not
+      block
+     */
+    typedef void (*FrameCapture)(uint8_t bus, const CanRxItem &item);
+    static void set_frame_capture(FrameCapture cb) {
+        _frame_cb = cb;
+    }
+
 protected:
     uint32_t bitrate_;
     OperatingMode mode_;
+
+    // called by backends when a received frame is handed to a driver
+    void capture_frame(uint8_t bus, const CanRxItem &item) const {
+        if (_frame_cb != nullptr) {
+            _frame_cb(bus, item);
+        }
+    }
+
+private:
+    static FrameCapture _frame_cb;
 };
@@ -17,6 +17,9 @@
 
 #include <stdio.h>
 
+// global raw bus transaction capture callback, shared by all devices
+AP_HAL::Device::TransferCapture AP_HAL::Device::_capture_cb;
+
 /*
   using checked registers allows a device check that a set of critical
   register values don't change at runtime. This is useful on key
@@ -356,9 +356,35 @@ public:
     /* set number of retries on transfers */
     virtual void set_retries(uint8_t retries) {};
 
+    /*
+     * optional capture of raw bus transactions for offline driver
+     * debugging. The callback is global to all devices and is invoked
+     * from the bus thread that performed the transfer, so it must be
+     * thread-safe and must not block
+     */
+    typedef void (*TransferCapture)(const Device &dev,
+                                    const uint8_t *send, uint32_t send_len,
+                                    const uint8_t *recv, uint32_t recv_len);
+
+    // set the transaction capture callback for all devices
+    static void set_transfer_capture(TransferCapture cb) {
+        _capture_cb = cb;
+    }
+
 protected:
     uint8_t _read_flag = 0;
 
+    // called by bus implementations after a successful transfer to
+    // pass the raw transaction to any registered capture callback
+    void capture_transfer(const uint8_t *send, uint32_t send_len,
+                          const uint8_t *recv, uint32_t recv_len) const {
+        if (_capture_cb != nullptr) {
+            _capture_cb(*this, send, send_len, recv, recv_len);
+        }
+    }
+
+    static TransferCapture _capture_cb;
+
     /*
       broken out device elements. The bitfields are used to keep
       the overall value small enough to fit in a float accurately,
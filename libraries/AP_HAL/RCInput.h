@@ -35,6 +35,13 @@ public:
     /* get receiver based RSSI if available. -1 for unknown, 0 for no link, 255 for maximum link */
     virtual int16_t get_rssi(void) { return -1; }
 
+    /**
+     * Microsecond timestamp taken when the last RC frame completed
+     * decoding, or 0 if no frame has been received. Allows callers to
+     * measure the age of the current input
+     */
+    virtual uint32_t last_input_us(void) { return 0; }
+
     /* Return string describing method RC input protocol */
     virtual const char *protocol() const = 0;
 
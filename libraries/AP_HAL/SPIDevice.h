@@ -45,6 +45,17 @@ public:
     virtual bool transfer_fullduplex(const uint8_t *send, uint8_t *recv,
                                      uint32_t len) = 0;
 
+    /*
+     * Like #transfer_fullduplex() but the same caller-owned buffer is
+     * used for send and receive. The buffer must be DMA-safe
+     * (allocated with AP_HAL::Util::MEM_DMA_SAFE), which allows
+     * implementations to DMA directly into it with no bounce copy.
+     * Used by high-rate FIFO drains such as the Invensense drivers
+     */
+    virtual bool transfer_fullduplex(uint8_t *send_recv, uint32_t len) {
+        return transfer_fullduplex(send_recv, send_recv, len);
+    }
+
     /* 
      *  send N bytes of clock pulses without taking CS. This is used
      *  when initialising microSD interfaces over SPI
@@ -1,7 +1,62 @@
 #include "AP_HAL.h"
+#if HAL_SEMAPHORE_TRACE_ENABLED
+#include <AP_Common/ExpandingString.h>
+#include <string.h>
+#endif
 
 extern const AP_HAL::HAL &hal;
 
+#if HAL_SEMAPHORE_TRACE_ENABLED
+/*
+  per-call-site lock statistics. A call site is identified by the
+  __FILE__/__LINE__ pair from the WITH_SEMAPHORE() expansion; the file
+  name is a string literal so pointer comparison is sufficient. The
+  counters are updated without locking - under concurrent updates they
+  are approximate, which is fine for finding contention hot spots
+ */
+struct lock_trace {
+    const char *file;
+    uint16_t line;
+    uint32_t count;
+    uint32_t contended;
+    uint64_t wait_us;
+    uint64_t held_us;
+    uint32_t wait_max_us;
+    uint32_t held_max_us;
+};
+
+#ifndef HAL_SEMAPHORE_TRACE_SLOTS
+#define HAL_SEMAPHORE_TRACE_SLOTS 64
+#endif
+
+static lock_trace lock_traces[HAL_SEMAPHORE_TRACE_SLOTS];
+
+/*
+  find or claim the record for a call site. Slots are claimed with an
+  atomic exchange so two threads hitting new call sites concurrently
+  cannot share a slot; a call site that loses every slot race simply
+  goes untraced
+ */
+static lock_trace *lock_trace_find(const char *file, uint16_t line)
+{
+    for (uint8_t i=0; i<HAL_SEMAPHORE_TRACE_SLOTS; i++) {
+        lock_trace &t = lock_traces[i];
+        if (t.file == file && t.line == line) {
+            return &t;
+        }
+        if (t.file == nullptr) {
+            const char *expected = nullptr;
+            if (__atomic_compare_exchange_n(&t.file, &expected, file, false,
+                                            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+                t.line = line;
+                return &t;
+            }
+        }
+    }
+    return nullptr;
+}
+#endif // HAL_SEMAPHORE_TRACE_ENABLED
+
 /*
   implement WithSemaphore class for WITH_SEMAPHORE() support
  */
@@ -12,6 +67,10 @@ WithSemaphore::WithSemaphore(AP_HAL::Semaphore *mtx, uint32_t line) :
 WithSemaphore::WithSemaphore(AP_HAL::Semaphore &mtx, uint32_t line) :
     _mtx(mtx)
 {
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    _rec = nullptr;
+    _take_us = AP_HAL::micros();
+#endif
     bool in_main = hal.scheduler->in_main_thread();
     if (in_main) {
         hal.util->persistent_data.semaphore_line = line;
@@ -22,7 +81,79 @@ WithSemaphore::WithSemaphore(AP_HAL::Semaphore &mtx, uint32_t line) :
     }
 }
 
+#if HAL_SEMAPHORE_TRACE_ENABLED
+WithSemaphore::WithSemaphore(AP_HAL::Semaphore *mtx, uint32_t line, const char *file) :
+    WithSemaphore(*mtx, line, file)
+{}
+
+WithSemaphore::WithSemaphore(AP_HAL::Semaphore &mtx, uint32_t line, const char *file) :
+    _mtx(mtx)
+{
+    bool in_main = hal.scheduler->in_main_thread();
+    if (in_main) {
+        hal.util->persistent_data.semaphore_line = line;
+    }
+    _rec = lock_trace_find(file, line);
+    const uint32_t start_us = AP_HAL::micros();
+    if (!_mtx.take_nonblocking()) {
+        // the uncontended path above keeps the trace overhead off the
+        // common case; only a failed non-blocking take counts as
+        // contention
+        _mtx.take_blocking();
+        if (_rec != nullptr) {
+            _rec->contended++;
+        }
+    }
+    _take_us = AP_HAL::micros();
+    if (_rec != nullptr) {
+        const uint32_t wait = _take_us - start_us;
+        _rec->count++;
+        _rec->wait_us += wait;
+        if (wait > _rec->wait_max_us) {
+            _rec->wait_max_us = wait;
+        }
+    }
+    if (in_main) {
+        hal.util->persistent_data.semaphore_line = 0;
+    }
+}
+
+void WithSemaphore::lock_info(ExpandingString &str)
+{
+    str.printf("LockTrace v1\n%-32s %8s %8s %10s %8s %10s %8s\n",
+               "CALLSITE", "COUNT", "CONTEND", "WAIT_US", "WMAX_US", "HELD_US", "HMAX_US");
+    for (uint8_t i=0; i<HAL_SEMAPHORE_TRACE_SLOTS; i++) {
+        const lock_trace &t = lock_traces[i];
+        if (t.file == nullptr) {
+            continue;
+        }
+        // strip the build tree prefix from the file name
+        const char *base = strrchr(t.file, '/');
+        base = (base != nullptr) ? base+1 : t.file;
+        char callsite[40];
+        hal.util->snprintf(callsite, sizeof(callsite), "%s:%u", base, unsigned(t.line));
+        str.printf("%-32s %8u %8u %10u %8u %10u %8u\n",
+                   callsite,
+                   unsigned(t.count),
+                   unsigned(t.contended),
+                   unsigned(t.wait_us),
+                   unsigned(t.wait_max_us),
+                   unsigned(t.held_us),
+                   unsigned(t.held_max_us));
+    }
+}
+#endif // HAL_SEMAPHORE_TRACE_ENABLED
+
 WithSemaphore::~WithSemaphore()
 {
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    if (_rec != nullptr) {
+        const uint32_t held = AP_HAL::micros() - _take_us;
+        _rec->held_us += held;
+        if (held > _rec->held_max_us) {
+            _rec->held_max_us = held;
+        }
+    }
+#endif
     _mtx.give();
 }
@@ -6,6 +6,14 @@
 
 #define HAL_SEMAPHORE_BLOCK_FOREVER 0
 
+// opt-in lock contention tracing. When enabled each WITH_SEMAPHORE()
+// call site records take count, contention count, wait time and held
+// time, readable at @SYS/locks.txt. Define to 1 in hwdef.dat or with
+// --extra-hwdef to enable; costs a table walk on every lock take
+#ifndef HAL_SEMAPHORE_TRACE_ENABLED
+#define HAL_SEMAPHORE_TRACE_ENABLED 0
+#endif
+
 class AP_HAL::Semaphore {
 public:
 
@@ -41,17 +49,36 @@ public:
   The WITH_SEMAPHORE() macro can be used with either type of semaphore
  */
 
+#if HAL_SEMAPHORE_TRACE_ENABLED
+struct lock_trace;
+#endif
+
 class WithSemaphore {
 public:
     WithSemaphore(AP_HAL::Semaphore *mtx, uint32_t line);
     WithSemaphore(AP_HAL::Semaphore &mtx, uint32_t line);
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    WithSemaphore(AP_HAL::Semaphore *mtx, uint32_t line, const char *file);
+    WithSemaphore(AP_HAL::Semaphore &mtx, uint32_t line, const char *file);
+
+    // dump per-call-site lock statistics for @SYS/locks.txt
+    static void lock_info(class ExpandingString &str);
+#endif
 
     ~WithSemaphore();
 private:
     AP_HAL::Semaphore &_mtx;
+#if HAL_SEMAPHORE_TRACE_ENABLED
+    lock_trace *_rec;
+    uint32_t _take_us;
+#endif
 };
 
 // From: https://stackoverflow.com/questions/19666142/why-is-a-level-of-indirection-needed-for-this-concatenation-macro
 #define WITH_SEMAPHORE( sem ) JOIN( sem, __LINE__, __COUNTER__ )
 #define JOIN( sem, line, counter ) _DO_JOIN( sem, line, counter )
+#if HAL_SEMAPHORE_TRACE_ENABLED
+#define _DO_JOIN( sem, line, counter ) WithSemaphore _getsem ## counter(sem, line, __FILE__)
+#else
 #define _DO_JOIN( sem, line, counter ) WithSemaphore _getsem ## counter(sem, line)
+#endif
@@ -51,7 +51,42 @@ public:
 
     // read from a locked port. If port is locked and key is not correct then 0 is returned
     virtual int16_t read_locked(uint32_t key) { return -1; }
-    
+
+    // zero-copy receive: return a pointer to the longest contiguous block
+    // of received bytes without copying or consuming them, setting len to
+    // the block length. Protocol parsers can scan the block in place and
+    // then discard whole frames with read_consume(). Ports without a
+    // buffered receiver return nullptr
+    virtual const uint8_t *read_peek(uint32_t &len) {
+        len = 0;
+        return nullptr;
+    }
+
+    // discard bytes previously returned by read_peek()
+    virtual bool read_consume(uint32_t n) { return false; }
+
+    // vector of bytes for gather writes
+    struct IoVec {
+        const uint8_t *data;
+        uint16_t len;
+    };
+
+    // gather write - write a set of byte vectors as one contiguous block.
+    // This default simply loops over write(); ports may override to pay
+    // for locking once per call rather than once per vector
+    virtual size_t writev(const IoVec *vec, uint8_t count) {
+        size_t ret = 0;
+        for (uint8_t i=0; i<count; i++) {
+            const size_t n = write(vec[i].data, vec[i].len);
+            ret += n;
+            if (n < vec[i].len) {
+                break;
+            }
+        }
+        return ret;
+    }
+
+
     // control optional features
     virtual bool set_options(uint16_t options) { return options==0; }
     virtual uint8_t get_options(void) const { return 0; }
@@ -68,6 +103,7 @@ public:
         OPTION_NODMA_RX           = (1U<<8), // don't use DMA for RX
         OPTION_NODMA_TX           = (1U<<9), // don't use DMA for TX
         OPTION_MAVLINK_NO_FORWARD = (1U<<10), // don't forward MAVLink data to or from this device
+        OPTION_LOWPOWER_IDLE      = (1U<<11), // reduce processing rate while the link is idle
     };
 
     enum flow_control {
@@ -80,6 +80,9 @@ public:
         int8_t scheduler_task;
         bool armed; // true if vehicle was armed
         enum safety_state safety_state;
+        // EKF primary lane + 1, 0 if unknown. Fits in what was a
+        // padding byte, the structure is at the 76 byte limit
+        uint8_t ekf_primary_core;
     };
     struct PersistentData persistent_data;
     // last_persistent_data is only filled in if we've suffered a watchdog reset
@@ -110,6 +113,10 @@ public:
     // overwrite bootloader (probably with one from ROMFS)
     virtual FlashBootloader flash_bootloader() { return FlashBootloader::NOT_AVAILABLE; }
 
+    // on dual-bank MCUs, arm a swap of the active and inactive flash
+    // banks for the next reset. Returns false if not supported
+    virtual bool flash_swap_banks() { return false; }
+
     /*
       get system identifier (eg. serial number)
       return false if a system identifier is not available
@@ -159,7 +166,10 @@ public:
     // allocate and free DMA-capable memory if possible. Otherwise return normal memory
     enum Memory_Type {
         MEM_DMA_SAFE,
-        MEM_FAST
+        MEM_FAST,
+        // never-freed boot-time allocations, packed into an arena so
+        // permanent state does not fragment the general heap
+        MEM_PERMANENT
     };
     virtual void *malloc_type(size_t size, Memory_Type mem_type) { return calloc(1, size); }
     virtual void free_type(void *ptr, size_t size, Memory_Type mem_type) { return free(ptr); }
@@ -190,9 +200,21 @@ public:
     // request information on dma contention
     virtual void dma_info(ExpandingString &str) {}
 
+    // request information on memory allocation
+    virtual void mem_info(ExpandingString &str) {}
+
+    // request a snapshot of the sampled PC profile, starting the
+    // sampler on first use. The data is a raw array of 32 bit program
+    // counter values for offline symbolization
+    virtual void profile_info(ExpandingString &str) {}
+
     // load persistent parameters from bootloader sector
     virtual bool load_persistent_params(ExpandingString &str) const { return false; }
 
+    // retrieve the crash dump saved by the fault handlers of a
+    // previous boot, if the platform keeps one
+    virtual void crash_dump(ExpandingString &str) {}
+
 protected:
     // we start soft_armed false, so that actuators don't send any
     // values until the vehicle code has fully started
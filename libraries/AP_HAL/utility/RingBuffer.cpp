@@ -257,6 +257,178 @@ const uint8_t *ByteBuffer::readptr(uint32_t &available_bytes)
     return available_bytes ? &buf[head] : nullptr;
 }
 
+MPSCByteBuffer::MPSCByteBuffer(uint32_t _size)
+{
+    buf = (uint8_t*)calloc(1, _size);
+    size = buf ? _size : 0;
+}
+
+MPSCByteBuffer::~MPSCByteBuffer(void)
+{
+    free(buf);
+}
+
+/*
+ * Caller is responsible for locking in set_size()
+ */
+bool MPSCByteBuffer::set_size(uint32_t _size)
+{
+    head = committed = 0;
+    claim_state = 0;
+    publish_tail = 0;
+    for (uint8_t i = 0; i < claim_records; i++) {
+        records[i].end = 0;
+        records[i].seq = 0;
+    }
+    if (_size != size) {
+        free(buf);
+        buf = (uint8_t*)calloc(1, _size);
+        if (!buf) {
+            size = 0;
+            return false;
+        }
+        size = _size;
+    }
+    return true;
+}
+
+uint32_t MPSCByteBuffer::available(void) const
+{
+    return committed.load(std::memory_order_acquire) - head.load(std::memory_order_relaxed);
+}
+
+uint32_t MPSCByteBuffer::space(void) const
+{
+    if (size == 0) {
+        return 0;
+    }
+    const uint32_t reserved = uint32_t(claim_state.load(std::memory_order_relaxed));
+    return size - (reserved - head.load(std::memory_order_relaxed));
+}
+
+bool MPSCByteBuffer::is_empty(void) const
+{
+    return available() == 0;
+}
+
+void MPSCByteBuffer::clear(void)
+{
+    // drop all published data. Space claimed but not yet published by
+    // a writer mid-copy will still be published afterwards, which is
+    // harmless
+    head.store(committed.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+uint32_t MPSCByteBuffer::write(const uint8_t *data, uint32_t len)
+{
+    if (len == 0 || len > size) {
+        return 0;
+    }
+
+    // atomically claim a region of the buffer and a publish record.
+    // The claim can race with other writers, so retry the
+    // compare-exchange until it wins or there is not enough space or
+    // no free record left
+    uint64_t state = claim_state.load(std::memory_order_relaxed);
+    uint32_t start, ordinal;
+    do {
+        start = uint32_t(state);
+        ordinal = uint32_t(state >> 32);
+        if (size - (start - head.load(std::memory_order_acquire)) < len) {
+            return 0;
+        }
+        if (ordinal - publish_tail.load(std::memory_order_acquire) >= claim_records) {
+            // every record is held by a writer still mid-copy; drop
+            // the block rather than wait on another thread
+            return 0;
+        }
+    } while (!claim_state.compare_exchange_weak(state,
+                                                (uint64_t(ordinal + 1) << 32) | uint32_t(start + len),
+                                                std::memory_order_acquire));
+
+    // copy into the claimed region, in two parts if it wraps
+    const uint32_t ofs = start % size;
+    uint32_t n = size - ofs;
+    if (n > len) {
+        n = len;
+    }
+    memcpy(&buf[ofs], data, n);
+    if (len > n) {
+        memcpy(&buf[0], &data[n], len - n);
+    }
+
+    // mark our claim complete
+    claim_rec &rec = records[ordinal % claim_records];
+    rec.end.store(start + len, std::memory_order_relaxed);
+    rec.seq.store(ordinal + 1, std::memory_order_release);
+
+    /*
+      fold completed claims into committed, in claim order. Whichever
+      writer wins the tail compare-exchange publishes that record, so
+      nobody waits on another writer: a lower priority writer
+      preempted mid-copy cannot block this thread, and its block is
+      published by whichever writer completes after it
+     */
+    uint32_t tail = publish_tail.load(std::memory_order_acquire);
+    while (records[tail % claim_records].seq.load(std::memory_order_acquire) == tail + 1) {
+        const uint32_t end = records[tail % claim_records].end.load(std::memory_order_relaxed);
+        if (publish_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel)) {
+            // advance committed to at least end, never backwards. Two
+            // folding writers can race, so this is a monotonic max
+            uint32_t cur = committed.load(std::memory_order_relaxed);
+            while (int32_t(end - cur) > 0 &&
+                   !committed.compare_exchange_weak(cur, end, std::memory_order_release)) {
+            }
+            tail++;
+        }
+        // on a lost race compare_exchange reloads tail for the next pass
+    }
+    return len;
+}
+
+bool MPSCByteBuffer::advance(uint32_t n)
+{
+    if (n > available()) {
+        return false;
+    }
+    head.fetch_add(n, std::memory_order_release);
+    return true;
+}
+
+/*
+  read len bytes without advancing the read pointer
+ */
+uint32_t MPSCByteBuffer::peekbytes(uint8_t *data, uint32_t len)
+{
+    const uint32_t avail = available();
+    if (len > avail) {
+        len = avail;
+    }
+    const uint32_t ofs = head.load(std::memory_order_relaxed) % size;
+    uint32_t n = size - ofs;
+    if (n > len) {
+        n = len;
+    }
+    memcpy(data, &buf[ofs], n);
+    if (len > n) {
+        memcpy(&data[n], &buf[0], len - n);
+    }
+    return len;
+}
+
+/*
+ * Returns the pointer and size to a contiguous read in the buffer
+ */
+const uint8_t *MPSCByteBuffer::readptr(uint32_t &available_bytes)
+{
+    const uint32_t _head = head.load(std::memory_order_relaxed);
+    const uint32_t n = committed.load(std::memory_order_acquire) - _head;
+    const uint32_t ofs = _head % size;
+    available_bytes = (n < size - ofs) ? n : size - ofs;
+
+    return available_bytes ? &buf[ofs] : nullptr;
+}
+
 int16_t ByteBuffer::peek(uint32_t ofs) const
 {
     if (ofs >= available()) {
@@ -101,6 +101,85 @@ private:
     bool external_buf;
 };
 
+/*
+ * Circular buffer of bytes with multiple concurrent writers and a
+ * single reader. Writers claim space with an atomic compare-exchange
+ * and the claims are folded into the published region in claim order
+ * by whichever writer completes, so no writer ever waits on another -
+ * a writer preempted mid-copy cannot block a higher priority one.
+ * Writes are all-or-nothing. Unlike ByteBuffer the indexes are
+ * free-running, so the full buffer size is usable; size must be below
+ * 2^31
+ */
+class MPSCByteBuffer {
+public:
+    MPSCByteBuffer(uint32_t size);
+    ~MPSCByteBuffer(void);
+
+    /* Do not allow copies */
+    MPSCByteBuffer(const MPSCByteBuffer &other) = delete;
+    MPSCByteBuffer &operator=(const MPSCByteBuffer&) = delete;
+
+    // number of published bytes available to be read
+    uint32_t available(void) const;
+
+    // number of bytes of space available to claim
+    uint32_t space(void) const;
+
+    // true if available() is zero
+    bool is_empty(void) const WARN_IF_UNUSED;
+
+    // discards the buffer content, emptying it. Reader side only
+    void clear(void);
+
+    // write len bytes to the ringbuffer. All-or-nothing: returns len
+    // on success or 0 if there is not enough space. Safe to call
+    // concurrently from multiple threads
+    uint32_t write(const uint8_t *data, uint32_t len);
+
+    // returns the pointer and size to a contiguous read of the next
+    // available published data. Reader side only
+    const uint8_t *readptr(uint32_t &available_bytes);
+
+    // read len bytes without advancing the read pointer. Reader side
+    // only. Returns the number of bytes copied
+    uint32_t peekbytes(uint8_t *data, uint32_t len);
+
+    // advance the read pointer (discarding bytes). Reader side only
+    bool advance(uint32_t n);
+
+    // return size of ringbuffer
+    uint32_t get_size(void) const { return size; }
+
+    // set size of ringbuffer, caller responsible for locking
+    bool set_size(uint32_t size);
+
+private:
+    uint8_t *buf;
+    uint32_t size;
+
+    std::atomic<uint32_t> head{0};      // where to read data
+    std::atomic<uint32_t> committed{0}; // end of published data
+
+    /*
+      claim state packs the claim ordinal (high 32 bits) and the end
+      of claimed space (low 32 bits) so one compare-exchange claims
+      both and the publish records are in the same order as the
+      claimed space
+     */
+    std::atomic<uint64_t> claim_state{0};
+
+    // ring of claims not yet folded into committed. A slot is done
+    // when seq holds the claim ordinal plus one
+    static const uint8_t claim_records = 8;
+    struct claim_rec {
+        std::atomic<uint32_t> end{0};
+        std::atomic<uint32_t> seq{0};
+    };
+    claim_rec records[claim_records];
+    std::atomic<uint32_t> publish_tail{0}; // ordinal of the next record to fold
+};
+
 /*
   ring buffer class for objects of fixed size
   !!! Note ObjectBuffer_TS is a duplicate of this update, in both places !!!
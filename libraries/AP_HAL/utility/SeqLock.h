@@ -0,0 +1,68 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+/*
+  single-writer sequence lock for handing small structures from a
+  high-rate producer thread to consumers that must never block the
+  producer. The writer is wait-free; a reader retries if it observes a
+  torn update. Suitable for publishing sensor samples from bus threads
+  to the main loop without taking a semaphore in either thread.
+ */
+template <typename T>
+class SeqLock {
+public:
+    // publish a new value. Only a single thread may call write()
+    void write(const T &v) {
+        // the acquire/release pair on the sequence counter brackets
+        // the non-atomic copy so readers can detect a torn read
+        _seq.fetch_add(1, std::memory_order_acquire);
+        _value = v;
+        _seq.fetch_add(1, std::memory_order_release);
+    }
+
+    // read the latest value, retrying if the writer is mid-update.
+    // Returns the sequence number of the value read, which is zero if
+    // write() has never completed and otherwise increases with each
+    // write, allowing callers to detect new data
+    uint32_t read(T &v) const {
+        uint32_t seq1, seq2;
+        do {
+            seq1 = _seq.load(std::memory_order_acquire);
+            if (seq1 & 1U) {
+                // writer mid-update; it never blocks, so just retry
+                continue;
+            }
+            v = _value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq2 = _seq.load(std::memory_order_relaxed);
+        } while (seq1 != seq2);
+        return seq1;
+    }
+
+    // current sequence number without copying the value. Lets a
+    // high-rate reader skip the copy in read() when nothing has
+    // changed since the sequence it last consumed
+    uint32_t sequence(void) const {
+        return _seq.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+    T _value{};
+};
@@ -72,6 +72,24 @@ uint32_t AnalogIn::sample_count;
 AnalogSource::AnalogSource(int16_t pin) :
     _pin(pin)
 {
+    _update_pin_info();
+}
+
+/*
+  cache the pin_config entry for the current pin so the per-tick
+  sample matching and the voltage scaling don't re-scan the table
+ */
+void AnalogSource::_update_pin_info(void)
+{
+    _config_index = -1;
+    _scaler = VOLTAGE_SCALING;
+    for (uint8_t i=0; i<ADC_GRP1_NUM_CHANNELS; i++) {
+        if (AnalogIn::pin_config[i].channel == _pin) {
+            _config_index = i;
+            _scaler = AnalogIn::pin_config[i].scaling;
+            break;
+        }
+    }
 }
 
 
@@ -101,14 +119,7 @@ float AnalogSource::read_latest()
  */
 float AnalogSource::_pin_scaler(void)
 {
-    float scaling = VOLTAGE_SCALING;
-    for (uint8_t i=0; i<ADC_GRP1_NUM_CHANNELS; i++) {
-        if (AnalogIn::pin_config[i].channel == _pin) {
-            scaling = AnalogIn::pin_config[i].scaling;
-            break;
-        }
-    }
-    return scaling;
+    return _scaler;
 }
 
 /*
@@ -144,6 +155,7 @@ void AnalogSource::set_pin(uint8_t pin)
     }
     WITH_SEMAPHORE(_semaphore);
     _pin = pin;
+    _update_pin_info();
     _sum_value = 0;
     _sum_ratiometric = 0;
     _sum_count = 0;
@@ -311,16 +323,21 @@ void AnalogIn::_timer_tick(void)
         Debug("chan %u value=%u\n",
               (unsigned)pin_config[i].channel,
               (unsigned)buf_adc[i]);
-        for (uint8_t j=0; j < ANALOG_MAX_CHANNELS; j++) {
-            ChibiOS::AnalogSource *c = _channels[j];
-            if (c != nullptr) {
-                if (pin_config[i].channel == c->_pin) {
-                    // add a value
-                    c->_add_value(buf_adc[i], _board_voltage);
-                } else if (c->_pin == ANALOG_SERVO_VRSSI_PIN) {
-                    c->_add_value(_rssi_voltage / VOLTAGE_SCALING, 0);
-                }
-            }
+    }
+
+    // hand this scan's samples to the active sources using their
+    // cached pin_config index, so every consumer sees values from the
+    // same conversion batch
+    for (uint8_t j=0; j < ANALOG_MAX_CHANNELS; j++) {
+        ChibiOS::AnalogSource *c = _channels[j];
+        if (c == nullptr) {
+            continue;
+        }
+        if (c->_pin == ANALOG_SERVO_VRSSI_PIN) {
+            c->_add_value(_rssi_voltage / VOLTAGE_SCALING, 0);
+        } else if (c->_config_index >= 0) {
+            // add a value
+            c->_add_value(buf_adc[c->_config_index], _board_voltage);
         }
     }
 
@@ -46,8 +46,11 @@ private:
     uint8_t _sum_count;
     float _sum_value;
     float _sum_ratiometric;
+    int8_t _config_index;  // index of _pin in AnalogIn::pin_config, -1 if not an ADC pin
+    float _scaler;         // cached scaling from ADC count to volts for _pin
     void _add_value(float v, float vcc5V);
     float _pin_scaler();
+    void _update_pin_info();
     HAL_Semaphore _semaphore;
 };
 
@@ -344,14 +344,19 @@ int16_t CANIface::send(const AP_HAL::CANFrame& frame, uint64_t tx_deadline,
 
 int16_t CANIface::receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_us, CanIOFlags& out_flags)
 {
-    CriticalSectionLocker lock;
     CanRxItem rx_item;
-    if (!rx_queue_.pop(rx_item) || !initialised_) {
-        return 0;
+    {
+        CriticalSectionLocker lock;
+        if (!rx_queue_.pop(rx_item) || !initialised_) {
+            return 0;
+        }
     }
     out_frame    = rx_item.frame;
     out_timestamp_us = rx_item.timestamp_us;
     out_flags    = rx_item.flags;
+    // capture outside the critical section, keeping the hardware FIFO
+    // timestamp from the rx interrupt
+    capture_frame(self_index_, rx_item);
     return 1;
 }
 
@@ -0,0 +1,57 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <AP_HAL/AP_HAL.h>
+
+/*
+  crash dump to a reserved flash page. A board enables this by
+  defining HAL_CRASH_DUMP_FLASHPAGE in its hwdef to a flash page that
+  is not used for firmware or storage. The fault handlers write the
+  dump directly with the low level flash driver, bypassing the
+  filesystem, and it is extracted after reboot as @SYS/crash_dump.bin
+ */
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+
+#define CRASH_DUMP_MAGIC 0x504D4443 // 'CDMP'
+
+// fixed header of the dump, followed by stack_bytes copied from the
+// faulting thread's stack starting at the exception frame
+struct crash_dump_header {
+    uint32_t magic;
+    uint32_t fault_type;
+    uint32_t fault_addr;
+    uint32_t icsr;
+    uint32_t cfsr;
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;
+    uint32_t xpsr;
+    uint32_t sp;
+    char thread_name[16];
+    uint32_t stack_bytes;
+    // scheduler and semaphore state at fault time
+    AP_HAL::Util::PersistentData pd;
+};
+
+// called from the fault handlers with sp pointing at the stacked
+// exception frame. Only the first fault of a boot is recorded
+extern "C" void crash_dump_save(uint32_t fault_type, uint32_t fault_addr, uint32_t sp);
+
+#endif // HAL_CRASH_DUMP_FLASHPAGE
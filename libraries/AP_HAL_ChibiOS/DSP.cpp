@@ -52,7 +52,11 @@ extern const AP_HAL::HAL& hal;
 AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample_rate, uint8_t harmonics)
 {
     DSP::FFTWindowStateARM* fft = new DSP::FFTWindowStateARM(window_size, sample_rate, harmonics);
-    if (fft == nullptr || fft->_hanning_window == nullptr || fft->_rfft_data == nullptr || fft->_freq_bins == nullptr || fft->_derivative_freq_bins == nullptr) {
+    if (fft == nullptr || fft->_hanning_window == nullptr || fft->_rfft_data == nullptr || fft->_freq_bins == nullptr || fft->_derivative_freq_bins == nullptr
+#if HAL_DSP_FFT_Q15
+        || fft->_q15_samples == nullptr || fft->_q15_hanning == nullptr || fft->_q15_rfft_data == nullptr
+#endif
+        ) {
         delete fft;
         return nullptr;
     }
@@ -62,16 +66,24 @@ AP_HAL::DSP::FFTWindowState* DSP::fft_init(uint16_t window_size, uint16_t sample
 // start an FFT analysis
 void DSP::fft_start(FFTWindowState* state, FloatBuffer& samples, uint16_t advance)
 {
+#if HAL_DSP_FFT_Q15
+    step_hanning_q15((FFTWindowStateARM*)state, samples, advance);
+#else
     step_hanning((FFTWindowStateARM*)state, samples, advance);
+#endif
 }
 
 // perform remaining steps of an FFT analysis
 uint16_t DSP::fft_analyse(AP_HAL::DSP::FFTWindowState* state, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff)
 {
     FFTWindowStateARM* fft = (FFTWindowStateARM*)state;
+#if HAL_DSP_FFT_Q15
+    step_rfft_q15(fft);
+#else
     step_arm_cfft_f32(fft);
     step_bitreversal(fft);
     step_stage_rfft_f32(fft);
+#endif
     step_arm_cmplx_mag_f32(fft, start_bin, end_bin, noise_att_cutoff);
     return step_calc_frequencies_f32(fft, start_bin, end_bin);
 }
@@ -113,9 +125,43 @@ DSP::FFTWindowStateARM::FFTWindowStateARM(uint16_t window_size, uint16_t sample_
         break;
 #endif
     }
+
+#if HAL_DSP_FFT_Q15
+    // fixed-point pipeline: windowed samples, window coefficients and
+    // FFT output all live in q15, halving the working-set size
+    _q15_samples = (q15_t*)hal.util->malloc_type(sizeof(q15_t) * window_size, DSP_MEM_REGION);
+    _q15_hanning = (q15_t*)hal.util->malloc_type(sizeof(q15_t) * window_size, DSP_MEM_REGION);
+    _q15_rfft_data = (q15_t*)hal.util->malloc_type(sizeof(q15_t) * (window_size + 2), DSP_MEM_REGION);
+
+    if (_q15_samples == nullptr || _q15_hanning == nullptr || _q15_rfft_data == nullptr ||
+        arm_rfft_init_q15(&_fft_instance_q15, window_size, 0, 1) != ARM_MATH_SUCCESS) {
+        hal.util->free_type(_q15_samples, sizeof(q15_t) * window_size, DSP_MEM_REGION);
+        hal.util->free_type(_q15_hanning, sizeof(q15_t) * window_size, DSP_MEM_REGION);
+        hal.util->free_type(_q15_rfft_data, sizeof(q15_t) * (window_size + 2), DSP_MEM_REGION);
+        _q15_samples = nullptr;
+        _q15_hanning = nullptr;
+        _q15_rfft_data = nullptr;
+        return;
+    }
+
+    arm_float_to_q15(_hanning_window, _q15_hanning, window_size);
+    // arm_rfft_q15 downscales the output by log2(N) bits to prevent
+    // saturation; undone when converting back to float
+    _q15_shift = __builtin_ctz(window_size);
+#endif
 }
 
-DSP::FFTWindowStateARM::~FFTWindowStateARM() {}
+DSP::FFTWindowStateARM::~FFTWindowStateARM()
+{
+#if HAL_DSP_FFT_Q15
+    hal.util->free_type(_q15_samples, sizeof(q15_t) * _window_size, DSP_MEM_REGION);
+    _q15_samples = nullptr;
+    hal.util->free_type(_q15_hanning, sizeof(q15_t) * _window_size, DSP_MEM_REGION);
+    _q15_hanning = nullptr;
+    hal.util->free_type(_q15_rfft_data, sizeof(q15_t) * (_window_size + 2), DSP_MEM_REGION);
+    _q15_rfft_data = nullptr;
+#endif
+}
 
 extern "C" {
     void stage_rfft_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut);
@@ -207,6 +253,62 @@ void DSP::step_stage_rfft_f32(FFTWindowStateARM* fft)
     TIMER_END(_stage_rfft_f32_timer);
 }
 
+#if HAL_DSP_FFT_Q15
+// fixed-point replacement for step 1: normalise the incoming samples
+// to use the full q15 range, then apply the Hanning window in q15
+void DSP::step_hanning_q15(FFTWindowStateARM* fft, FloatBuffer& samples, uint16_t advance)
+{
+    TIMER_START(_hanning_timer);
+
+    samples.peek(&fft->_freq_bins[0], fft->_window_size); // the caller ensures we get a full buffer of samples
+    samples.advance(advance);
+
+    // normalise to the q15 range. The FFT is linear so the scale is
+    // simply reapplied to the output; without this the limited
+    // dynamic range swamps small oscillation peaks
+    float max_value;
+    uint32_t max_index;
+    arm_max_f32(&fft->_freq_bins[0], fft->_window_size, &max_value, &max_index);
+    float min_value;
+    arm_min_f32(&fft->_freq_bins[0], fft->_window_size, &min_value, &max_index);
+    max_value = MAX(fabsf(max_value), fabsf(min_value));
+    if (!is_positive(max_value)) {
+        max_value = 1.0f;
+    }
+    arm_scale_f32(&fft->_freq_bins[0], 1.0f / max_value, &fft->_freq_bins[0], fft->_window_size);
+    fft->_q15_scale = max_value;
+
+    arm_float_to_q15(&fft->_freq_bins[0], fft->_q15_samples, fft->_window_size);
+    arm_mult_q15(fft->_q15_samples, fft->_q15_hanning, fft->_q15_samples, fft->_window_size);
+
+    TIMER_END(_hanning_timer);
+}
+
+// fixed-point replacement for steps 2-4: a single q15 real FFT,
+// converted back to float in the packed layout that the magnitude and
+// frequency interpolation steps expect
+void DSP::step_rfft_q15(FFTWindowStateARM* fft)
+{
+    TIMER_START(_arm_cfft_f32_timer);
+
+    arm_rfft_q15(&fft->_fft_instance_q15, fft->_q15_samples, fft->_q15_rfft_data);
+
+    // q15 output is bins 0..N/2 as re/im pairs, downscaled by
+    // 2^log2(N). Rebuild _rfft_data in the arm_rfft_fast_f32 packed
+    // convention: [re(0), re(N/2), re(1), im(1), ...]
+    const float scale = fft->_q15_scale * float(1U << fft->_q15_shift) / 32768.0f;
+    const q15_t* q = fft->_q15_rfft_data;
+    float* out = fft->_rfft_data;
+    out[0] = q[0] * scale;                      // DC
+    out[1] = q[fft->_window_size] * scale;      // Nyquist
+    for (uint16_t i = 2; i < fft->_window_size; i++) {
+        out[i] = q[i] * scale;
+    }
+
+    TIMER_END(_arm_cfft_f32_timer);
+}
+#endif // HAL_DSP_FFT_Q15
+
 // step 5: find the magnitudes of the complex data
 void DSP::step_arm_cmplx_mag_f32(FFTWindowStateARM* fft, uint16_t start_bin, uint16_t end_bin, float noise_att_cutoff)
 {
@@ -25,6 +25,14 @@
 
 #define DEBUG_FFT   0
 
+// select the q15 fixed-point FFT backend. This roughly halves the
+// per-window cycle cost on M4F at the expense of dynamic range and is
+// intended for F4-class boards; enable in a board hwdef with
+// 'define HAL_DSP_FFT_Q15 1'
+#ifndef HAL_DSP_FFT_Q15
+#define HAL_DSP_FFT_Q15 0
+#endif
+
 // ChibiOS implementation of FFT analysis to run on STM32 processors
 class ChibiOS::DSP : public AP_HAL::DSP {
 public:
@@ -45,6 +53,21 @@ public:
     private:
         // underlying CMSIS data structure for FFT analysis
         arm_rfft_fast_instance_f32 _fft_instance;
+#if HAL_DSP_FFT_Q15
+        // underlying CMSIS data structure for fixed-point FFT analysis
+        arm_rfft_instance_q15 _fft_instance_q15;
+        // windowed input samples in q15
+        q15_t* _q15_samples;
+        // Hanning window coefficients in q15
+        q15_t* _q15_hanning;
+        // raw q15 FFT output, bins 0..N/2 as re/im pairs
+        q15_t* _q15_rfft_data;
+        // bits of bin growth downscaling applied by arm_rfft_q15
+        uint8_t _q15_shift;
+        // per-window input normalisation factor, undone when
+        // converting the FFT output back to float
+        float _q15_scale;
+#endif
     };
 
 protected:
@@ -65,6 +88,11 @@ protected:
 private:
     // following are the six independent steps for calculating an FFT
     void step_hanning(FFTWindowStateARM* fft, FloatBuffer& samples, uint16_t advance);
+#if HAL_DSP_FFT_Q15
+    // fixed-point replacements for steps 1-4
+    void step_hanning_q15(FFTWindowStateARM* fft, FloatBuffer& samples, uint16_t advance);
+    void step_rfft_q15(FFTWindowStateARM* fft);
+#endif
     void step_arm_cfft_f32(FFTWindowStateARM* fft);
     void step_bitreversal(FFTWindowStateARM* fft);
     void step_stage_rfft_f32(FFTWindowStateARM* fft);
@@ -133,9 +133,39 @@ AP_HAL::Device::PeriodicHandle DeviceBus::register_periodic_callback(uint32_t pe
     callback->period_usec = period_usec;
     callback->next_usec = AP_HAL::micros64() + period_usec;
 
-    // add to linked list of callbacks on thread
-    callback->next = callbacks;
-    callbacks = callback;
+    // stagger the phase of callbacks sharing a period on this bus so
+    // they don't all come due in the same pass of the bus thread.
+    // Devices registered at the same rate otherwise form a convoy
+    // holding the bus for the sum of their transaction times, which
+    // delays any other thread waiting on the bus semaphore
+    uint32_t nsame = 0;
+    for (DeviceBus::callback_info *c = callbacks; c; c = c->next) {
+        if (c->period_usec == period_usec) {
+            nsame++;
+        }
+    }
+    if (nsame > 0) {
+        callback->next_usec += (uint64_t(period_usec) * nsame) / (nsame + 1);
+    }
+
+    // add to the linked list of callbacks on the thread, sorted by
+    // period so that when several callbacks come due in the same pass
+    // the fastest device (the IMU on a shared bus) is always serviced
+    // first. This makes the IMU's worst-case sample latency depend only
+    // on its own transaction rather than on the registration order of
+    // its bus neighbours. Insertion keeps the list walkable by the bus
+    // thread at every intermediate step
+    if (callbacks == nullptr || period_usec < callbacks->period_usec) {
+        callback->next = callbacks;
+        callbacks = callback;
+    } else {
+        DeviceBus::callback_info *c = callbacks;
+        while (c->next != nullptr && c->next->period_usec <= period_usec) {
+            c = c->next;
+        }
+        callback->next = c->next;
+        c->next = callback;
+    }
 
     return callback;
 }
@@ -66,6 +66,12 @@ I2CBus I2CDeviceManager::businfo[ARRAY_SIZE(I2CD)];
 #define HAL_I2C_CLEAR_ON_TIMEOUT 1
 #endif
 
+// consecutive timed-out transfers before a device's circuit breaker
+// opens, and the backoff bounds while it is open
+#define HAL_I2C_BREAKER_TIMEOUT_LIMIT 3
+#define HAL_I2C_BREAKER_BACKOFF_MIN_MS 100U
+#define HAL_I2C_BREAKER_BACKOFF_MAX_MS 2000U
+
 // get a handle for DMA sharing DMA channels with other subsystems
 void I2CBus::dma_init(void)
 {
@@ -169,6 +175,10 @@ I2CDevice::I2CDevice(uint8_t busnum, uint8_t address, uint32_t bus_clock, bool u
     _address(address),
     _use_smbus(use_smbus),
     _timeout_ms(timeout_ms),
+    _saw_timeout(false),
+    _timeout_count(0),
+    _breaker_open_ms(0),
+    _breaker_backoff_ms(HAL_I2C_BREAKER_BACKOFF_MIN_MS),
     bus(I2CDeviceManager::businfo[busnum])
 {
     set_device_bus(busnum+HAL_I2C_BUS_BASE);
@@ -223,6 +233,12 @@ bool I2CDevice::transfer(const uint8_t *send, uint32_t send_len,
         return false;
     }
 
+    if (!breaker_allow_transfer()) {
+        // device circuit breaker is open; fail fast so co-bus
+        // devices don't pay our timeout
+        return false;
+    }
+
 #if defined(STM32F7) || defined(STM32H7) || defined(STM32F3)
     if (_use_smbus) {
         bus.i2ccfg.cr1 |= I2C_CR1_SMBHEN;
@@ -237,6 +253,7 @@ bool I2CDevice::transfer(const uint8_t *send, uint32_t send_len,
     }
 #endif
 
+    bool ok = true;
     if (_split_transfers) {
         /*
           splitting the transfer() into two pieces avoids a stop condition
@@ -244,28 +261,73 @@ bool I2CDevice::transfer(const uint8_t *send, uint32_t send_len,
           LidarLite blue label)
         */
         if (send && send_len) {
-            if (!_transfer(send, send_len, nullptr, 0)) {
-                return false;
-            }
+            ok = _transfer(send, send_len, nullptr, 0);
         }
-        if (recv && recv_len) {
-            if (!_transfer(nullptr, 0, recv, recv_len)) {
-                return false;
-            }
+        if (ok && recv && recv_len) {
+            ok = _transfer(nullptr, 0, recv, recv_len);
         }
     } else {
         // combined transfer
-        if (!_transfer(send, send_len, recv, recv_len)) {
-            return false;
-        }
+        ok = _transfer(send, send_len, recv, recv_len);
     }
 
+    breaker_transfer_result(ok);
+    if (!ok) {
+        return false;
+    }
+
+    capture_transfer(send, send_len, recv, recv_len);
+
     return true;
 }
 
+/*
+  return false if this device's circuit breaker is open and the
+  backoff period has not yet expired. At the end of each backoff
+  period one transfer is let through as a probe; if it succeeds the
+  breaker closes, otherwise it re-opens with a doubled backoff
+ */
+bool I2CDevice::breaker_allow_transfer(void)
+{
+    if (_breaker_open_ms == 0) {
+        return true;
+    }
+    return (AP_HAL::millis() - _breaker_open_ms) >= _breaker_backoff_ms;
+}
+
+// update circuit breaker state with the result of a transfer
+void I2CDevice::breaker_transfer_result(bool success)
+{
+    if (success || !_saw_timeout) {
+        // NACKs fail quickly and don't hold the bus thread, so only
+        // timeouts count towards opening the breaker
+        _timeout_count = 0;
+        _breaker_open_ms = 0;
+        _breaker_backoff_ms = HAL_I2C_BREAKER_BACKOFF_MIN_MS;
+        return;
+    }
+    if (_timeout_count < HAL_I2C_BREAKER_TIMEOUT_LIMIT) {
+        _timeout_count++;
+    }
+    if (_timeout_count >= HAL_I2C_BREAKER_TIMEOUT_LIMIT || _breaker_open_ms != 0) {
+        // open (or re-open after a failed probe) with exponential backoff
+        if (_breaker_open_ms != 0) {
+            _breaker_backoff_ms = MIN(_breaker_backoff_ms*2, HAL_I2C_BREAKER_BACKOFF_MAX_MS);
+        } else {
+            _breaker_backoff_ms = HAL_I2C_BREAKER_BACKOFF_MIN_MS;
+        }
+        uint32_t now_ms = AP_HAL::millis();
+        if (now_ms == 0) {
+            now_ms = 1;
+        }
+        _breaker_open_ms = now_ms;
+    }
+}
+
 bool I2CDevice::_transfer(const uint8_t *send, uint32_t send_len,
                          uint8_t *recv, uint32_t recv_len)
 {
+    _saw_timeout = false;
     i2cAcquireBus(I2CD[bus.busnum].i2c);
 
     if (!bus.bouncebuffer_setup(send, send_len, recv, recv_len)) {
@@ -318,6 +380,10 @@ bool I2CDevice::_transfer(const uint8_t *send, uint32_t send_len,
             i2cReleaseBus(I2CD[bus.busnum].i2c);
             return true;
         }
+        if (ret == MSG_TIMEOUT) {
+            // feeds the per-device circuit breaker
+            _saw_timeout = true;
+        }
 #if HAL_I2C_CLEAR_ON_TIMEOUT
         if (ret == MSG_TIMEOUT && I2CBus::read_sda(bus.busnum) == 0) {
             I2CBus::clear_bus(bus.busnum);
@@ -108,6 +108,23 @@ private:
     bool _split_transfers;
     bool _use_smbus;
     uint32_t _timeout_ms;
+
+    /*
+      per-device circuit breaker. A wedged device pays the full
+      timeout on every retry, starving other devices on the same bus
+      thread. After enough consecutive timeouts we fail transfers
+      immediately for an exponentially growing backoff period, letting
+      one transfer through at the end of each period as a probe
+     */
+    bool _saw_timeout;           // set by _transfer() when an attempt timed out
+    uint8_t _timeout_count;      // consecutive transfers that timed out
+    uint32_t _breaker_open_ms;   // time the breaker opened, 0 when closed
+    uint32_t _breaker_backoff_ms;
+
+    // update breaker state with the result of a transfer, return
+    // false if the transfer should be failed without touching the bus
+    bool breaker_allow_transfer(void);
+    void breaker_transfer_result(bool success);
 };
 
 class I2CDeviceManager : public AP_HAL::I2CDeviceManager {
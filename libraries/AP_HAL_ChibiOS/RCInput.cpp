@@ -92,6 +92,12 @@ bool RCInput::new_input()
     return valid;
 }
 
+uint32_t RCInput::last_input_us()
+{
+    WITH_SEMAPHORE(rcin_mutex);
+    return _rcin_timestamp_last_signal;
+}
+
 uint8_t RCInput::num_channels()
 {
     if (!_init) {
@@ -175,7 +181,10 @@ void RCInput::_timer_tick(void)
 
     if (rcprot.new_input()) {
         WITH_SEMAPHORE(rcin_mutex);
-        _rcin_timestamp_last_signal = AP_HAL::micros();
+        // use the decode-time timestamp rather than the time this
+        // tick noticed the frame, so input age is not quantised to
+        // the tick rate
+        _rcin_timestamp_last_signal = rcprot.last_frame_time_us();
         _num_channels = rcprot.num_channels();
         _num_channels = MIN(_num_channels, RC_INPUT_MAX_CHANNELS);
         rcprot.read(_rc_values, _num_channels);
@@ -53,6 +53,8 @@ public:
         return _rssi;
     }
 
+    uint32_t last_input_us(void) override;
+
     const char *protocol() const override { return last_protocol; }
 
     void _timer_tick(void);
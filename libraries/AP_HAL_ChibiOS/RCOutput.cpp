@@ -531,6 +531,9 @@ bool RCOutput::setup_group_DMA(pwm_group &group, uint32_t bitrate, uint32_t bit_
         }
         group.dma_buffer_len = buffer_length;
     }
+    // any previously encoded dshot packets are stale; this also
+    // covers returning from serial output, which borrows the buffer
+    group.dshot_buffer_valid = false;
     // for dshot we setup for DMAR based output
     if (!group.dma_handle) {
         group.dma_handle = new Shared_DMA(group.dma_up_stream_id, SHARED_DMA_NONE,
@@ -1092,8 +1095,13 @@ void RCOutput::dshot_send(pwm_group &group, bool blocking)
         }
     }
 
-    // if the last transaction returned telemetry, decode it
-    if (group.dshot_state == DshotState::RECV_COMPLETE) {
+    // if the last transaction returned telemetry, decode it. The
+    // decode is only done on the blocking path, which runs in the
+    // timer thread, so that the fast loop path through
+    // trigger_groups() never pays for the GCR decode. A pending
+    // sample skipped by the fast path is simply replaced by a newer
+    // capture on the next send
+    if (group.dshot_state == DshotState::RECV_COMPLETE && blocking) {
         uint8_t chan = group.chan[group.bdshot.prev_telem_chan];
         uint32_t now = AP_HAL::millis();
         if (bdshot_decode_dshot_telemetry(group, group.bdshot.prev_telem_chan)) {
@@ -1122,7 +1130,13 @@ void RCOutput::dshot_send(pwm_group &group, bool blocking)
 #endif
     bool safety_on = hal.util->safety_switch_state() == AP_HAL::Util::SAFETY_DISARMED;
 
-    memset((uint8_t *)group.dma_buffer, 0, DSHOT_BUFFER_LENGTH);
+    // only re-encode lanes whose packet has changed since the last
+    // send. The full clear is needed whenever the buffer has been
+    // used for something else, such as bidir telemetry capture
+    if (!group.dshot_buffer_valid) {
+        memset((uint8_t *)group.dma_buffer, 0, DSHOT_BUFFER_LENGTH);
+        group.dshot_filled_mask = 0;
+    }
 
     for (uint8_t i=0; i<4; i++) {
         uint8_t chan = group.chan[i];
@@ -1139,7 +1153,14 @@ void RCOutput::dshot_send(pwm_group &group, bool blocking)
 
             const uint16_t chan_mask = (1U<<chan);
             if (pwm == 0) {
-                // no output
+                // no output; make sure the lane is zeroed if it still
+                // holds a previous packet
+                if (group.dshot_filled_mask & (1U<<i)) {
+                    for (uint16_t n=0; n<dshot_bit_length; n++) {
+                        group.dma_buffer[i + 4*n] = 0;
+                    }
+                    group.dshot_filled_mask &= ~(1U<<i);
+                }
                 continue;
             }
 
@@ -1167,10 +1188,19 @@ void RCOutput::dshot_send(pwm_group &group, bool blocking)
             if (request_telemetry) {
                 telem_request_mask &= ~chan_mask;
             }
-            fill_DMA_buffer_dshot(group.dma_buffer + i, 4, packet, group.bit_width_mul);
+            if (!(group.dshot_filled_mask & (1U<<i)) ||
+                group.dshot_last_packet[i] != packet) {
+                fill_DMA_buffer_dshot(group.dma_buffer + i, 4, packet, group.bit_width_mul);
+                group.dshot_last_packet[i] = packet;
+                group.dshot_filled_mask |= (1U<<i);
+            }
         }
     }
 
+    // in bidir mode the same buffer captures the telemetry response,
+    // so the encoded pulses won't survive this send
+    group.dshot_buffer_valid = !group.bdshot.enabled;
+
     // start sending the pulses out
     send_pulses_DMAR(group, DSHOT_BUFFER_LENGTH);
 
@@ -252,6 +252,17 @@ private:
         uint32_t rc_frequency;
         bool in_serial_dma;
         uint64_t last_dmar_send_us;
+        // cache of the last dshot packet encoded into the DMA buffer
+        // for each channel, used to skip re-encoding when the
+        // throttle value hasn't changed
+        uint16_t dshot_last_packet[4];
+        // mask of channels whose lane of the DMA buffer holds the
+        // cached packet rather than zeros
+        uint8_t dshot_filled_mask;
+        // true while the DMA buffer contents match the cache. Cleared
+        // whenever something else writes the buffer, such as bidir
+        // telemetry capture or serial output
+        bool dshot_buffer_valid;
         uint32_t dshot_pulse_time_us;
         uint32_t dshot_pulse_send_time_us;
         virtual_timer_t dma_timeout;
@@ -274,7 +274,11 @@ bool SPIDevice::transfer(const uint8_t *send, uint32_t send_len,
     }
     if ((send_len == recv_len && send == recv) || !send || !recv) {
         // simplest cases, needed for DMA
-        return do_transfer(send, recv, recv_len?recv_len:send_len);
+        bool ret = do_transfer(send, recv, recv_len?recv_len:send_len);
+        if (ret) {
+            capture_transfer(send, send_len, recv, recv_len);
+        }
+        return ret;
     }
     uint8_t buf[send_len+recv_len];
     if (send_len > 0) {
@@ -287,6 +291,9 @@ bool SPIDevice::transfer(const uint8_t *send, uint32_t send_len,
     if (ret && recv_len > 0) {
         memcpy(recv, &buf[send_len], recv_len);
     }
+    if (ret) {
+        capture_transfer(send, send_len, recv, recv_len);
+    }
     return ret;
 }
 
@@ -302,6 +309,15 @@ bool SPIDevice::transfer_fullduplex(const uint8_t *send, uint8_t *recv, uint32_t
     return ret;
 }
 
+bool SPIDevice::transfer_fullduplex(uint8_t *send_recv, uint32_t len)
+{
+    bus.semaphore.assert_owner();
+    // the caller guarantees a DMA-safe buffer, so the DMA engine
+    // reads and writes it directly; the bouncebuffer check in
+    // do_transfer() becomes a no-op rather than a copy
+    return do_transfer(send_recv, send_recv, len);
+}
+
 AP_HAL::Semaphore *SPIDevice::get_semaphore()
 {
     return &bus.semaphore;
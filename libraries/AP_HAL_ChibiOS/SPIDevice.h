@@ -84,6 +84,10 @@ public:
     bool transfer_fullduplex(const uint8_t *send, uint8_t *recv,
                              uint32_t len) override;
 
+    /* single-buffer fullduplex transfer straight into a DMA-safe
+       caller-owned buffer, with no bounce copy */
+    bool transfer_fullduplex(uint8_t *send_recv, uint32_t len) override;
+
     /*
         Links the bank select callback to the spi bus, so that even when
         used outside of the driver bank selection can be done.
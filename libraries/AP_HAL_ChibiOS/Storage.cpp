@@ -251,11 +251,20 @@ void Storage::_timer_tick(void)
     }
     if (_dirty_mask.empty()) {
         _last_empty_ms = AP_HAL::millis();
+#ifdef STORAGE_FLASH_PAGE
+        if (_initialisedType == StorageBackend::Flash) {
+            // use idle time to erase any full sector, so the next
+            // sector switch does not need an erase in the write path
+            _flash.process_erase();
+        }
+#endif
         return;
     }
 
-    // write out the first dirty line. We don't write more
-    // than one to keep the latency of this call to a minimum
+    // write out a run of consecutive dirty lines, capped at
+    // CH_STORAGE_MAX_WRITE_LINES to keep the latency of this call
+    // bounded. Writing a run as one backend operation lets bulk
+    // updates such as a mission upload drain quickly
     uint16_t i;
     for (i=0; i<CH_STORAGE_NUM_LINES; i++) {
         if (_dirty_mask.get(i)) {
@@ -267,17 +276,24 @@ void Storage::_timer_tick(void)
         return;
     }
 
+    uint16_t n_lines;
+
     {
-        // take a copy of the line we are writing with a semaphore held
+        // take a copy of the lines we are writing with a semaphore held
         WITH_SEMAPHORE(sem);
-        memcpy(tmpline, &_buffer[CH_STORAGE_LINE_SIZE*i], CH_STORAGE_LINE_SIZE);
+        for (n_lines=1; n_lines<CH_STORAGE_MAX_WRITE_LINES; n_lines++) {
+            if (i+n_lines >= CH_STORAGE_NUM_LINES || !_dirty_mask.get(i+n_lines)) {
+                break;
+            }
+        }
+        memcpy(tmpline, &_buffer[CH_STORAGE_LINE_SIZE*i], CH_STORAGE_LINE_SIZE*n_lines);
     }
 
     bool write_ok = false;
 
 #if HAL_WITH_RAMTRON
     if (_initialisedType == StorageBackend::FRAM) {
-        if (fram.write(CH_STORAGE_LINE_SIZE*i, tmpline, CH_STORAGE_LINE_SIZE)) {
+        if (fram.write(CH_STORAGE_LINE_SIZE*i, tmpline, CH_STORAGE_LINE_SIZE*n_lines)) {
             write_ok = true;
         }
     }
@@ -289,7 +305,7 @@ void Storage::_timer_tick(void)
         if (AP::FS().lseek(log_fd, offset, SEEK_SET) != offset) {
             return;
         }
-        if (AP::FS().write(log_fd, &_buffer[offset], CH_STORAGE_LINE_SIZE) != CH_STORAGE_LINE_SIZE) {
+        if (AP::FS().write(log_fd, tmpline, CH_STORAGE_LINE_SIZE*n_lines) != CH_STORAGE_LINE_SIZE*n_lines) {
             return;
         }
         if (AP::FS().fsync(log_fd) != 0) {
@@ -302,7 +318,7 @@ void Storage::_timer_tick(void)
 #ifdef STORAGE_FLASH_PAGE
     if (_initialisedType == StorageBackend::Flash) {
         // save to storage backend
-        if (_flash_write(i)) {
+        if (_flash_write(i, n_lines)) {
             write_ok = true;
         }
     }
@@ -310,14 +326,18 @@ void Storage::_timer_tick(void)
 
     if (write_ok) {
         WITH_SEMAPHORE(sem);
-        // while holding the semaphore we check if the copy of the
+        // while holding the semaphore we check if the copy of each
         // line is different from the original line. If it is
         // different then someone has re-dirtied the line while we
         // were writing it, in which case we should not mark it
         // clean. If it matches then we know we can mark the line as
         // clean
-        if (memcmp(tmpline, &_buffer[CH_STORAGE_LINE_SIZE*i], CH_STORAGE_LINE_SIZE) == 0) {
-            _dirty_mask.clear(i);
+        for (uint16_t n=0; n<n_lines; n++) {
+            if (memcmp(&tmpline[CH_STORAGE_LINE_SIZE*n],
+                       &_buffer[CH_STORAGE_LINE_SIZE*(i+n)],
+                       CH_STORAGE_LINE_SIZE) == 0) {
+                _dirty_mask.clear(i+n);
+            }
         }
     }
 }
@@ -341,12 +361,12 @@ void Storage::_flash_load(void)
 }
 
 /*
-  write one storage line. This also updates _dirty_mask.
+  write a run of storage lines. This also updates _dirty_mask.
 */
-bool Storage::_flash_write(uint16_t line)
+bool Storage::_flash_write(uint16_t line, uint16_t n_lines)
 {
 #ifdef STORAGE_FLASH_PAGE
-    return _flash.write(line*CH_STORAGE_LINE_SIZE, CH_STORAGE_LINE_SIZE);
+    return _flash.write(line*CH_STORAGE_LINE_SIZE, n_lines*CH_STORAGE_LINE_SIZE);
 #else
     return false;
 #endif
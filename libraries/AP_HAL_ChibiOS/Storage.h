@@ -34,6 +34,12 @@
 #define CH_STORAGE_LINE_SIZE (1<<CH_STORAGE_LINE_SHIFT)
 #define CH_STORAGE_NUM_LINES (CH_STORAGE_SIZE/CH_STORAGE_LINE_SIZE)
 
+// maximum number of consecutive dirty lines written out in one
+// _timer_tick() call. This bounds the latency of a single tick while
+// letting bulk updates (eg. a mission upload) drain much faster than
+// one line per tick
+#define CH_STORAGE_MAX_WRITE_LINES 8
+
 static_assert(CH_STORAGE_SIZE % CH_STORAGE_LINE_SIZE == 0,
               "Storage is not multiple of line size");
 
@@ -62,7 +68,7 @@ private:
     uint8_t _buffer[CH_STORAGE_SIZE] __attribute__((aligned(4)));
     Bitmask<CH_STORAGE_NUM_LINES> _dirty_mask;
     HAL_Semaphore sem;
-    uint8_t tmpline[CH_STORAGE_LINE_SIZE];
+    uint8_t tmpline[CH_STORAGE_LINE_SIZE*CH_STORAGE_MAX_WRITE_LINES];
 
     bool _flash_write_data(uint8_t sector, uint32_t offset, const uint8_t *data, uint16_t length);
     bool _flash_read_data(uint8_t sector, uint32_t offset, uint8_t *data, uint16_t length);
@@ -83,7 +89,7 @@ private:
 #endif
 
     void _flash_load(void);
-    bool _flash_write(uint16_t line);
+    bool _flash_write(uint16_t line, uint16_t n_lines);
 
 #if HAL_WITH_RAMTRON
     AP_RAMTRON fram;
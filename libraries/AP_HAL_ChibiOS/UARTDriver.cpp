@@ -619,6 +619,39 @@ ssize_t UARTDriver::read(uint8_t *buffer, uint16_t count)
     return ret;
 }
 
+/*
+  zero-copy receive - return a pointer to the contiguous block of received
+  bytes at the head of the receive buffer so parsers can scan it in place.
+  The block remains valid until read_consume() or another read call
+*/
+const uint8_t *UARTDriver::read_peek(uint32_t &len)
+{
+    if (lock_read_key != 0 || _uart_owner_thd != chThdGetSelfX() ||
+        !_initialised) {
+        len = 0;
+        return nullptr;
+    }
+    return _readbuf.readptr(len);
+}
+
+/*
+  discard bytes previously returned by read_peek()
+*/
+bool UARTDriver::read_consume(uint32_t n)
+{
+    if (lock_read_key != 0 || _uart_owner_thd != chThdGetSelfX() ||
+        !_initialised) {
+        return false;
+    }
+    if (!_readbuf.advance(n)) {
+        return false;
+    }
+    if (!_rts_is_active) {
+        update_rts_line();
+    }
+    return true;
+}
+
 int16_t UARTDriver::read()
 {
     if (lock_read_key != 0 || _uart_owner_thd != chThdGetSelfX()){
@@ -712,6 +745,44 @@ size_t UARTDriver::write(const uint8_t *buffer, size_t size)
     size_t ret = _writebuf.write(buffer, size);
     if (unbuffered_writes) {
         write_pending_bytes();
+    } else if (ret > 0 && uart_thread_ctx != nullptr) {
+        // wake the uart thread to start the transmit rather than
+        // waiting for the next 1kHz tick
+        chEvtSignal(uart_thread_ctx, EVENT_MASK(serial_num));
+    }
+    return ret;
+}
+
+/*
+  gather write - copy a set of byte vectors into the transmit buffer as one
+  block, paying for the write lock once per call rather than once per
+  vector.  The write is all-or-nothing so a multi-part packet is never
+  half-queued.
+*/
+size_t UARTDriver::writev(const IoVec *vec, uint8_t count)
+{
+    if (!_initialised || lock_write_key != 0) {
+        return 0;
+    }
+
+    WITH_SEMAPHORE(_write_mutex);
+
+    uint32_t total = 0;
+    for (uint8_t i=0; i<count; i++) {
+        total += vec[i].len;
+    }
+    if (_writebuf.space() < total) {
+        return 0;
+    }
+
+    size_t ret = 0;
+    for (uint8_t i=0; i<count; i++) {
+        ret += _writebuf.write(vec[i].data, vec[i].len);
+    }
+    if (unbuffered_writes) {
+        write_pending_bytes();
+    } else if (ret > 0 && uart_thread_ctx != nullptr) {
+        chEvtSignal(uart_thread_ctx, EVENT_MASK(serial_num));
     }
     return ret;
 }
@@ -1005,6 +1076,27 @@ void UARTDriver::_timer_tick(void)
 {
     if (!_initialised) return;
 
+    /*
+      on ports marked with OPTION_LOWPOWER_IDLE we drop the tick rate
+      to 100Hz once the link has been idle for 2 seconds. RX DMA keeps
+      filling the buffers so nothing is lost; any pending byte in
+      either direction immediately restores the full 1kHz rate. This
+      cuts the processing cost of unused telemetry ports at the price
+      of up to 10ms of extra latency on the first bytes of a session
+     */
+    if (_last_options & OPTION_LOWPOWER_IDLE) {
+        const uint32_t now_ms = AP_HAL::millis();
+        if (_readbuf.available() != 0 || _writebuf.available() != 0) {
+            _lowpower_active_ms = now_ms;
+        }
+        if (now_ms - _lowpower_active_ms > 2000U) {
+            if (++_lowpower_ticks < 10) {
+                return;
+            }
+        }
+        _lowpower_ticks = 0;
+    }
+
 #ifdef HAVE_USB_SERIAL
     if (hd_tx_active && (chEvtGetAndClearFlags(&hd_listener) & CHN_OUTPUT_EMPTY) != 0) {
         /*
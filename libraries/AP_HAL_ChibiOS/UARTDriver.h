@@ -48,12 +48,15 @@ public:
     int16_t read() override;
     ssize_t read(uint8_t *buffer, uint16_t count) override;
     int16_t read_locked(uint32_t key) override;
+    const uint8_t *read_peek(uint32_t &len) override;
+    bool read_consume(uint32_t n) override;
     void _timer_tick(void) override;
 
     bool discard_input() override;
 
     size_t write(uint8_t c) override;
     size_t write(const uint8_t *buffer, size_t size) override;
+    size_t writev(const IoVec *vec, uint8_t count) override;
 
     // lock a port for exclusive use. Use a key of 0 to unlock
     bool lock_port(uint32_t write_key, uint32_t read_key) override;
@@ -203,6 +206,10 @@ private:
     uint32_t _cr3_options;
     uint16_t _last_options;
 
+    // idle-link throttling of the timer tick for OPTION_LOWPOWER_IDLE
+    uint32_t _lowpower_active_ms;
+    uint8_t _lowpower_ticks;
+
     // half duplex control. After writing we throw away bytes for 4 byte widths to
     // prevent reading our own bytes back
 #if CH_CFG_USE_EVENTS == TRUE
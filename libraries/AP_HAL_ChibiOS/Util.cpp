@@ -57,12 +57,113 @@ uint32_t Util::available_memory(void)
     Special Allocation Routines
 */
 
+#ifndef HAL_CHIBIOS_ENABLE_MALLOC_GUARD
+/*
+  size-class pool for DMA-safe allocations. DMA-capable SRAM is scarce
+  and fragments badly when mixed-size bounce buffers are allocated and
+  freed ad hoc, which can leave late-boot DMA allocations unable to
+  find a contiguous block, particularly after a soft reboot. Small DMA
+  allocations are rounded up to a small set of size classes and freed
+  blocks are kept on per-class free lists for deterministic reuse
+  rather than returned to the heap. Blocks come from malloc_dma() so
+  they carry its DMA (cache-line on H7) alignment
+ */
+static const uint16_t dma_pool_sizes[] = { 32, 64, 128, 256, 512, 1024 };
+struct dma_pool_block {
+    struct dma_pool_block *next;
+};
+static struct dma_pool {
+    dma_pool_block *free_list;
+    uint16_t num_free;
+    uint16_t num_used;
+    uint16_t peak_used;
+} dma_pools[ARRAY_SIZE(dma_pool_sizes)];
+static HAL_Semaphore dma_pool_sem;
+
+// smallest size class that fits size, or -1 to pass the request
+// straight to the heap
+static int8_t dma_pool_class(size_t size)
+{
+    for (uint8_t i=0; i<ARRAY_SIZE(dma_pool_sizes); i++) {
+        if (size <= dma_pool_sizes[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif // HAL_CHIBIOS_ENABLE_MALLOC_GUARD
+
+/*
+  bump allocator for permanent boot-time allocations. Objects that are
+  never freed are packed into arena chunks instead of interleaving
+  with transient heap allocations, leaving the remaining heap as
+  contiguous as possible for late large allocations such as the
+  scripting heap. Memory handed out from the arena is never returned
+ */
+#define BOOT_ARENA_CHUNK_SIZE 4096U
+static struct {
+    uint8_t *ptr;
+    uint32_t remaining;
+    uint32_t total;
+} boot_arena;
+static HAL_Semaphore boot_arena_sem;
+
+static void *boot_arena_alloc(size_t size)
+{
+    if (size >= BOOT_ARENA_CHUNK_SIZE) {
+        // large blocks go straight to the heap
+        return calloc(1, size);
+    }
+    WITH_SEMAPHORE(boot_arena_sem);
+    // keep the same alignment as the heap
+    const uint32_t aligned = (size + 7U) & ~7U;
+    if (boot_arena.remaining < aligned) {
+        // the tail of the previous chunk is abandoned; at most one
+        // chunk of waste per boot
+        uint8_t *chunk = (uint8_t *)calloc(1, BOOT_ARENA_CHUNK_SIZE);
+        if (chunk == nullptr) {
+            return calloc(1, size);
+        }
+        boot_arena.ptr = chunk;
+        boot_arena.remaining = BOOT_ARENA_CHUNK_SIZE;
+        boot_arena.total += BOOT_ARENA_CHUNK_SIZE;
+    }
+    void *p = boot_arena.ptr;
+    boot_arena.ptr += aligned;
+    boot_arena.remaining -= aligned;
+    return p;
+}
+
 void* Util::malloc_type(size_t size, AP_HAL::Util::Memory_Type mem_type)
 {
     if (mem_type == AP_HAL::Util::MEM_DMA_SAFE) {
+#ifndef HAL_CHIBIOS_ENABLE_MALLOC_GUARD
+        const int8_t cls = dma_pool_class(size);
+        if (cls >= 0) {
+            WITH_SEMAPHORE(dma_pool_sem);
+            struct dma_pool &pool = dma_pools[cls];
+            void *p;
+            if (pool.free_list != nullptr) {
+                p = pool.free_list;
+                pool.free_list = pool.free_list->next;
+                pool.num_free--;
+                // callers rely on zeroed memory, as from the heap
+                memset(p, 0, dma_pool_sizes[cls]);
+            } else {
+                p = malloc_dma(dma_pool_sizes[cls]);
+            }
+            if (p != nullptr) {
+                pool.num_used++;
+                pool.peak_used = MAX(pool.peak_used, pool.num_used);
+            }
+            return p;
+        }
+#endif
         return malloc_dma(size);
     } else if (mem_type == AP_HAL::Util::MEM_FAST) {
         return malloc_fastmem(size);
+    } else if (mem_type == AP_HAL::Util::MEM_PERMANENT) {
+        return boot_arena_alloc(size);
     } else {
         return calloc(1, size);
     }
@@ -70,9 +171,56 @@ void* Util::malloc_type(size_t size, AP_HAL::Util::Memory_Type mem_type)
 
 void Util::free_type(void *ptr, size_t size, AP_HAL::Util::Memory_Type mem_type)
 {
-    if (ptr != NULL) {
-        free(ptr);
+    if (ptr == NULL) {
+        return;
+    }
+#ifndef HAL_CHIBIOS_ENABLE_MALLOC_GUARD
+    if (mem_type == AP_HAL::Util::MEM_DMA_SAFE) {
+        const int8_t cls = dma_pool_class(size);
+        if (cls >= 0) {
+            // keep the block on the free list for reuse rather than
+            // fragmenting the DMA heap
+            WITH_SEMAPHORE(dma_pool_sem);
+            struct dma_pool &pool = dma_pools[cls];
+            struct dma_pool_block *b = (struct dma_pool_block *)ptr;
+            b->next = pool.free_list;
+            pool.free_list = b;
+            pool.num_free++;
+            pool.num_used--;
+            return;
+        }
+    }
+#endif
+    if (mem_type == AP_HAL::Util::MEM_PERMANENT && size < BOOT_ARENA_CHUNK_SIZE) {
+        // arena memory is never returned. Freeing an allocation
+        // classed as permanent only happens on rare error paths, so
+        // the few bytes stay abandoned in the arena
+        return;
     }
+    free(ptr);
+}
+
+/*
+  fill in memory statistics for @SYS/memory.txt
+ */
+void Util::mem_info(ExpandingString &str)
+{
+    str.printf("MemInfoV1\n");
+    str.printf("free_memory %u\n", unsigned(available_memory()));
+#ifndef HAL_CHIBIOS_ENABLE_MALLOC_GUARD
+    str.printf("DMA pool (size used free peak):\n");
+    WITH_SEMAPHORE(dma_pool_sem);
+    for (uint8_t i=0; i<ARRAY_SIZE(dma_pool_sizes); i++) {
+        const struct dma_pool &pool = dma_pools[i];
+        str.printf("%4u %3u %3u %3u\n",
+                   unsigned(dma_pool_sizes[i]),
+                   unsigned(pool.num_used),
+                   unsigned(pool.num_free),
+                   unsigned(pool.peak_used));
+    }
+#endif
+    str.printf("boot_arena_total %u\n", unsigned(boot_arena.total));
+    str.printf("boot_arena_free %u\n", unsigned(boot_arena.remaining));
 }
 
 
@@ -296,6 +444,21 @@ Util::FlashBootloader Util::flash_bootloader()
 }
 #endif // !HAL_NO_FLASH_SUPPORT && !HAL_NO_ROMFS_SUPPORT
 
+#ifndef HAL_NO_FLASH_SUPPORT
+/*
+  arm a swap of the active and inactive flash banks for the next
+  reset. Only available on dual-bank MCUs with the SWAP_BANK option bit
+ */
+bool Util::flash_swap_banks()
+{
+#if defined(STM32H7) && defined(FLASH_OPTSR_SWAP_BANK_OPT)
+    return stm32_flash_set_bank_swap(!stm32_flash_get_bank_swap());
+#else
+    return false;
+#endif
+}
+#endif // !HAL_NO_FLASH_SUPPORT
+
 /*
   display system identifer - board type and serial number
  */
@@ -378,6 +541,54 @@ void Util::dma_info(ExpandingString &str)
 }
 #endif
 
+/*
+  PC sampling profiler for @SYS/profile.bin. A virtual timer samples the
+  program counter of the interrupted thread context once per tick into a
+  ring buffer allocated on first use. The buffer holds raw 32 bit PC
+  values which are symbolized offline against the matching elf
+ */
+#define PROFILE_NUM_SAMPLES 1024U
+
+static struct pc_profile {
+    virtual_timer_t vt;
+    uint32_t *samples;
+    uint32_t next;
+    bool started;
+} profile;
+
+// virtual timer callback, runs in the system tick interrupt
+static void profile_sample_cb(void *)
+{
+    // the hardware stacked exception frame of the interrupted thread
+    // lives on the process stack: r0-r3, r12, lr, pc, xpsr. If the tick
+    // preempted another interrupt this records the last thread PC, which
+    // slightly over-counts the interrupted thread but keeps the sampler
+    // trivially cheap
+    uint32_t psp;
+    __asm volatile("mrs %0, psp" : "=r"(psp));
+    const uint32_t *frame = (const uint32_t *)psp;
+    profile.samples[profile.next++ % PROFILE_NUM_SAMPLES] = frame[6];
+    chSysLockFromISR();
+    chVTSetI(&profile.vt, chTimeMS2I(1), profile_sample_cb, nullptr);
+    chSysUnlockFromISR();
+}
+
+void Util::profile_info(ExpandingString &str)
+{
+    if (!profile.started) {
+        profile.samples = (uint32_t *)calloc(PROFILE_NUM_SAMPLES, sizeof(uint32_t));
+        if (profile.samples == nullptr) {
+            return;
+        }
+        profile.started = true;
+        // the first read starts the sampler and returns no data, later
+        // reads return a snapshot of the ring
+        chVTSet(&profile.vt, chTimeMS2I(1), profile_sample_cb, nullptr);
+        return;
+    }
+    str.append((const char *)profile.samples, PROFILE_NUM_SAMPLES * sizeof(uint32_t));
+}
+
 #if HAL_ENABLE_SAVE_PERSISTENT_PARAMS
 
 static const char *persistent_header = "{{PERSISTENT_START_V1}}\n";
@@ -454,3 +665,29 @@ void Util::apply_persistent_params(void) const
 
 #endif // HAL_ENABLE_SAVE_PERSISTENT_PARAMS
 
+
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+#include "CrashDump.h"
+
+/*
+  retrieve the crash dump written by the fault handlers of a previous
+  boot, exposed as @SYS/crash_dump.bin. The flash page is memory
+  mapped so this is a straight copy; the dump stays in place until the
+  next fault replaces it
+ */
+void Util::crash_dump(ExpandingString &str)
+{
+    const uint32_t addr = stm32_flash_getpageaddr(HAL_CRASH_DUMP_FLASHPAGE);
+    const uint32_t page_size = stm32_flash_getpagesize(HAL_CRASH_DUMP_FLASHPAGE);
+    if (addr == 0 || page_size < sizeof(struct crash_dump_header)) {
+        return;
+    }
+    const struct crash_dump_header *hdr = (const struct crash_dump_header *)addr;
+    if (hdr->magic != CRASH_DUMP_MAGIC) {
+        // no dump recorded
+        return;
+    }
+    const uint32_t stack_bytes = MIN(hdr->stack_bytes, page_size - sizeof(*hdr));
+    str.append((const char *)hdr, sizeof(*hdr) + stack_bytes);
+}
+#endif // HAL_CRASH_DUMP_FLASHPAGE
@@ -75,6 +75,13 @@ public:
     // request information on dma contention
     void dma_info(ExpandingString &str) override;
 #endif
+#if CH_CFG_USE_HEAP == TRUE
+    // request information on memory allocation for @SYS/memory.txt
+    void mem_info(ExpandingString &str) override;
+#endif
+
+    // request a snapshot of the sampled PC profile for @SYS/profile.bin
+    void profile_info(ExpandingString &str) override;
 
 #if HAL_ENABLE_SAVE_PERSISTENT_PARAMS
     // apply persistent parameters to current parameters
@@ -85,7 +92,12 @@ public:
     // save/load key persistent parameters in bootloader sector
     bool load_persistent_params(ExpandingString &str) const override;
 #endif
-    
+
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+    // retrieve the crash dump from the reserved flash page
+    void crash_dump(ExpandingString &str) override;
+#endif
+
 private:
 #ifdef HAL_PWM_ALARM
     struct ToneAlarmPwmGroup {
@@ -110,6 +122,10 @@ private:
     FlashBootloader flash_bootloader() override;
 #endif
 
+#ifndef HAL_NO_FLASH_SUPPORT
+    bool flash_swap_banks() override;
+#endif
+
 #ifdef ENABLE_HEAP
     static memory_heap_t scripting_heap;
 #endif // ENABLE_HEAP
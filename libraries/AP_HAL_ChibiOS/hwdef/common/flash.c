@@ -679,5 +679,58 @@ bool stm32_flash_recent_erase(void)
 }
 #endif
 
+#if defined(STM32H7) && defined(FLASH_OPTSR_SWAP_BANK_OPT)
+/*
+  dual-bank swap support. The SWAP_BANK option bit exchanges which
+  physical bank is aliased at 0x08000000 on the next reset, allowing a
+  new firmware image to be streamed into the inactive bank while the
+  current one keeps running
+ */
+#ifndef FLASH_OPTKEY1
+#define FLASH_OPTKEY1   0x08192A3B
+#endif
+#ifndef FLASH_OPTKEY2
+#define FLASH_OPTKEY2   0x4C5D6E7F
+#endif
+
+bool stm32_flash_get_bank_swap(void)
+{
+    return (FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK_OPT) != 0;
+}
+
+bool stm32_flash_set_bank_swap(bool enable)
+{
+    if (stm32_flash_get_bank_swap() == enable) {
+        return true;
+    }
+    stm32_flash_wait_idle();
+
+    if (FLASH->OPTCR & FLASH_OPTCR_OPTLOCK) {
+        /* Option byte unlock sequence */
+        FLASH->OPTKEYR = FLASH_OPTKEY1;
+        FLASH->OPTKEYR = FLASH_OPTKEY2;
+    }
+    if (FLASH->OPTCR & FLASH_OPTCR_OPTLOCK) {
+        return false;
+    }
+
+    uint32_t optsr = FLASH->OPTSR_CUR;
+    if (enable) {
+        optsr |= FLASH_OPTSR_SWAP_BANK_OPT;
+    } else {
+        optsr &= ~FLASH_OPTSR_SWAP_BANK_OPT;
+    }
+    FLASH->OPTSR_PRG = optsr;
+    FLASH->OPTCR |= FLASH_OPTCR_OPTSTART;
+
+    while (FLASH->OPTSR_CUR & FLASH_OPTSR_OPT_BUSY) {
+        // nop
+    }
+    FLASH->OPTCR |= FLASH_OPTCR_OPTLOCK;
+
+    return stm32_flash_get_bank_swap() == enable;
+}
+#endif // STM32H7 && FLASH_OPTSR_SWAP_BANK_OPT
+
 #endif // HAL_NO_FLASH_SUPPORT
 
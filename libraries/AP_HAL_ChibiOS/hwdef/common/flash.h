@@ -30,6 +30,11 @@ bool stm32_flash_ispageerased(uint32_t page);
 #ifndef HAL_BOOTLOADER_BUILD
 bool stm32_flash_recent_erase(void);
 #endif
+#if defined(STM32H7) && defined(FLASH_OPTSR_SWAP_BANK_OPT)
+// dual-bank swap control, takes effect on the next reset
+bool stm32_flash_get_bank_swap(void);
+bool stm32_flash_set_bank_swap(bool enable);
+#endif
 #ifdef __cplusplus
 }
 #endif
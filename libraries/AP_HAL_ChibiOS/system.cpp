@@ -21,6 +21,8 @@
 #include <AP_BoardConfig/AP_BoardConfig.h>
 #include "hwdef/common/watchdog.h"
 #include "hwdef/common/stm32_util.h"
+#include "hwdef/common/flash.h"
+#include "CrashDump.h"
 
 #include <ch.h>
 #include "hal.h"
@@ -93,6 +95,67 @@ static void save_fault_watchdog(uint16_t line, FaultType fault_type, uint32_t fa
 #endif
 }
 
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+/*
+  write a crash dump to the reserved flash page, bypassing the
+  filesystem. The header carries the registers, fault status and the
+  persistent data (scheduler task, semaphore line and internal error
+  state), followed by a copy of the faulting stack starting at the
+  exception frame. Read back after reboot via @SYS/crash_dump.bin
+ */
+void crash_dump_save(uint32_t fault_type, uint32_t fault_addr, uint32_t sp)
+{
+    static bool saved;
+    if (saved) {
+        // keep the first fault of this boot
+        return;
+    }
+    saved = true;
+
+    const uint32_t addr = stm32_flash_getpageaddr(HAL_CRASH_DUMP_FLASHPAGE);
+    const uint32_t page_size = stm32_flash_getpagesize(HAL_CRASH_DUMP_FLASHPAGE);
+    if (addr == 0 || page_size < sizeof(struct crash_dump_header)) {
+        return;
+    }
+    // a dump from a previous boot is replaced by this fault
+    if (!stm32_flash_ispageerased(HAL_CRASH_DUMP_FLASHPAGE) &&
+        !stm32_flash_erasepage(HAL_CRASH_DUMP_FLASHPAGE)) {
+        return;
+    }
+
+    struct crash_dump_header hdr {};
+    hdr.magic = CRASH_DUMP_MAGIC;
+    hdr.fault_type = fault_type;
+    hdr.fault_addr = fault_addr;
+    hdr.icsr = SCB->ICSR;
+    hdr.cfsr = SCB->CFSR;
+    const struct port_extctx *ctx = (const struct port_extctx *)sp;
+    hdr.r0 = ctx->r0;
+    hdr.r1 = ctx->r1;
+    hdr.r2 = ctx->r2;
+    hdr.r3 = ctx->r3;
+    hdr.r12 = ctx->r12;
+    hdr.lr = (uint32_t)ctx->lr_thd;
+    hdr.pc = (uint32_t)ctx->pc;
+    hdr.xpsr = ctx->xpsr;
+    hdr.sp = sp;
+    thread_t *tp = chThdGetSelfX();
+    if (tp != nullptr && tp->name != nullptr) {
+        strncpy_noterm(hdr.thread_name, tp->name, sizeof(hdr.thread_name)-1);
+    }
+    hdr.pd = hal.util->persistent_data;
+    // copy the faulting stack when sp looks like a RAM address
+    if ((sp & 0xF0000000U) == 0x20000000U) {
+        hdr.stack_bytes = MIN(1024U, page_size - sizeof(hdr));
+    }
+
+    stm32_flash_write(addr, &hdr, sizeof(hdr));
+    if (hdr.stack_bytes != 0) {
+        stm32_flash_write(addr + sizeof(hdr), (const void *)sp, hdr.stack_bytes);
+    }
+}
+#endif // HAL_CRASH_DUMP_FLASHPAGE
+
 void HardFault_Handler(void);
 void HardFault_Handler(void) {
     //Copy to local variables (not pointers) to allow GDB "i loc" to directly show the info
@@ -121,6 +184,10 @@ void HardFault_Handler(void) {
 
     save_fault_watchdog(__LINE__, faultType, faultAddress, (uint32_t)ctx.lr_thd);
 
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+    crash_dump_save((uint32_t)faultType, faultAddress, __get_PSP());
+#endif
+
 #ifdef HAL_GPIO_PIN_FAULT
     while (true) {
         fault_printf("HARDFAULT\n");
@@ -174,6 +241,10 @@ void UsageFault_Handler(void) {
 
     save_fault_watchdog(__LINE__, faultType, faultAddress, (uint32_t)ctx.lr_thd);
 
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+    crash_dump_save((uint32_t)faultType, faultAddress, __get_PSP());
+#endif
+
     //Cause debugger to stop. Ignored if no debugger is attached
     while(1) {}
 }
@@ -206,6 +277,10 @@ void MemManage_Handler(void) {
 
     save_fault_watchdog(__LINE__, faultType, faultAddress, (uint32_t)ctx.lr_thd);
 
+#if defined(HAL_CRASH_DUMP_FLASHPAGE)
+    crash_dump_save((uint32_t)faultType, faultAddress, __get_PSP());
+#endif
+
     while(1) {}
 }
 }
@@ -44,6 +44,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FLOW_PX4_NEON 1
+#else
+#define FLOW_PX4_NEON 0
+#endif
+
 extern const AP_HAL::HAL& hal;
 
 using namespace Linux;
@@ -137,6 +144,24 @@ static inline uint32_t compute_sad(uint8_t *image1, uint8_t *image2,
     unsigned int i,j;
     uint32_t acc = 0;
 
+#if FLOW_PX4_NEON
+    /* the 8x8 window is the common case (HAL_FLOW_PX4_MAX_FLOW_PIXEL
+     * of 4). One vabal per row accumulates the absolute differences of
+     * a whole row, and the SAD search dominates the flow cost
+     */
+    if (window_size == 8) {
+        uint16x8_t sum = vdupq_n_u16(0);
+        for (j = 0; j < 8; j++) {
+            const uint8x8_t a = vld1_u8(&image1[off1 + j*row_size]);
+            const uint8x8_t b = vld1_u8(&image2[off2 + j*row_size]);
+            sum = vabal_u8(sum, a, b);
+        }
+        const uint32x4_t sum32 = vpaddlq_u16(sum);
+        const uint64x2_t sum64 = vpaddlq_u32(sum32);
+        return vgetq_lane_u64(sum64, 0) + vgetq_lane_u64(sum64, 1);
+    }
+#endif
+
     for (i = 0; i < window_size; i++) {
         for (j = 0; j < window_size; j++) {
             acc += abs(image1[off1 + i + j*row_size] -
@@ -189,6 +189,7 @@ int16_t CANIface::receive(AP_HAL::CANFrame& out_frame, uint64_t& out_timestamp_u
         out_frame        = rx.frame;
         out_timestamp_us = rx.timestamp_us;
         out_flags        = rx.flags;
+        capture_frame(_self_index, rx);
     }
     (void)_rx_queue.pop();
     return 1;
@@ -70,11 +70,21 @@ DSP::FFTWindowStateSITL::FFTWindowStateSITL(uint16_t window_size, uint16_t sampl
     }
 
     buf = new complexf[window_size];
+
+    // the window size is fixed for the life of the instance so the twiddle
+    // factors can be computed once here rather than on every FFT
+    twiddles = new complexf[window_size / 2];
+    if (twiddles != nullptr) {
+        for (uint16_t a = 0; a < window_size / 2; a++) {
+            twiddles[a] = complexf(sinf(2 * M_PI * (a + (window_size / 4)) / window_size), sinf(2 * M_PI * a / window_size));
+        }
+    }
 }
 
 DSP::FFTWindowStateSITL::~FFTWindowStateSITL()
 {
     delete[] buf;
+    delete[] twiddles;
 }
 
 // step 1: filter the incoming samples through a Hanning window
@@ -96,7 +106,7 @@ void DSP::step_fft(FFTWindowStateSITL* fft)
         fft->buf[i] = complexf(fft->_freq_bins[i], 0);
     }
 
-    calculate_fft(fft->buf, fft->_window_size);
+    calculate_fft(fft, fft->buf, fft->_window_size);
 
     for (uint16_t i = 0; i < fft->_bin_count; i++) {
         fft->_freq_bins[i] = std::norm(fft->buf[i]);
@@ -158,7 +168,7 @@ static uint16_t fft_log2(uint16_t n)
 
 // calculate the in-place FFT of the input using the Cooley–Tukey algorithm
 // this is a translation of Ron Nicholson's version in http://www.nicholson.com/dsp.fft1.html
-void DSP::calculate_fft(complexf *samples, uint16_t fftlen)
+void DSP::calculate_fft(FFTWindowStateSITL* fft, complexf *samples, uint16_t fftlen)
 {
     uint16_t m = fft_log2(fftlen);
     // shuffle data using bit reversed addressing ***
@@ -187,7 +197,7 @@ void DSP::calculate_fft(complexf *samples, uint16_t fftlen)
         uint16_t astep = fftlen / istep;
         for (uint16_t km = 0; km < is2; km++) { // outer row loop
             uint16_t a  = km * astep; // twiddle angle index
-            complexf w(sinf(2 * M_PI * (a+(fftlen/4)) / fftlen), sinf(2 * M_PI * a / fftlen));
+            const complexf w = fft->twiddles[a];
             for (uint16_t ki = 0; ki <= (fftlen - istep); ki += istep) { // inner column loop
                 uint16_t i = km + ki;
                 uint16_t j = is2 + i;
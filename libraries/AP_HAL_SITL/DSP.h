@@ -43,6 +43,8 @@ public:
 
     private:
         complexf* buf;
+        // twiddle factors precomputed for the window size at init
+        complexf* twiddles;
     };
 
 private:
@@ -52,5 +54,5 @@ private:
     void vector_max_float(const float* vin, uint16_t len, float* maxValue, uint16_t* maxIndex) const override;
     void vector_scale_float(const float* vin, float scale, float* vout, uint16_t len) const override;
     float vector_mean_float(const float* vin, uint16_t len) const override;
-    void calculate_fft(complexf* f, uint16_t length);
+    void calculate_fft(FFTWindowStateSITL* fft, complexf* f, uint16_t length);
 };
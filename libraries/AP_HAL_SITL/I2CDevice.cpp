@@ -153,6 +153,9 @@ bool I2CDevice::transfer(const uint8_t *send, uint32_t send_len,
     if (!_transfer(send, send_len, recv, recv_len)) {
         return false;
     }
+
+    capture_transfer(send, send_len, recv, recv_len);
+
     return true;
 }
 
@@ -102,6 +102,10 @@ void SITL_State::_sitl_setup(const char *home_str)
             fg_socket.connect(_fg_address, _fg_view_port);
         }
 
+        if (_use_sim_state) {
+            sim_state_socket.connect(_sim_state_address, _sim_state_port);
+        }
+
         fprintf(stdout, "Using Irlock at port : %d\n", _irlock_port);
         _sitl->irlock_port = _irlock_port;
     }
@@ -598,6 +602,40 @@ void SITL_State::_output_to_flightgear(void)
     fg_socket.send(&fdm, sizeof(fdm));
 }
 
+/*
+  output a fixed-layout binary state packet, bypassing MAVLink. Used by
+  farm monitoring where a MAVLink stream per subscriber is too expensive
+ */
+void SITL_State::_output_sim_state(void)
+{
+    sim_state_packet pkt {};
+    const SITL::sitl_fdm &sfdm = _sitl->state;
+
+    pkt.magic = SIM_STATE_PACKET_MAGIC;
+    pkt.instance = _instance;
+    pkt.timestamp_us = sfdm.timestamp_us;
+    pkt.latitude = sfdm.latitude;
+    pkt.longitude = sfdm.longitude;
+    pkt.altitude = sfdm.altitude;
+    pkt.rollDeg = sfdm.rollDeg;
+    pkt.pitchDeg = sfdm.pitchDeg;
+    pkt.yawDeg = sfdm.yawDeg;
+    pkt.speedN = sfdm.speedN;
+    pkt.speedE = sfdm.speedE;
+    pkt.speedD = sfdm.speedD;
+    pkt.xAccel = sfdm.xAccel;
+    pkt.yAccel = sfdm.yAccel;
+    pkt.zAccel = sfdm.zAccel;
+    pkt.rollRate = sfdm.rollRate;
+    pkt.pitchRate = sfdm.pitchRate;
+    pkt.yawRate = sfdm.yawRate;
+    pkt.airspeed = sfdm.airspeed;
+    pkt.battery_voltage = sfdm.battery_voltage;
+    pkt.battery_current = sfdm.battery_current;
+
+    sim_state_socket.send(&pkt, sizeof(pkt));
+}
+
 /*
   get FDM input from a local model
  */
@@ -725,6 +763,10 @@ void SITL_State::_fdm_input_local(void)
         _output_to_flightgear();
     }
 
+    if (_sitl && _use_sim_state) {
+        _output_sim_state();
+    }
+
     // update simulation time
     if (_sitl) {
         hal.scheduler->stop_clock(_sitl->state.timestamp_us);
@@ -149,6 +149,9 @@ private:
     };
 
 #define MAX_GPS_DELAY 100
+
+// identifies packets of the raw binary state stream ("SSIM")
+#define SIM_STATE_PACKET_MAGIC 0x4d495353
     gps_data _gps_data[2][MAX_GPS_DELAY];
 
     bool _gps_has_basestation_position;
@@ -180,6 +183,7 @@ private:
     bool _read_rc_sitl_input();
     void _fdm_input_local(void);
     void _output_to_flightgear(void);
+    void _output_sim_state(void);
     void _simulator_servos(struct sitl_input &input);
     void _fdm_input_step(void);
 
@@ -209,9 +213,31 @@ private:
 
     bool _use_rtscts;
     bool _use_fg_view;
-    
+
     const char *_fg_address;
 
+    // raw binary state output enabled with --sim-state-port; used by
+    // farm monitoring to read vehicle state without a MAVLink
+    // connection per subscriber. A fixed-layout packet is sent at the
+    // simulation rate, optionally to a multicast group
+    struct PACKED sim_state_packet {
+        uint32_t magic;   // SIM_STATE_PACKET_MAGIC
+        uint32_t instance;
+        uint64_t timestamp_us;
+        double latitude, longitude;          // degrees
+        float altitude;                      // m MSL
+        float rollDeg, pitchDeg, yawDeg;     // euler angles, degrees
+        float speedN, speedE, speedD;        // m/s
+        float xAccel, yAccel, zAccel;        // m/s/s in body frame
+        float rollRate, pitchRate, yawRate;  // degrees/s in body frame
+        float airspeed;                      // m/s
+        float battery_voltage;               // Volts
+        float battery_current;               // Amps
+    };
+    bool _use_sim_state;
+    uint16_t _sim_state_port;
+    const char *_sim_state_address = "127.0.0.1";
+
     // delay buffer variables
     static const uint8_t mag_buffer_length = 250;
     static const uint8_t wind_buffer_length = 50;
@@ -306,6 +332,9 @@ private:
     
     // output socket for flightgear viewing
     SocketAPM fg_socket{true};
+
+    // output socket for the raw binary state stream
+    SocketAPM sim_state_socket{true};
     
     const char *defaults_path = HAL_PARAM_DEFAULTS_PATH;
 
@@ -101,6 +101,8 @@ void SITL_State::_usage(void)
            "\t--irlock-port PORT       set port num for irlock\n"
            "\t--start-time TIMESTR     set simulation start time in UNIX timestamp\n"
            "\t--sysid ID               set SYSID_THISMAV\n"
+           "\t--sim-state-port PORT    enable raw binary state output on UDP port\n"
+           "\t--sim-state-address ADDR set address for raw state output (may be multicast), defaults to 127.0.0.1\n"
         );
 }
 
@@ -238,6 +240,8 @@ void SITL_State::_parse_command_line(int argc, char * const argv[])
         CMDLINE_IRLOCK_PORT,
         CMDLINE_START_TIME,
         CMDLINE_SYSID,
+        CMDLINE_SIM_STATE_PORT,
+        CMDLINE_SIM_STATE_ADDRESS,
     };
 
     const struct GetOptLong::option options[] = {
@@ -276,6 +280,8 @@ void SITL_State::_parse_command_line(int argc, char * const argv[])
         {"irlock-port",     true,   0, CMDLINE_IRLOCK_PORT},
         {"start-time",      true,   0, CMDLINE_START_TIME},
         {"sysid",           true,   0, CMDLINE_SYSID},
+        {"sim-state-port",  true,   0, CMDLINE_SIM_STATE_PORT},
+        {"sim-state-address", true, 0, CMDLINE_SIM_STATE_ADDRESS},
         {0, false, 0, 0}
     };
 
@@ -405,6 +411,13 @@ void SITL_State::_parse_command_line(int argc, char * const argv[])
         case CMDLINE_START_TIME:
             start_time_UTC = atoi(gopt.optarg);
             break;
+        case CMDLINE_SIM_STATE_PORT:
+            _sim_state_port = atoi(gopt.optarg);
+            _use_sim_state = true;
+            break;
+        case CMDLINE_SIM_STATE_ADDRESS:
+            _sim_state_address = gopt.optarg;
+            break;
         case CMDLINE_SYSID: {
             const int32_t sysid = atoi(gopt.optarg);
             if (sysid < 1 || sysid > 255) {
@@ -208,9 +208,28 @@ void AP_IOMCU::thread_main(void)
 
         // check for regular timed events
         uint32_t now = AP_HAL::millis();
-        if (now - last_rc_read_ms > 20) {
-            // read RC input at 50Hz
-            read_rc_input();
+        if (now - last_rc_read_ms > 2) {
+            // poll the RC frame counter, which is a single register,
+            // and transfer the full RC input page only when the IOMCU
+            // has received a new frame. This cuts both the bus
+            // traffic and the latency of the old fixed 50Hz full-page
+            // poll
+            uint16_t frame_count;
+            const uint8_t frame_reg = offsetof(struct page_rc_input, frame_count)/2;
+            if (read_registers(PAGE_RAW_RCIN, frame_reg, 1, &frame_count)) {
+                if (frame_count != rc_frame_count || now - last_rc_full_read_ms > 50) {
+                    // also do a periodic full read to pick up flag
+                    // changes when no frames are arriving
+                    read_rc_input();
+                    rc_frame_count = frame_count;
+                    last_rc_full_read_ms = now;
+                }
+            } else if (now - last_rc_full_read_ms > 20) {
+                // fall back to timed full reads for firmware without
+                // the frame counter register
+                read_rc_input();
+                last_rc_full_read_ms = now;
+            }
             last_rc_read_ms = AP_HAL::millis();
         }
 
@@ -145,6 +145,7 @@ private:
     // time when we last read various pages
     uint32_t last_status_read_ms;
     uint32_t last_rc_read_ms;
+    uint32_t last_rc_full_read_ms;
     uint32_t last_servo_read_ms;
     uint32_t last_safety_option_check_ms;
 
@@ -172,6 +173,9 @@ private:
 
     // PAGE_RAW_RCIN values
     struct page_rc_input rc_input;
+
+    // last RC frame counter value seen from the IOMCU
+    uint16_t rc_frame_count;
     uint32_t rc_last_input_ms;
 
     // MIXER values
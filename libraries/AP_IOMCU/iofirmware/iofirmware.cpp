@@ -305,6 +305,7 @@ void AP_IOMCU_FW::rcin_update()
         rc_last_input_ms = last_ms;
         rc_input.rc_protocol = (uint16_t)AP::RC().protocol_detected();
         rc_input.rssi = AP::RC().get_RSSI();
+        rc_input.frame_count++;
     } else if (last_ms - rc_last_input_ms > 200U) {
         rc_input.flags_rc_ok = false;
     }
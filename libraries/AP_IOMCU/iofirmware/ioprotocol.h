@@ -125,6 +125,9 @@ struct page_rc_input {
     uint8_t rc_protocol;
     uint16_t pwm[IOMCU_MAX_CHANNELS];
     int16_t rssi;
+    // incremented on each new RC frame. The FMU polls this single
+    // register and only transfers the full page when it changes
+    uint16_t frame_count;
 };
 
 /*
@@ -628,6 +628,14 @@ const AP_Param::GroupInfo AP_InertialSensor::var_info[] = {
     // @Bitmask: 0:PersistParams
     // @User: Advanced
     AP_GROUPINFO("TCAL_OPTIONS", 52, AP_InertialSensor, tcal_options, 0),
+
+    // @Param: FAST_AAF
+    // @DisplayName: Fast sampling anti-alias filter mask
+    // @Description: Mask of IMUs to apply a second order CIC decimation filter to when fast sampling, improving rejection of above-Nyquist gyro noise at a cost of two vector additions per raw sample
+    // @User: Advanced
+    // @Bitmask: 0:FirstIMU,1:SecondIMU,2:ThirdIMU
+    // @RebootRequired: True
+    AP_GROUPINFO("FAST_AAF", 53, AP_InertialSensor, _fast_aaf_mask, 0),
     
 #endif // HAL_INS_TEMPERATURE_CAL_ENABLE
 
@@ -663,9 +671,9 @@ AP_InertialSensor::AP_InertialSensor() :
 }
 
 /*
- * Get the AP_InertialSensor singleton
+ * slow path of get_singleton(), constructs the frontend on first use
  */
-AP_InertialSensor *AP_InertialSensor::get_singleton()
+AP_InertialSensor *AP_InertialSensor::create_singleton()
 {
     if (!_singleton) {
         _singleton = new AP_InertialSensor();
@@ -1491,6 +1499,54 @@ void AP_InertialSensor::_save_gyro_calibration()
 /*
   update gyro and accel values from backends
  */
+/*
+  time-align the per-instance delta sets. Each backend's accumulator
+  ends at its own last sample time, so with heterogeneous IMUs (e.g.
+  8kHz and 1kHz) the deltas the EKF treats as simultaneous can differ
+  in phase by up to one slow-sensor period. Extend each instance's
+  window to the most recent end time using its current rate as a
+  first order fractional-delay prediction, and remove the previous
+  update's prediction now that the real motion for that gap is in the
+  accumulator, so nothing is counted twice
+ */
+void AP_InertialSensor::align_deltas(void)
+{
+    // the most recent window end among instances with fresh data is
+    // the common reference time
+    uint64_t ref_us = 0;
+    for (uint8_t i=0; i<INS_MAX_INSTANCES; i++) {
+        if (_delta_angle_valid[i] && _delta_angle_end_us[i] > ref_us) {
+            ref_us = _delta_angle_end_us[i];
+        }
+        if (_delta_velocity_valid[i] && _delta_velocity_end_us[i] > ref_us) {
+            ref_us = _delta_velocity_end_us[i];
+        }
+    }
+    if (ref_us == 0) {
+        return;
+    }
+
+    for (uint8_t i=0; i<INS_MAX_INSTANCES; i++) {
+        if (_delta_angle_valid[i] && _delta_angle_end_us[i] != 0) {
+            // limit the prediction to one slow-sensor period worth
+            const float gap = constrain_float((ref_us - _delta_angle_end_us[i]) * 1.0e-6f, 0, 0.01f);
+            const Vector3f corr = _gyro[i] * gap;
+            _delta_angle[i] += corr - _delta_angle_align[i];
+            _delta_angle_dt[i] = MAX(_delta_angle_dt[i] + gap - _delta_angle_align_dt[i], 0.0f);
+            _delta_angle_align[i] = corr;
+            _delta_angle_align_dt[i] = gap;
+        }
+        if (_delta_velocity_valid[i] && _delta_velocity_end_us[i] != 0) {
+            const float gap = constrain_float((ref_us - _delta_velocity_end_us[i]) * 1.0e-6f, 0, 0.01f);
+            const Vector3f corr = _accel[i] * gap;
+            _delta_velocity[i] += corr - _delta_velocity_align[i];
+            _delta_velocity_dt[i] = MAX(_delta_velocity_dt[i] + gap - _delta_velocity_align_dt[i], 0.0f);
+            _delta_velocity_align[i] = corr;
+            _delta_velocity_align_dt[i] = gap;
+        }
+    }
+}
+
 void AP_InertialSensor::update(void)
 {
     // during initialisation update() may be called without
@@ -1500,8 +1556,7 @@ void AP_InertialSensor::update(void)
     if (!_hil_mode) {
         for (uint8_t i=0; i<INS_MAX_INSTANCES; i++) {
             // mark sensors unhealthy and let update() in each backend
-            // mark them healthy via _publish_gyro() and
-            // _publish_accel()
+            // mark them healthy via update_gyro() and update_accel()
             _gyro_healthy[i] = false;
             _accel_healthy[i] = false;
             _delta_velocity_valid[i] = false;
@@ -1511,13 +1566,13 @@ void AP_InertialSensor::update(void)
             _backends[i]->update();
         }
 
-        // clear accumulators
-        for (uint8_t i = 0; i < INS_MAX_INSTANCES; i++) {
-            _delta_velocity_acc[i].zero();
-            _delta_velocity_acc_dt[i] = 0;
-            _delta_angle_acc[i].zero();
-            _delta_angle_acc_dt[i] = 0;
-        }
+        // note that the accumulators are not cleared here; consuming
+        // them is flagged to the sensor threads via the consumption
+        // epochs in update_gyro()/update_accel(), so the main loop
+        // never writes data owned by the sensor threads
+
+        // bring the per-instance delta sets to a common end time
+        align_deltas();
 
         if (!_startup_error_counts_set) {
             for (uint8_t i=0; i<INS_MAX_INSTANCES; i++) {
@@ -2388,11 +2443,3 @@ void AP_InertialSensor::handle_external(const AP_ExternalAHRS::ins_data_message_
 }
 #endif // HAL_EXTERNAL_AHRS_ENABLED
 
-namespace AP {
-
-AP_InertialSensor &ins()
-{
-    return *AP_InertialSensor::get_singleton();
-}
-
-};
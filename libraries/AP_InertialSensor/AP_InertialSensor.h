@@ -41,6 +41,7 @@
 #include <AP_AccelCal/AP_AccelCal.h>
 #include <AP_HAL/AP_HAL.h>
 #include <AP_HAL/utility/RingBuffer.h>
+#include <AP_HAL/utility/SeqLock.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_ExternalAHRS/AP_ExternalAHRS.h>
 #include <Filter/LowPassFilter2p.h>
@@ -77,7 +78,15 @@ public:
     AP_InertialSensor(const AP_InertialSensor &other) = delete;
     AP_InertialSensor &operator=(const AP_InertialSensor&) = delete;
 
-    static AP_InertialSensor *get_singleton();
+    // inline fast path so that hot-path callers avoid a cross
+    // translation unit call; construction on first use stays out of
+    // line
+    static AP_InertialSensor *get_singleton() {
+        if (_singleton != nullptr) {
+            return _singleton;
+        }
+        return create_singleton();
+    }
 
     enum Gyro_Calibration_Timing {
         GYRO_CAL_NEVER = 0,
@@ -498,6 +507,82 @@ private:
     bool _new_accel_data[INS_MAX_INSTANCES];
     bool _new_gyro_data[INS_MAX_INSTANCES];
 
+    // lock-free exchange of the latest filtered sample and
+    // accumulator state from the sensor bus threads to the main
+    // loop. Written by the backends after each sample burst and read
+    // by update_gyro()/update_accel() without taking the backend
+    // semaphore, so the fast loop never blocks on a bus thread
+    struct GyroExchange {
+        Vector3f gyro;
+        Vector3f delta_angle;
+        float dt;
+        // time the accumulated window ends at, for cross-instance alignment
+        uint64_t sample_us;
+#if HAL_WITH_DSP
+        Vector3f raw;
+#endif
+    };
+    struct AccelExchange {
+        Vector3f accel;
+        Vector3f delta_velocity;
+        float dt;
+        uint64_t sample_us;
+    };
+    SeqLock<GyroExchange> _gyro_exchange[INS_MAX_INSTANCES];
+    SeqLock<AccelExchange> _accel_exchange[INS_MAX_INSTANCES];
+    // sequence numbers of the last exchange values consumed by the
+    // main loop. Only touched by the main loop
+    uint32_t _gyro_exchange_seq[INS_MAX_INSTANCES];
+    uint32_t _accel_exchange_seq[INS_MAX_INSTANCES];
+
+    /*
+      time alignment of per-instance delta sets. The end time of each
+      instance's accumulated window and the correction applied last
+      update, so align_deltas() can keep the published deltas phase
+      coherent across heterogeneous IMUs without double counting
+     */
+    uint64_t _delta_angle_end_us[INS_MAX_INSTANCES];
+    uint64_t _delta_velocity_end_us[INS_MAX_INSTANCES];
+    Vector3f _delta_angle_align[INS_MAX_INSTANCES];
+    float    _delta_angle_align_dt[INS_MAX_INSTANCES];
+    Vector3f _delta_velocity_align[INS_MAX_INSTANCES];
+    float    _delta_velocity_align_dt[INS_MAX_INSTANCES];
+
+    void align_deltas(void);
+
+    // fused calibration transform. Sensor orientation, offsets, scale
+    // factors and board orientation collapse to a single affine
+    // transform (out = mat * raw + offset) when no calibration or
+    // temperature compensation is active. Recomputed by the backends
+    // in the main loop and read by the sensor threads, so the raw
+    // sample path applies the whole chain with one matrix multiply
+    struct FusedCorrection {
+        Matrix3f mat;
+        Vector3f offset;
+        bool valid;
+    };
+    SeqLock<FusedCorrection> _accel_fused[INS_MAX_INSTANCES];
+    SeqLock<FusedCorrection> _gyro_fused[INS_MAX_INSTANCES];
+    // sensor-thread copies of the fused transforms, refreshed from
+    // the seqlock only when the sequence number advances. Only
+    // touched by the sensor thread owning the instance
+    FusedCorrection _accel_fused_cache[INS_MAX_INSTANCES];
+    FusedCorrection _gyro_fused_cache[INS_MAX_INSTANCES];
+    uint32_t _accel_fused_cache_seq[INS_MAX_INSTANCES];
+    uint32_t _gyro_fused_cache_seq[INS_MAX_INSTANCES];
+
+    // accumulator state already consumed by the main loop. The
+    // sensor thread subtracts these when it sees the epoch advance,
+    // so the main loop never writes the accumulators directly
+    Vector3f _delta_angle_consumed[INS_MAX_INSTANCES];
+    float _delta_angle_consumed_dt[INS_MAX_INSTANCES];
+    std::atomic<uint32_t> _delta_angle_consume_epoch[INS_MAX_INSTANCES];
+    uint32_t _delta_angle_ack_epoch[INS_MAX_INSTANCES];
+    Vector3f _delta_velocity_consumed[INS_MAX_INSTANCES];
+    float _delta_velocity_consumed_dt[INS_MAX_INSTANCES];
+    std::atomic<uint32_t> _delta_velocity_consume_epoch[INS_MAX_INSTANCES];
+    uint32_t _delta_velocity_ack_epoch[INS_MAX_INSTANCES];
+
     // optional notch filter on gyro
     NotchFilterParams _notch_filter;
     NotchFilterVector3f _gyro_notch_filter[INS_MAX_INSTANCES];
@@ -577,6 +662,9 @@ private:
     // control enable of fast sampling
     AP_Int8     _fast_sampling_mask;
 
+    // control enable of the CIC decimation filter when fast sampling
+    AP_Int8     _fast_aaf_mask;
+
     // control enable of fast sampling
     AP_Int8     _fast_sampling_rate;
 
@@ -667,6 +755,8 @@ private:
     AP_Int8 _trim_option;
 
     static AP_InertialSensor *_singleton;
+    // construct the frontend on first use of get_singleton()
+    static AP_InertialSensor *create_singleton();
     AP_AccelCal* _acal;
 
     AccelCalibrator *_accel_calibrator;
@@ -790,5 +880,7 @@ private:
 };
 
 namespace AP {
-    AP_InertialSensor &ins();
+    inline AP_InertialSensor &ins() {
+        return *AP_InertialSensor::get_singleton();
+    }
 };
@@ -84,7 +84,7 @@ void AP_InertialSensor_Backend::_update_sensor_rate(uint16_t &count, uint32_t &s
     }
 }
 
-void AP_InertialSensor_Backend::_rotate_and_correct_accel(uint8_t instance, Vector3f &accel) 
+void AP_InertialSensor_Backend::_rotate_and_correct_accel(uint8_t instance, Vector3f &accel)
 {
     /*
       accel calibration is always done in sensor frame with this
@@ -92,6 +92,27 @@ void AP_InertialSensor_Backend::_rotate_and_correct_accel(uint8_t instance, Vect
       offsets and scaling.
      */
 
+    /*
+      fast path: when no calibration or temperature compensation is
+      active the whole chain below collapses to the precomputed affine
+      transform published by update_accel_fused_correction(). The
+      local copy is only refreshed when the sequence number shows the
+      main loop has published a new transform
+     */
+    if (_imu._accel_fused[instance].sequence() != _imu._accel_fused_cache_seq[instance]) {
+        _imu._accel_fused_cache_seq[instance] = _imu._accel_fused[instance].read(_imu._accel_fused_cache[instance]);
+    }
+    const AP_InertialSensor::FusedCorrection &fused = _imu._accel_fused_cache[instance];
+    bool fused_ok = fused.valid && !_imu._calibrating_accel &&
+        (_imu._acal == nullptr || !_imu._acal->running());
+#if HAL_INS_TEMPERATURE_CAL_ENABLE
+    fused_ok = fused_ok && !_imu.tcal_learning;
+#endif
+    if (fused_ok) {
+        accel = fused.mat * accel + fused.offset;
+        return;
+    }
+
     // rotate for sensor orientation
     accel.rotate(_imu._accel_orientation[instance]);
 
@@ -127,8 +148,22 @@ void AP_InertialSensor_Backend::_rotate_and_correct_accel(uint8_t instance, Vect
     }
 }
 
-void AP_InertialSensor_Backend::_rotate_and_correct_gyro(uint8_t instance, Vector3f &gyro) 
+void AP_InertialSensor_Backend::_rotate_and_correct_gyro(uint8_t instance, Vector3f &gyro)
 {
+    // fast path, as for _rotate_and_correct_accel()
+    if (_imu._gyro_fused[instance].sequence() != _imu._gyro_fused_cache_seq[instance]) {
+        _imu._gyro_fused_cache_seq[instance] = _imu._gyro_fused[instance].read(_imu._gyro_fused_cache[instance]);
+    }
+    const AP_InertialSensor::FusedCorrection &fused = _imu._gyro_fused_cache[instance];
+    bool fused_ok = fused.valid && !_imu._calibrating_gyro;
+#if HAL_INS_TEMPERATURE_CAL_ENABLE
+    fused_ok = fused_ok && !_imu.tcal_learning;
+#endif
+    if (fused_ok) {
+        gyro = fused.mat * gyro + fused.offset;
+        return;
+    }
+
     // rotate for sensor orientation
     gyro.rotate(_imu._gyro_orientation[instance]);
 
@@ -157,20 +192,56 @@ void AP_InertialSensor_Backend::_rotate_and_correct_gyro(uint8_t instance, Vecto
 }
 
 /*
-  rotate gyro vector and add the gyro offset
+  subtract delta angle accumulator state already consumed by the main
+  loop. Must be called with _sem held, before new samples are
+  integrated, so only unconsumed motion remains in the accumulator
  */
-void AP_InertialSensor_Backend::_publish_gyro(uint8_t instance, const Vector3f &gyro)
+void AP_InertialSensor_Backend::ack_gyro_consumption(uint8_t instance)
 {
-    if ((1U<<instance) & _imu.imu_kill_mask) {
-        return;
+    const uint32_t epoch = _imu._delta_angle_consume_epoch[instance].load(std::memory_order_acquire);
+    if (epoch != _imu._delta_angle_ack_epoch[instance]) {
+        _imu._delta_angle_acc[instance] -= _imu._delta_angle_consumed[instance];
+        _imu._delta_angle_acc_dt[instance] -= _imu._delta_angle_consumed_dt[instance];
+        _imu._delta_angle_ack_epoch[instance] = epoch;
+    }
+}
+
+void AP_InertialSensor_Backend::ack_accel_consumption(uint8_t instance)
+{
+    const uint32_t epoch = _imu._delta_velocity_consume_epoch[instance].load(std::memory_order_acquire);
+    if (epoch != _imu._delta_velocity_ack_epoch[instance]) {
+        _imu._delta_velocity_acc[instance] -= _imu._delta_velocity_consumed[instance];
+        _imu._delta_velocity_acc_dt[instance] -= _imu._delta_velocity_consumed_dt[instance];
+        _imu._delta_velocity_ack_epoch[instance] = epoch;
     }
-    _imu._gyro[instance] = gyro;
-    _imu._gyro_healthy[instance] = true;
+}
+
+/*
+  publish the filtered gyro and delta angle accumulator state through
+  the lock-free exchange so the main loop can pick them up without
+  blocking on _sem. Must be called with _sem held
+ */
+void AP_InertialSensor_Backend::publish_gyro_exchange(uint8_t instance)
+{
+    AP_InertialSensor::GyroExchange sample;
+    sample.gyro = _imu._gyro_filtered[instance];
+    sample.delta_angle = _imu._delta_angle_acc[instance];
+    sample.dt = _imu._delta_angle_acc_dt[instance];
+    sample.sample_us = _imu._gyro_last_sample_us[instance];
+#if HAL_WITH_DSP
+    sample.raw = _imu._last_raw_gyro[instance] * _imu._gyro_raw_sampling_multiplier[instance];
+#endif
+    _imu._gyro_exchange[instance].write(sample);
+}
 
-    // publish delta angle
-    _imu._delta_angle[instance] = _imu._delta_angle_acc[instance];
-    _imu._delta_angle_dt[instance] = _imu._delta_angle_acc_dt[instance];
-    _imu._delta_angle_valid[instance] = true;
+void AP_InertialSensor_Backend::publish_accel_exchange(uint8_t instance)
+{
+    AP_InertialSensor::AccelExchange sample;
+    sample.accel = _imu._accel_filtered[instance];
+    sample.delta_velocity = _imu._delta_velocity_acc[instance];
+    sample.dt = _imu._delta_velocity_acc_dt[instance];
+    sample.sample_us = _imu._accel_last_sample_us[instance];
+    _imu._accel_exchange[instance].write(sample);
 }
 
 void AP_InertialSensor_Backend::_notify_new_gyro_raw_sample(uint8_t instance,
@@ -236,12 +307,17 @@ void AP_InertialSensor_Backend::_notify_new_gyro_raw_sample(uint8_t instance,
         WITH_SEMAPHORE(_sem);
         uint64_t now = AP_HAL::micros64();
 
+        // apply any accumulator consumption flagged by the main loop
+        ack_gyro_consumption(instance);
+
         if (now - last_sample_us > 100000U) {
             // zero accumulator if sensor was unhealthy for 0.1s
             _imu._delta_angle_acc[instance].zero();
             _imu._delta_angle_acc_dt[instance] = 0;
             dt = 0;
             delta_angle.zero();
+            // drop any consumption that raced with the reset
+            _imu._delta_angle_ack_epoch[instance] = _imu._delta_angle_consume_epoch[instance].load(std::memory_order_acquire);
         }
 
         // integrate delta angle accumulator
@@ -263,38 +339,163 @@ void AP_InertialSensor_Backend::_notify_new_gyro_raw_sample(uint8_t instance,
             _imu._gyro_window[instance][2].push(scaled_gyro.z);
         }
 #endif
-        Vector3f gyro_filtered = gyro;
+        apply_gyro_filters(instance, gyro);
+
+        publish_gyro_exchange(instance);
+        _imu._new_gyro_data[instance] = true;
+    }
+
+    if (!_imu.batchsampler.doing_post_filter_logging()) {
+        log_gyro_raw(instance, sample_us, gyro);
+    }
+    else {
+        log_gyro_raw(instance, sample_us, _imu._gyro_filtered[instance]);
+    }
+}
+
+/*
+  apply the gyro filter chain to one sample, updating
+  _gyro_filtered. The three axes travel together in a Vector3f so
+  each biquad stage updates x/y/z in a single pass, keeping the
+  filter state hot in cache. Must be called with _sem held
+ */
+void AP_InertialSensor_Backend::apply_gyro_filters(const uint8_t instance, const Vector3f &gyro)
+{
+    Vector3f gyro_filtered = gyro;
 
-        // apply the notch filter
-        if (_gyro_notch_enabled()) {
-            gyro_filtered = _imu._gyro_notch_filter[instance].apply(gyro_filtered);
+    // apply the notch filter
+    if (_gyro_notch_enabled()) {
+        gyro_filtered = _imu._gyro_notch_filter[instance].apply(gyro_filtered);
+    }
+
+    // apply the harmonic notch filter
+    if (gyro_harmonic_notch_enabled()) {
+        gyro_filtered = _imu._gyro_harmonic_notch_filter[instance].apply(gyro_filtered);
+    }
+
+    // apply the low pass filter last to attentuate any notch induced noise
+    gyro_filtered = _imu._gyro_filter[instance].apply(gyro_filtered);
+
+    // if the filtering failed in any way then reset the filters and keep the old value
+    if (gyro_filtered.is_nan() || gyro_filtered.is_inf()) {
+        _imu._gyro_filter[instance].reset();
+        _imu._gyro_notch_filter[instance].reset();
+        _imu._gyro_harmonic_notch_filter[instance].reset();
+    } else {
+        _imu._gyro_filtered[instance] = gyro_filtered;
+    }
+}
+
+/*
+  batch version of _notify_new_gyro_raw_sample() for FIFO based
+  sensors. Processing a whole FIFO burst in one call takes the
+  frontend semaphore once per burst instead of once per sample, which
+  matters when fast-sampling drivers deliver data at up to 8kHz per
+  instance
+ */
+void AP_InertialSensor_Backend::_notify_new_gyro_raw_samples(uint8_t instance,
+                                                             const Vector3f *gyro,
+                                                             uint8_t n_samples)
+{
+    if (((1U<<instance) & _imu.imu_kill_mask) || n_samples == 0) {
+        return;
+    }
+
+    // process oversize bursts in chunks sized to the on-stack
+    // filtered sample buffer
+    while (n_samples > INS_MAX_GYRO_BATCH) {
+        _notify_new_gyro_raw_samples(instance, gyro, INS_MAX_GYRO_BATCH);
+        gyro += INS_MAX_GYRO_BATCH;
+        n_samples -= INS_MAX_GYRO_BATCH;
+    }
+
+    for (uint8_t i = 0; i < n_samples; i++) {
+        _update_sensor_rate(_imu._sample_gyro_count[instance], _imu._sample_gyro_start_us[instance],
+                            _imu._gyro_raw_sample_rates[instance]);
+    }
+
+    // batch delivery is only used by FIFO based sensors, so deltaT
+    // comes from the observed sample rate. Don't accept below 40Hz
+    if (_imu._gyro_raw_sample_rates[instance] < 40) {
+        return;
+    }
+    const float dt = 1.0f / _imu._gyro_raw_sample_rates[instance];
+
+    const uint64_t last_sample_us = _imu._gyro_last_sample_us[instance];
+    const uint64_t now = AP_HAL::micros64();
+    _imu._gyro_last_sample_us[instance] = now;
+
+    // reconstruct evenly spaced per-sample timestamps across the
+    // burst for logging
+    const uint64_t first_sample_us = now - (uint64_t)((n_samples-1) * dt * 1.0e6f);
+
+#if AP_MODULE_SUPPORTED
+    // call gyro_sample hook if any
+    for (uint8_t i = 0; i < n_samples; i++) {
+        AP_Module::call_hook_gyro_sample(instance, dt, gyro[i]);
+    }
+#endif
+
+    // push gyros if optical flow present
+    if (hal.opticalflow) {
+        for (uint8_t i = 0; i < n_samples; i++) {
+            hal.opticalflow->push_gyro(gyro[i].x, gyro[i].y, dt);
         }
+    }
+
+    Vector3f filtered[INS_MAX_GYRO_BATCH];
 
-        // apply the harmonic notch filter
-        if (gyro_harmonic_notch_enabled()) {
-            gyro_filtered = _imu._gyro_harmonic_notch_filter[instance].apply(gyro_filtered);
+    {
+        WITH_SEMAPHORE(_sem);
+
+        // apply any accumulator consumption flagged by the main loop
+        ack_gyro_consumption(instance);
+
+        if (now - last_sample_us > 100000U) {
+            // zero accumulator if sensor was unhealthy for 0.1s
+            _imu._delta_angle_acc[instance].zero();
+            _imu._delta_angle_acc_dt[instance] = 0;
+            // drop any consumption that raced with the reset
+            _imu._delta_angle_ack_epoch[instance] = _imu._delta_angle_consume_epoch[instance].load(std::memory_order_acquire);
         }
 
-        // apply the low pass filter last to attentuate any notch induced noise
-        gyro_filtered = _imu._gyro_filter[instance].apply(gyro_filtered);
+        for (uint8_t i = 0; i < n_samples; i++) {
+            // compute delta angle with coning correction, as in the
+            // single sample path
+            const Vector3f delta_angle = (gyro[i] + _imu._last_raw_gyro[instance]) * 0.5f * dt;
+            Vector3f delta_coning = (_imu._delta_angle_acc[instance] +
+                                     _imu._last_delta_angle[instance] * (1.0f / 6.0f));
+            delta_coning = delta_coning % delta_angle;
+            delta_coning *= 0.5f;
 
-        // if the filtering failed in any way then reset the filters and keep the old value
-        if (gyro_filtered.is_nan() || gyro_filtered.is_inf()) {
-            _imu._gyro_filter[instance].reset();
-            _imu._gyro_notch_filter[instance].reset();
-            _imu._gyro_harmonic_notch_filter[instance].reset();
-        } else {
-            _imu._gyro_filtered[instance] = gyro_filtered;
+            _imu._delta_angle_acc[instance] += delta_angle + delta_coning;
+            _imu._delta_angle_acc_dt[instance] += dt;
+
+            // save previous delta angle for coning correction
+            _imu._last_delta_angle[instance] = delta_angle;
+            _imu._last_raw_gyro[instance] = gyro[i];
+
+#if HAL_WITH_DSP
+            // capture gyro window for FFT analysis
+            if (_imu._gyro_window_size > 0) {
+                const Vector3f& scaled_gyro = gyro[i] * _imu._gyro_raw_sampling_multiplier[instance];
+                _imu._gyro_window[instance][0].push(scaled_gyro.x);
+                _imu._gyro_window[instance][1].push(scaled_gyro.y);
+                _imu._gyro_window[instance][2].push(scaled_gyro.z);
+            }
+#endif
+            apply_gyro_filters(instance, gyro[i]);
+            filtered[i] = _imu._gyro_filtered[instance];
         }
 
+        publish_gyro_exchange(instance);
         _imu._new_gyro_data[instance] = true;
     }
 
-    if (!_imu.batchsampler.doing_post_filter_logging()) {
-        log_gyro_raw(instance, sample_us, gyro);
-    }
-    else {
-        log_gyro_raw(instance, sample_us, _imu._gyro_filtered[instance]);
+    const bool post_filter = _imu.batchsampler.doing_post_filter_logging();
+    for (uint8_t i = 0; i < n_samples; i++) {
+        const uint64_t sample_us = first_sample_us + (uint64_t)(i * dt * 1.0e6f);
+        log_gyro_raw(instance, sample_us, post_filter ? filtered[i] : gyro[i]);
     }
 }
 
@@ -324,34 +525,6 @@ void AP_InertialSensor_Backend::log_gyro_raw(uint8_t instance, const uint64_t sa
     }
 }
 
-/*
-  rotate accel vector, scale and add the accel offset
- */
-void AP_InertialSensor_Backend::_publish_accel(uint8_t instance, const Vector3f &accel)
-{
-    if ((1U<<instance) & _imu.imu_kill_mask) {
-        return;
-    }
-    _imu._accel[instance] = accel;
-    _imu._accel_healthy[instance] = true;
-
-    // publish delta velocity
-    _imu._delta_velocity[instance] = _imu._delta_velocity_acc[instance];
-    _imu._delta_velocity_dt[instance] = _imu._delta_velocity_acc_dt[instance];
-    _imu._delta_velocity_valid[instance] = true;
-
-
-    if (_imu._accel_calibrator != nullptr && _imu._accel_calibrator[instance].get_status() == ACCEL_CAL_COLLECTING_SAMPLE) {
-        Vector3f cal_sample = _imu._delta_velocity[instance];
-
-        // remove rotation. Note that we don't need to remove offsets or scale factor as those
-        // are not applied when calibrating
-        cal_sample.rotate_inverse(_imu._board_orientation);
-
-        _imu._accel_calibrator[instance].new_sample(cal_sample, _imu._delta_velocity_dt[instance]);
-    }
-}
-
 void AP_InertialSensor_Backend::_notify_new_accel_raw_sample(uint8_t instance,
                                                              const Vector3f &accel,
                                                              uint64_t sample_us,
@@ -401,13 +574,18 @@ void AP_InertialSensor_Backend::_notify_new_accel_raw_sample(uint8_t instance,
 
         uint64_t now = AP_HAL::micros64();
 
+        // apply any accumulator consumption flagged by the main loop
+        ack_accel_consumption(instance);
+
         if (now - last_sample_us > 100000U) {
             // zero accumulator if sensor was unhealthy for 0.1s
             _imu._delta_velocity_acc[instance].zero();
             _imu._delta_velocity_acc_dt[instance] = 0;
             dt = 0;
+            // drop any consumption that raced with the reset
+            _imu._delta_velocity_ack_epoch[instance] = _imu._delta_velocity_consume_epoch[instance].load(std::memory_order_acquire);
         }
-        
+
         // delta velocity
         _imu._delta_velocity_acc[instance] += accel * dt;
         _imu._delta_velocity_acc_dt[instance] += dt;
@@ -419,6 +597,7 @@ void AP_InertialSensor_Backend::_notify_new_accel_raw_sample(uint8_t instance,
 
         _imu.set_accel_peak_hold(instance, _imu._accel_filtered[instance]);
 
+        publish_accel_exchange(instance);
         _imu._new_accel_data[instance] = true;
     }
 
@@ -531,39 +710,85 @@ void AP_InertialSensor_Backend::_publish_temperature(uint8_t instance, float tem
 }
 
 /*
-  common gyro update function for all backends
+  common gyro update function for all backends. Reads the latest
+  filtered sample through the lock-free exchange, so the main loop
+  never blocks on the sensor thread
  */
 void AP_InertialSensor_Backend::update_gyro(uint8_t instance)
-{    
-    WITH_SEMAPHORE(_sem);
-
+{
     if ((1U<<instance) & _imu.imu_kill_mask) {
         return;
     }
-    if (_imu._new_gyro_data[instance]) {
-        _publish_gyro(instance, _imu._gyro_filtered[instance]);
-        // copy the gyro samples from the backend to the frontend window
+
+    AP_InertialSensor::GyroExchange sample;
+    const uint32_t seq = _imu._gyro_exchange[instance].read(sample);
+    if (seq != 0 && seq != _imu._gyro_exchange_seq[instance]) {
+        _imu._gyro_exchange_seq[instance] = seq;
+
+        _imu._gyro[instance] = sample.gyro;
+        _imu._gyro_healthy[instance] = true;
+
+        // publish delta angle
+        _imu._delta_angle[instance] = sample.delta_angle;
+        _imu._delta_angle_dt[instance] = sample.dt;
+        _imu._delta_angle_end_us[instance] = sample.sample_us;
+        _imu._delta_angle_valid[instance] = true;
+
 #if HAL_WITH_DSP
-        _imu._gyro_raw[instance] = _imu._last_raw_gyro[instance] * _imu._gyro_raw_sampling_multiplier[instance];
+        // copy the gyro samples from the backend to the frontend window
+        _imu._gyro_raw[instance] = sample.raw;
 #endif
+        // flag the consumed accumulator state for the sensor thread
+        // to subtract. The consumed values must be visible before the
+        // epoch advances
+        _imu._delta_angle_consumed[instance] = sample.delta_angle;
+        _imu._delta_angle_consumed_dt[instance] = sample.dt;
+        _imu._delta_angle_consume_epoch[instance].fetch_add(1, std::memory_order_release);
+
         _imu._new_gyro_data[instance] = false;
     }
 
+    update_gyro_filter_params(instance);
+    update_gyro_fused_correction(instance);
+}
+
+/*
+  re-initialise or re-tune the gyro filters when parameters have
+  changed. Filter state is shared with the sensor thread, so _sem is
+  taken, but only when an update is actually needed
+ */
+void AP_InertialSensor_Backend::update_gyro_filter_params(uint8_t instance)
+{
+    const bool update_lpf = _last_gyro_filter_hz != _gyro_filter_cutoff() || sensors_converging();
+    const bool init_harmonic_notch = !is_equal(_last_harmonic_notch_bandwidth_hz, gyro_harmonic_notch_bandwidth_hz()) ||
+        !is_equal(_last_harmonic_notch_attenuation_dB, gyro_harmonic_notch_attenuation_dB()) ||
+        sensors_converging();
+    const bool update_harmonic_notch = !init_harmonic_notch &&
+        !is_equal(_last_harmonic_notch_center_freq_hz, gyro_harmonic_notch_center_freq_hz());
+    const bool init_notch = !is_equal(_last_notch_center_freq_hz, _gyro_notch_center_freq_hz()) ||
+        !is_equal(_last_notch_bandwidth_hz, _gyro_notch_bandwidth_hz()) ||
+        !is_equal(_last_notch_attenuation_dB, _gyro_notch_attenuation_dB()) ||
+        sensors_converging();
+
+    if (!update_lpf && !init_harmonic_notch && !update_harmonic_notch && !init_notch) {
+        return;
+    }
+
+    WITH_SEMAPHORE(_sem);
+
     // possibly update filter frequency
-    if (_last_gyro_filter_hz != _gyro_filter_cutoff() || sensors_converging()) {
+    if (update_lpf) {
         _imu._gyro_filter[instance].set_cutoff_frequency(_gyro_raw_sample_rate(instance), _gyro_filter_cutoff());
         _last_gyro_filter_hz = _gyro_filter_cutoff();
     }
 
     // possily update the harmonic notch filter parameters
-    if (!is_equal(_last_harmonic_notch_bandwidth_hz, gyro_harmonic_notch_bandwidth_hz()) ||
-        !is_equal(_last_harmonic_notch_attenuation_dB, gyro_harmonic_notch_attenuation_dB()) ||
-        sensors_converging()) {
+    if (init_harmonic_notch) {
         _imu._gyro_harmonic_notch_filter[instance].init(_gyro_raw_sample_rate(instance), gyro_harmonic_notch_center_freq_hz(), gyro_harmonic_notch_bandwidth_hz(), gyro_harmonic_notch_attenuation_dB());
         _last_harmonic_notch_center_freq_hz = gyro_harmonic_notch_center_freq_hz();
         _last_harmonic_notch_bandwidth_hz = gyro_harmonic_notch_bandwidth_hz();
         _last_harmonic_notch_attenuation_dB = gyro_harmonic_notch_attenuation_dB();
-    } else if (!is_equal(_last_harmonic_notch_center_freq_hz, gyro_harmonic_notch_center_freq_hz())) {
+    } else if (update_harmonic_notch) {
         if (num_gyro_harmonic_notch_center_frequencies() > 1) {
             _imu._gyro_harmonic_notch_filter[instance].update(num_gyro_harmonic_notch_center_frequencies(), gyro_harmonic_notch_center_frequencies_hz());
         } else {
@@ -572,10 +797,7 @@ void AP_InertialSensor_Backend::update_gyro(uint8_t instance)
         _last_harmonic_notch_center_freq_hz = gyro_harmonic_notch_center_freq_hz();
     }
     // possily update the notch filter parameters
-    if (!is_equal(_last_notch_center_freq_hz, _gyro_notch_center_freq_hz()) ||
-        !is_equal(_last_notch_bandwidth_hz, _gyro_notch_bandwidth_hz()) ||
-        !is_equal(_last_notch_attenuation_dB, _gyro_notch_attenuation_dB()) ||
-        sensors_converging()) {
+    if (init_notch) {
         _imu._gyro_notch_filter[instance].init(_gyro_raw_sample_rate(instance), _gyro_notch_center_freq_hz(), _gyro_notch_bandwidth_hz(), _gyro_notch_attenuation_dB());
         _last_notch_center_freq_hz = _gyro_notch_center_freq_hz();
         _last_notch_bandwidth_hz = _gyro_notch_bandwidth_hz();
@@ -584,25 +806,131 @@ void AP_InertialSensor_Backend::update_gyro(uint8_t instance)
 }
 
 /*
-  common accel update function for all backends
+  common accel update function for all backends. As with update_gyro()
+  the latest sample comes through the lock-free exchange
  */
 void AP_InertialSensor_Backend::update_accel(uint8_t instance)
-{    
-    WITH_SEMAPHORE(_sem);
-
+{
     if ((1U<<instance) & _imu.imu_kill_mask) {
         return;
     }
-    if (_imu._new_accel_data[instance]) {
-        _publish_accel(instance, _imu._accel_filtered[instance]);
+
+    AP_InertialSensor::AccelExchange sample;
+    const uint32_t seq = _imu._accel_exchange[instance].read(sample);
+    if (seq != 0 && seq != _imu._accel_exchange_seq[instance]) {
+        _imu._accel_exchange_seq[instance] = seq;
+
+        _imu._accel[instance] = sample.accel;
+        _imu._accel_healthy[instance] = true;
+
+        // publish delta velocity
+        _imu._delta_velocity[instance] = sample.delta_velocity;
+        _imu._delta_velocity_dt[instance] = sample.dt;
+        _imu._delta_velocity_end_us[instance] = sample.sample_us;
+        _imu._delta_velocity_valid[instance] = true;
+
+        if (_imu._accel_calibrator != nullptr && _imu._accel_calibrator[instance].get_status() == ACCEL_CAL_COLLECTING_SAMPLE) {
+            Vector3f cal_sample = _imu._delta_velocity[instance];
+
+            // remove rotation. Note that we don't need to remove offsets or scale factor as those
+            // are not applied when calibrating
+            cal_sample.rotate_inverse(_imu._board_orientation);
+
+            _imu._accel_calibrator[instance].new_sample(cal_sample, _imu._delta_velocity_dt[instance]);
+        }
+
+        // flag the consumed accumulator state for the sensor thread
+        // to subtract
+        _imu._delta_velocity_consumed[instance] = sample.delta_velocity;
+        _imu._delta_velocity_consumed_dt[instance] = sample.dt;
+        _imu._delta_velocity_consume_epoch[instance].fetch_add(1, std::memory_order_release);
+
         _imu._new_accel_data[instance] = false;
     }
-    
+
     // possibly update filter frequency
     if (_last_accel_filter_hz != _accel_filter_cutoff()) {
+        WITH_SEMAPHORE(_sem);
         _imu._accel_filter[instance].set_cutoff_frequency(_accel_raw_sample_rate(instance), _accel_filter_cutoff());
         _last_accel_filter_hz = _accel_filter_cutoff();
     }
+
+    update_accel_fused_correction(instance);
+}
+
+/*
+  recompute the fused accel calibration transform from the current
+  parameters. The chain in _rotate_and_correct_accel() is
+  out = B * S * (R * accel - offset) with R the sensor orientation, S
+  the diagonal scale matrix and B the board rotation, which collapses
+  to out = (B*S*R) * accel - B*(S*offset). Published through the
+  seqlock so the sensor thread never sees a torn matrix
+ */
+void AP_InertialSensor_Backend::update_accel_fused_correction(uint8_t instance)
+{
+    AP_InertialSensor::FusedCorrection fused;
+
+    Matrix3f board;
+    if (_imu._board_orientation == ROTATION_CUSTOM && _imu._custom_rotation) {
+        board = *_imu._custom_rotation;
+    } else {
+        board.from_rotation(_imu._board_orientation);
+    }
+
+    Matrix3f mat;
+    mat.from_rotation(_imu._accel_orientation[instance]);
+
+    // fold the diagonal scale matrix into the rows of the sensor rotation
+    const Vector3f &scale = _imu._accel_scale[instance].get();
+    mat.a *= scale.x;
+    mat.b *= scale.y;
+    mat.c *= scale.z;
+
+    const Vector3f &offset = _imu._accel_offset[instance].get();
+    fused.mat = board * mat;
+    fused.offset = -(board * Vector3f(offset.x * scale.x, offset.y * scale.y, offset.z * scale.z));
+
+    fused.valid = true;
+#if HAL_INS_TEMPERATURE_CAL_ENABLE
+    // temperature corrections depend on the sample temperature and
+    // cannot be folded into a fixed transform
+    if (_imu.tcal[instance].enable != AP_InertialSensor::TCal::Enable::Disabled) {
+        fused.valid = false;
+    }
+#endif
+
+    _imu._accel_fused[instance].write(fused);
+}
+
+/*
+  as for update_accel_fused_correction(), but gyros have no scale
+  factors: out = (B*R) * gyro - B*offset
+ */
+void AP_InertialSensor_Backend::update_gyro_fused_correction(uint8_t instance)
+{
+    AP_InertialSensor::FusedCorrection fused;
+
+    Matrix3f board;
+    if (_imu._board_orientation == ROTATION_CUSTOM && _imu._custom_rotation) {
+        board = *_imu._custom_rotation;
+    } else {
+        board.from_rotation(_imu._board_orientation);
+    }
+
+    Matrix3f mat;
+    mat.from_rotation(_imu._gyro_orientation[instance]);
+
+    fused.mat = board * mat;
+    fused.offset = -(board * _imu._gyro_offset[instance].get());
+
+    fused.valid = true;
+#if HAL_INS_TEMPERATURE_CAL_ENABLE
+    if (_imu.tcal[instance].enable != AP_InertialSensor::TCal::Enable::Disabled) {
+        fused.valid = false;
+    }
+#endif
+
+    _imu._gyro_fused[instance].write(fused);
 }
 
 bool AP_InertialSensor_Backend::should_log_imu_raw() const
@@ -32,6 +32,10 @@
 class AuxiliaryBus;
 class AP_Logger;
 
+// largest gyro FIFO burst that the batch filtering path will process
+// in one pass. Bursts larger than this are processed in chunks
+#define INS_MAX_GYRO_BATCH 8
+
 class AP_InertialSensor_Backend
 {
 public:
@@ -45,7 +49,7 @@ public:
     /*
      * Update the sensor data. Called by the frontend to transfer
      * accumulated sensor readings to the frontend structure via the
-     * _publish_gyro() and _publish_accel() functions
+     * update_gyro() and update_accel() functions
      */
     virtual bool update() = 0;
 
@@ -136,8 +140,16 @@ protected:
     void _rotate_and_correct_accel(uint8_t instance, Vector3f &accel);
     void _rotate_and_correct_gyro(uint8_t instance, Vector3f &gyro);
 
-    // rotate gyro vector, offset and publish
-    void _publish_gyro(uint8_t instance, const Vector3f &gyro);
+    // subtract accumulator state already consumed by the main loop,
+    // flagged via the consumption epoch. Must be called with _sem
+    // held, before new samples are integrated
+    void ack_gyro_consumption(uint8_t instance);
+    void ack_accel_consumption(uint8_t instance);
+
+    // publish the latest filtered sample and accumulator state
+    // through the lock-free exchange. Must be called with _sem held
+    void publish_gyro_exchange(uint8_t instance);
+    void publish_accel_exchange(uint8_t instance);
 
     // this should be called every time a new gyro raw sample is
     // available - be it published or not the sample is raw in the
@@ -147,8 +159,11 @@ protected:
     // sensors, and should be set to zero for FIFO based sensors
     void _notify_new_gyro_raw_sample(uint8_t instance, const Vector3f &accel, uint64_t sample_us=0);
 
-    // rotate accel vector, scale, offset and publish
-    void _publish_accel(uint8_t instance, const Vector3f &accel);
+    // batch version of _notify_new_gyro_raw_sample() for FIFO based
+    // sensors. The whole burst is filtered with the frontend
+    // semaphore taken once, avoiding per-sample locking when a driver
+    // drains a FIFO at high rate
+    void _notify_new_gyro_raw_samples(uint8_t instance, const Vector3f *gyro, uint8_t n_samples);
 
     // this should be called every time a new accel raw sample is available -
     // be it published or not
@@ -318,6 +333,11 @@ protected:
         return (1 << uint8_t(_imu._fast_sampling_rate));
     }
 
+    // should the CIC decimation filter be used when fast sampling this IMU?
+    bool enable_fast_sampling_aaf(uint8_t instance) {
+        return (_imu._fast_aaf_mask & (1U<<instance)) != 0;
+    }
+
     // called by subclass when data is received from the sensor, thus
     // at the 'sensor rate'
     void _notify_new_accel_sensor_rate_sample(uint8_t instance, const Vector3f &accel);
@@ -339,4 +359,16 @@ private:
     void log_accel_raw(uint8_t instance, const uint64_t sample_us, const Vector3f &accel);
     void log_gyro_raw(uint8_t instance, const uint64_t sample_us, const Vector3f &gryo);
 
+    // apply the notch/harmonic-notch/low-pass chain to one gyro
+    // sample, updating _gyro_filtered. Must be called with _sem held
+    void apply_gyro_filters(const uint8_t instance, const Vector3f &gyro);
+
+    // re-initialise or re-tune the gyro filters if parameters have
+    // changed, taking _sem only when an update is actually needed
+    void update_gyro_filter_params(uint8_t instance);
+
+    // recompute the fused calibration transforms from the current
+    // calibration parameters. Called from the main loop only
+    void update_accel_fused_correction(uint8_t instance);
+    void update_gyro_fused_correction(uint8_t instance);
 };
@@ -348,7 +348,12 @@ void AP_InertialSensor_Invensense::start()
     // setup scale factors for fifo data after downsampling
     _fifo_accel_scale = _accel_scale / _accel_fifo_downsample_rate;
     _fifo_gyro_scale = _gyro_scale / _gyro_fifo_downsample_rate;
-    
+
+    // the second order CIC decimator has gain of the square of the
+    // decimation ratio. Only worth running when we are actually decimating
+    _gyro_cic_enabled = enable_fast_sampling_aaf(_gyro_instance) && _gyro_fifo_downsample_rate > 1;
+    _fifo_gyro_cic_scale = _fifo_gyro_scale / _gyro_fifo_downsample_rate;
+
     // allocate fifo buffer
     _fifo_buffer = (uint8_t *)hal.util->malloc_type(MPU_FIFO_BUFFER_LEN * MPU_SAMPLE_SIZE, AP_HAL::Util::MEM_DMA_SAFE);
     if (_fifo_buffer == nullptr) {
@@ -428,6 +433,12 @@ void AP_InertialSensor_Invensense::_poll_data()
 
 bool AP_InertialSensor_Invensense::_accumulate(uint8_t *samples, uint8_t n_samples)
 {
+    // gyro samples are collected across the burst and handed to the
+    // frontend in one batch, so the filter chain runs over the whole
+    // FIFO drain with a single semaphore acquisition
+    Vector3f gyro_batch[MPU_FIFO_BUFFER_LEN];
+    uint8_t gyro_count = 0;
+
     for (uint8_t i = 0; i < n_samples; i++) {
         const uint8_t *data = samples + MPU_SAMPLE_SIZE * i;
         Vector3f accel, gyro;
@@ -436,7 +447,7 @@ bool AP_InertialSensor_Invensense::_accumulate(uint8_t *samples, uint8_t n_sampl
 #if INVENSENSE_EXT_SYNC_ENABLE
         fsync_set = (int16_val(data, 2) & 1U) != 0;
 #endif
-        
+
         accel = Vector3f(int16_val(data, 1),
                          int16_val(data, 0),
                          -int16_val(data, 2));
@@ -447,11 +458,13 @@ bool AP_InertialSensor_Invensense::_accumulate(uint8_t *samples, uint8_t n_sampl
             if (!hal.scheduler->in_expected_delay()) {
                 debug("temp reset IMU[%u] %d %d", _accel_instance, _raw_temp, t2);
             }
+            // flush the good samples collected so far before resetting
+            _notify_new_gyro_raw_samples(_gyro_instance, gyro_batch, gyro_count);
             _fifo_reset(true);
             return false;
         }
         float temp = t2 * temp_sensitivity + temp_zero;
-        
+
         gyro = Vector3f(int16_val(data, 5),
                         int16_val(data, 4),
                         -int16_val(data, 6));
@@ -461,10 +474,12 @@ bool AP_InertialSensor_Invensense::_accumulate(uint8_t *samples, uint8_t n_sampl
         _rotate_and_correct_gyro(_gyro_instance, gyro);
 
         _notify_new_accel_raw_sample(_accel_instance, accel, 0, fsync_set);
-        _notify_new_gyro_raw_sample(_gyro_instance, gyro);
+        gyro_batch[gyro_count++] = gyro;
 
         _temp_filtered = _temp_filter.apply(temp);
     }
+
+    _notify_new_gyro_raw_samples(_gyro_instance, gyro_batch, gyro_count);
     return true;
 }
 
@@ -482,7 +497,12 @@ bool AP_InertialSensor_Invensense::_accumulate_sensor_rate_sampling(uint8_t *sam
     const int32_t unscaled_clip_limit = _clip_limit / _accel_scale;
     bool clipped = false;
     bool ret = true;
-    
+
+    // downsampled gyro output collected across the burst and handed
+    // to the frontend as one batch
+    Vector3f gyro_batch[MPU_FIFO_BUFFER_LEN];
+    uint8_t gyro_batch_count = 0;
+
     for (uint8_t i = 0; i < n_samples; i++) {
         const uint8_t *data = samples + MPU_SAMPLE_SIZE * i;
 
@@ -535,16 +555,36 @@ bool AP_InertialSensor_Invensense::_accumulate_sensor_rate_sampling(uint8_t *sam
         Vector3f g2 = g * _gyro_scale;
         _notify_new_gyro_sensor_rate_sample(_gyro_instance, g2);
 
-        _accum.gyro += g;
+        if (_gyro_cic_enabled) {
+            // two integrator stages at the sample rate. sinc^2 response
+            // rejects above-Nyquist content far better than the boxcar
+            _accum.gyro_cic_i1 += Vector3l(int16_val(data, 5),
+                                           int16_val(data, 4),
+                                           -int16_val(data, 6));
+            _accum.gyro_cic_i2 += _accum.gyro_cic_i1;
+        } else {
+            _accum.gyro += g;
+        }
 
         if (_accum.gyro_count % _gyro_fifo_downsample_rate == 0) {
-            _accum.gyro *= _fifo_gyro_scale;
+            if (_gyro_cic_enabled) {
+                // two comb stages at the decimated rate
+                const Vector3l y1 = _accum.gyro_cic_i2 - _accum.gyro_cic_c1;
+                _accum.gyro_cic_c1 = _accum.gyro_cic_i2;
+                const Vector3l y2 = y1 - _accum.gyro_cic_c2;
+                _accum.gyro_cic_c2 = y1;
+                _accum.gyro = Vector3f(y2.x, y2.y, y2.z) * _fifo_gyro_cic_scale;
+            } else {
+                _accum.gyro *= _fifo_gyro_scale;
+            }
             _rotate_and_correct_gyro(_gyro_instance, _accum.gyro);
-            _notify_new_gyro_raw_sample(_gyro_instance, _accum.gyro);
+            gyro_batch[gyro_batch_count++] = _accum.gyro;
             _accum.gyro.zero();
         }
     }
 
+    _notify_new_gyro_raw_samples(_gyro_instance, gyro_batch, gyro_batch_count);
+
     if (clipped) {
         increment_clip_count(_accel_instance);
     }
@@ -611,8 +651,10 @@ void AP_InertialSensor_Invensense::_read_fifo()
                 _dev->set_chip_select(false);
                 goto check_registers;
             }
+            // _fifo_buffer is DMA-safe, so the burst is clocked
+            // straight into it with no bounce copy
             memset(rx, 0, n * MPU_SAMPLE_SIZE);
-            if (!_dev->transfer(rx, n * MPU_SAMPLE_SIZE, rx, n * MPU_SAMPLE_SIZE)) {
+            if (!_dev->transfer_fullduplex(rx, n * MPU_SAMPLE_SIZE)) {
                 if (!hal.scheduler->in_expected_delay()) {
                     debug("MPU60x0: error in fifo read %u bytes\n", n * MPU_SAMPLE_SIZE);
                 }
@@ -124,6 +124,11 @@ private:
 
     float _fifo_accel_scale;
     float _fifo_gyro_scale;
+    float _fifo_gyro_cic_scale;
+
+    // true when the second order CIC decimation filter is used for the
+    // downsampled gyro data in place of the plain boxcar accumulator
+    bool _gyro_cic_enabled;
     LowPassFilter2pFloat _temp_filter;
     uint32_t last_reset_ms;
     uint8_t reset_count;
@@ -171,6 +176,14 @@ private:
         uint8_t accel_count;
         uint8_t gyro_count;
         LowPassFilterVector3f accel_filter{4000, 188};
+        // second order CIC decimation filter state: two integrators run
+        // at the sample rate, two comb delays at the decimated rate.
+        // integer state so integrator wrap-around cancels exactly in the
+        // comb stages; 16 bit samples with a decimate-by-8 need 22 bits
+        Vector3l gyro_cic_i1;
+        Vector3l gyro_cic_i2;
+        Vector3l gyro_cic_c1;
+        Vector3l gyro_cic_c2;
     } _accum;
 };
 
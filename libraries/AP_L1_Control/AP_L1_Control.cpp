@@ -3,6 +3,10 @@
 
 extern const AP_HAL::HAL& hal;
 
+// scaling from 1e-7 degrees to metres at the equator, matching
+// Location::get_distance_NE()
+static const float loc_scaling = 1.0e-7f * DEG_TO_RAD * RADIUS_OF_EARTH;
+
 // table of user settable parameters
 const AP_Param::GroupInfo AP_L1_Control::var_info[] = {
     // @Param: PERIOD
@@ -227,9 +231,6 @@ void AP_L1_Control::update_waypoint(const struct Location &prev_WP, const struct
 
     Vector2f _groundspeed_vector = _ahrs.groundspeed_vector();
 
-    // update _target_bearing_cd
-    _target_bearing_cd = _current_loc.get_bearing_to(next_WP);
-
     //Calculate groundspeed
     float groundSpeed = _groundspeed_vector.length();
     if (groundSpeed < 0.1f) {
@@ -244,22 +245,48 @@ void AP_L1_Control::update_waypoint(const struct Location &prev_WP, const struct
     // 0.3183099 = 1/1/pipi
     _L1_dist = MAX(0.3183099f * _L1_damping * _L1_period * groundSpeed, dist_min);
 
-    // Calculate the NE position of WP B relative to WP A
-    Vector2f AB = prev_WP.get_distance_NE(next_WP);
-    float AB_length = AB.length();
+    // the segment geometry only changes when the mission advances to
+    // a new waypoint pair, so cache the unit vector, length and
+    // longitude scaling and reduce the per-loop work to dot products
+    if (!_wp_cache.valid ||
+        prev_WP.lat != _wp_cache.prev_lat || prev_WP.lng != _wp_cache.prev_lng ||
+        next_WP.lat != _wp_cache.next_lat || next_WP.lng != _wp_cache.next_lng) {
+        _wp_cache.prev_lat = prev_WP.lat;
+        _wp_cache.prev_lng = prev_WP.lng;
+        _wp_cache.next_lat = next_WP.lat;
+        _wp_cache.next_lng = next_WP.lng;
+        _wp_cache.lng_scale = prev_WP.longitude_scale();
+        const Vector2f AB_full = prev_WP.get_distance_NE(next_WP);
+        _wp_cache.AB_length = AB_full.length();
+        if (_wp_cache.AB_length >= 1.0e-6f) {
+            _wp_cache.AB = AB_full / _wp_cache.AB_length;
+        }
+        _wp_cache.valid = true;
+    }
+
+    const float AB_length = _wp_cache.AB_length;
+    Vector2f AB = _wp_cache.AB;
+
+    // Calculate the NE position of the aircraft relative to WP A,
+    // using the cached longitude scaling
+    const Vector2f A_air((_current_loc.lat - prev_WP.lat) * loc_scaling,
+                         (_current_loc.lng - prev_WP.lng) * loc_scaling * _wp_cache.lng_scale);
+
+    // NE vector from the aircraft to WP B, from the cached segment
+    const Vector2f air_B = AB * AB_length - A_air;
 
     // Check for AB zero length and track directly to the destination
     // if too small
-    if (AB.length() < 1.0e-6f) {
-        AB = _current_loc.get_distance_NE(next_WP);
+    if (AB_length < 1.0e-6f) {
+        AB = air_B;
         if (AB.length() < 1.0e-6f) {
             AB = Vector2f(cosf(get_yaw()), sinf(get_yaw()));
         }
+        AB.normalize();
     }
-    AB.normalize();
 
-    // Calculate the NE position of the aircraft relative to WP A
-    const Vector2f A_air = prev_WP.get_distance_NE(_current_loc);
+    // update _target_bearing_cd
+    _target_bearing_cd = wrap_360_cd(RadiansToCentiDegrees(atan2f(air_B.y, air_B.x)));
 
     // calculate distance to target track, for reporting
     _crosstrack_error = A_air % AB;
@@ -280,7 +307,7 @@ void AP_L1_Control::update_waypoint(const struct Location &prev_WP, const struct
     } else if (alongTrackDist > AB_length + groundSpeed*3) {
         // we have passed point B by 3 seconds. Head towards B
         // Calc Nu to fly To WP B
-        const Vector2f B_air = next_WP.get_distance_NE(_current_loc);
+        const Vector2f B_air = -air_B;
         Vector2f B_air_unit = (B_air).normalized(); // Unit vector from WP B to aircraft
         xtrackVel = _groundspeed_vector % (-B_air_unit); // Velocity across line
         ltrackVel = _groundspeed_vector * (-B_air_unit); // Velocity along line
@@ -363,17 +390,27 @@ void AP_L1_Control::update_loiter(const struct Location &center_WP, float radius
     float groundSpeed = MAX(_groundspeed_vector.length() , 1.0f);
 
 
-    // update _target_bearing_cd
-    _target_bearing_cd = _current_loc.get_bearing_to(center_WP);
-
-
     // Calculate time varying control parameters
     // Calculate the L1 length required for specified period
     // 0.3183099 = 1/pi
     _L1_dist = 0.3183099f * _L1_damping * _L1_period * groundSpeed;
 
+    // the longitude scaling only changes with the loiter centre, so
+    // cache it rather than recomputing the trig every loop
+    if (!_loiter_cache.valid ||
+        center_WP.lat != _loiter_cache.lat || center_WP.lng != _loiter_cache.lng) {
+        _loiter_cache.lat = center_WP.lat;
+        _loiter_cache.lng = center_WP.lng;
+        _loiter_cache.lng_scale = center_WP.longitude_scale();
+        _loiter_cache.valid = true;
+    }
+
     //Calculate the NE position of the aircraft relative to WP A
-    const Vector2f A_air = center_WP.get_distance_NE(_current_loc);
+    const Vector2f A_air((_current_loc.lat - center_WP.lat) * loc_scaling,
+                         (_current_loc.lng - center_WP.lng) * loc_scaling * _loiter_cache.lng_scale);
+
+    // update _target_bearing_cd
+    _target_bearing_cd = wrap_360_cd(RadiansToCentiDegrees(atan2f(-A_air.y, -A_air.x)));
 
     // Calculate the unit vector from WP A to aircraft
     // protect against being on the waypoint and having zero velocity
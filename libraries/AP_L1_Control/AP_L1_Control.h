@@ -129,4 +129,26 @@ private:
     bool _reverse = false;
     float get_yaw();
     int32_t get_yaw_sensor() const;
+
+    // cached waypoint segment geometry. The segment terms only change
+    // when the mission advances to a new waypoint pair, so they are
+    // recomputed on change rather than every loop
+    struct {
+        int32_t prev_lat;
+        int32_t prev_lng;
+        int32_t next_lat;
+        int32_t next_lng;
+        Vector2f AB;         // unit vector along the segment
+        float AB_length;     // segment length in metres
+        float lng_scale;     // longitude scaling at the segment start
+        bool valid;
+    } _wp_cache;
+
+    // cached longitude scaling for the loiter centre
+    struct {
+        int32_t lat;
+        int32_t lng;
+        float lng_scale;
+        bool valid;
+    } _loiter_cache;
 };
@@ -7,7 +7,9 @@
 #include "AP_Logger_DataFlash.h"
 #include "AP_Logger_MAVLink.h"
 
+#include <AP_HAL/Device.h>
 #include <AP_InternalError/AP_InternalError.h>
+#include <AP_Math/crc.h>
 #include <GCS_MAVLink/GCS.h>
 #include <AP_BoardConfig/AP_BoardConfig.h>
 
@@ -114,6 +116,30 @@ const AP_Param::GroupInfo AP_Logger::var_info[] = {
     // @User: Standard
     AP_GROUPINFO("_FILE_MB_FREE",  7, AP_Logger, _params.min_MB_free, 500),
 
+    // @Param: _FILE_COMPRESS
+    // @DisplayName: Compress log files
+    // @Description: When enabled the file backend compresses each chunk written to the SD card with an LZ4 style compressor, reducing SD write bandwidth and card wear. Compressed logs must be decompressed by ground tools before analysis.
+    // @Values: 0:Disabled,1:Enabled
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("_FILE_COMPRESS",  8, AP_Logger, _params.file_compress, 0),
+
+    // @Param: _FILE_DELTA
+    // @DisplayName: Delta encode log files
+    // @Description: When enabled the file backend delta encodes high rate message streams, writing a full record periodically and only the changed bytes in between. This roughly halves logger bandwidth for the hottest streams. Delta encoded logs must be decoded by ground tools before analysis.
+    // @Values: 0:Disabled,1:Enabled
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("_FILE_DELTA",  9, AP_Logger, _params.file_delta, 0),
+
+    // @Param: _BUS_RECORD
+    // @DisplayName: Raw bus transaction recording
+    // @Description: Bitmask of bus types to record raw transfers for. Every transfer on a selected bus type is written to the BUSR log message, allowing driver traffic to be inspected and replayed offline. This is very high bandwidth; enable only for bench debugging.
+    // @Bitmask: 1:I2C,2:SPI,4:SITL,6:Serial
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("_BUS_RECORD",  10, AP_Logger, _params.bus_record, 0),
+
     AP_GROUPEND
 };
 
@@ -240,6 +266,16 @@ void AP_Logger::Init(const struct LogStructure *structures, uint8_t num_types)
     start_io_thread();
 
     EnableWrites(true);
+
+    if (_params.bus_record != 0) {
+        // record raw bus transfers for driver debugging. The callback
+        // runs in the bus threads so the writer must never block
+        AP_HAL::Device::set_transfer_capture([](const AP_HAL::Device &dev,
+                                                const uint8_t *send, uint32_t send_len,
+                                                const uint8_t *recv, uint32_t recv_len) {
+            AP::logger().Write_BusTransfer(dev, send, send_len, recv, recv_len);
+        });
+    }
 }
 
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
@@ -642,6 +678,11 @@ void AP_Logger::PrepForArming()
     FOR_EACH_BACKEND(PrepForArming());
 }
 
+void AP_Logger::write_latency_info(ExpandingString &str)
+{
+    FOR_EACH_BACKEND(write_latency_info(str));
+}
+
 void AP_Logger::setVehicle_Startup_Writer(vehicle_startup_message_Writer writer)
 {
     _vehicle_messages = writer;
@@ -911,9 +952,7 @@ void AP_Logger::WriteCritical(const char *name, const char *labels, const char *
 
 void AP_Logger::WriteV(const char *name, const char *labels, const char *units, const char *mults, const char *fmt, va_list arg_list, bool is_critical)
 {
-    // WriteV is not safe in replay as we can re-use IDs
-    const bool direct_comp = APM_BUILD_TYPE(APM_BUILD_Replay);
-    struct log_write_fmt *f = msg_fmt_for_name(name, labels, units, mults, fmt, direct_comp);
+    struct log_write_fmt *f = msg_fmt_for_name(name, labels, units, mults, fmt);
     if (f == nullptr) {
         // unable to map name to a messagetype; could be out of
         // msgtypes, could be out of slots, ...
@@ -1006,33 +1045,52 @@ bool AP_Logger::assert_same_fmt_for_name(const AP_Logger::log_write_fmt *f,
 }
 #endif
 
-AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const char *labels, const char *units, const char *mults, const char *fmt, const bool direct_comp)
+/*
+  FNV-1a hash of a message name folded to 32 bits, used as the key for
+  the write format index
+ */
+uint32_t AP_Logger::hash_name(const char *name)
+{
+    uint64_t hash = FNV_1_OFFSET_BASIS_64;
+    hash_fnv_1a(strlen(name), (const uint8_t *)name, &hash);
+    return uint32_t(hash ^ (hash >> 32));
+}
+
+AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const char *labels, const char *units, const char *mults, const char *fmt)
 {
+    const uint32_t hash = hash_name(name);
     WITH_SEMAPHORE(log_write_fmts_sem);
-    struct log_write_fmt *f;
-    for (f = log_write_fmts; f; f=f->next) {
-        if (!direct_comp) {
-            if (f->name == name) { // ptr comparison
-                // already have an ID for this name:
-#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
-                if (!assert_same_fmt_for_name(f, name, labels, units, mults, fmt)) {
-                    return nullptr;
-                }
-#endif
-                return f;
+    struct log_write_fmt *f = nullptr;
+
+    /* probe the open-addressing index. A hash match is confirmed with
+    a string compare as scripting does not keep name pointers stable */
+    for (uint16_t i=0; i<WRITE_FMT_INDEX_SIZE; i++) {
+        struct log_write_fmt *c = log_write_fmt_index[(hash + i) % WRITE_FMT_INDEX_SIZE];
+        if (c == nullptr) {
+            // name is not in the index
+            break;
+        }
+        if (c->name_hash == hash && strcmp(c->name, name) == 0) {
+            f = c;
+            break;
+        }
+    }
+    if (f == nullptr && log_write_fmt_index_full) {
+        // scan the list for formats that never fitted in the index
+        for (f = log_write_fmts; f; f=f->next) {
+            if (f->name_hash == hash && strcmp(f->name, name) == 0) {
+                break;
             }
-        } else {
-            // direct comparison used from scripting where pointer is not maintained
-            if (strcmp(f->name,name) == 0) {
-                // already have an ID for this name:
+        }
+    }
+    if (f != nullptr) {
+        // already have an ID for this name:
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
-                if (!assert_same_fmt_for_name(f, name, labels, units, mults, fmt)) {
-                    return nullptr;
-                }
-#endif
-                return f;
-            }
+        if (!assert_same_fmt_for_name(f, name, labels, units, mults, fmt)) {
+            return nullptr;
         }
+#endif
+        return f;
     }
 
 #if APM_BUILD_TYPE(APM_BUILD_Replay)
@@ -1041,7 +1099,9 @@ AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const ch
     return nullptr;
 #endif
 
-    f = (struct log_write_fmt *)calloc(1, sizeof(*f));
+    // formats live for the life of the flight; allocate them from
+    // the permanent arena rather than the general heap
+    f = (struct log_write_fmt *)hal.util->malloc_type(sizeof(*f), AP_HAL::Util::MEM_PERMANENT);
     if (f == nullptr) {
         // out of memory
         return nullptr;
@@ -1049,10 +1109,11 @@ AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const ch
     // no message type allocated for this name.  Try to allocate one:
     int16_t msg_type = find_free_msg_type();
     if (msg_type == -1) {
-        free(f);
+        hal.util->free_type(f, sizeof(*f), AP_HAL::Util::MEM_PERMANENT);
         return nullptr;
     }
     f->msg_type = msg_type;
+    f->name_hash = hash;
     f->name = name;
     f->fmt = fmt;
     f->labels = labels;
@@ -1061,7 +1122,7 @@ AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const ch
 
     int16_t tmp = Write_calc_msg_len(fmt);
     if (tmp == -1) {
-        free(f);
+        hal.util->free_type(f, sizeof(*f), AP_HAL::Util::MEM_PERMANENT);
         return nullptr;
     }
 
@@ -1071,6 +1132,21 @@ AP_Logger::log_write_fmt *AP_Logger::msg_fmt_for_name(const char *name, const ch
     f->next = log_write_fmts;
     log_write_fmts = f;
 
+    /* insert into the index. If the table is full further lookups for
+    this name fall back to the list scan above */
+    bool inserted = false;
+    for (uint16_t i=0; i<WRITE_FMT_INDEX_SIZE; i++) {
+        const uint16_t slot = (hash + i) % WRITE_FMT_INDEX_SIZE;
+        if (log_write_fmt_index[slot] == nullptr) {
+            log_write_fmt_index[slot] = f;
+            inserted = true;
+            break;
+        }
+    }
+    if (!inserted) {
+        log_write_fmt_index_full = true;
+    }
+
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
     char ls_name[LS_NAME_SIZE] = {};
     char ls_format[LS_FORMAT_SIZE] = {};
@@ -1404,11 +1480,3 @@ bool AP_Logger::log_while_disarmed(void) const
     return false;
 }
 
-namespace AP {
-
-AP_Logger &logger()
-{
-    return *AP_Logger::get_singleton();
-}
-
-};
@@ -281,6 +281,9 @@ public:
 
     void PrepForArming();
 
+    // dump backend write latency statistics for @SYS/log_latency.txt
+    void write_latency_info(class ExpandingString &str);
+
     void EnableWrites(bool enable) { _writes_enabled = enable; }
     bool WritesEnabled() const { return _writes_enabled; }
 
@@ -322,6 +325,9 @@ public:
     void Write_ESCStatus(uint64_t time_us, uint8_t id, uint32_t error_count, float voltage, float current, float temperature, int32_t rpm, uint8_t power_pct);
     void Write_Compass();
     void Write_Mode(uint8_t mode, const ModeReason reason);
+    void Write_BusTransfer(const AP_HAL::Device &dev,
+                           const uint8_t *send, uint32_t send_len,
+                           const uint8_t *recv, uint32_t recv_len);
 
     void Write_EntireMission();
     void Write_Command(const mavlink_command_int_t &packet, MAV_RESULT result, bool was_command_long=false);
@@ -363,6 +369,7 @@ public:
     };
 
     void Write_PID(uint8_t msg_type, const PID_Info &info);
+    void Write_PID(uint8_t msg_type, const PID_Info &info, uint64_t time_us);
 
     // returns true if logging of a message should be attempted
     bool should_log(uint32_t mask) const;
@@ -403,6 +410,9 @@ public:
         AP_Int8 mav_bufsize; // in kilobytes
         AP_Int16 file_timeout; // in seconds
         AP_Int16 min_MB_free;
+        AP_Int8 file_compress;
+        AP_Int8 file_delta;
+        AP_Int16 bus_record;
     } _params;
 
     const struct LogStructure *structure(uint16_t num) const;
@@ -446,6 +456,7 @@ public:
         uint8_t msg_type;
         uint8_t msg_len;
         uint8_t sent_mask; // bitmask of backends sent to
+        uint32_t name_hash; // folded FNV-1a hash of name
         const char *name;
         const char *fmt;
         const char *labels;
@@ -453,8 +464,18 @@ public:
         const char *mults;
     } *log_write_fmts;
 
+    // open-addressing index over log_write_fmts keyed on a hash of
+    // the message name, so dynamic Write() calls do not linear-scan
+    // the list with string compares
+    static const uint16_t WRITE_FMT_INDEX_SIZE = 64; // power of two
+    struct log_write_fmt *log_write_fmt_index[WRITE_FMT_INDEX_SIZE];
+    bool log_write_fmt_index_full;
+
+    // folded FNV-1a hash of a message name for the index
+    static uint32_t hash_name(const char *name);
+
     // return (possibly allocating) a log_write_fmt for a name
-    struct log_write_fmt *msg_fmt_for_name(const char *name, const char *labels, const char *units, const char *mults, const char *fmt, const bool direct_comp = false);
+    struct log_write_fmt *msg_fmt_for_name(const char *name, const char *labels, const char *units, const char *mults, const char *fmt);
 
     // output a FMT message for each backend if not already done so
     void Safe_Write_Emit_FMT(log_write_fmt *f);
@@ -583,6 +604,18 @@ private:
     // start page of log data
     uint32_t _log_data_page;
 
+    // read-ahead cache so each LOG_DATA packet does not cost a
+    // backend seek and read. Allocated while a download is active
+    uint8_t *_log_read_cache;
+    uint32_t _log_read_cache_ofs;  // log offset of the first cached byte
+    uint32_t _log_read_cache_len;  // valid bytes in the cache
+
+    // fill a LOG_DATA sized packet from the read-ahead cache
+    int16_t get_log_data_cached(uint16_t log_num, uint32_t page, uint32_t offset, uint16_t len, uint8_t *data);
+
+    // release the read-ahead cache at the end of a download
+    void free_log_read_cache(void);
+
     GCS_MAVLINK *_log_sending_link;
     HAL_Semaphore _log_send_sem;
 
@@ -613,5 +646,7 @@ private:
 };
 
 namespace AP {
-    AP_Logger &logger();
+    inline AP_Logger &logger() {
+        return *AP_Logger::get_singleton();
+    }
 };
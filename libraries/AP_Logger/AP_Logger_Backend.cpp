@@ -48,6 +48,25 @@ AP_Logger_Backend::vehicle_startup_message_Writer AP_Logger_Backend::vehicle_mes
     return _front._vehicle_messages;
 }
 
+/*
+  return the length of a message of the given type, covering both the
+  static structures and types allocated for Write() calls
+ */
+uint8_t AP_Logger_Backend::msg_len_for_type(uint8_t msg_type) const
+{
+    for (uint8_t i = 0; i < num_types(); i++) {
+        const struct LogStructure *s = structure(i);
+        if (s != nullptr && s->msg_type == msg_type) {
+            return s->msg_len;
+        }
+    }
+    const struct AP_Logger::log_write_fmt *f = _front.log_write_fmt_for_msg_type(msg_type);
+    if (f != nullptr) {
+        return f->msg_len;
+    }
+    return 0;
+}
+
 void AP_Logger_Backend::periodic_10Hz(const uint32_t now)
 {
 }
@@ -132,6 +132,9 @@ public:
 
     virtual void io_timer(void) {}
 
+    // dump write latency statistics for @SYS/log_latency.txt
+    virtual void write_latency_info(class ExpandingString &str) {}
+
 protected:
 
     AP_Logger &_front;
@@ -163,6 +166,10 @@ protected:
 
     // must be called when a new log is being started:
     virtual void start_new_log_reset_variables();
+
+    // return the length of a message of the given type, including the
+    // header, or 0 if unknown. Used by record-aware backends
+    uint8_t msg_len_for_type(uint8_t msg_type) const;
     // convert between log numbering in storage and normalized numbering
     uint16_t log_num_from_list_entry(const uint16_t list_entry);
 
@@ -18,6 +18,7 @@
 #if HAL_LOGGING_FILESYSTEM_ENABLED
 
 #include <AP_Common/AP_Common.h>
+#include <AP_Common/ExpandingString.h>
 #include <AP_InternalError/AP_InternalError.h>
 #include <AP_RTC/AP_RTC.h>
 
@@ -66,6 +67,17 @@ void AP_Logger_File::ensure_log_directory_exists()
 
 void AP_Logger_File::Init()
 {
+    // discover the card allocation unit so writes can be batched and
+    // aligned with it; writes that straddle an allocation unit can
+    // trigger internal card garbage collection and multi-hundred-ms
+    // stalls. FAT cluster sizes are powers of two, so aligning to a
+    // clamped divisor keeps the benefit when the unit is large
+    const uint32_t alloc_unit = AP::FS().alloc_unit_size(_log_directory);
+    if (alloc_unit >= 512 && (alloc_unit & (alloc_unit-1)) == 0) {
+        _fs_align = MIN(alloc_unit, 16384U);
+        _writebuf_chunk = uint16_t(MAX(uint32_t(_writebuf_chunk), MIN(alloc_unit, 8192U)));
+    }
+
     // determine and limit file backend buffersize
     uint32_t bufsize = _front._params.file_bufsize;
     bufsize *= 1024;
@@ -87,6 +99,37 @@ void AP_Logger_File::Init()
 
     hal.console->printf("AP_Logger_File: buffer size=%u\n", (unsigned)bufsize);
 
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_front._params.file_compress) {
+        _compress_buf_size = LogCompressor::max_compressed_size(_writebuf_chunk) + sizeof(log_compress_frame_header);
+        _compress_buf = (uint8_t *)malloc(_compress_buf_size);
+        if (_compress_buf == nullptr || !_compressor.init()) {
+            free(_compress_buf);
+            _compress_buf = nullptr;
+            hal.console->printf("AP_Logger: no memory for log compression\n");
+        }
+    }
+#endif
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+    if (_front._params.file_delta) {
+        _delta_out_size = _writebuf_chunk;
+        _delta_in = (uint8_t *)malloc(_writebuf_chunk);
+        _delta_out = (uint8_t *)malloc(_delta_out_size);
+        _delta_msg_len = (uint8_t *)calloc(256, 1);
+        if (_delta_in == nullptr || _delta_out == nullptr ||
+            _delta_msg_len == nullptr || !_delta.init(255)) {
+            free(_delta_in);
+            free(_delta_out);
+            free(_delta_msg_len);
+            _delta_in = nullptr;
+            _delta_out = nullptr;
+            _delta_msg_len = nullptr;
+            hal.console->printf("AP_Logger: no memory for delta encoding\n");
+        }
+    }
+#endif
+
     _initialised = true;
 
     const char* custom_dir = hal.util->get_custom_log_directory();
@@ -406,6 +449,9 @@ void AP_Logger_File::EraseAll()
     const bool was_logging = (_write_fd != -1);
     stop_logging();
 
+    // don't leave a descriptor open on a file we are about to unlink
+    discard_prepped_log_file();
+
     for (uint16_t log_num=1; log_num<=MAX_LOG_FILES; log_num++) {
         char *fname = _log_file_name(log_num);
         if (fname == nullptr) {
@@ -451,8 +497,6 @@ bool AP_Logger_File::StartNewLogOK() const
 /* Write a block of data at current offset */
 bool AP_Logger_File::_WritePrioritisedBlock(const void *pBuffer, uint16_t size, bool is_critical)
 {
-    WITH_SEMAPHORE(semaphore);
-
     if (! WriteBlockCheckStartupMessages()) {
         _dropped++;
         return false;
@@ -488,6 +532,15 @@ bool AP_Logger_File::_WritePrioritisedBlock(const void *pBuffer, uint16_t size,
             _dropped++;
             return false;
         }
+        // under buffer pressure shed the IMU batch samples first;
+        // they are by far the largest stream and losing some batches
+        // is much better than losing the event trail when the SD
+        // card stalls
+        if (space < _writebuf.get_size()/4 && size >= 3 &&
+            ((const uint8_t *)pBuffer)[2] == LOG_ISBD_MSG) {
+            _dropped++;
+            return false;
+        }
     }
 
     // if no room for entire message - drop it:
@@ -496,7 +549,14 @@ bool AP_Logger_File::_WritePrioritisedBlock(const void *pBuffer, uint16_t size,
         return false;
     }
 
-    _writebuf.write((uint8_t*)pBuffer, size);
+    // the write claims space atomically and is all-or-nothing;
+    // another writer may have claimed the space we saw above, in
+    // which case the block is dropped. The statistics updates are
+    // unlocked and may lose the occasional count under contention
+    if (_writebuf.write((uint8_t*)pBuffer, size) != size) {
+        _dropped++;
+        return false;
+    }
     df_stats_gather(size, _writebuf.space());
     return true;
 }
@@ -724,6 +784,11 @@ void AP_Logger_File::start_new_log(void)
         return;
     }
 
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+    // each log must start with keyframes for every stream
+    _delta.reset();
+#endif
+
     const bool open_error_ms_was_zero = (_open_error_ms == 0);
 
     // set _open_error here to avoid infinite recursion.  Simply
@@ -743,6 +808,42 @@ void AP_Logger_File::start_new_log(void)
         _read_fd = -1;
     }
 
+    // adopt a file prepared by the io thread if one is ready. This
+    // makes the common arming-time log start a descriptor swap rather
+    // than a series of filesystem operations
+    int prep_fd = -1;
+    char *prep_filename = nullptr;
+    {
+        WITH_SEMAPHORE(_prep_sem);
+        prep_fd = _prep_fd;
+        prep_filename = _prep_filename;
+        _prep_fd = -1;
+        _prep_filename = nullptr;
+    }
+    if (prep_fd != -1) {
+        if (write_fd_semaphore.take(1)) {
+            free(_write_filename);
+            _write_filename = prep_filename;
+            _write_fd = prep_fd;
+#if CONFIG_HAL_BOARD == HAL_BOARD_CHIBIOS
+            // remember if we had utc time when we opened the file
+            uint64_t utc_usec;
+            _need_rtc_update = !AP::rtc().get_utc_usec(utc_usec);
+#endif
+            _cached_oldest_log = 0;
+            _last_write_ms = AP_HAL::millis();
+            _open_error_ms = 0;
+            _write_offset = 0;
+            _writebuf.clear();
+            write_fd_semaphore.give();
+            // lastlog.txt was already written when the file was prepared
+            return;
+        }
+        // could not claim the write fd; fall back to the normal path
+        AP::FS().close(prep_fd);
+        free(prep_filename);
+    }
+
     if (disk_space_avail() < _free_space_min_avail && disk_space() > 0) {
         hal.console->printf("Out of space for logging\n");
         return;
@@ -800,14 +901,26 @@ void AP_Logger_File::start_new_log(void)
     write_fd_semaphore.give();
 
     // now update lastlog.txt with the new log number
+    if (!write_lastlog_file(log_num)) {
+        _open_error_ms = AP_HAL::millis();
+        return;
+    }
+
+    return;
+}
+
+/*
+  update lastlog.txt with the given log number
+ */
+bool AP_Logger_File::write_lastlog_file(uint16_t log_num)
+{
     char *fname = _lastlog_file_name();
 
     EXPECT_DELAY_MS(3000);
     int fd = AP::FS().open(fname, O_WRONLY|O_CREAT);
     free(fname);
     if (fd == -1) {
-        _open_error_ms = AP_HAL::millis();
-        return;
+        return false;
     }
 
     char buf[30];
@@ -816,12 +929,82 @@ void AP_Logger_File::start_new_log(void)
     const ssize_t written = AP::FS().write(fd, buf, to_write);
     AP::FS().close(fd);
 
-    if (written < to_write) {
-        _open_error_ms = AP_HAL::millis();
+    return written >= to_write;
+}
+
+/*
+  pre-create the next log file. Called from the io thread while
+  disarmed and not logging, so that start_new_log() at arming does not
+  block on slow filesystem operations; it just adopts the prepared
+  descriptor. An unused prepared file is empty and is re-used by the
+  normal log numbering on the next start
+ */
+void AP_Logger_File::prep_next_log_file(void)
+{
+    if (_prep_fd != -1 || recent_open_error()) {
         return;
     }
+    const uint32_t now = AP_HAL::millis();
+    if (now - _last_prep_ms < 1000) {
+        return;
+    }
+    _last_prep_ms = now;
 
-    return;
+    if (disk_space_avail() < _free_space_min_avail && disk_space() > 0) {
+        return;
+    }
+
+    uint16_t log_num = find_last_log();
+    // re-use empty logs if possible
+    if (_get_log_size(log_num) > 0 || log_num == 0) {
+        log_num++;
+    }
+    if (log_num > MAX_LOG_FILES) {
+        log_num = 1;
+    }
+    char *fname = _log_file_name(log_num);
+    if (fname == nullptr) {
+        return;
+    }
+
+    ensure_log_directory_exists();
+
+    EXPECT_DELAY_MS(3000);
+    const int fd = AP::FS().open(fname, O_WRONLY|O_CREAT|O_TRUNC);
+    if (fd == -1) {
+        free(fname);
+        return;
+    }
+    if (!write_lastlog_file(log_num)) {
+        AP::FS().close(fd);
+        free(fname);
+        return;
+    }
+
+    WITH_SEMAPHORE(_prep_sem);
+    if (_write_fd != -1 || _prep_fd != -1) {
+        // a log was started while we were preparing; discard to avoid
+        // two descriptors on the same file
+        AP::FS().close(fd);
+        free(fname);
+        return;
+    }
+    _prep_fd = fd;
+    _prep_filename = fname;
+}
+
+/*
+  discard any prepared log file, e.g. before erasing all logs
+ */
+void AP_Logger_File::discard_prepped_log_file(void)
+{
+    WITH_SEMAPHORE(_prep_sem);
+    if (_prep_fd != -1) {
+        AP::FS().close(_prep_fd);
+        _prep_fd = -1;
+    }
+    free(_prep_filename);
+    _prep_filename = nullptr;
 }
 
 
@@ -854,11 +1037,85 @@ void AP_Logger_File::flush(void)
 #endif // APM_BUILD_TYPE(APM_BUILD_Replay) || APM_BUILD_TYPE(APM_BUILD_UNKNOWN)
 #endif
 
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+/*
+  compress a chunk from the write buffer into _compress_buf, including
+  the frame header. Returns the number of bytes to write. Chunks that
+  do not compress are stored uncompressed in the frame
+ */
+uint32_t AP_Logger_File::compress_chunk(const uint8_t *data, uint32_t n)
+{
+    struct log_compress_frame_header hdr {};
+    hdr.magic[0] = LOG_COMPRESS_MAGIC0;
+    hdr.magic[1] = LOG_COMPRESS_MAGIC1;
+    hdr.raw_len = n;
+    uint32_t clen = _compressor.compress(data, n, &_compress_buf[sizeof(hdr)], _compress_buf_size - sizeof(hdr));
+    if (clen == 0 || clen >= n) {
+        // incompressible; store the chunk as-is
+        memcpy(&_compress_buf[sizeof(hdr)], data, n);
+        clen = n;
+    }
+    hdr.comp_len = clen;
+    memcpy(_compress_buf, &hdr, sizeof(hdr));
+    return clen + sizeof(hdr);
+}
+#endif
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+/*
+  peek whole records from the write buffer and delta encode them into
+  _delta_out. Returns the encoded size and sets consumed to the number
+  of ring buffer bytes represented. A zero return falls back to the
+  raw byte stream
+ */
+uint32_t AP_Logger_File::delta_encode_chunk(uint32_t max_bytes, uint32_t &consumed)
+{
+    consumed = 0;
+    const uint32_t n = _writebuf.peekbytes(_delta_in, max_bytes);
+    uint32_t out = 0;
+    uint32_t ofs = 0;
+    while (ofs + 3 <= n) {
+        uint8_t mlen = 0;
+        if (_delta_in[ofs] == HEAD_BYTE1 && _delta_in[ofs+1] == HEAD_BYTE2) {
+            const uint8_t msgid = _delta_in[ofs+2];
+            mlen = _delta_msg_len[msgid];
+            if (mlen == 0) {
+                mlen = msg_len_for_type(msgid);
+                _delta_msg_len[msgid] = mlen;
+            }
+        }
+        if (mlen == 0) {
+            // lost record sync or unknown type; should not happen as
+            // the buffer only ever holds whole records. Disable delta
+            // encoding and fall back to the raw byte stream
+            free(_delta_in);
+            _delta_in = nullptr;
+            hal.console->printf("AP_Logger: delta encoding lost sync\n");
+            return 0;
+        }
+        if (ofs + mlen > n ||
+            out + mlen + LOG_DELTA_MAX_OVERHEAD > _delta_out_size) {
+            break;
+        }
+        out += _delta.encode_record(&_delta_in[ofs], mlen, &_delta_out[out]);
+        ofs += mlen;
+    }
+    consumed = ofs;
+    return out;
+}
+#endif
+
 void AP_Logger_File::io_timer(void)
 {
     uint32_t tnow = AP_HAL::millis();
     _io_timer_heartbeat = tnow;
     if (_write_fd == -1 || !_initialised || recent_open_error()) {
+        if (_write_fd == -1 && _initialised && !recent_open_error() &&
+            !hal.util->get_soft_armed()) {
+            // not logging; use the idle time to prepare the next log
+            // file so that start_new_log() is fast
+            prep_next_log_file();
+        }
         return;
     }
 
@@ -895,14 +1152,55 @@ void AP_Logger_File::io_timer(void)
     const uint8_t *head = _writebuf.readptr(size);
     nbytes = MIN(nbytes, size);
 
-    // try to align writes on a 512 byte boundary to avoid filesystem reads
-    if ((nbytes + _write_offset) % 512 != 0) {
-        uint32_t ofs = (nbytes + _write_offset) % 512;
+    // bytes consumed from the ring if the write fully succeeds. When
+    // a transform stage is active this differs from the bytes written
+    uint32_t ring_advance = nbytes;
+    bool raw_stream = true;
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+    if (_delta_in != nullptr) {
+        // delta encode whole records and write the encoded stream
+        // instead of the raw ring buffer data
+        const uint32_t encoded = delta_encode_chunk(nbytes, ring_advance);
+        if (encoded > 0) {
+            head = _delta_out;
+            nbytes = encoded;
+            raw_stream = false;
+        } else {
+            ring_advance = nbytes;
+        }
+    }
+#endif
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_compress_buf != nullptr) {
+        raw_stream = false;
+    }
+#endif
+
+    if (raw_stream) {
+        // try to end writes on an allocation unit boundary when one
+        // would be straddled, and otherwise on a 512 byte boundary to
+        // avoid filesystem reads
+        uint32_t ofs = (nbytes + _write_offset) % _fs_align;
+        if (ofs >= nbytes) {
+            ofs = (nbytes + _write_offset) % 512;
+        }
         if (ofs < nbytes) {
             nbytes -= ofs;
+            ring_advance = nbytes;
         }
     }
 
+    const uint8_t *write_ptr = head;
+    uint32_t write_nbytes = nbytes;
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+    if (_compress_buf != nullptr) {
+        // compress the chunk into a frame and write that instead
+        write_nbytes = compress_chunk(head, nbytes);
+        write_ptr = _compress_buf;
+    }
+#endif
+
     last_io_operation = "write";
     if (!write_fd_semaphore.take(1)) {
         return;
@@ -911,8 +1209,15 @@ void AP_Logger_File::io_timer(void)
         write_fd_semaphore.give();
         return;
     }
-    ssize_t nwritten = AP::FS().write(_write_fd, head, nbytes);
+    const uint32_t write_start_us = AP_HAL::micros();
+    ssize_t nwritten = AP::FS().write(_write_fd, write_ptr, write_nbytes);
     last_io_operation = "";
+    if (!raw_stream && nwritten > 0 && uint32_t(nwritten) != write_nbytes) {
+        // a short write leaves a truncated frame or record; tools
+        // resync on the record or frame magic, but do not advance the
+        // ring so the data is written again whole
+        nwritten = 0;
+    }
     if (nwritten <= 0) {
         if ((tnow - _last_write_ms)/1000U > unsigned(_front._params.file_timeout)) {
             // if we can't write for LOG_FILE_TIMEOUT seconds we give up and close
@@ -929,7 +1234,13 @@ void AP_Logger_File::io_timer(void)
         _last_write_failed = false;
         _last_write_ms = tnow;
         _write_offset += nwritten;
-        _writebuf.advance(nwritten);
+        if (raw_stream) {
+            _writebuf.advance(nwritten);
+        } else {
+            // a whole transformed chunk went out; the ring advances
+            // by the raw bytes it represented
+            _writebuf.advance(ring_advance);
+        }
         /*
           the best strategy for minimizing corruption on microSD cards
           seems to be to write in 4k chunks and fsync the file on each
@@ -942,6 +1253,18 @@ void AP_Logger_File::io_timer(void)
         last_io_operation = "";
 #endif
 
+        // bucket the write+fsync latency for @SYS/log_latency.txt so
+        // card garbage collection stalls show up in the field
+        const uint32_t lat_us = AP_HAL::micros() - write_start_us;
+        if (lat_us > _write_lat_max_us) {
+            _write_lat_max_us = lat_us;
+        }
+        uint8_t bucket = 0;
+        while (bucket < ARRAY_SIZE(_write_lat_hist)-1 && (1000U << bucket) <= lat_us) {
+            bucket++;
+        }
+        _write_lat_hist[bucket]++;
+
 #if CONFIG_HAL_BOARD == HAL_BOARD_CHIBIOS
         // ChibiOS does not update mtime on writes, so if we opened
         // without knowing the time we should update it later
@@ -958,6 +1281,26 @@ void AP_Logger_File::io_timer(void)
     write_fd_semaphore.give();
 }
 
+/*
+  dump the write latency histogram for @SYS/log_latency.txt
+ */
+void AP_Logger_File::write_latency_info(ExpandingString &str)
+{
+    str.printf("LogWriteLatency v1 chunk=%u align=%u\n%-10s %10s\n",
+               unsigned(_writebuf_chunk), unsigned(_fs_align),
+               "BUCKET", "COUNT");
+    for (uint8_t i=0; i<ARRAY_SIZE(_write_lat_hist); i++) {
+        char label[12];
+        if (i < ARRAY_SIZE(_write_lat_hist)-1) {
+            hal.util->snprintf(label, sizeof(label), "<%ums", unsigned(1U<<i));
+        } else {
+            hal.util->snprintf(label, sizeof(label), ">=%ums", unsigned(1U<<(i-1)));
+        }
+        str.printf("%-10s %10u\n", label, unsigned(_write_lat_hist[i]));
+    }
+    str.printf("max %uus\n", unsigned(_write_lat_max_us));
+}
+
 bool AP_Logger_File::io_thread_alive() const
 {
     // if the io thread hasn't had a heartbeat in a full seconds then it is dead
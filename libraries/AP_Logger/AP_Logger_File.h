@@ -10,6 +10,8 @@
 
 #include <AP_HAL/utility/RingBuffer.h>
 #include "AP_Logger_Backend.h"
+#include "LogCompress.h"
+#include "LogDelta.h"
 
 #if HAL_LOGGING_FILESYSTEM_ENABLED
 
@@ -57,6 +59,9 @@ public:
     bool logging_started(void) const override { return _write_fd != -1; }
     void io_timer(void) override;
 
+    // dump write latency statistics for @SYS/log_latency.txt
+    void write_latency_info(class ExpandingString &str) override;
+
 protected:
 
     bool WritesOK() const override;
@@ -95,11 +100,51 @@ private:
     bool file_exists(const char *filename) const;
     bool log_exists(const uint16_t lognum) const;
 
-    // write buffer
-    ByteBuffer _writebuf{0};
-    const uint16_t _writebuf_chunk = HAL_LOGGER_WRITE_CHUNK_SIZE;
+    // write buffer. Multi-writer so that Write() callers on any
+    // thread can queue blocks without taking a lock
+    MPSCByteBuffer _writebuf{0};
+    // raised to the card allocation unit in Init() when memory allows
+    uint16_t _writebuf_chunk = HAL_LOGGER_WRITE_CHUNK_SIZE;
+    // write ends are kept aligned to this, the card allocation unit
+    // (or a power-of-two divisor of it) so writes do not straddle an
+    // allocation unit and trigger card garbage collection
+    uint16_t _fs_align = 512;
     uint32_t _last_write_time;
 
+    // write+fsync latency histogram for @SYS/log_latency.txt; bucket
+    // n counts operations that took less than 2^n ms, the last bucket
+    // everything slower
+    uint32_t _write_lat_hist[9];
+    uint32_t _write_lat_max_us;
+
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+    // optional compression stage between the write buffer and the
+    // filesystem, enabled with LOG_FILE_COMPRESS
+    LogCompressor _compressor;
+    uint8_t *_compress_buf = nullptr;
+    uint32_t _compress_buf_size;
+
+    // compress a chunk into _compress_buf including the frame header,
+    // returning the number of bytes to write
+    uint32_t compress_chunk(const uint8_t *data, uint32_t n);
+#endif
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+    // optional record-aware delta encoding stage between the write
+    // buffer and the filesystem, enabled with LOG_FILE_DELTA
+    LogDeltaEncoder _delta;
+    uint8_t *_delta_in = nullptr;
+    uint8_t *_delta_out = nullptr;
+    uint32_t _delta_out_size;
+    // cached message lengths indexed by message type, 0 when unknown
+    uint8_t *_delta_msg_len = nullptr;
+
+    // delta encode whole records from the write buffer into
+    // _delta_out. Returns the encoded size and sets consumed to the
+    // number of ring buffer bytes represented
+    uint32_t delta_encode_chunk(uint32_t max_bytes, uint32_t &consumed);
+#endif
+
     /* construct a file name given a log number. Caller must free. */
     char *_log_file_name(const uint16_t log_num) const;
     char *_log_file_name_long(const uint16_t log_num) const;
@@ -110,6 +155,19 @@ private:
 
     void stop_logging(void) override;
 
+    // next log file prepared by the io thread while disarmed, so that
+    // starting a log at arming is just a descriptor swap
+    int _prep_fd = -1;
+    char *_prep_filename;
+    uint32_t _last_prep_ms;
+    HAL_Semaphore _prep_sem;
+
+    void prep_next_log_file(void);
+    void discard_prepped_log_file(void);
+
+    // write the log number to lastlog.txt
+    bool write_lastlog_file(uint16_t log_num);
+
     uint32_t last_messagewrite_message_sent;
 
     // free-space checks; filling up SD cards under NuttX leads to
@@ -119,8 +177,6 @@ private:
     const uint32_t _free_space_check_interval = 1000UL; // milliseconds
     const uint32_t _free_space_min_avail = 8388608; // bytes
 
-    // semaphore mediates access to the ringbuffer
-    HAL_Semaphore semaphore;
     // write_fd_semaphore mediates access to write_fd so the frontend
     // can open/close files without causing the backend to write to a
     // bad fd
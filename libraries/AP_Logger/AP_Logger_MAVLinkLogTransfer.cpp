@@ -24,6 +24,10 @@
 
 extern const AP_HAL::HAL& hal;
 
+// size of the read-ahead cache used during log downloads. Each
+// backend read fills the cache once rather than seeking per packet
+#define LOG_READ_CACHE_SIZE 4096
+
 // We avoid doing log messages when timing is critical:
 bool AP_Logger::should_handle_log_message()
 {
@@ -138,6 +142,9 @@ void AP_Logger::handle_log_request_data(GCS_MAVLINK &link, const mavlink_message
 
         uint32_t end;
         get_log_boundaries(packet.id, _log_data_page, end);
+
+        // any cached data is from the previous log
+        _log_read_cache_len = 0;
     }
 
     _log_data_offset = packet.ofs;
@@ -178,6 +185,7 @@ void AP_Logger::handle_log_request_end(GCS_MAVLINK &link, const mavlink_message_
 
     transfer_activity = TransferActivity::IDLE;
     _log_sending_link = nullptr;
+    free_log_read_cache();
 }
 
 /**
@@ -210,24 +218,24 @@ void AP_Logger::handle_log_sending()
 {
     WITH_SEMAPHORE(_log_send_sem);
 
+    uint32_t num_sends = 1;
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
     // assume USB speeds in SITL for the purposes of log download
-    const uint8_t num_sends = 40;
+    num_sends = 40;
 #else
-    uint8_t num_sends = 1;
     if (_log_sending_link->is_high_bandwidth() && hal.gpio->usb_connected()) {
         // when on USB we can send a lot more data
         num_sends = 250;
     } else if (_log_sending_link->have_flow_control()) {
-    #if CONFIG_HAL_BOARD == HAL_BOARD_LINUX
-        num_sends = 80;
-    #else
-        num_sends = 10;
-    #endif
+        // burst-fill the available transmit buffer. The per-packet
+        // space check in handle_log_send_data() is the hard limit;
+        // this just bounds the work done per call
+        const uint16_t pkt_size = PAYLOAD_SIZE(_log_sending_link->get_chan(), LOG_DATA);
+        num_sends = MAX(_log_sending_link->txspace() / pkt_size, 1U);
     }
 #endif
 
-    for (uint8_t i=0; i<num_sends; i++) {
+    for (uint32_t i=0; i<num_sends; i++) {
         if (transfer_activity != TransferActivity::SENDING) {
             // may have completed sending data
             break;
@@ -299,7 +307,7 @@ bool AP_Logger::handle_log_send_data()
         len = MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
     }
 
-    nbytes = get_log_data(_log_num_data, _log_data_page, _log_data_offset, len, packet.data);
+    nbytes = get_log_data_cached(_log_num_data, _log_data_page, _log_data_offset, len, packet.data);
 
     if (nbytes < 0) {
         // report as EOF on error
@@ -324,6 +332,52 @@ bool AP_Logger::handle_log_send_data()
     if (nbytes < MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN || _log_data_remaining == 0) {
         transfer_activity = TransferActivity::IDLE;
         _log_sending_link = nullptr;
+        free_log_read_cache();
     }
     return true;
 }
+
+/*
+  fill a LOG_DATA sized request from the read-ahead cache, refilling
+  the cache with a single large backend read when needed. This avoids
+  a backend seek and read for every 90 byte packet
+ */
+int16_t AP_Logger::get_log_data_cached(uint16_t log_num, uint32_t page, uint32_t offset, uint16_t len, uint8_t *data)
+{
+    if (_log_read_cache == nullptr) {
+        _log_read_cache = (uint8_t *)malloc(LOG_READ_CACHE_SIZE);
+        _log_read_cache_len = 0;
+        if (_log_read_cache == nullptr) {
+            // no memory for the cache; fall back to direct reads
+            return get_log_data(log_num, page, offset, len, data);
+        }
+    }
+    if (_log_read_cache_len == 0 ||
+        offset < _log_read_cache_ofs ||
+        offset + len > _log_read_cache_ofs + _log_read_cache_len) {
+        const int16_t n = get_log_data(log_num, page, offset, LOG_READ_CACHE_SIZE, _log_read_cache);
+        if (n <= 0) {
+            _log_read_cache_len = 0;
+            return n;
+        }
+        _log_read_cache_ofs = offset;
+        _log_read_cache_len = n;
+    }
+    const uint32_t avail = _log_read_cache_ofs + _log_read_cache_len - offset;
+    if (len > avail) {
+        // near the end of the log
+        len = avail;
+    }
+    memcpy(data, &_log_read_cache[offset - _log_read_cache_ofs], len);
+    return len;
+}
+
+/*
+  release the read-ahead cache at the end of a download
+ */
+void AP_Logger::free_log_read_cache(void)
+{
+    free(_log_read_cache);
+    _log_read_cache = nullptr;
+    _log_read_cache_len = 0;
+}
@@ -0,0 +1,139 @@
+/*
+  small greedy LZ4 block format compressor for log file compression.
+  The repetitive fixed-layout LogStructure records typically compress
+  3-4x, cutting SD write bandwidth proportionally
+ */
+#include "LogCompress.h"
+
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LZ4_HASH_BITS 12
+#define LZ4_MINMATCH 4
+// matches may not start within the last 12 bytes of the block
+#define LZ4_MFLIMIT 12
+// the last 5 bytes of the block are always literals
+#define LZ4_LASTLITERALS 5
+
+// unaligned 32 bit read
+static inline uint32_t lz4_read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t lz4_hash(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+bool LogCompressor::init(void)
+{
+    if (table == nullptr) {
+        table = (uint16_t *)calloc(1U << LZ4_HASH_BITS, sizeof(uint16_t));
+    }
+    return table != nullptr;
+}
+
+uint32_t LogCompressor::compress(const uint8_t *src, uint32_t len, uint8_t *dst, uint32_t dst_size)
+{
+    if (table == nullptr || len < LZ4_MFLIMIT + 1 || len > 0xFFFF) {
+        return 0;
+    }
+    memset(table, 0, (1U << LZ4_HASH_BITS) * sizeof(uint16_t));
+
+    const uint8_t *ip = src;
+    const uint8_t *anchor = src;
+    const uint8_t * const iend = src + len;
+    const uint8_t * const mflimit = iend - LZ4_MFLIMIT;
+    const uint8_t * const matchlimit = iend - LZ4_LASTLITERALS;
+    uint8_t *op = dst;
+    uint8_t * const oend = dst + dst_size;
+
+    while (ip < mflimit) {
+        // look for a 4 byte match via the hash table
+        const uint32_t h = lz4_hash(lz4_read32(ip));
+        const uint16_t pos = table[h];
+        table[h] = (ip - src) + 1;
+        if (pos == 0 || lz4_read32(&src[pos - 1]) != lz4_read32(ip)) {
+            ip++;
+            continue;
+        }
+        const uint8_t *match = &src[pos - 1];
+
+        // extend the match forwards
+        const uint8_t *mip = ip + LZ4_MINMATCH;
+        const uint8_t *mref = match + LZ4_MINMATCH;
+        while (mip < matchlimit && *mip == *mref) {
+            mip++;
+            mref++;
+        }
+        const uint32_t match_len = (mip - ip) - LZ4_MINMATCH;
+        const uint32_t lit_len = ip - anchor;
+
+        // emit token, literal run, offset and extended match length
+        if (&op[1 + lit_len + lit_len/255 + 2 + match_len/255 + 2] > oend) {
+            return 0;
+        }
+        uint8_t *token = op++;
+        if (lit_len >= 15) {
+            *token = 0xF0;
+            uint32_t l = lit_len - 15;
+            while (l >= 255) {
+                *op++ = 255;
+                l -= 255;
+            }
+            *op++ = l;
+        } else {
+            *token = lit_len << 4;
+        }
+        memcpy(op, anchor, lit_len);
+        op += lit_len;
+
+        const uint16_t offset = ip - match;
+        *op++ = offset & 0xFF;
+        *op++ = offset >> 8;
+
+        if (match_len >= 15) {
+            *token |= 0x0F;
+            uint32_t l = match_len - 15;
+            while (l >= 255) {
+                *op++ = 255;
+                l -= 255;
+            }
+            *op++ = l;
+        } else {
+            *token |= match_len;
+        }
+
+        ip += LZ4_MINMATCH + match_len;
+        anchor = ip;
+    }
+
+    // emit the remaining bytes as literals
+    const uint32_t lit_len = iend - anchor;
+    if (&op[1 + lit_len + lit_len/255 + 1] > oend) {
+        return 0;
+    }
+    uint8_t *token = op++;
+    if (lit_len >= 15) {
+        *token = 0xF0;
+        uint32_t l = lit_len - 15;
+        while (l >= 255) {
+            *op++ = 255;
+            l -= 255;
+        }
+        *op++ = l;
+    } else {
+        *token = lit_len << 4;
+    }
+    memcpy(op, anchor, lit_len);
+    op += lit_len;
+
+    return op - dst;
+}
+
+#endif // HAL_LOGGER_FILE_COMPRESSION_ENABLED
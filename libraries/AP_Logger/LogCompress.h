@@ -0,0 +1,52 @@
+/*
+  LZ4 block format compressor used for optional log file compression.
+  Compression only - decompression is done by ground tools, which can
+  use any standard LZ4 block decoder on the frame payloads
+ */
+#pragma once
+
+#include <stdint.h>
+#include <AP_Common/AP_Common.h>
+#include <AP_HAL/AP_HAL_Boards.h>
+
+#ifndef HAL_LOGGER_FILE_COMPRESSION_ENABLED
+#define HAL_LOGGER_FILE_COMPRESSION_ENABLED !HAL_MINIMIZE_FEATURES
+#endif
+
+#if HAL_LOGGER_FILE_COMPRESSION_ENABLED
+
+// each compressed chunk is written as a frame with this header. A
+// comp_len equal to raw_len means the payload is stored uncompressed.
+// The magic bytes at the start of a .BIN file mark it as compressed
+// for existing tools
+#define LOG_COMPRESS_MAGIC0 'L'
+#define LOG_COMPRESS_MAGIC1 'Z'
+
+struct PACKED log_compress_frame_header {
+    uint8_t magic[2];   // 'L', 'Z'
+    uint16_t raw_len;
+    uint16_t comp_len;
+};
+
+class LogCompressor {
+public:
+    // allocate the match table. Returns false on allocation failure
+    bool init(void);
+
+    // worst case compressed size for len input bytes
+    static uint32_t max_compressed_size(uint32_t len) {
+        return len + len/255 + 16;
+    }
+
+    // compress len bytes from src into dst. Returns the compressed
+    // size, or 0 if the output does not fit in dst_size or the input
+    // is too small or too large to compress. len must be at most 64k
+    uint32_t compress(const uint8_t *src, uint32_t len, uint8_t *dst, uint32_t dst_size);
+
+private:
+    // match positions indexed by hash of the next 4 input bytes,
+    // stored +1 so zero means empty
+    uint16_t *table = nullptr;
+};
+
+#endif // HAL_LOGGER_FILE_COMPRESSION_ENABLED
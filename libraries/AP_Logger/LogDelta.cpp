@@ -0,0 +1,116 @@
+/*
+  delta encoder for high rate log streams. See LogDelta.h for the
+  record layout
+ */
+#include "LogDelta.h"
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+
+#include <stdlib.h>
+#include <string.h>
+
+bool LogDeltaEncoder::init(uint8_t max_msg_len)
+{
+    if (streams != nullptr) {
+        return true;
+    }
+    _max_msg_len = max_msg_len;
+    streams = (Stream *)calloc(LOG_DELTA_NUM_STREAMS, sizeof(Stream));
+    if (streams == nullptr) {
+        return false;
+    }
+    for (uint8_t i = 0; i < LOG_DELTA_NUM_STREAMS; i++) {
+        streams[i].prev = (uint8_t *)calloc(1, max_msg_len);
+        if (streams[i].prev == nullptr) {
+            for (uint8_t j = 0; j < i; j++) {
+                free(streams[j].prev);
+            }
+            free(streams);
+            streams = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+void LogDeltaEncoder::reset(void)
+{
+    if (streams == nullptr) {
+        return;
+    }
+    for (uint8_t i = 0; i < LOG_DELTA_NUM_STREAMS; i++) {
+        streams[i].used = false;
+    }
+}
+
+/*
+  find or allocate the stream slot for a message type. Slots go to
+  the first types seen, which on a running system are the high rate
+  streams. Returns nullptr if the type cannot be delta encoded
+ */
+LogDeltaEncoder::Stream *LogDeltaEncoder::find_stream(uint8_t msgid, uint8_t len)
+{
+    if (streams == nullptr || len > _max_msg_len || len <= 4) {
+        return nullptr;
+    }
+    Stream *free_slot = nullptr;
+    for (uint8_t i = 0; i < LOG_DELTA_NUM_STREAMS; i++) {
+        Stream &s = streams[i];
+        if (s.used && s.msgid == msgid) {
+            return (s.len == len) ? &s : nullptr;
+        }
+        if (!s.used && free_slot == nullptr) {
+            free_slot = &s;
+        }
+    }
+    if (free_slot != nullptr) {
+        free_slot->used = true;
+        free_slot->msgid = msgid;
+        free_slot->len = len;
+        free_slot->count = 0;
+        return free_slot;
+    }
+    return nullptr;
+}
+
+uint32_t LogDeltaEncoder::encode_record(const uint8_t *rec, uint8_t len, uint8_t *dst)
+{
+    Stream *s = find_stream(rec[2], len);
+    if (s == nullptr) {
+        // no stream slot for this type; pass the record through
+        memcpy(dst, rec, len);
+        return len;
+    }
+    const uint8_t plen = len - 3;
+    if (s->count > 0 && s->count < LOG_DELTA_KEYFRAME_INTERVAL) {
+        // try a delta record against the previous contents
+        const uint8_t mask_len = (plen + 7) / 8;
+        uint8_t *mask = &dst[4];
+        uint8_t *changed = &dst[4 + mask_len];
+        uint32_t nchanged = 0;
+        memset(mask, 0, mask_len);
+        for (uint8_t i = 0; i < plen; i++) {
+            if (rec[3 + i] != s->prev[3 + i]) {
+                mask[i / 8] |= 1U << (i % 8);
+                changed[nchanged++] = rec[3 + i];
+            }
+        }
+        const uint32_t total = 4 + mask_len + nchanged;
+        if (total < len) {
+            dst[0] = rec[0];
+            dst[1] = LOG_DELTA_HEAD_BYTE2;
+            dst[2] = rec[2];
+            dst[3] = nchanged;
+            memcpy(s->prev, rec, len);
+            s->count++;
+            return total;
+        }
+    }
+    // emit a keyframe and restart the delta chain
+    memcpy(dst, rec, len);
+    memcpy(s->prev, rec, len);
+    s->count = 1;
+    return len;
+}
+
+#endif // HAL_LOGGER_FILE_DELTA_ENABLED
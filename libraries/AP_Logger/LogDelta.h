@@ -0,0 +1,61 @@
+/*
+  delta encoder for high rate log streams. Records of the same message
+  type repeat with near-identical fields, so between keyframes only
+  the bytes that changed since the previous record are written, marked
+  with a per-byte change mask. Decoding is done by ground tools
+ */
+#pragma once
+
+#include <stdint.h>
+#include <AP_HAL/AP_HAL_Boards.h>
+
+#ifndef HAL_LOGGER_FILE_DELTA_ENABLED
+#define HAL_LOGGER_FILE_DELTA_ENABLED !HAL_MINIMIZE_FEATURES
+#endif
+
+#if HAL_LOGGER_FILE_DELTA_ENABLED
+
+// second header byte marking a delta record; pairs with HEAD_BYTE1.
+// Layout: 0xA3, 0x96, msgid, nchanged, change mask, changed bytes
+#define LOG_DELTA_HEAD_BYTE2 0x96
+
+// a keyframe (full record) is emitted at least this often per stream
+// so tools can start decoding anywhere in a log
+#define LOG_DELTA_KEYFRAME_INTERVAL 32
+
+// number of concurrently delta-encoded message types; assigned to the
+// first types seen, which are the high rate streams
+#define LOG_DELTA_NUM_STREAMS 16
+
+// worst case growth of a record from delta encoding, used to size
+// output buffers: 4 byte delta header plus the change mask
+#define LOG_DELTA_MAX_OVERHEAD (4 + (255 + 7)/8)
+
+class LogDeltaEncoder {
+public:
+    // allocate per-stream state. Returns false on allocation failure
+    bool init(uint8_t max_msg_len);
+
+    // reset all streams, forcing keyframes. Call on log rotation
+    void reset(void);
+
+    // encode one record of len bytes (including the 3 byte header)
+    // into dst, which must have room for len + LOG_DELTA_MAX_OVERHEAD
+    // bytes. Returns the number of bytes written
+    uint32_t encode_record(const uint8_t *rec, uint8_t len, uint8_t *dst);
+
+private:
+    struct Stream {
+        uint8_t msgid;
+        uint8_t len;
+        uint8_t count;      // records since the last keyframe
+        bool used;
+        uint8_t *prev;      // previous record contents
+    };
+    Stream *streams = nullptr;
+    uint8_t _max_msg_len;
+
+    Stream *find_stream(uint8_t msgid, uint8_t len);
+};
+
+#endif // HAL_LOGGER_FILE_DELTA_ENABLED
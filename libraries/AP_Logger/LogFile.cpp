@@ -4,6 +4,7 @@
 #include <AP_Baro/AP_Baro.h>
 #include <AP_Compass/AP_Compass.h>
 #include <AP_HAL/AP_HAL.h>
+#include <AP_HAL/Device.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_Param/AP_Param.h>
 #include <AP_RSSI/AP_RSSI.h>
@@ -443,6 +444,55 @@ void AP_Logger::Write_Power(void)
 #endif
 }
 
+/*
+  write a raw bus transaction recorded by the AP_HAL::Device capture
+  hook. This runs in the bus threads, so it must not block beyond the
+  logger's own buffer semaphore
+ */
+void AP_Logger::Write_BusTransfer(const AP_HAL::Device &dev,
+                                  const uint8_t *send, uint32_t send_len,
+                                  const uint8_t *recv, uint32_t recv_len)
+{
+    if ((_params.bus_record.get() & (1U << uint8_t(dev.bus_type()))) == 0) {
+        return;
+    }
+    // sequence numbers tie the chunks of one transaction together. A
+    // rare race between bus threads only shares a sequence number,
+    // which the differing bus ids disambiguate
+    static uint16_t transaction_seq;
+    const uint16_t seq = transaction_seq++;
+    const uint64_t now = AP_HAL::micros64();
+
+    // raw bytes, send first then receive
+    const uint32_t slen = MIN(send_len, 255U);
+    const uint32_t rlen = MIN(recv_len, 255U);
+    const uint32_t total = slen + rlen;
+    uint32_t ofs = 0;
+    uint8_t chunk = 0;
+    while (ofs < total) {
+        struct log_BUSR pkt{
+            LOG_PACKET_HEADER_INIT(LOG_BUSR_MSG),
+            time_us  : now,
+            bus_id   : dev.get_bus_id(),
+            seq      : seq,
+            chunk    : chunk++,
+            send_len : uint8_t(slen),
+            recv_len : uint8_t(rlen),
+            data_len : 0,
+            data     : {}
+        };
+        uint8_t *bytes = (uint8_t *)&pkt.data[0];
+        const uint32_t n = MIN(total - ofs, sizeof(pkt.data));
+        for (uint32_t i=0; i<n; i++) {
+            const uint32_t src = ofs + i;
+            bytes[i] = src < slen ? send[src] : recv[src - slen];
+        }
+        pkt.data_len = n;
+        WriteBlock(&pkt, sizeof(pkt));
+        ofs += n;
+    }
+}
+
 void AP_Logger::Write_Radio(const mavlink_radio_t &packet)
 {
     const struct log_Radio pkt{
@@ -621,10 +671,18 @@ void AP_Logger::Write_ESCStatus(uint64_t time_us, uint8_t id, uint32_t error_cou
 
 // Write a Yaw PID packet
 void AP_Logger::Write_PID(uint8_t msg_type, const PID_Info &info)
+{
+    Write_PID(msg_type, info, AP_HAL::micros64());
+}
+
+// Write a PID packet with a caller-supplied timestamp, used when
+// replaying buffered samples (e.g. burst captures) so each record
+// keeps the time it was sampled rather than the time it was flushed
+void AP_Logger::Write_PID(uint8_t msg_type, const PID_Info &info, uint64_t time_us)
 {
     const struct log_PID pkt{
         LOG_PACKET_HEADER_INIT(msg_type),
-        time_us         : AP_HAL::micros64(),
+        time_us         : time_us,
         target          : info.target,
         actual          : info.actual,
         error           : info.error,
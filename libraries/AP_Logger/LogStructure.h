@@ -282,6 +282,34 @@ struct PACKED log_ISBD {
 };
 static_assert(sizeof(log_ISBD) < 256, "log_ISBD is over-size");
 
+// raw bus transaction capture for offline driver debugging, enabled
+// with LOG_BUS_RECORD. Transfers longer than one data block are split
+// into consecutive chunks sharing the same sequence number
+struct PACKED log_BUSR {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint32_t bus_id;   // 24 bit AP_HAL::Device bus identifier
+    uint16_t seq;      // transaction sequence number
+    uint8_t chunk;     // chunk index within the transaction
+    uint8_t send_len;  // total bytes sent in the transaction
+    uint8_t recv_len;  // total bytes received in the transaction
+    uint8_t data_len;  // valid bytes in data for this chunk
+    int16_t data[32];  // raw bytes, two per element, sent then received
+};
+static_assert(sizeof(log_BUSR) < 256, "log_BUSR is over-size");
+
+// raw CAN frame capture for bus fault forensics, enabled with
+// CAN_FRMLOG. TimeUS is the hardware FIFO timestamp from the rx
+// interrupt, not the time the frame was logged
+struct PACKED log_CANF {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    uint8_t bus;
+    uint32_t id;       // CAN ID with EFF/RTR/ERR flags
+    uint8_t dlc;
+    uint64_t data;     // frame payload, little-endian
+};
+
 struct PACKED log_Vibe {
     LOG_PACKET_HEADER;
     uint64_t time_us;
@@ -1818,6 +1846,10 @@ struct PACKED log_PSC {
       "ISBH",ISBH_FMT,ISBH_LABELS,ISBH_UNITS,ISBH_MULTS },  \
     { LOG_ISBD_MSG, sizeof(log_ISBD), \
       "ISBD",ISBD_FMT,ISBD_LABELS, ISBD_UNITS, ISBD_MULTS }, \
+    { LOG_BUSR_MSG, sizeof(log_BUSR), \
+      "BUSR", "QIHBBBBa", "TimeUS,Id,Seq,Chk,SL,RL,DL,Data", "s-------", "F-------" }, \
+    { LOG_CANF_MSG, sizeof(log_CANF), \
+      "CANF", "QBIBQ", "TimeUS,Bus,Id,DLC,Data", "s#---", "F----" }, \
 LOG_STRUCTURE_FROM_DAL \
 LOG_STRUCTURE_FROM_NAVEKF2 \
 LOG_STRUCTURE_FROM_NAVEKF3 \
@@ -1976,6 +2008,8 @@ enum LogMessages : uint8_t {
     LOG_SIMPLE_AVOID_MSG,
     LOG_WINCH_MSG,
     LOG_PSC_MSG,
+    LOG_BUSR_MSG,
+    LOG_CANF_MSG,
 
     _LOG_LAST_MSG_
 };
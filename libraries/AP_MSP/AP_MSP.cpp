@@ -186,6 +186,8 @@ void AP_MSP::loop(void)
 
         for (uint8_t i=0; i< _msp_status.backend_count; i++) {
             if (_backends[i] != nullptr) {
+                // refill the shared telemetry snapshot on first use
+                _backends[i]->invalidate_telemetry_snapshot();
                 // dynamically hide/unhide
                 _backends[i]->hide_osd_items();
                 // process incoming MSP frames (and reply if needed)
@@ -250,6 +250,33 @@ void AP_MSP_Telem_Backend::update_airspeed(airspeed_state_t &airspeed_state)
     }
 }
 
+/*
+    Refresh the shared telemetry snapshot at most once per loop iteration.
+    The scheduled MSP messages and the OSD item logic all read from this
+    snapshot so each singleton semaphore is taken once per loop instead of
+    once per message. The snapshot is invalidated by the backend loop, see
+    AP_MSP::loop()
+*/
+const AP_MSP_Telem_Backend::telemetry_info_t &AP_MSP_Telem_Backend::telemetry_snapshot(void)
+{
+    if (_telemetry.stale) {
+        update_battery_state(_telemetry.battery);
+        update_gps_state(_telemetry.gps);
+        {
+            // hold the AHRS semaphore across the AHRS consumers, the
+            // nested takes are recursive and effectively free
+            AP_AHRS &ahrs = AP::ahrs();
+            WITH_SEMAPHORE(ahrs.get_semaphore());
+            update_airspeed(_telemetry.airspeed);
+            update_home_pos(_telemetry.home);
+        }
+        // outside of the AHRS semaphore as it may fall back to the baro
+        _telemetry.vspeed_ms = get_vspeed_ms();
+        _telemetry.stale = false;
+    }
+    return _telemetry;
+}
+
 /*
     MSP OSDs can display up to MSP_TXT_VISIBLE_CHARS chars (UTF8 characters are supported)
     We display the flight mode string either with or without wind state
@@ -565,8 +592,8 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_raw_gps(sbuf_t *dst)
         return MSP_RESULT_ERROR;
     }
 #endif
-    gps_state_t gps_state;
-    update_gps_state(gps_state);
+    const telemetry_info_t &telemetry = telemetry_snapshot();
+    gps_state_t gps_state = telemetry.gps;
 
     // handle airspeed override
     bool airspeed_en = false;
@@ -574,9 +601,7 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_raw_gps(sbuf_t *dst)
     airspeed_en = osd->screen[0].aspeed.enabled;
 #endif
     if (airspeed_en) {
-        airspeed_state_t airspeed_state;
-        update_airspeed(airspeed_state);
-        gps_state.speed_cms = airspeed_state.airspeed_estimate_ms * 100;           // airspeed in cm/s
+        gps_state.speed_cms = telemetry.airspeed.airspeed_estimate_ms * 100;       // airspeed in cm/s
     }
 
     sbuf_write_data(dst, &gps_state, sizeof(gps_state));
@@ -585,8 +610,7 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_raw_gps(sbuf_t *dst)
 
 MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_comp_gps(sbuf_t *dst)
 {
-    home_state_t home_state;
-    update_home_pos(home_state);
+    const home_state_t &home_state = telemetry_snapshot().home;
 
     // no need to apply yaw compensation, the DJI air unit will do it for us :-)
     int32_t home_angle_deg = home_state.home_bearing_cd * 0.01;
@@ -816,11 +840,10 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_attitude(sbuf_t *dst)
 
 MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_altitude(sbuf_t *dst)
 {
-    home_state_t home_state;
-    update_home_pos(home_state);
+    const telemetry_info_t &telemetry = telemetry_snapshot();
 
-    sbuf_write_u32(dst, home_state.rel_altitude_cm);                // relative altitude cm
-    sbuf_write_u16(dst, (int16_t)get_vspeed_ms() * 100);            // climb rate cm/s
+    sbuf_write_u32(dst, telemetry.home.rel_altitude_cm);            // relative altitude cm
+    sbuf_write_u16(dst, (int16_t)telemetry.vspeed_ms * 100);        // climb rate cm/s
     return MSP_RESULT_ACK;
 }
 
@@ -830,8 +853,7 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_analog(sbuf_t *dst)
     if (rssi == nullptr) {
         return MSP_RESULT_ERROR;
     }
-    battery_state_t battery_state;
-    update_battery_state(battery_state);
+    const battery_state_t &battery_state = telemetry_snapshot().battery;
 
     struct PACKED {
         uint8_t voltage_dv;
@@ -857,8 +879,7 @@ MSPCommandResult AP_MSP_Telem_Backend::msp_process_out_battery_state(sbuf_t *dst
     if (msp == nullptr) {
         return MSP_RESULT_ERROR;
     }
-    battery_state_t battery_state;
-    update_battery_state(battery_state);
+    const battery_state_t &battery_state = telemetry_snapshot().battery;
 
     struct PACKED {
         uint8_t cellcount;
@@ -1012,16 +1033,13 @@ void AP_MSP_Telem_Backend::hide_osd_items(void)
     BIT_CLEAR(osd_hidden_items_bitmask, OSD_RTC_DATETIME);
 
     if (msp->_msp_status.flashing_on) {
+        const telemetry_info_t &telemetry = telemetry_snapshot();
         // flash satcount when no 3D Fix
-        gps_state_t gps_state;
-        update_gps_state(gps_state);
-        if (gps_state.fix_type == 0) {
+        if (telemetry.gps.fix_type == 0) {
             BIT_SET(osd_hidden_items_bitmask, OSD_GPS_SATS);
         }
         // flash home dir and distance if home is not set
-        home_state_t home_state;
-        update_home_pos(home_state);
-        if (!home_state.home_is_set) {
+        if (!telemetry.home.home_is_set) {
             BIT_SET(osd_hidden_items_bitmask, OSD_HOME_DIR);
             BIT_SET(osd_hidden_items_bitmask, OSD_HOME_DIST);
         }
@@ -1031,9 +1049,7 @@ void AP_MSP_Telem_Backend::hide_osd_items(void)
         airspeed_en = osd->screen[0].aspeed.enabled;
 #endif
         if (airspeed_en) {
-            airspeed_state_t airspeed_state;
-            update_airspeed(airspeed_state);
-            if (!airspeed_state.airspeed_have_estimate) {
+            if (!telemetry.airspeed.airspeed_have_estimate) {
                 BIT_SET(osd_hidden_items_bitmask, OSD_GPS_SPEED);
             }
         }
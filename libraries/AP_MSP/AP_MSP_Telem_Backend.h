@@ -67,6 +67,18 @@ public:
         int32_t rel_altitude_cm;
     } home_state_t;
 
+    // per-loop snapshot of the state structs above, shared by the
+    // scheduled MSP messages and the OSD item logic so the singleton
+    // semaphores are taken once per loop instead of once per message
+    typedef struct telemetry_info_s {
+        battery_state_t battery;
+        gps_state_t gps;
+        airspeed_state_t airspeed;
+        home_state_t home;
+        float vspeed_ms;
+        bool stale = true;
+    } telemetry_info_t;
+
     // init - perform required initialisation
     virtual bool init() override;
     virtual bool init_uart();
@@ -77,6 +89,9 @@ public:
     void process_incoming_data();     // incoming data
     void process_outgoing_data();     // push outgoing data
 
+    // invalidate the shared telemetry snapshot, called once per loop
+    void invalidate_telemetry_snapshot() { _telemetry.stale = true; }
+
 protected:
     enum msp_packet_type : uint8_t {
         EMPTY_SLOT = 0,
@@ -143,7 +158,11 @@ protected:
         return true;
     }
 
+    // shared telemetry snapshot, lazily refreshed by telemetry_snapshot()
+    telemetry_info_t _telemetry;
+
     // telemetry helpers
+    const telemetry_info_t &telemetry_snapshot(void);
     uint8_t calc_cell_count(float battery_voltage);
     float get_vspeed_ms(void);
     void update_home_pos(home_state_t &home_state);
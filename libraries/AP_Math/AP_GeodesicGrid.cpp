@@ -184,12 +184,38 @@ const Matrix3f AP_GeodesicGrid::_mid_inverses[10]{
      { 0.618034f,  0.000000f, -1.000000f}},
 };
 
+int AP_GeodesicGrid::_last_triangle = -1;
+
 int AP_GeodesicGrid::section(const Vector3f &v, bool inclusive)
 {
-    int i = _triangle_index(v, inclusive);
+    int i = _last_triangle;
+
+    if (i >= 0) {
+        /* Queries arrive in spatially coherent bursts (eg. successive
+         * compass calibration samples), so first test the icosahedron
+         * triangle that matched last time. The fast path is only taken
+         * when v is strictly interior to that triangle, so boundary
+         * semantics of inclusive and exclusive lookups are unchanged. */
+        auto w = _inverses[i % 10] * v;
+        if (i > 9) {
+            w = -w;
+        }
+        if (!is_zero(w.x) && w.x > 0 &&
+            !is_zero(w.y) && w.y > 0 &&
+            !is_zero(w.z) && w.z > 0) {
+            int j = _subtriangle_index(i, v, inclusive);
+            if (j < 0) {
+                return -1;
+            }
+            return 4 * i + j;
+        }
+    }
+
+    i = _triangle_index(v, inclusive);
     if (i < 0) {
         return -1;
     }
+    _last_triangle = i;
 
     int j = _subtriangle_index(i, v, inclusive);
     if (j < 0) {
@@ -295,4 +295,11 @@ private:
     static int _subtriangle_index(const unsigned int triangle_index,
                                   const Vector3f &v,
                                   bool inclusive);
+
+    /**
+     * The icosahedron's triangle index returned by the last successful
+     * #section() call, or -1. Used as a first guess for the next query,
+     * which usually hits as successive queries are spatially coherent.
+     */
+    static int _last_triangle;
 };
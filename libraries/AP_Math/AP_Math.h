@@ -10,6 +10,7 @@
 
 #include "definitions.h"
 #include "crc.h"
+#include "fast_approx.h"
 #include "matrix3.h"
 #include "polygon.h"
 #include "quaternion.h"
@@ -90,6 +91,11 @@ void mat_mul(const T *A, const T *B, T *C, uint16_t n);
 template <typename T>
 bool mat_inverse(const T *x, T *y, uint16_t dim) WARN_IF_UNUSED;
 
+// matrix inverse with the dimension fixed at compile time, using
+// stack scratch space instead of heap allocation
+template <typename T, uint16_t N>
+bool mat_inverse(const T x[], T y[]) WARN_IF_UNUSED;
+
 // matrix identity
 template <typename T>
 void mat_identity(T *x, uint16_t dim);
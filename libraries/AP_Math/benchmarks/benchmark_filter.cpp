@@ -0,0 +1,33 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+#include <Filter/LowPassFilter2p.h>
+
+static void BM_LowPassFilter2pFloat(benchmark::State& state)
+{
+    LowPassFilter2pFloat filter(1000.0f, 98.0f);
+    uint32_t i = 0;
+
+    while (state.KeepRunning()) {
+        float out = filter.apply((i++ & 0xFF) * 0.01f);
+        gbenchmark_escape(&out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pFloat);
+
+static void BM_LowPassFilter2pVector3f(benchmark::State& state)
+{
+    LowPassFilter2pVector3f filter(1000.0f, 98.0f);
+    uint32_t i = 0;
+
+    while (state.KeepRunning()) {
+        const float v = (i++ & 0xFF) * 0.01f;
+        Vector3f out = filter.apply(Vector3f(v, -v, 2 * v));
+        gbenchmark_escape(&out);
+    }
+}
+
+BENCHMARK(BM_LowPassFilter2pVector3f);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,41 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+
+// hexagonal boundary, closed (first point equals the last) as expected
+// by Polygon_outside
+static const Vector2f boundary[] = {
+    {-100.0f,  -50.0f},
+    { -50.0f,  100.0f},
+    {  50.0f,  100.0f},
+    { 100.0f,  -50.0f},
+    {  50.0f, -100.0f},
+    { -50.0f, -100.0f},
+    {-100.0f,  -50.0f},
+};
+
+static void BM_PolygonOutsideInside(benchmark::State& state)
+{
+    const Vector2f point(1.0f, 2.0f);
+
+    while (state.KeepRunning()) {
+        bool outside = Polygon_outside(point, boundary, ARRAY_SIZE(boundary));
+        gbenchmark_escape(&outside);
+    }
+}
+
+BENCHMARK(BM_PolygonOutsideInside);
+
+static void BM_PolygonOutsideOutside(benchmark::State& state)
+{
+    const Vector2f point(500.0f, 2.0f);
+
+    while (state.KeepRunning()) {
+        bool outside = Polygon_outside(point, boundary, ARRAY_SIZE(boundary));
+        gbenchmark_escape(&outside);
+    }
+}
+
+BENCHMARK(BM_PolygonOutsideOutside);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,30 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+
+static void BM_QuaternionRotationMatrix(benchmark::State& state)
+{
+    Quaternion q;
+    q.from_euler(radians(10.0f), radians(20.0f), radians(30.0f));
+
+    while (state.KeepRunning()) {
+        Matrix3f m;
+        q.rotation_matrix(m);
+        gbenchmark_escape(&m);
+    }
+}
+
+BENCHMARK(BM_QuaternionRotationMatrix);
+
+static void BM_QuaternionFromEuler(benchmark::State& state)
+{
+    while (state.KeepRunning()) {
+        Quaternion q;
+        q.from_euler(radians(10.0f), radians(20.0f), radians(30.0f));
+        gbenchmark_escape(&q);
+    }
+}
+
+BENCHMARK(BM_QuaternionFromEuler);
+
+BENCHMARK_MAIN();
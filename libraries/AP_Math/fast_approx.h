@@ -0,0 +1,163 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+  bounded-error polynomial approximations for transcendental functions
+  that show up in loop-rate code. On boards with a software-float or
+  slow libm (notably F4) these cost a fraction of the library call.
+
+  The *_approx kernels are always available and each documents its
+  worst-case error. The fast_* wrappers select the kernel when the
+  board defines AP_FAST_MATH_ENABLED to 1 (hwdef.dat or --extra-hwdef)
+  and fall back to libm otherwise, so call sites opt in once without
+  per-site ifdefs
+ */
+#pragma once
+
+#include <cmath>
+#include <stdint.h>
+
+#ifndef AP_FAST_MATH_ENABLED
+#define AP_FAST_MATH_ENABLED 0
+#endif
+
+/*
+  four-quadrant arctangent. Octant reduction plus an odd degree-9
+  minimax polynomial on [-1,1]. Worst case error 2e-5 radians
+ */
+inline float atan2f_approx(float y, float x)
+{
+    const float ax = fabsf(x);
+    const float ay = fabsf(y);
+    if (!(ax > 0.0f) && !(ay > 0.0f)) {
+        return 0.0f;
+    }
+    const float z = (ax >= ay) ? (ay / ax) : (ax / ay);
+    const float z2 = z * z;
+    float a = z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f + z2 * (-0.0851330f + z2 * 0.0208351f))));
+    if (ay > ax) {
+        a = 1.5707963f - a;
+    }
+    if (x < 0.0f) {
+        a = 3.1415927f - a;
+    }
+    return (y < 0.0f) ? -a : a;
+}
+
+/*
+  arccosine for x in [-1,1], input clamped. Abramowitz & Stegun
+  4.4.45 cubic with sqrtf endpoint factor. Worst case error 7e-5
+  radians
+ */
+inline float acosf_approx(float v)
+{
+    const float x = (v > 1.0f) ? 1.0f : ((v < -1.0f) ? -1.0f : v);
+    const float ax = fabsf(x);
+    const float r = sqrtf(1.0f - ax) *
+        (1.5707288f + ax * (-0.2121144f + ax * (0.0742610f - ax * 0.0187293f)));
+    return (x < 0.0f) ? (3.1415927f - r) : r;
+}
+
+/*
+  arcsine for x in [-1,1], input clamped, via the acosf_approx
+  identity. Worst case error 7e-5 radians
+ */
+inline float asinf_approx(float v)
+{
+    return 1.5707963f - acosf_approx(v);
+}
+
+/*
+  2^x for x in [-126,127], input clamped. Exponent goes straight into
+  the float representation, the fraction through a degree-5 expansion
+  of exp(f*ln2) on [0,1). Worst case relative error 2e-4
+ */
+inline float exp2f_approx(float x)
+{
+    x = (x > 127.0f) ? 127.0f : ((x < -126.0f) ? -126.0f : x);
+    const float n = floorf(x);
+    const float f = x - n;
+    const float p = 1.0f + f * (0.6931472f + f * (0.2402265f + f * (0.0555041f + f * (0.0096181f + f * 0.0013334f))));
+    union { uint32_t u; float f32; } scale;
+    scale.u = uint32_t(int32_t(n) + 127) << 23;
+    return p * scale.f32;
+}
+
+/*
+  log2(x) for x > 0; returns -126 for x <= 0. Exponent comes from the
+  float representation, the mantissa through an atanh-form series
+  after reduction to [sqrt(0.5),sqrt(2)]. Worst case absolute error
+  3e-6
+ */
+inline float log2f_approx(float x)
+{
+    if (!(x > 0.0f)) {
+        return -126.0f;
+    }
+    union { float f32; uint32_t u; } v;
+    v.f32 = x;
+    int32_t e = int32_t((v.u >> 23) & 0xFF) - 127;
+    v.u = (v.u & 0x007FFFFFU) | 0x3F800000U;
+    float m = v.f32;
+    if (m > 1.4142136f) {
+        m *= 0.5f;
+        e++;
+    }
+    const float z = (m - 1.0f) / (m + 1.0f);
+    const float z2 = z * z;
+    return float(e) + 2.8853901f * z * (1.0f + z2 * (0.3333333f + z2 * 0.2f));
+}
+
+// e^x via exp2f_approx. Worst case relative error 2e-4
+inline float expf_approx(float x)
+{
+    return exp2f_approx(x * 1.4426950f);
+}
+
+// natural log via log2f_approx. Worst case absolute error 2e-6
+inline float logf_approx(float x)
+{
+    return log2f_approx(x) * 0.6931472f;
+}
+
+/*
+  x^y for x > 0; returns 0 for x <= 0. Worst case relative error
+  2.5e-4 for |y| <= 10
+ */
+inline float powf_approx(float x, float y)
+{
+    if (!(x > 0.0f)) {
+        return 0.0f;
+    }
+    return exp2f_approx(y * log2f_approx(x));
+}
+
+/*
+  board-option selectors used at adopted hot call sites
+ */
+#if AP_FAST_MATH_ENABLED
+inline float fast_atan2f(float y, float x) { return atan2f_approx(y, x); }
+inline float fast_acosf(float x) { return acosf_approx(x); }
+inline float fast_asinf(float x) { return asinf_approx(x); }
+inline float fast_expf(float x) { return expf_approx(x); }
+inline float fast_logf(float x) { return logf_approx(x); }
+inline float fast_powf(float x, float y) { return powf_approx(x, y); }
+#else
+inline float fast_atan2f(float y, float x) { return atan2f(y, x); }
+inline float fast_acosf(float x) { return acosf(x); }
+inline float fast_asinf(float x) { return asinf(x); }
+inline float fast_expf(float x) { return expf(x); }
+inline float fast_logf(float x) { return logf(x); }
+inline float fast_powf(float x, float y) { return powf(x, y); }
+#endif
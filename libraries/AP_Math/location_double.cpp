@@ -25,6 +25,28 @@
 #include <stdlib.h>
 #include "AP_Math.h"
 #include "location.h"
+#include <AP_Common/Location.h>
+
+/*
+  double precision origin-relative conversions.  The single precision
+  versions in AP_Common/Location.cpp lose accuracy once the offset
+  from the origin grows to tens of kilometres; the EKF uses these for
+  converting GPS measurements to and from the NED frame so position
+  consistency is kept at centimetre level on long missions
+ */
+Vector2f Location::get_distance_NE_double(const Location &loc2) const
+{
+    const double scale = MAX(cos(lat * double(1.0e-7 * DEG_TO_RAD)), 0.01);
+    return Vector2f((loc2.lat - lat) * double(LOCATION_SCALING_FACTOR),
+                    (loc2.lng - lng) * double(LOCATION_SCALING_FACTOR) * scale);
+}
+
+void Location::offset_double(double ofs_north, double ofs_east)
+{
+    const double scale = MAX(cos(lat * double(1.0e-7 * DEG_TO_RAD)), 0.01);
+    lat += int32_t(ofs_north * double(LOCATION_SCALING_FACTOR_INV));
+    lng += int32_t(ofs_east * double(LOCATION_SCALING_FACTOR_INV) / scale);
+}
 
 /*
   these are not currently used. They should be moved to location_double.cpp if we do enable them in the future
@@ -20,6 +20,11 @@
 
 #include "AP_Math.h"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define AP_MATH_MATRIX3_NEON 1
+#endif
+
 // create a rotation matrix given some euler angles
 // this is based on http://gentlenav.googlecode.com/files/EulerAngles.pdf
 template <typename T>
@@ -162,6 +167,15 @@ Vector3<T> Matrix3<T>::mul_transpose(const Vector3<T> &v) const
                       a.z * v.x + b.z * v.y + c.z * v.z);
 }
 
+// multiplication of transpose by a vector, accumulating into out
+template <typename T>
+void Matrix3<T>::mul_transpose_accumulate(const Vector3<T> &v, Vector3<T> &out) const
+{
+    out.x += a.x * v.x + b.x * v.y + c.x * v.z;
+    out.y += a.y * v.x + b.y * v.y + c.y * v.z;
+    out.z += a.z * v.x + b.z * v.y + c.z * v.z;
+}
+
 // multiplication by another Matrix3<T>
 template <typename T>
 Matrix3<T> Matrix3<T>::operator *(const Matrix3<T> &m) const
@@ -178,6 +192,88 @@ Matrix3<T> Matrix3<T>::operator *(const Matrix3<T> &m) const
     return temp;
 }
 
+#if AP_MATH_MATRIX3_NEON
+/*
+  NEON specialisations of the float rotation kernels, used by the EKF
+  and attitude controllers on boards with a NEON unit (Linux boards
+  and SITL on ARM; the Cortex-M targets only have scalar VFP and use
+  the generic code above)
+
+  the rows are unpadded Vector3f, so the 9 floats of the matrix are
+  contiguous. Rows a and b can be loaded 4-wide staying inside the
+  object; row c is loaded from b.z and rotated to avoid reading past
+  the end
+ */
+static inline float32x4_t matrix3f_row_c(const float *base)
+{
+    const float32x4_t t = vld1q_f32(base + 5);  // b.z c.x c.y c.z
+    return vextq_f32(t, t, 1);                  // c.x c.y c.z b.z
+}
+
+template <>
+Vector3<float> Matrix3<float>::operator *(const Vector3<float> &v) const
+{
+    const float vbuf[4] { v.x, v.y, v.z, 0 };
+    const float32x4_t vv = vld1q_f32(vbuf);
+    // the 4th lane of each row product is multiplied by zero
+    const float32x4_t pa = vmulq_f32(vld1q_f32(&a.x), vv);
+    const float32x4_t pb = vmulq_f32(vld1q_f32(&b.x), vv);
+    const float32x4_t pc = vmulq_f32(matrix3f_row_c(&a.x), vv);
+    const float32x2_t sab = vpadd_f32(vadd_f32(vget_low_f32(pa), vget_high_f32(pa)),
+                                      vadd_f32(vget_low_f32(pb), vget_high_f32(pb)));
+    const float32x2_t sc = vadd_f32(vget_low_f32(pc), vget_high_f32(pc));
+    return Vector3<float>(vget_lane_f32(sab, 0),
+                          vget_lane_f32(sab, 1),
+                          vget_lane_f32(vpadd_f32(sc, sc), 0));
+}
+
+template <>
+Vector3<float> Matrix3<float>::mul_transpose(const Vector3<float> &v) const
+{
+    // M^T * v is a weighted sum of the rows, which vectorises without
+    // any horizontal adds. The 4th lane is junk and is not stored
+    float32x4_t acc = vmulq_n_f32(vld1q_f32(&a.x), v.x);
+    acc = vmlaq_n_f32(acc, vld1q_f32(&b.x), v.y);
+    acc = vmlaq_n_f32(acc, matrix3f_row_c(&a.x), v.z);
+    float out[4];
+    vst1q_f32(out, acc);
+    return Vector3<float>(out[0], out[1], out[2]);
+}
+
+template <>
+void Matrix3<float>::mul_transpose_accumulate(const Vector3<float> &v, Vector3<float> &out) const
+{
+    float obuf[4] { out.x, out.y, out.z, 0 };
+    float32x4_t acc = vld1q_f32(obuf);
+    acc = vmlaq_n_f32(acc, vld1q_f32(&a.x), v.x);
+    acc = vmlaq_n_f32(acc, vld1q_f32(&b.x), v.y);
+    acc = vmlaq_n_f32(acc, matrix3f_row_c(&a.x), v.z);
+    vst1q_f32(obuf, acc);
+    out.x = obuf[0];
+    out.y = obuf[1];
+    out.z = obuf[2];
+}
+
+template <>
+Matrix3<float> Matrix3<float>::operator *(const Matrix3<float> &m) const
+{
+    const float32x4_t ma = vld1q_f32(&m.a.x);
+    const float32x4_t mb = vld1q_f32(&m.b.x);
+    const float32x4_t mc = matrix3f_row_c(&m.a.x);
+    const float *self = &a.x;
+    float rows[3][4];
+    for (uint8_t i=0; i<3; i++) {
+        float32x4_t acc = vmulq_n_f32(ma, self[3*i]);
+        acc = vmlaq_n_f32(acc, mb, self[3*i+1]);
+        acc = vmlaq_n_f32(acc, mc, self[3*i+2]);
+        vst1q_f32(rows[i], acc);
+    }
+    return Matrix3<float>(Vector3<float>(rows[0][0], rows[0][1], rows[0][2]),
+                          Vector3<float>(rows[1][0], rows[1][1], rows[1][2]),
+                          Vector3<float>(rows[2][0], rows[2][1], rows[2][2]));
+}
+#endif // AP_MATH_MATRIX3_NEON
+
 template <typename T>
 Matrix3<T> Matrix3<T>::transposed(void) const
 {
@@ -151,6 +151,11 @@ public:
     // multiplication of transpose by a vector
     Vector3<T>                  mul_transpose(const Vector3<T> &v) const;
 
+    // multiplication of transpose by a vector, accumulating into
+    // out. Fused form for rotation-and-sum loops, avoiding a
+    // temporary Vector3
+    void mul_transpose_accumulate(const Vector3<T> &v, Vector3<T> &out) const;
+
     // multiplication by a vector giving a Vector2 result (XY components)
     Vector2<T> mulXY(const Vector3<T> &v) const;
 
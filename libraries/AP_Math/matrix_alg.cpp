@@ -24,30 +24,6 @@
 #include <fenv.h>
 #endif
 
-/*
- *    Does matrix multiplication of two regular/square matrices
- *
- *    @param     A,           Matrix A
- *    @param     B,           Matrix B
- *    @param     n,           dimemsion of square matrices
- *    @returns                multiplied matrix i.e. A*B
- */
-template<typename T>
-static T* matrix_multiply(const T *A, const T *B, uint16_t n)
-{
-    T* ret = new T[n*n];
-    memset(ret,0.0f,n*n*sizeof(T));
-
-    for(uint16_t i = 0; i < n; i++) {
-        for(uint16_t j = 0; j < n; j++) {
-            for(uint16_t k = 0;k < n; k++) {
-                ret[i*n + j] += A[i*n + k] * B[k*n + j];
-            }
-        }
-    }
-    return ret;
-}
-
 template<typename T>
 static inline void swap(T &a, T &b)
 {
@@ -58,40 +34,30 @@ static inline void swap(T &a, T &b)
 }
 
 /*
- *    calculates pivot matrix such that all the larger elements in the row are on diagonal
+ *    calculates the pivot permutation such that all the larger elements in the row are on diagonal.
+ *    pivot[i] gives the row of A to use as row i of the pivoted matrix
  *
  *    @param     A,           input matrix matrix
  *    @param     pivot
  *    @param     n,           dimenstion of square matrix
- *    @returns                false = matrix is Singular or non positive definite, true = matrix inversion successful
  */
 template<typename T>
-static void mat_pivot(const T* A, T* pivot, uint16_t n)
+static void mat_pivot(const T* A, uint8_t* pivot, uint16_t n)
 {
     for(uint16_t i = 0;i<n;i++){
-        for(uint16_t j=0;j<n;j++) {
-            pivot[i*n+j] = static_cast<T>(i==j);
-        }
+        pivot[i] = i;
     }
 
     for(uint16_t i = 0;i < n; i++) {
         uint16_t max_j = i;
         for(uint16_t j=i;j<n;j++){
-            if (std::is_same<T, double>::value) {
-                if(fabsf(A[j*n + i]) > fabsf(A[max_j*n + i])) {
-                    max_j = j;
-                }
-            } else {
-                if(fabsf(A[j*n + i]) > fabsf(A[max_j*n + i])) {
-                    max_j = j;
-                }
+            if(fabsf(A[j*n + i]) > fabsf(A[max_j*n + i])) {
+                max_j = j;
             }
         }
 
         if(max_j != i) {
-            for(uint16_t k = 0; k < n; k++) {
-                swap(pivot[i*n + k], pivot[max_j*n + k]);
-            }
+            swap(pivot[i], pivot[max_j]);
         }
     }
 }
@@ -142,95 +108,107 @@ static void mat_back_sub(const T *U, T *out, uint16_t n)
 
 /*
  *    Decomposes square matrix into Lower and Upper triangular matrices such that
- *    A*P = L*U, where P is the pivot matrix
+ *    P*A = L*U, where P is the pivot permutation
  *    ref: http://rosettacode.org/wiki/LU_decomposition
- *    @param     U,           upper triangular matrix
- *    @param     out,         Output inverted upper triangular matrix
+ *    @param     L,           output lower triangular matrix
+ *    @param     U,           output upper triangular matrix
+ *    @param     pivot,       output pivot permutation
+ *    @param     APrime,      n*n scratch block for the pivoted copy of A
  *    @param     n,           dimension of matrix
  */
 template<typename T>
-static void mat_LU_decompose(const T* A, T* L, T* U, T *P, uint16_t n)
+static void mat_LU_decompose(const T* A, T* L, T* U, uint8_t *pivot, T *APrime, uint16_t n)
 {
     memset(L,0,n*n*sizeof(T));
     memset(U,0,n*n*sizeof(T));
-    memset(P,0,n*n*sizeof(T));
-    mat_pivot(A,P,n);
+    mat_pivot(A,pivot,n);
 
-    T *APrime = matrix_multiply(P,A,n);
+    // APrime = P*A is just a row gather
+    for(uint16_t i = 0; i < n; i++) {
+        memcpy(&APrime[i*n], &A[pivot[i]*n], n*sizeof(T));
+    }
     for(uint16_t i = 0; i < n; i++) {
         L[i*n + i] = 1;
     }
     for(uint16_t i = 0; i < n; i++) {
         for(uint16_t j = 0; j < n; j++) {
-            if(j <= i) {    
+            if(j <= i) {
                 U[j*n + i] = APrime[j*n + i];
                 for(uint16_t k = 0; k < j; k++) {
-                    U[j*n + i] -= L[j*n + k] * U[k*n + i]; 
+                    U[j*n + i] -= L[j*n + k] * U[k*n + i];
                 }
             }
             if(j >= i) {
                 L[j*n + i] = APrime[j*n + i];
                 for(uint16_t k = 0; k < i; k++) {
-                    L[j*n + i] -= L[j*n + k] * U[k*n + i]; 
+                    L[j*n + i] -= L[j*n + k] * U[k*n + i];
                 }
                 L[j*n + i] /= U[i*n + i];
             }
         }
     }
-    delete[] APrime;
 }
 
 /*
  *    matrix inverse code for any square matrix using LU decomposition
- *    inv = inv(U)*inv(L)*P, where L and U are triagular matrices and P the pivot matrix
+ *    inv = inv(U)*inv(L)*P, where L and U are triagular matrices and P the pivot permutation
  *    ref: http://www.cl.cam.ac.uk/teaching/1314/NumMethods/supporting/mcmaster-kiruba-ludecomp.pdf
- *    @param     m,           input 4x4 matrix
- *    @param     inv,      Output inverted 4x4 matrix
+ *    the caller provides three n*n scratch blocks and the pivot
+ *    vector, so no memory is allocated here
+ *    @param     A,           input matrix
+ *    @param     inv,         output inverted matrix, may alias A
  *    @param     n,           dimension of square matrix
  *    @returns                false = matrix is Singular, true = matrix inversion successful
  */
 template<typename T>
-static bool mat_inverseN(const T* A, T* inv, uint16_t n)
+static bool mat_inverse_lu(const T* A, T* inv, T* L, T* U, T* t, uint8_t *pivot, uint16_t n)
 {
-    T *L, *U, *P;
-    bool ret = true;
-    L = new T[n*n];
-    U = new T[n*n];
-    P = new T[n*n];
-    mat_LU_decompose(A,L,U,P,n);
-
-    T *L_inv = new T[n*n];
-    T *U_inv = new T[n*n];
+    mat_LU_decompose(A,L,U,pivot,t,n);
 
-    memset(L_inv,0,n*n*sizeof(T));
-    mat_forward_sub(L,L_inv,n);
+    memset(t,0,n*n*sizeof(T));
+    mat_forward_sub(L,t,n);     // t = inv(L)
 
-    memset(U_inv,0,n*n*sizeof(T));
-    mat_back_sub(U,U_inv,n);
+    memset(L,0,n*n*sizeof(T));
+    mat_back_sub(U,L,n);        // L = inv(U)
 
-    // decomposed matrices no longer required
-    delete[] L;
-    delete[] U;
+    mat_mul(L,t,U,n);           // U = inv(U)*inv(L)
 
-    T *inv_unpivoted = matrix_multiply(U_inv,L_inv,n);
-    T *inv_pivoted = matrix_multiply(inv_unpivoted, P, n);
+    // multiplying by the pivot matrix is a column scatter
+    for(uint16_t i = 0; i < n; i++) {
+        for(uint16_t j = 0; j < n; j++) {
+            inv[i*n + pivot[j]] = U[i*n + j];
+        }
+    }
 
     //check sanity of results
+    bool ret = true;
     for(uint16_t i = 0; i < n; i++) {
         for(uint16_t j = 0; j < n; j++) {
-            if(isnan(inv_pivoted[i*n+j]) || isinf(inv_pivoted[i*n+j])){
+            if(isnan(inv[i*n+j]) || isinf(inv[i*n+j])){
                 ret = false;
             }
         }
     }
-    memcpy(inv,inv_pivoted,n*n*sizeof(T));
-
-    //free memory
-    delete[] inv_pivoted;
-    delete[] inv_unpivoted;
-    delete[] P;
-    delete[] U_inv;
-    delete[] L_inv;
+    return ret;
+}
+
+/*
+ *    heap-allocating wrapper for matrix inversion when the dimension
+ *    is only known at runtime
+ */
+template<typename T>
+static bool mat_inverseN(const T* A, T* inv, uint16_t n)
+{
+    T *scratch = new T[3*n*n];
+    uint8_t *pivot = new uint8_t[n];
+    if (scratch == nullptr || pivot == nullptr) {
+        delete[] scratch;
+        delete[] pivot;
+        return false;
+    }
+    const bool ret = mat_inverse_lu(A, inv, &scratch[0], &scratch[n*n], &scratch[2*n*n], pivot, n);
+    delete[] scratch;
+    delete[] pivot;
     return ret;
 }
 
@@ -444,6 +422,29 @@ bool mat_inverse(const T x[], T y[], uint16_t dim)
     }
 }
 
+/*
+ *    matrix inverse with the dimension fixed at compile time, using
+ *    stack scratch space. Used by the calibration code to avoid heap
+ *    allocation inside fit iterations
+ *
+ *    @param     x,     input NxN matrix
+ *    @param     y,     Output inverted NxN matrix, may alias x
+ *    @returns          false = matrix is Singular, true = matrix inversion successful
+ */
+template<typename T, uint16_t N>
+bool mat_inverse(const T x[], T y[])
+{
+    if (N == 3) {
+        return inverse3x3(x,y);
+    }
+    if (N == 4) {
+        return inverse4x4(x,y);
+    }
+    T scratch[3*N*N];
+    uint8_t pivot[N];
+    return mat_inverse_lu(x, y, &scratch[0], &scratch[N*N], &scratch[2*N*N], pivot, N);
+}
+
 template <typename T>
 void mat_mul(const T *A, const T *B, T *C, uint16_t n)
 {
@@ -473,3 +474,9 @@ template void mat_identity<float>(float x[], uint16_t dim);
 template bool mat_inverse<double>(const double x[], double y[], uint16_t dim);
 template void mat_mul<double>(const double *A, const double *B, double *C, uint16_t n);
 template void mat_identity<double>(double x[], uint16_t dim);
+
+// compile-time dimensions used by the calibrators and polyfit
+template bool mat_inverse<float,4>(const float x[], float y[]);
+template bool mat_inverse<float,6>(const float x[], float y[]);
+template bool mat_inverse<float,9>(const float x[], float y[]);
+template bool mat_inverse<double,4>(const double x[], double y[]);
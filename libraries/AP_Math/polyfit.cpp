@@ -30,13 +30,8 @@ void PolyFit<order,xtype,vtype>::update(xtype x, vtype y)
 template <uint8_t order, typename xtype, typename vtype>
 bool PolyFit<order,xtype,vtype>::get_polynomial(vtype res[order]) const
 {
-    // we dynamically allocate the inverse matrix to keep stack usage low
-    xtype *inv_mat = new xtype[order*order];
-    if (inv_mat == nullptr) {
-        return false;
-    }
-    if (!mat_inverse(&mat[0][0], inv_mat, order)) {
-        delete[] inv_mat;
+    xtype inv_mat[order*order];
+    if (!mat_inverse<xtype, order>(&mat[0][0], inv_mat)) {
         return false;
     }
     // the summation must be done with double precision to get
@@ -54,7 +49,6 @@ bool PolyFit<order,xtype,vtype>::get_polynomial(vtype res[order]) const
         res[j].y = resd[j].y;
         res[j].z = resd[j].z;
     }
-    delete[] inv_mat;
     return true;
 }
 
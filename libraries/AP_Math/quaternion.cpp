@@ -534,10 +534,11 @@ void Quaternion::rotate_fast(const Vector3f &v)
     q4 = w1*z2 + x1*y2 - y1*x2 + z1*w2;
 }
 
-// get euler roll angle
+// get euler roll angle. fast_atan2f costs at most 2e-5 radians when
+// the board enables AP_FAST_MATH
 float Quaternion::get_euler_roll() const
 {
-    return (atan2f(2.0f*(q1*q2 + q3*q4), 1.0f - 2.0f*(q2*q2 + q3*q3)));
+    return (fast_atan2f(2.0f*(q1*q2 + q3*q4), 1.0f - 2.0f*(q2*q2 + q3*q3)));
 }
 
 // get euler pitch angle
@@ -546,10 +547,11 @@ float Quaternion::get_euler_pitch() const
     return safe_asin(2.0f*(q1*q3 - q4*q2));
 }
 
-// get euler yaw angle
+// get euler yaw angle. fast_atan2f costs at most 2e-5 radians when
+// the board enables AP_FAST_MATH
 float Quaternion::get_euler_yaw() const
 {
-    return atan2f(2.0f*(q1*q4 + q2*q3), 1.0f - 2.0f*(q3*q3 + q4*q4));
+    return fast_atan2f(2.0f*(q1*q4 + q2*q3), 1.0f - 2.0f*(q3*q3 + q4*q4));
 }
 
 // create eulers from a quaternion
@@ -0,0 +1,61 @@
+#include <AP_gtest.h>
+
+#include <AP_Math/AP_Math.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+/*
+  each kernel documents a worst case error in fast_approx.h; sweep the
+  useful input range and check the documented bound holds
+ */
+
+TEST(FastApproxTest, Atan2)
+{
+    for (float y = -50.0f; y < 50.0f; y += 0.37f) {
+        for (float x = -5.0f; x < 5.0f; x += 0.11f) {
+            EXPECT_NEAR(atan2f_approx(y, x), atan2f(y, x), 2.0e-5f);
+        }
+    }
+    // degenerate origin input must not produce a NaN
+    EXPECT_FLOAT_EQ(atan2f_approx(0.0f, 0.0f), 0.0f);
+}
+
+TEST(FastApproxTest, AcosAsin)
+{
+    for (float v = -1.0f; v <= 1.0f; v += 1.0e-3f) {
+        EXPECT_NEAR(acosf_approx(v), acosf(v), 7.0e-5f);
+        EXPECT_NEAR(asinf_approx(v), asinf(v), 7.0e-5f);
+    }
+    // out of range inputs clamp rather than returning NaN
+    EXPECT_NEAR(acosf_approx(1.5f), 0.0f, 7.0e-5f);
+    EXPECT_NEAR(acosf_approx(-1.5f), M_PI, 7.0e-5f);
+}
+
+TEST(FastApproxTest, Exp2Log2)
+{
+    for (float v = -10.0f; v <= 10.0f; v += 1.0e-3f) {
+        EXPECT_NEAR(exp2f_approx(v) / exp2f(v), 1.0f, 2.0e-4f);
+    }
+    for (float v = 1.0e-3f; v <= 200.0f; v += 1.0e-3f) {
+        EXPECT_NEAR(log2f_approx(v), log2f(v), 3.0e-6f);
+    }
+}
+
+TEST(FastApproxTest, ExpLogPow)
+{
+    for (float v = -10.0f; v <= 10.0f; v += 1.0e-3f) {
+        EXPECT_NEAR(expf_approx(v) / expf(v), 1.0f, 2.0e-4f);
+    }
+    for (float v = 1.0e-3f; v <= 200.0f; v += 1.0e-3f) {
+        EXPECT_NEAR(logf_approx(v), logf(v), 2.0e-6f);
+    }
+    for (float x = 0.01f; x <= 20.0f; x += 0.13f) {
+        for (float y = -5.0f; y <= 5.0f; y += 0.17f) {
+            EXPECT_NEAR(powf_approx(x, y) / powf(x, y), 1.0f, 2.5e-4f);
+        }
+    }
+    // domain guard for non-positive base
+    EXPECT_FLOAT_EQ(powf_approx(-1.0f, 2.0f), 0.0f);
+}
+
+AP_GTEST_MAIN()
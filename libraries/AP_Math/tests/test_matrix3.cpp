@@ -101,6 +101,22 @@ TEST_P(Matrix3fTest, Inverses)
     }
 }
 
+TEST(Matrix3fKernelTest, MulTransposeAccumulate)
+{
+    const Matrix3f m{
+        { 6.0f,  2.0f,  20.0f},
+        { 1.0f, -9.0f,   4.0f},
+        {-4.0f,  7.0f, -27.0f}
+    };
+    const Vector3f v{1.0f, 2.0f, 3.0f};
+    Vector3f out{0.5f, -1.0f, 2.0f};
+    const Vector3f expected = out + m.mul_transpose(v);
+    m.mul_transpose_accumulate(v, out);
+    EXPECT_FLOAT_EQ(expected.x, out.x);
+    EXPECT_FLOAT_EQ(expected.y, out.y);
+    EXPECT_FLOAT_EQ(expected.z, out.z);
+}
+
 INSTANTIATE_TEST_CASE_P(InvertibleMatrices,
                         Matrix3fTest,
                         ::testing::ValuesIn(invertible));
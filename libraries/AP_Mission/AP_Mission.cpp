@@ -59,6 +59,10 @@ void AP_Mission::init()
     }
 
     _last_change_time_ms = AP_HAL::millis();
+
+    // refresh the command prefetch cache from the IO thread so the
+    // main thread does not block on storage reads when the mission advances
+    hal.scheduler->register_io_process(FUNCTOR_BIND_MEMBER(&AP_Mission::prefetch_update, void));
 }
 
 /// start - resets current commands to point to the beginning of the mission
@@ -96,8 +100,13 @@ void AP_Mission::resume()
     if (_flags.state == MISSION_STOPPED) {
         _flags.state = MISSION_RUNNING;
 
-        // if no valid nav command index restart from beginning
+        // if no valid nav command index we have no in-memory
+        // progress, i.e. this is the first resume since boot.  Try
+        // the progress snapshot before restarting from the beginning
         if (_nav_cmd.index == AP_MISSION_CMD_INDEX_NONE) {
+            if (restore_progress_snapshot()) {
+                return;
+            }
             start();
             return;
         }
@@ -282,6 +291,12 @@ void AP_Mission::update()
             _flags.do_cmd_loaded = false;
         }
     }
+
+    // persist progress each time the active nav command changes so a
+    // power cycle can resume from the current leg
+    if (_flags.nav_cmd_loaded && _nav_cmd.index != _last_snapshot_nav_index) {
+        save_progress_snapshot();
+    }
 }
 
 bool AP_Mission::verify_command(const Mission_Command& cmd)
@@ -633,6 +648,16 @@ bool AP_Mission::read_cmd_from_storage(uint16_t index, Mission_Command& cmd) con
         return false;
     }
 
+    // return the command from the prefetch cache if it covers this index
+    // and the mission has not changed since the cache was filled
+    if (_prefetch.count != 0 &&
+        _prefetch.change_time_ms == _last_change_time_ms &&
+        index >= _prefetch.start_index &&
+        index < _prefetch.start_index + _prefetch.count) {
+        cmd = _prefetch.cmd[index - _prefetch.start_index];
+        return true;
+    }
+
     // Find out proper location in memory by using the start_byte position + the index
     // we can load a command, we don't process it yet
     // read WP position
@@ -684,6 +709,48 @@ bool AP_Mission::read_cmd_from_storage(uint16_t index, Mission_Command& cmd) con
     return true;
 }
 
+/// prefetch_update - refresh the cache of commands following the active
+///     navigation command.  Runs on the IO thread so that
+///     advance_current_nav_cmd finds upcoming commands already in memory
+///     rather than reading them from storage in the flight path
+void AP_Mission::prefetch_update(void)
+{
+    WITH_SEMAPHORE(_rsem);
+
+    if (_flags.state != MISSION_RUNNING ||
+        _nav_cmd.index == AP_MISSION_CMD_INDEX_NONE) {
+        _prefetch.count = 0;
+        return;
+    }
+
+    // cache starts at the active navigation command.  command #0 (home) is
+    // never cached as it is synthesised from the AHRS home position
+    const uint16_t start_index = MAX(_nav_cmd.index, AP_MISSION_FIRST_REAL_COMMAND);
+    if (_prefetch.count != 0 &&
+        _prefetch.start_index == start_index &&
+        _prefetch.change_time_ms == _last_change_time_ms) {
+        // cache is already up to date
+        return;
+    }
+
+    // invalidate the cache while refilling so read_cmd_from_storage does
+    // not return entries from the window being replaced
+    _prefetch.count = 0;
+    _prefetch.start_index = start_index;
+    _prefetch.change_time_ms = _last_change_time_ms;
+
+    uint8_t count = 0;
+    while (count < ARRAY_SIZE(_prefetch.cmd)) {
+        const uint16_t index = start_index + count;
+        if (index >= (unsigned)_cmd_total ||
+            !read_cmd_from_storage(index, _prefetch.cmd[count])) {
+            break;
+        }
+        count++;
+    }
+    _prefetch.count = count;
+}
+
 bool AP_Mission::stored_in_location(uint16_t id)
 {
     switch (id) {
@@ -1585,6 +1652,9 @@ void AP_Mission::complete()
     _flags.state = MISSION_COMPLETE;
     _flags.in_landing_sequence = false;
 
+    // a completed mission must not be resumed after a power cycle
+    clear_progress_snapshot();
+
     // callback to main program's mission complete function
     _mission_complete_fn();
 }
@@ -1908,8 +1978,93 @@ void AP_Mission::check_eeprom_version()
  */
 uint16_t AP_Mission::num_commands_max(void) const
 {
-    // -4 to remove space for eeprom version number
-    return (_storage.size() - 4) / AP_MISSION_EEPROM_COMMAND_SIZE;
+    // -4 to remove space for eeprom version number, and the progress
+    // snapshot is reserved at the end of storage
+    return (_storage.size() - 4 - AP_MISSION_PROGRESS_SNAPSHOT_SIZE) / AP_MISSION_EEPROM_COMMAND_SIZE;
+}
+
+/*
+ * progress snapshot - layout of the reserved area at the end of
+ * mission storage.  A snapshot is only honoured if the magic matches
+ * and the mission length is unchanged
+ */
+struct PACKED mission_progress_snapshot {
+    uint8_t magic;
+    uint8_t pad;
+    uint16_t cmd_total;
+    uint16_t nav_index;
+    uint16_t do_index;
+    struct PACKED {
+        uint16_t index;
+        int16_t num_times_run;
+    } jump[AP_MISSION_MAX_NUM_DO_JUMP_COMMANDS];
+};
+static_assert(sizeof(mission_progress_snapshot) <= AP_MISSION_PROGRESS_SNAPSHOT_SIZE,
+              "progress snapshot must fit in its reserved storage");
+
+#define AP_MISSION_SNAPSHOT_MAGIC 0x53
+
+// save_progress_snapshot - write the current progress to storage
+void AP_Mission::save_progress_snapshot()
+{
+    mission_progress_snapshot snapshot {};
+    snapshot.magic = AP_MISSION_SNAPSHOT_MAGIC;
+    snapshot.cmd_total = _cmd_total;
+    snapshot.nav_index = _nav_cmd.index;
+    snapshot.do_index = _flags.do_cmd_loaded ? _do_cmd.index : AP_MISSION_CMD_INDEX_NONE;
+    for (uint8_t i=0; i<AP_MISSION_MAX_NUM_DO_JUMP_COMMANDS; i++) {
+        snapshot.jump[i].index = _jump_tracking[i].index;
+        snapshot.jump[i].num_times_run = _jump_tracking[i].num_times_run;
+    }
+    _storage.write_block(_storage.size() - AP_MISSION_PROGRESS_SNAPSHOT_SIZE, &snapshot, sizeof(snapshot));
+    _last_snapshot_nav_index = _nav_cmd.index;
+}
+
+// clear_progress_snapshot - invalidate any stored progress
+void AP_Mission::clear_progress_snapshot()
+{
+    _storage.write_byte(_storage.size() - AP_MISSION_PROGRESS_SNAPSHOT_SIZE, 0);
+    _last_snapshot_nav_index = AP_MISSION_CMD_INDEX_NONE;
+}
+
+// restore_progress_snapshot - restore progress from storage.  Only
+// called when there is no in-memory progress, i.e. after a power
+// cycle.  Returns true if the mission was restored to the stored
+// command
+bool AP_Mission::restore_progress_snapshot()
+{
+    mission_progress_snapshot snapshot;
+    _storage.read_block(&snapshot, _storage.size() - AP_MISSION_PROGRESS_SNAPSHOT_SIZE, sizeof(snapshot));
+
+    if (snapshot.magic != AP_MISSION_SNAPSHOT_MAGIC) {
+        return false;
+    }
+    // reject a snapshot saved against a different mission
+    if (snapshot.cmd_total != (unsigned)_cmd_total) {
+        return false;
+    }
+    if (snapshot.nav_index == 0 || snapshot.nav_index >= (unsigned)_cmd_total) {
+        return false;
+    }
+
+    // restart from the do command if one was active, which will also
+    // load the nav command (mirroring resume())
+    uint16_t restart_index = snapshot.nav_index;
+    if (snapshot.do_index != AP_MISSION_CMD_INDEX_NONE && snapshot.do_index < (unsigned)_cmd_total) {
+        restart_index = snapshot.do_index;
+    }
+    if (!set_current_cmd(restart_index)) {
+        return false;
+    }
+
+    // restore jump counters after set_current_cmd, which resets them
+    for (uint8_t i=0; i<AP_MISSION_MAX_NUM_DO_JUMP_COMMANDS; i++) {
+        _jump_tracking[i].index = snapshot.jump[i].index;
+        _jump_tracking[i].num_times_run = snapshot.jump[i].num_times_run;
+    }
+
+    gcs().send_text(MAV_SEVERITY_INFO, "Mission: resuming at command %u", (unsigned)restart_index);
+    return true;
 }
 
 // find the nearest landing sequence starting point (DO_LAND_START) and
@@ -2271,6 +2426,12 @@ void AP_Mission::reset_wp_history(void)
 // store the latest reported position incase of mission exit and rewind resume
 void AP_Mission::update_exit_position(void)
 {
+    // the exit position is only consumed by calc_rewind_pos, which
+    // only runs when a DO_SET_RESUME_REPEAT_DIST is active; skip the
+    // AHRS position query on every other mission
+    if (_repeat_dist == 0) {
+        return;
+    }
     if (!AP::ahrs().get_position(_exit_position)) {
         _exit_position.lat = 0;
         _exit_position.lng = 0;
@@ -24,6 +24,8 @@
 #define AP_MISSION_EEPROM_VERSION           0x65AE  // version number stored in first four bytes of eeprom.  increment this by one when eeprom format is changed
 #define AP_MISSION_EEPROM_COMMAND_SIZE      15      // size in bytes of all mission commands
 
+#define AP_MISSION_PROGRESS_SNAPSHOT_SIZE   68      // bytes reserved at the end of mission storage for the progress snapshot
+
 #define AP_MISSION_MAX_NUM_DO_JUMP_COMMANDS 15      // allow up to 15 do-jump commands
 
 #define AP_MISSION_JUMP_REPEAT_FOREVER      -1      // when do-jump command's repeat count is -1 this means endless repeat
@@ -44,6 +46,8 @@
 #define AP_MISSION_MAX_WP_HISTORY           7       // The maximum number of previous wp commands that will be stored from the active missions history
 #define LAST_WP_PASSED (AP_MISSION_MAX_WP_HISTORY-2)
 
+#define AP_MISSION_PREFETCH_NUM_COMMANDS    8       // number of upcoming commands held in the prefetch cache filled by the IO thread
+
 /// @class    AP_Mission
 /// @brief    Object managing Mission
 class AP_Mission
@@ -313,6 +317,7 @@ public:
         _flags.in_landing_sequence = false;
         _flags.resuming_mission = false;
         _force_resume = false;
+        _last_snapshot_nav_index = AP_MISSION_CMD_INDEX_NONE;
     }
 
     // get singleton instance
@@ -628,6 +633,24 @@ private:
     // init_jump_tracking - initialise jump_tracking variables
     void init_jump_tracking();
 
+    /*
+     * progress snapshot - the active command indices and jump
+     * counters are persisted to a reserved area at the end of
+     * mission storage each time the active nav command changes, so
+     * that a power cycle mid-mission (e.g. a battery swap) can
+     * resume from the current leg instead of replaying the mission
+     */
+    // save_progress_snapshot - write the current progress to storage
+    void save_progress_snapshot();
+    // clear_progress_snapshot - invalidate any stored progress
+    void clear_progress_snapshot();
+    // restore_progress_snapshot - restore progress from storage.
+    // returns true if a valid snapshot for the loaded mission was
+    // found and the mission state restored from it
+    bool restore_progress_snapshot() WARN_IF_UNUSED;
+    // nav index the last snapshot was saved with
+    uint16_t _last_snapshot_nav_index;
+
     /// get_jump_times_run - returns number of times the jump command has been run
     ///     return is signed to be consistent with do-jump cmd's repeat count which can be -1 (to signify to repeat forever)
     int16_t get_jump_times_run(const Mission_Command& cmd);
@@ -680,6 +703,18 @@ private:
         int16_t num_times_run;          // number of times this jump command has been run
     } _jump_tracking[AP_MISSION_MAX_NUM_DO_JUMP_COMMANDS];
 
+    // refresh the prefetch cache of upcoming commands.  called from the IO thread
+    void prefetch_update(void);
+
+    // prefetch cache of upcoming commands, filled by the IO thread so
+    // that advancing the mission does not block on storage reads
+    struct {
+        Mission_Command cmd[AP_MISSION_PREFETCH_NUM_COMMANDS];
+        uint16_t start_index;    // index in the mission of cmd[0]
+        uint8_t count;           // number of valid entries in cmd, zero if the cache is invalid
+        uint32_t change_time_ms; // _last_change_time_ms when the cache was filled
+    } _prefetch;
+
     // last time that mission changed
     uint32_t _last_change_time_ms;
 
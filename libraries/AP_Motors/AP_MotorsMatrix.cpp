@@ -193,27 +193,26 @@ void AP_MotorsMatrix::output_armed_stabilizing()
     // this is always equal to or less than the requested yaw from the pilot or rate controller
     float rp_low = 1.0f;    // lowest thrust value
     float rp_high = -1.0f;  // highest thrust value
-    for (i = 0; i < AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
-            // calculate the thrust outputs for roll and pitch
-            _thrust_rpyt_out[i] = roll_thrust * _roll_factor[i] + pitch_thrust * _pitch_factor[i];
-            // record lowest roll + pitch command
-            if (_thrust_rpyt_out[i] < rp_low) {
-                rp_low = _thrust_rpyt_out[i];
-            }
-            // record highest roll + pitch command
-            if (_thrust_rpyt_out[i] > rp_high && (!_thrust_boost || i != _motor_lost_index)) {
-                rp_high = _thrust_rpyt_out[i];
-            }
+    for (uint8_t n = 0; n < _num_enabled; n++) {
+        i = _enabled_motors[n];
+        // calculate the thrust outputs for roll and pitch
+        _thrust_rpyt_out[i] = roll_thrust * _roll_factor[i] + pitch_thrust * _pitch_factor[i];
+        // record lowest roll + pitch command
+        if (_thrust_rpyt_out[i] < rp_low) {
+            rp_low = _thrust_rpyt_out[i];
+        }
+        // record highest roll + pitch command
+        if (_thrust_rpyt_out[i] > rp_high && (!_thrust_boost || i != _motor_lost_index)) {
+            rp_high = _thrust_rpyt_out[i];
+        }
 
-            // Check the maximum yaw control that can be used on this channel
-            // Exclude any lost motors if thrust boost is enabled
-            if (!is_zero(_yaw_factor[i]) && (!_thrust_boost || i != _motor_lost_index)){
-                if (is_positive(yaw_thrust * _yaw_factor[i])) {
-                    yaw_allowed = MIN(yaw_allowed, fabsf(MAX(1.0f - (throttle_thrust_best_rpy + _thrust_rpyt_out[i]), 0.0f)/_yaw_factor[i]));
-                } else {
-                    yaw_allowed = MIN(yaw_allowed, fabsf(MAX(throttle_thrust_best_rpy + _thrust_rpyt_out[i], 0.0f)/_yaw_factor[i]));
-                }
+        // Check the maximum yaw control that can be used on this channel
+        // Exclude any lost motors if thrust boost is enabled
+        if (!is_zero(_yaw_factor[i]) && (!_thrust_boost || i != _motor_lost_index)){
+            if (is_positive(yaw_thrust * _yaw_factor[i])) {
+                yaw_allowed = MIN(yaw_allowed, MAX(1.0f - (throttle_thrust_best_rpy + _thrust_rpyt_out[i]), 0.0f) * _yaw_factor_inv_abs[i]);
+            } else {
+                yaw_allowed = MIN(yaw_allowed, MAX(throttle_thrust_best_rpy + _thrust_rpyt_out[i], 0.0f) * _yaw_factor_inv_abs[i]);
             }
         }
     }
@@ -255,19 +254,18 @@ void AP_MotorsMatrix::output_armed_stabilizing()
     // add yaw control to thrust outputs
     float rpy_low = 1.0f;   // lowest thrust value
     float rpy_high = -1.0f; // highest thrust value
-    for (i = 0; i < AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
-            _thrust_rpyt_out[i] = _thrust_rpyt_out[i] + yaw_thrust * _yaw_factor[i];
+    for (uint8_t n = 0; n < _num_enabled; n++) {
+        i = _enabled_motors[n];
+        _thrust_rpyt_out[i] = _thrust_rpyt_out[i] + yaw_thrust * _yaw_factor[i];
 
-            // record lowest roll + pitch + yaw command
-            if (_thrust_rpyt_out[i] < rpy_low) {
-                rpy_low = _thrust_rpyt_out[i];
-            }
-            // record highest roll + pitch + yaw command
-            // Exclude any lost motors if thrust boost is enabled
-            if (_thrust_rpyt_out[i] > rpy_high && (!_thrust_boost || i != _motor_lost_index)) {
-                rpy_high = _thrust_rpyt_out[i];
-            }
+        // record lowest roll + pitch + yaw command
+        if (_thrust_rpyt_out[i] < rpy_low) {
+            rpy_low = _thrust_rpyt_out[i];
+        }
+        // record highest roll + pitch + yaw command
+        // Exclude any lost motors if thrust boost is enabled
+        if (_thrust_rpyt_out[i] > rpy_high && (!_thrust_boost || i != _motor_lost_index)) {
+            rpy_high = _thrust_rpyt_out[i];
         }
     }
     // Include the lost motor scaled by _thrust_boost_ratio to smoothly transition this motor in and out of the calculation
@@ -313,10 +311,9 @@ void AP_MotorsMatrix::output_armed_stabilizing()
     }
 
     // add scaled roll, pitch, constrained yaw and throttle for each motor
-    for (i = 0; i < AP_MOTORS_MAX_NUM_MOTORS; i++) {
-        if (motor_enabled[i]) {
-            _thrust_rpyt_out[i] = throttle_thrust_best_rpy + thr_adj + (rpy_scale * _thrust_rpyt_out[i]);
-        }
+    for (uint8_t n = 0; n < _num_enabled; n++) {
+        i = _enabled_motors[n];
+        _thrust_rpyt_out[i] = throttle_thrust_best_rpy + thr_adj + (rpy_scale * _thrust_rpyt_out[i]);
     }
 
     // determine throttle thrust for harmonic notch
@@ -482,6 +479,21 @@ void AP_MotorsMatrix::remove_motor(int8_t motor_num)
 
 void AP_MotorsMatrix::setup_motors(motor_frame_class frame_class, motor_frame_type frame_type)
 {
+    /*
+      boards built for a single production airframe can lock the frame
+      geometry at compile time with "define AP_MOTORS_FRAME_CLASS_LOCK"
+      (and optionally AP_MOTORS_FRAME_TYPE_LOCK) in hwdef.dat. The
+      FRAME_CLASS/FRAME_TYPE parameters are then ignored and the
+      compiler constant-folds the frame selection, dead-stripping the
+      unused frame definitions
+     */
+#ifdef AP_MOTORS_FRAME_CLASS_LOCK
+    frame_class = (motor_frame_class)AP_MOTORS_FRAME_CLASS_LOCK;
+#ifdef AP_MOTORS_FRAME_TYPE_LOCK
+    frame_type = (motor_frame_type)AP_MOTORS_FRAME_TYPE_LOCK;
+#endif
+#endif
+
     // remove existing motors
     for (int8_t i = 0; i < AP_MOTORS_MAX_NUM_MOTORS; i++) {
         remove_motor(i);
@@ -955,6 +967,22 @@ void AP_MotorsMatrix::normalise_rpy_factors()
             }
         }
     }
+
+    // the factors and enabled set are final at this point
+    update_mixer_cache();
+}
+
+// rebuild the cached compact list of enabled motors and the
+// reciprocal yaw factors used by output_armed_stabilizing
+void AP_MotorsMatrix::update_mixer_cache()
+{
+    _num_enabled = 0;
+    for (uint8_t i = 0; i < AP_MOTORS_MAX_NUM_MOTORS; i++) {
+        if (motor_enabled[i]) {
+            _enabled_motors[_num_enabled++] = i;
+        }
+        _yaw_factor_inv_abs[i] = is_zero(_yaw_factor[i]) ? 0.0f : 1.0f / fabsf(_yaw_factor[i]);
+    }
 }
 
 
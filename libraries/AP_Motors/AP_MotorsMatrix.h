@@ -84,6 +84,9 @@ protected:
     // normalizes the roll, pitch and yaw factors so maximum magnitude is 0.5
     void                normalise_rpy_factors();
 
+    // rebuild the cached enabled motor list and reciprocal yaw factors
+    void                update_mixer_cache();
+
     // call vehicle supplied thrust compensation if set
     void                thrust_compensation(void) override;
 
@@ -95,6 +98,14 @@ protected:
     motor_frame_class   _last_frame_class; // most recently requested frame class (i.e. quad, hexa, octa, etc)
     motor_frame_type    _last_frame_type; // most recently requested frame type (i.e. plus, x, v, etc)
 
+    // mixer cache built by update_mixer_cache(). The compact list
+    // avoids scanning all AP_MOTORS_MAX_NUM_MOTORS slots every loop
+    // and the reciprocals avoid a divide per motor in the yaw
+    // headroom calculation
+    uint8_t             _enabled_motors[AP_MOTORS_MAX_NUM_MOTORS]; // motor numbers of the enabled motors
+    uint8_t             _num_enabled;                              // number of entries in _enabled_motors
+    float               _yaw_factor_inv_abs[AP_MOTORS_MAX_NUM_MOTORS]; // 1/fabsf(_yaw_factor), 0 when the factor is zero
+
     // motor failure handling
     float               _thrust_rpyt_out_filt[AP_MOTORS_MAX_NUM_MOTORS];    // filtered thrust outputs with 1 second time constant
     uint8_t             _motor_lost_index;  // index number of the lost motor
@@ -18,8 +18,16 @@ bool ekf_ring_buffer::init(uint8_t size)
     if (buffer) {
         free(buffer);
     }
+    if (timestamps) {
+        free(timestamps);
+    }
     buffer = calloc(size, elsize);
-    if (buffer == nullptr) {
+    timestamps = (uint32_t *)calloc(size, sizeof(uint32_t));
+    if (buffer == nullptr || timestamps == nullptr) {
+        free(buffer);
+        free(timestamps);
+        buffer = nullptr;
+        timestamps = nullptr;
         return false;
     }
     _size = size;
@@ -38,12 +46,13 @@ void *ekf_ring_buffer::get_offset(uint8_t idx) const
 }
 
 /*
-  get a reference to the timestamp for an index
+  get a reference to the timestamp for an index.  This comes from the
+  dense timestamp array, not the stored element, so the recall()
+  search does not pull each element's payload into cache
  */
 uint32_t &ekf_ring_buffer::time_ms(uint8_t idx)
 {
-    EKF_obs_element_t *el = (EKF_obs_element_t *)get_offset(idx);
-    return el->time_ms;
+    return timestamps[idx];
 }
 
 /*
@@ -97,6 +106,34 @@ bool ekf_ring_buffer::recall(void *element,uint32_t sample_time)
     return true;
 }
 
+/*
+  return true if recall() would succeed for this sample time, without
+  consuming any data. This mirrors the search in recall()
+ */
+bool ekf_ring_buffer::would_recall(uint32_t sample_time) const
+{
+    if (!_new_data) {
+        return false;
+    }
+    uint8_t tail = _tail;
+    if (_head == tail) {
+        return timestamps[tail] != 0 &&
+            timestamps[tail] <= sample_time &&
+            (sample_time - timestamps[tail]) < 100;
+    }
+    while (_head != tail) {
+        if (timestamps[tail] != 0 && timestamps[tail] <= sample_time) {
+            if ((sample_time - timestamps[tail]) < 100) {
+                return true;
+            }
+        } else if (timestamps[tail] > sample_time) {
+            break;
+        }
+        tail = (tail+1) % _size;
+    }
+    return false;
+}
+
 /*
  * Writes data and timestamp to a Ring buffer and advances indices that
  * define the location of the newest and oldest data
@@ -110,6 +147,8 @@ void ekf_ring_buffer::push(const void *element)
     _head = (_head+1) % _size;
     // New data is written at the head
     memcpy(get_offset(_head), element, elsize);
+    // mirror the timestamp into the dense search array
+    time_ms(_head) = ((const EKF_obs_element_t *)element)->time_ms;
     _new_data = true;
 }
 
@@ -121,6 +160,7 @@ void ekf_ring_buffer::reset()
     _tail = 0;
     _new_data = false;
     memset((void *)buffer,0,_size*uint32_t(elsize));
+    memset(timestamps,0,_size*sizeof(uint32_t));
 }
 
 ////////////////////////////////////////////////////
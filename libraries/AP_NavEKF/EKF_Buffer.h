@@ -30,6 +30,13 @@ public:
     */
     bool recall(void *element, uint32_t sample_time);
 
+    /*
+     * Returns true if recall() would succeed for this sample time,
+     * without consuming any data. Used by fusion scheduling to detect
+     * cycles where several sensors come due together
+    */
+    bool would_recall(uint32_t sample_time) const;
+
     /*
      * Writes data and timestamp to a Ring buffer and advances indices that
      * define the location of the newest and oldest data
@@ -42,6 +49,10 @@ public:
 private:
     const uint8_t elsize;
     void *buffer;
+    // timestamps are kept in a separate dense array so the recall()
+    // scan walks sequential uint32_t values instead of striding
+    // through full-size elements, keeping the search cache-friendly
+    uint32_t *timestamps;
     uint8_t _size, _head, _tail, _new_data;
 
     uint32_t &time_ms(uint8_t idx);
@@ -71,6 +82,10 @@ public:
         return ekf_ring_buffer::recall(&element, sample_time);
     }
 
+    bool would_recall(uint32_t sample_time) const {
+        return ekf_ring_buffer::would_recall(sample_time);
+    }
+
     void push(element_type element) {
         return ekf_ring_buffer::push(&element);
     }
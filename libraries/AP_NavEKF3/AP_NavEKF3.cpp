@@ -5,11 +5,15 @@
 #include <AP_Logger/AP_Logger.h>
 #include <AP_Vehicle/AP_Vehicle_Type.h>
 #include <AP_BoardConfig/AP_BoardConfig.h>
+#include <AP_InertialSensor/AP_InertialSensor.h>
+#include <AP_RTC/AP_RTC.h>
 
 #include "AP_DAL/AP_DAL.h"
 
 #include <new>
 
+extern const AP_HAL::HAL& hal;
+
 /*
   parameter defaults for different types of vehicle. The
   APM_BUILD_DIRECTORY is taken from the main vehicle directory name
@@ -690,6 +694,14 @@ const AP_Param::GroupInfo NavEKF3::var_info2[] = {
     // @User: Advanced
     AP_GROUPINFO("DRAG_MCOEF", 5, NavEKF3, _momentumDragCoef, 0.0f),
 
+    // @Param: THREAD
+    // @DisplayName: EKF3 worker thread enable
+    // @Description: This enables updating of the non-primary EKF3 lanes on a worker thread, reducing the time spent in the main loop when more than one lane is active. The worker runs in the gap between main loop iterations and the main loop waits for it to complete before the next update, so lane data is at most one loop stale when used for lane selection. This option must not be used when EKF2 is also enabled as the two filters share working memory.
+    // @Values: 0:Disabled,1:Enabled
+    // @User: Advanced
+    // @RebootRequired: True
+    AP_GROUPINFO("THREAD", 6, NavEKF3, _threadEnable, 0),
+
     AP_GROUPEND
 };
 
@@ -799,6 +811,16 @@ bool NavEKF3::InitialiseFilter(void)
     // Set the primary initially to be the lowest index
     primary = 0;
 
+    // after an in-flight watchdog reset resume on the lane that was
+    // primary before the reset rather than re-running lane selection
+    // from scratch
+    if (hal.util->was_watchdog_reset()) {
+        const uint8_t last_primary = hal.util->last_persistent_data.ekf_primary_core;
+        if (last_primary > 0 && last_primary <= num_cores) {
+            primary = last_primary - 1;
+        }
+    }
+
     // invalidate shared origin
     common_origin_valid = false;
 
@@ -817,6 +839,22 @@ bool NavEKF3::InitialiseFilter(void)
     memset((void *)&pos_reset_data, 0, sizeof(pos_reset_data));
     memset(&pos_down_reset_data, 0, sizeof(pos_down_reset_data));
 
+    // optionally update the non-primary lanes on a worker thread. The
+    // cores share scratch memory with EKF2 (see NavEKF_core_common)
+    // so this is only allowed when EKF2 is disabled
+    if (ret && _threadEnable != 0 && num_cores > 1 && !updateThreadStarted) {
+        enum ap_var_type ptype;
+        const AP_Int8 *ek2_enable = (const AP_Int8 *)AP_Param::find("EK2_ENABLE", &ptype);
+        if (ek2_enable != nullptr && ek2_enable->get() != 0) {
+            GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "EK3_THREAD requires EK2_ENABLE=0");
+        } else if (hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&NavEKF3::updateWorkerThread, void),
+                                                "EKF3_worker", 4096, AP_HAL::Scheduler::PRIORITY_MAIN, 0)) {
+            updateThreadStarted = true;
+        } else {
+            GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "EKF3 worker thread create failed");
+        }
+    }
+
     return ret;
 }
 
@@ -852,6 +890,12 @@ bool NavEKF3::coreBetterScore(uint8_t new_core, uint8_t current_core) const
 */
 void NavEKF3::UpdateFilter(void)
 {
+    // the worker thread must have finished the previous frame's
+    // non-primary lane updates before the DAL frame advances
+    if (updateThreadStarted) {
+        waitForWorker();
+    }
+
     AP::dal().start_frame(AP_DAL::FrameType::UpdateFilterEKF3);
 
     if (!core) {
@@ -870,9 +914,21 @@ void NavEKF3::UpdateFilter(void)
             AP::dal().ekf_low_time_remaining(AP_DAL::EKFType::EKF3, i)) {
             allow_state_prediction = false;
         }
+        if (updateThreadStarted && i != primary) {
+            // non-primary lanes are updated by the worker thread
+            // after this function returns
+            workerAllowPrediction[i] = allow_state_prediction;
+            continue;
+        }
         core[i].UpdateFilter(allow_state_prediction);
     }
 
+    // the worker must skip every lane that is updated inline this
+    // frame. Normally that is just the primary, but if lane selection
+    // below changes the primary then the new lane is updated inline
+    // as well before the worker is kicked
+    uint8_t inlineLanes = 1U << primary;
+
     // If the current core selected has a bad error score or is unhealthy, switch to a healthy core with the lowest fault score
     // Don't start running the check until the primary core has started returned healthy for at least 10 seconds to avoid switching
     // due to initial alignment fluctuations and race conditions
@@ -949,8 +1005,176 @@ void NavEKF3::UpdateFilter(void)
         primary = 0;
     }
 
+    // record the primary lane for use after a watchdog reset
+    hal.util->persistent_data.ekf_primary_core = primary + 1;
+
+    // save the learned alignment states when the vehicle disarms
+    checkSaveAlignmentCache(armed);
+
     // align position of inactive sources to ahrs
     sources.align_inactive_sources();
+
+    // hand the non-primary lanes to the worker thread. It will run
+    // them in the gap before the next call to this function
+    if (updateThreadStarted) {
+        if ((inlineLanes & (1U << primary)) == 0) {
+            // lane selection changed the primary this frame. The new
+            // primary has not been updated yet, and the worker must
+            // not touch it once this function returns because the
+            // AHRS reads it without waiting, so update it inline
+            core[primary].UpdateFilter(workerAllowPrediction[primary]);
+            inlineLanes |= 1U << primary;
+        }
+        workerSkipLanes = inlineLanes;
+        workerFrameRequest.fetch_add(1, std::memory_order_release);
+    }
+}
+
+/*
+  worker thread updating the non-primary lanes. It only runs between
+  frames: a frame is requested at the end of UpdateFilter() and the
+  main thread waits for completion before the next DAL frame starts,
+  so the cores are never updated concurrently with each other or with
+  DAL updates
+ */
+void NavEKF3::updateWorkerThread(void)
+{
+    while (true) {
+        const uint32_t frame = workerFrameRequest.load(std::memory_order_acquire);
+        if (workerFrameComplete.load(std::memory_order_relaxed) == frame) {
+            hal.scheduler->delay_microseconds(100);
+            continue;
+        }
+        for (uint8_t i=0; i<num_cores; i++) {
+            if (workerSkipLanes & (1U << i)) {
+                continue;
+            }
+            core[i].UpdateFilter(workerAllowPrediction[i]);
+        }
+        workerFrameComplete.store(frame, std::memory_order_release);
+    }
+}
+
+/*
+  wait for the worker thread to finish the last requested frame. The
+  worker only has the non-primary lane updates to do per frame so this
+  returns quickly
+ */
+void NavEKF3::waitForWorker(void)
+{
+    while (workerFrameComplete.load(std::memory_order_acquire) !=
+           workerFrameRequest.load(std::memory_order_relaxed)) {
+        hal.scheduler->delay_microseconds(20);
+    }
+}
+
+// storage for the cross-boot alignment cache
+StorageAccess NavEKF3::_storage(StorageManager::StorageEKF);
+
+// layout of one core's entry in the alignment cache
+struct PACKED AlignmentCacheRecord {
+    Vector3f gyro_bias;      // rad/sec
+    Vector3f accel_bias;     // m/s/s
+    Vector3f earth_magfield; // NED gauss
+    Vector3f body_magfield;  // body frame gauss
+    float temperature;       // IMU temperature when saved : degC
+    uint32_t utc_sec;        // UTC time when saved, 0 if unknown : sec
+    uint8_t imu_index;       // IMU the states were learned on
+    uint8_t valid;
+};
+
+#define ALIGNMENT_CACHE_MAGIC        0x3EA1 // changes when the record layout changes
+#define ALIGNMENT_CACHE_HDR_SIZE     4
+#define ALIGNMENT_CACHE_MAX_CORES    2
+#define ALIGNMENT_CACHE_TEMP_ERR_MAX 5.0f   // degC of IMU temperature change before cached biases are rejected
+#define ALIGNMENT_CACHE_AGE_MAX_SEC  1800U  // maximum cache age when UTC time is available
+
+// return current UTC time in seconds, or 0 if not available
+static uint32_t alignment_cache_utc_sec(void)
+{
+    uint64_t utc_usec;
+    if (!AP::rtc().get_utc_usec(utc_usec)) {
+        return 0;
+    }
+    return utc_usec / 1000000ULL;
+}
+
+// save the learned alignment states of all healthy cores when the
+// vehicle disarms so the next boot can restore them
+void NavEKF3::checkSaveAlignmentCache(bool armed)
+{
+    if (armed) {
+        alignmentCacheWasArmed = true;
+        return;
+    }
+    if (!alignmentCacheWasArmed) {
+        // only save once per disarm
+        return;
+    }
+    alignmentCacheWasArmed = false;
+
+    const uint8_t ncores = MIN(num_cores, ALIGNMENT_CACHE_MAX_CORES);
+    bool wrote = false;
+    for (uint8_t i=0; i<ncores; i++) {
+        const uint16_t ofs = ALIGNMENT_CACHE_HDR_SIZE + i * sizeof(AlignmentCacheRecord);
+        if (ofs + sizeof(AlignmentCacheRecord) > _storage.size()) {
+            // no storage area on this board
+            break;
+        }
+        AlignmentCacheRecord rec {};
+        if (core[i].healthy() &&
+            core[i].getAlignmentStates(rec.gyro_bias, rec.accel_bias, rec.earth_magfield, rec.body_magfield)) {
+            rec.imu_index = core[i].getIMUIndex();
+            rec.temperature = AP::ins().get_temperature(rec.imu_index);
+            rec.utc_sec = alignment_cache_utc_sec();
+            rec.valid = 1;
+        }
+        _storage.write_block(ofs, &rec, sizeof(rec));
+        wrote = true;
+    }
+    if (wrote) {
+        _storage.write_uint16(0, ALIGNMENT_CACHE_MAGIC);
+        _storage.write_uint16(2, 0); // reserved
+    }
+}
+
+// load core_index's cached alignment states. Returns false if the
+// cache is missing, was learned on a different IMU or has fallen
+// outside the temperature/time validity window
+bool NavEKF3::loadAlignmentCache(uint8_t core_index, uint8_t imu_index, Vector3f &gyroBias, Vector3f &accelBias, Vector3f &earthMag, Vector3f &bodyMag) const
+{
+    const uint16_t ofs = ALIGNMENT_CACHE_HDR_SIZE + core_index * sizeof(AlignmentCacheRecord);
+    if (core_index >= ALIGNMENT_CACHE_MAX_CORES ||
+        ofs + sizeof(AlignmentCacheRecord) > _storage.size() ||
+        _storage.read_uint16(0) != ALIGNMENT_CACHE_MAGIC) {
+        return false;
+    }
+    AlignmentCacheRecord rec;
+    if (!_storage.read_block(&rec, ofs, sizeof(rec)) ||
+        !rec.valid || rec.imu_index != imu_index) {
+        return false;
+    }
+    // the biases drift with temperature, so reject the cache when the
+    // IMU temperature has moved too far from where they were learned
+    if (fabsf(AP::ins().get_temperature(imu_index) - rec.temperature) > ALIGNMENT_CACHE_TEMP_ERR_MAX) {
+        return false;
+    }
+    // age the cache out when UTC time is available at both ends;
+    // without it the temperature check stands alone
+    const uint32_t now_sec = alignment_cache_utc_sec();
+    if (rec.utc_sec != 0 && now_sec != 0 &&
+        (now_sec < rec.utc_sec || now_sec - rec.utc_sec > ALIGNMENT_CACHE_AGE_MAX_SEC)) {
+        return false;
+    }
+    if (rec.gyro_bias.is_nan() || rec.accel_bias.is_nan() ||
+        rec.earth_magfield.is_nan() || rec.body_magfield.is_nan()) {
+        return false;
+    }
+    gyroBias = rec.gyro_bias;
+    accelBias = rec.accel_bias;
+    earthMag = rec.earth_magfield;
+    bodyMag = rec.body_magfield;
+    return true;
 }
 
 /*
@@ -969,6 +1193,12 @@ void NavEKF3::checkLaneSwitch(void)
         return;
     }
 
+    // the error scores of the other lanes must not be read while the
+    // worker thread is part way through updating them
+    if (updateThreadStarted) {
+        waitForWorker();
+    }
+
     float primaryErrorScore = core[primary].errorScore();
     float lowestErrorScore = primaryErrorScore;
     uint8_t newPrimaryIndex = primary;
@@ -1000,6 +1230,10 @@ void NavEKF3::requestYawReset(void)
 {
     AP::dal().log_event3(AP_DAL::Event::requestYawReset);
 
+    if (updateThreadStarted) {
+        waitForWorker();
+    }
+
     for (uint8_t i = 0; i < num_cores; i++) {
         core[i].EKFGSF_requestYawReset();
     }
@@ -1498,6 +1732,34 @@ void NavEKF3::writeExtNavData(const Vector3f &pos, const Quaternion &quat, float
     }
 }
 
+/* restore a lane's state snapshot, used by Replay to seek into a log
+ * rather than replaying it from the start. The header carries the
+ * chunk count of the snapshot so one written by a different state
+ * layout can be rejected
+*/
+void NavEKF3::handleSnapshotHeader(uint8_t core_index, uint16_t num_chunks)
+{
+    if (core == nullptr || core_index >= num_cores) {
+        return;
+    }
+    if (num_chunks != core[core_index].getSnapshotNumChunks()) {
+        snapshotIgnoreMask |= (1U << core_index);
+    } else {
+        snapshotIgnoreMask &= ~(1U << core_index);
+    }
+}
+
+void NavEKF3::handleSnapshotChunk(uint8_t core_index, uint16_t index, const float data[6])
+{
+    if (core == nullptr || core_index >= num_cores) {
+        return;
+    }
+    if (snapshotIgnoreMask & (1U << core_index)) {
+        return;
+    }
+    core[core_index].restoreSnapshotChunk(index, data);
+}
+
 /* Write velocity data from an external navigation system
  * vel : velocity in NED (m)
  * err : velocity error (m/s)
@@ -19,12 +19,15 @@
  */
 #pragma once
 
+#include <atomic>
+
 #include <AP_Common/Location.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_Param/AP_Param.h>
 #include <GCS_MAVLink/GCS_MAVLink.h>
 #include <AP_NavEKF/AP_Nav_Common.h>
 #include <AP_NavEKF/AP_NavEKF_Source.h>
+#include <StorageManager/StorageManager.h>
 
 class NavEKF3_core;
 
@@ -359,6 +362,11 @@ public:
     // write EKF information to on-board logs
     void Log_Write();
 
+    // restore a lane's state snapshot, used by Replay to seek into a
+    // log rather than replaying it from the start
+    void handleSnapshotHeader(uint8_t core_index, uint16_t num_chunks);
+    void handleSnapshotChunk(uint8_t core_index, uint16_t index, const float data[6]);
+
     // are we using an external yaw source? This is needed by AHRS attitudes_consistent check
     bool using_external_yaw(void) const;
 
@@ -437,6 +445,7 @@ private:
     AP_Int8 _gsfResetMaxCount;      // maximum number of times the EKF3 is allowed to reset it's yaw to the EKF-GSF estimate
     AP_Float _err_thresh;           // lanes have to be consistently better than the primary by at least this threshold to reduce their overall relativeCoreError
     AP_Int32 _affinity;             // bitmask of sensor affinity options
+    AP_Int8  _threadEnable;         // non-zero to update non-primary lanes on a worker thread
     AP_Float _dragObsNoise;         // drag specific force observatoin noise (m/s/s)**2
     AP_Float _ballisticCoef_x;      // ballistic coefficient measured for flow in X body frame directions
     AP_Float _ballisticCoef_y;      // ballistic coefficient measured for flow in Y body frame directions
@@ -489,6 +498,16 @@ private:
     // last time of Log_Write
     uint64_t lastLogWrite_us;
 
+    // state snapshots for Replay seek. One lane is snapshotted at a
+    // time, rotating through the lanes to bound the burst written to
+    // the logger
+    uint64_t lastSnapshotWrite_us;  // last time a snapshot was written
+    uint8_t snapshotCoreNext;       // next lane to snapshot
+    uint8_t snapshotIgnoreMask;     // bitmask of lanes whose incoming snapshot chunks are from a different layout and must be ignored
+
+    // write one lane's state snapshot as replay log messages
+    void Log_WriteSnapshot(uint8_t core_index);
+
     struct {
         uint32_t last_function_call;  // last time getLastYawResetAngle was called
         bool core_changed;            // true when a core change happened and hasn't been consumed, false otherwise
@@ -524,7 +543,39 @@ private:
     // origin set by one of the cores
     struct Location common_EKF_origin;
     bool common_origin_valid;
-    
+
+    // worker thread support (EK3_THREAD). The non-primary lanes are
+    // updated on a worker thread in the gap between main loop
+    // iterations; the main thread waits for completion before the
+    // next DAL frame starts so the cores are never updated
+    // concurrently with each other or with DAL updates
+    bool updateThreadStarted;                        // worker thread created
+    std::atomic<uint32_t> workerFrameRequest{0};     // frame counter the worker has been asked to process
+    std::atomic<uint32_t> workerFrameComplete{0};    // frame counter the worker has completed
+    uint8_t workerSkipLanes;                         // bitmask of lanes updated on the main thread, skipped by the worker
+    bool workerAllowPrediction[MAX_EKF_CORES];       // per-lane covariance prediction flags for the worker
+
+    // main loop of the worker thread
+    void updateWorkerThread(void);
+
+    // wait for the worker thread to finish the previous frame's lane updates
+    void waitForWorker(void);
+
+    // cross-boot alignment cache. The learned gyro/accel biases and
+    // mag field states are saved to storage on disarm and restored
+    // with validity checks at the next filter initialisation,
+    // shortening the time to full navigation health after a quick
+    // battery swap
+    static StorageAccess _storage;
+    bool alignmentCacheWasArmed;    // true if we have been armed since the last cache save
+
+    // save the learned alignment states of all healthy cores on disarm
+    void checkSaveAlignmentCache(bool armed);
+
+    // load core_index's cached alignment states, returning false if
+    // the cache is missing or no longer valid for imu_index
+    bool loadAlignmentCache(uint8_t core_index, uint8_t imu_index, Vector3f &gyroBias, Vector3f &accelBias, Vector3f &earthMag, Vector3f &bodyMag) const;
+
     // update the yaw reset data to capture changes due to a lane switch
     // new_primary - index of the ekf instance that we are about to switch to as the primary
     // old_primary - index of the ekf instance that we are currently using as the primary
@@ -142,36 +142,23 @@ void NavEKF3_core::FuseAirspeed()
             stateStruct.quat.normalize();
 
             // correct the covariance P = (I - K*H)*P
-            // take advantage of the empty columns in KH to reduce the
-            // number of operations
-            for (unsigned i = 0; i<=stateIndexLim; i++) {
-                for (unsigned j = 0; j<=3; j++) {
-                    KH[i][j] = 0.0f;
-                }
-                for (unsigned j = 4; j<=6; j++) {
-                    KH[i][j] = Kfusion[i] * H_TAS[j];
-                }
-                for (unsigned j = 7; j<=21; j++) {
-                    KH[i][j] = 0.0f;
-                }
-                for (unsigned j = 22; j<=23; j++) {
-                    KH[i][j] = Kfusion[i] * H_TAS[j];
-                }
-            }
+            // K*H*P is rank one, so the row vector H*P is formed once
+            // and the correction becomes an outer product. This
+            // replaces the per-element dot product chains with an
+            // independent multiply-subtract per element which the
+            // compiler can keep in flight
+            ftype HP[24];
             for (unsigned j = 0; j<=stateIndexLim; j++) {
-                for (unsigned i = 0; i<=stateIndexLim; i++) {
-                    ftype res = 0;
-                    res += KH[i][4] * P[4][j];
-                    res += KH[i][5] * P[5][j];
-                    res += KH[i][6] * P[6][j];
-                    res += KH[i][22] * P[22][j];
-                    res += KH[i][23] * P[23][j];
-                    KHP[i][j] = res;
-                }
+                ftype res = H_TAS[4] * P[4][j];
+                res += H_TAS[5] * P[5][j];
+                res += H_TAS[6] * P[6][j];
+                res += H_TAS[22] * P[22][j];
+                res += H_TAS[23] * P[23][j];
+                HP[j] = res;
             }
             for (unsigned i = 0; i<=stateIndexLim; i++) {
                 for (unsigned j = 0; j<=stateIndexLim; j++) {
-                    P[i][j] = P[i][j] - KHP[i][j];
+                    P[i][j] = P[i][j] - Kfusion[i] * HP[j];
                 }
             }
         }
@@ -217,10 +204,10 @@ void NavEKF3_core::SelectTasFusion()
 // it requires a stable wind for best results and should not be used for aerobatic flight
 void NavEKF3_core::SelectBetaDragFusion()
 {
-    // Check if the magnetometer has been fused on that time step and the filter is running at faster than 200 Hz
+    // Check if the magnetometer or airspeed has been fused on that time step and the filter is running at faster than 200 Hz
     // If so, don't fuse measurements on this time step to reduce frame over-runs
     // Only allow one time slip to prevent high rate magnetometer data preventing fusion of other measurements
-    if (magFusePerformed && dtIMUavg < 0.005f && !sideSlipFusionDelayed) {
+    if ((magFusePerformed || prevTasStep_ms == imuSampleTime_ms) && dtIMUavg < 0.005f && !sideSlipFusionDelayed) {
         sideSlipFusionDelayed = true;
         return;
     } else {
@@ -411,37 +398,24 @@ void NavEKF3_core::FuseSideslip()
         stateStruct.quat.normalize();
 
         // correct the covariance P = (I - K*H)*P
-        // take advantage of the empty columns in KH to reduce the
-        // number of operations
-        for (unsigned i = 0; i<=stateIndexLim; i++) {
-            for (unsigned j = 0; j<=6; j++) {
-                KH[i][j] = Kfusion[i] * H_BETA[j];
-            }
-            for (unsigned j = 7; j<=21; j++) {
-                KH[i][j] = 0.0f;
-            }
-            for (unsigned j = 22; j<=23; j++) {
-                KH[i][j] = Kfusion[i] * H_BETA[j];
-            }
-        }
+        // K*H*P is rank one, so the row vector H*P is formed once and
+        // the correction becomes an outer product, as in FuseAirspeed()
+        ftype HP[24];
         for (unsigned j = 0; j<=stateIndexLim; j++) {
-            for (unsigned i = 0; i<=stateIndexLim; i++) {
-                ftype res = 0;
-                res += KH[i][0] * P[0][j];
-                res += KH[i][1] * P[1][j];
-                res += KH[i][2] * P[2][j];
-                res += KH[i][3] * P[3][j];
-                res += KH[i][4] * P[4][j];
-                res += KH[i][5] * P[5][j];
-                res += KH[i][6] * P[6][j];
-                res += KH[i][22] * P[22][j];
-                res += KH[i][23] * P[23][j];
-                KHP[i][j] = res;
-            }
+            ftype res = H_BETA[0] * P[0][j];
+            res += H_BETA[1] * P[1][j];
+            res += H_BETA[2] * P[2][j];
+            res += H_BETA[3] * P[3][j];
+            res += H_BETA[4] * P[4][j];
+            res += H_BETA[5] * P[5][j];
+            res += H_BETA[6] * P[6][j];
+            res += H_BETA[22] * P[22][j];
+            res += H_BETA[23] * P[23][j];
+            HP[j] = res;
         }
         for (unsigned i = 0; i<=stateIndexLim; i++) {
             for (unsigned j = 0; j<=stateIndexLim; j++) {
-                P[i][j] = P[i][j] - KHP[i][j];
+                P[i][j] = P[i][j] - Kfusion[i] * HP[j];
             }
         }
     }
@@ -353,15 +353,55 @@ void NavEKF3::Log_Write()
     }
     lastLogWrite_us = imuSampleTime_us;
 
+    // logging reads the core states, so the worker thread must not be
+    // part way through a lane update
+    if (updateThreadStarted) {
+        waitForWorker();
+    }
+
     uint64_t time_us = AP::dal().micros64();
 
     for (uint8_t i=0; i<activeCores(); i++) {
         core[i].Log_Write(time_us);
     }
 
+    // periodically write a full state snapshot for one lane, rotating
+    // through the lanes to bound the burst written to the logger.
+    // Snapshots let Replay seek into a log rather than replaying it
+    // from the start
+    if (time_us - lastSnapshotWrite_us >= 10000000ULL) {
+        lastSnapshotWrite_us = time_us;
+        if (snapshotCoreNext >= activeCores()) {
+            snapshotCoreNext = 0;
+        }
+        Log_WriteSnapshot(snapshotCoreNext);
+        snapshotCoreNext++;
+    }
+
     AP::dal().start_frame(AP_DAL::FrameType::LogWriteEKF3);
 }
 
+/*
+  write one lane's state snapshot as replay log messages. The header
+  carries the chunk count so Replay can reject a snapshot written by a
+  different state layout
+ */
+void NavEKF3::Log_WriteSnapshot(uint8_t core_index)
+{
+    struct log_RSH3 hdr {
+        num_chunks : core[core_index].getSnapshotNumChunks(),
+        core       : DAL_CORE(core_index),
+    };
+    WRITE_REPLAY_BLOCK(RSH3, hdr);
+
+    struct log_RSC3 pkt {};
+    pkt.core = DAL_CORE(core_index);
+    for (uint16_t n=0; core[core_index].getSnapshotChunk(n, pkt.data); n++) {
+        pkt.index = n;
+        WRITE_REPLAY_BLOCK(RSC3, pkt);
+    }
+}
+
 void NavEKF3_core::Log_Write(uint64_t time_us)
 {
     // note that several of these functions exit-early if they're not
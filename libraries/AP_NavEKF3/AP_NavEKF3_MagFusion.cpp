@@ -371,6 +371,24 @@ void NavEKF3_core::SelectMagFusion()
         readMagData();
     }
 
+    /*
+      spread coincident fusions across adjacent cycles: if GPS data is
+      also due on this time horizon, defer the magnetometer fusion by
+      one cycle so position/velocity fusion (which has priority) does
+      not share its cycle with the mag fusion. Only one deferral in a
+      row is allowed so mag data cannot go stale. This flattens the
+      worst-case cycle time that sets the loop rate ceiling; it is
+      only done on fast loop rates where cycles are short enough for
+      a one-cycle delay to have no tuning impact
+     */
+    if (!magFusionDelayed && dtIMUavg < 0.005f &&
+        storedMag.would_recall(imuDataDelayed.time_ms) &&
+        storedGPS.would_recall(imuDataDelayed.time_ms)) {
+        magFusionDelayed = true;
+        return;
+    }
+    magFusionDelayed = false;
+
     // check for availability of magnetometer or other yaw data to fuse
     magDataToFuse = storedMag.recall(magDataDelayed,imuDataDelayed.time_ms);
 
@@ -788,10 +806,18 @@ void NavEKF3_core::FuseMagnetometer()
             // this can be used by other fusion processes to avoid fusing on the same frame as this expensive step
             magFusePerformed = true;
         }
+        // rows of K*H*P for states with a zeroed gain are structurally
+        // zero, so they are skipped below
+        bool zeroRows[24];
+        calcZeroGainRows(zeroRows);
+
         // correct the covariance P = (I - K*H)*P
         // take advantage of the empty columns in KH to reduce the
         // number of operations
         for (unsigned i = 0; i<=stateIndexLim; i++) {
+            if (zeroRows[i]) {
+                continue;
+            }
             for (unsigned j = 0; j<=3; j++) {
                 KH[i][j] = Kfusion[i] * H_MAG[j];
             }
@@ -807,6 +833,9 @@ void NavEKF3_core::FuseMagnetometer()
         }
         for (unsigned j = 0; j<=stateIndexLim; j++) {
             for (unsigned i = 0; i<=stateIndexLim; i++) {
+                if (zeroRows[i]) {
+                    continue;
+                }
                 ftype res = 0;
                 res += KH[i][0] * P[0][j];
                 res += KH[i][1] * P[1][j];
@@ -824,13 +853,16 @@ void NavEKF3_core::FuseMagnetometer()
         // Check that we are not going to drive any variances negative and skip the update if so
         bool healthyFusion = true;
         for (uint8_t i= 0; i<=stateIndexLim; i++) {
-            if (KHP[i][i] > P[i][i]) {
+            if (!zeroRows[i] && KHP[i][i] > P[i][i]) {
                 healthyFusion = false;
             }
         }
         if (healthyFusion) {
             // update the covariance matrix
             for (uint8_t i= 0; i<=stateIndexLim; i++) {
+                if (zeroRows[i]) {
+                    continue;
+                }
                 for (uint8_t j= 0; j<=stateIndexLim; j++) {
                     P[i][j] = P[i][j] - KHP[i][j];
                 }
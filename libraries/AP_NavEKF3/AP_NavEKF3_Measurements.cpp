@@ -652,6 +652,15 @@ void NavEKF3_core::readGpsData()
             // Read the GPS location in WGS-84 lat,long,height coordinates
             const struct Location &gpsloc = gps.location(selected_gps);
 
+            // warm the world magnetic model cache as soon as we have
+            // a fix.  gpsGoodToAlign takes several seconds to pass,
+            // so by the time the origin is set the table lookups
+            // below are cache hits instead of a table interpolation
+            // in the middle of the filter update
+            if (!have_table_earth_field) {
+                AP_Declination::get_earth_field_ga(gpsloc);
+            }
+
             // Set the EKF origin and magnetic field declination if not previously set and GPS checks have passed
             if (gpsGoodToAlign && !validOrigin) {
                 setOrigin(gpsloc);
@@ -684,7 +693,7 @@ void NavEKF3_core::readGpsData()
 
             // convert GPS measurements to local NED and save to buffer to be fused later if we have a valid origin
             if (validOrigin) {
-                gpsDataNew.pos = EKF_origin.get_distance_NE(gpsloc);
+                gpsDataNew.pos = EKF_origin.get_distance_NE_double(gpsloc);
                 if ((frontend->_originHgtMode & (1<<2)) == 0) {
                     gpsDataNew.hgt = (float)((double)0.01 * (double)gpsloc.alt - ekfGpsRefHgt);
                 } else {
@@ -55,6 +55,13 @@ float NavEKF3_core::errorScore() const
         if (frontend->_affinity & EKF_AFFINITY_MAG) {
             score = MAX(score, 0.3f * (magTestRatio.x + magTestRatio.y + magTestRatio.z));
         }
+        // bad IMU data is the earliest indication of a failing or
+        // clipping IMU. Report a score above the frontend's switch
+        // threshold immediately so a lane switch away from this core
+        // does not have to wait for the fusion test ratios to grow
+        if (badIMUdata) {
+            score = MAX(score, 1.2f);
+        }
     }
     return score;
 }
@@ -231,7 +238,7 @@ bool NavEKF3_core::getPosNE(Vector2f &posNE) const
             if ((gps.status(selected_gps) >= AP_DAL_GPS::GPS_OK_FIX_2D)) {
                 // If the origin has been set and we have GPS, then return the GPS position relative to the origin
                 const struct Location &gpsloc = gps.location(selected_gps);
-                const Vector2f tempPosNE = EKF_origin.get_distance_NE(gpsloc);
+                const Vector2f tempPosNE = EKF_origin.get_distance_NE_double(gpsloc);
                 posNE.x = tempPosNE.x;
                 posNE.y = tempPosNE.y;
                 return false;
@@ -306,7 +313,7 @@ bool NavEKF3_core::getLLH(struct Location &loc) const
         if (filterStatus.flags.horiz_pos_abs || filterStatus.flags.horiz_pos_rel) {
             loc.lat = EKF_origin.lat;
             loc.lng = EKF_origin.lng;
-            loc.offset(outputDataNew.position.x, outputDataNew.position.y);
+            loc.offset_double(outputDataNew.position.x, outputDataNew.position.y);
             return true;
         } else {
             // we could be in constant position mode because the vehicle has taken off without GPS, or has lost GPS
@@ -322,9 +329,9 @@ bool NavEKF3_core::getLLH(struct Location &loc) const
                 loc.lat = EKF_origin.lat;
                 loc.lng = EKF_origin.lng;
                 if (PV_AidingMode == AID_NONE) {
-                    loc.offset(lastKnownPositionNE.x, lastKnownPositionNE.y);
+                    loc.offset_double(lastKnownPositionNE.x, lastKnownPositionNE.y);
                 } else {
-                    loc.offset(outputDataNew.position.x, outputDataNew.position.y);
+                    loc.offset_double(outputDataNew.position.x, outputDataNew.position.y);
                 }
                 return false;
             }
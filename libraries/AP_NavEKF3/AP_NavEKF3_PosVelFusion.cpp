@@ -910,9 +910,17 @@ void NavEKF3_core::FuseVelPosNED()
                     memset(&Kfusion[22], 0, 8);
                 }
 
+                // rows of K*H*P for states with a zeroed gain are structurally
+                // zero, so they are skipped below
+                bool zeroRows[24];
+                calcZeroGainRows(zeroRows);
+
                 // update the covariance - take advantage of direct observation of a single state at index = stateIndex to reduce computations
                 // this is a numerically optimised implementation of standard equation P = (I - K*H)*P;
                 for (uint8_t i= 0; i<=stateIndexLim; i++) {
+                    if (zeroRows[i]) {
+                        continue;
+                    }
                     for (uint8_t j= 0; j<=stateIndexLim; j++) {
                         KHP[i][j] = Kfusion[i] * P[stateIndex][j];
                     }
@@ -920,13 +928,16 @@ void NavEKF3_core::FuseVelPosNED()
                 // Check that we are not going to drive any variances negative and skip the update if so
                 bool healthyFusion = true;
                 for (uint8_t i= 0; i<=stateIndexLim; i++) {
-                    if (KHP[i][i] > P[i][i]) {
+                    if (!zeroRows[i] && KHP[i][i] > P[i][i]) {
                         healthyFusion = false;
                     }
                 }
                 if (healthyFusion) {
                     // update the covariance matrix
                     for (uint8_t i= 0; i<=stateIndexLim; i++) {
+                        if (zeroRows[i]) {
+                            continue;
+                        }
                         for (uint8_t j= 0; j<=stateIndexLim; j++) {
                             P[i][j] = P[i][j] - KHP[i][j];
                         }
@@ -1753,10 +1764,18 @@ void NavEKF3_core::FuseBodyVel()
                 bodyVelFusionActive = true;
                 GCS_SEND_TEXT(MAV_SEVERITY_INFO, "EKF3 IMU%u fusing odometry",(unsigned)imu_index);
             }
+            // rows of K*H*P for states with a zeroed gain are structurally
+            // zero, so they are skipped below
+            bool zeroRows[24];
+            calcZeroGainRows(zeroRows);
+
             // correct the covariance P = (I - K*H)*P
             // take advantage of the empty columns in KH to reduce the
             // number of operations
             for (unsigned i = 0; i<=stateIndexLim; i++) {
+                if (zeroRows[i]) {
+                    continue;
+                }
                 for (unsigned j = 0; j<=6; j++) {
                     KH[i][j] = Kfusion[i] * H_VEL[j];
                 }
@@ -1766,6 +1785,9 @@ void NavEKF3_core::FuseBodyVel()
             }
             for (unsigned j = 0; j<=stateIndexLim; j++) {
                 for (unsigned i = 0; i<=stateIndexLim; i++) {
+                    if (zeroRows[i]) {
+                        continue;
+                    }
                     ftype res = 0;
                     res += KH[i][0] * P[0][j];
                     res += KH[i][1] * P[1][j];
@@ -1781,7 +1803,7 @@ void NavEKF3_core::FuseBodyVel()
             // Check that we are not going to drive any variances negative and skip the update if so
             bool healthyFusion = true;
             for (uint8_t i= 0; i<=stateIndexLim; i++) {
-                if (KHP[i][i] > P[i][i]) {
+                if (!zeroRows[i] && KHP[i][i] > P[i][i]) {
                     healthyFusion = false;
                 }
             }
@@ -1789,6 +1811,9 @@ void NavEKF3_core::FuseBodyVel()
             if (healthyFusion) {
                 // update the covariance matrix
                 for (uint8_t i= 0; i<=stateIndexLim; i++) {
+                    if (zeroRows[i]) {
+                        continue;
+                    }
                     for (uint8_t j= 0; j<=stateIndexLim; j++) {
                         P[i][j] = P[i][j] - KHP[i][j];
                     }
@@ -310,6 +310,7 @@ void NavEKF3_core::InitialiseVariables()
     flowFusionActive = false;
     airSpdFusionDelayed = false;
     sideSlipFusionDelayed = false;
+    magFusionDelayed = false;
     posResetNE.zero();
     velResetNE.zero();
     posResetD = 0.0f;
@@ -566,6 +567,17 @@ bool NavEKF3_core::InitialiseFilterBootstrap(void)
     // initialise the covariance matrix
     CovarianceInit();
 
+    // restore states learned on a previous boot if the frontend holds
+    // a valid alignment cache for this IMU. This shortens the time to
+    // full navigation health after a quick battery swap. Never done in
+    // flight as a cache from a previous boot would be stale
+    if (!dal.get_armed()) {
+        Vector3f gyroBias, accelBias, earthMag, bodyMag;
+        if (frontend->loadAlignmentCache(core_index, gyro_index_active, gyroBias, accelBias, earthMag, bodyMag)) {
+            restoreAlignmentStates(gyroBias, accelBias, earthMag, bodyMag);
+        }
+    }
+
     // reset the output predictor states
     StoreOutputReset();
 
@@ -631,6 +643,36 @@ void NavEKF3_core::CovarianceInit()
 
 }
 
+// return the learned alignment states for the cross-boot alignment cache
+bool NavEKF3_core::getAlignmentStates(Vector3f &gyroBias, Vector3f &accelBias, Vector3f &earthMag, Vector3f &bodyMag) const
+{
+    if (!statesInitialised || dtEkfAvg < 1e-6f) {
+        return false;
+    }
+    gyroBias = stateStruct.gyro_bias / dtEkfAvg;
+    accelBias = stateStruct.accel_bias / dtEkfAvg;
+    earthMag = stateStruct.earth_magfield;
+    bodyMag = stateStruct.body_magfield;
+    return true;
+}
+
+// apply alignment states saved by a previous boot. The cached values
+// are close but not exact, so the matching covariance terms are set
+// well below their bootstrap values while leaving the filter enough
+// uncertainty to trim the residual error
+void NavEKF3_core::restoreAlignmentStates(const Vector3f &gyroBias, const Vector3f &accelBias, const Vector3f &earthMag, const Vector3f &bodyMag)
+{
+    stateStruct.gyro_bias = gyroBias * dtEkfAvg;
+    stateStruct.accel_bias = accelBias * dtEkfAvg;
+    stateStruct.earth_magfield = earthMag;
+    stateStruct.body_magfield = bodyMag;
+
+    // gyro delta angle biases
+    P[10][10] = P[11][11] = P[12][12] = sq(radians(0.1f * InitialGyroBiasUncertainty() * dtEkfAvg));
+    // delta velocity biases
+    P[13][13] = P[14][14] = P[15][15] = sq(0.1f * ACCEL_BIAS_LIM_SCALER * frontend->_accBiasLim * dtEkfAvg);
+}
+
 /********************************************************
 *                 UPDATE FUNCTIONS                      *
 ********************************************************/
@@ -1748,6 +1790,17 @@ void NavEKF3_core::StoreQuatRotate(const Quaternion &deltaQuat)
     outputDataDelayed.quat = outputDataDelayed.quat*deltaQuat;
 }
 
+// mark the rows of K*H*P that are structurally zero because the Kalman gain
+// for that state is exactly zero, typically because the state group is
+// inhibited. Subtracting those rows in the covariance update is a no-op, so
+// the fusion kernels skip them
+void NavEKF3_core::calcZeroGainRows(bool *zeroRows) const
+{
+    for (uint8_t i=0; i<=stateIndexLim; i++) {
+        zeroRows[i] = !(fabsf(Kfusion[i]) > 0.0f);
+    }
+}
+
 // force symmetry on the covariance matrix to prevent ill-conditioning
 void NavEKF3_core::ForceSymmetry()
 {
@@ -2069,3 +2122,51 @@ void NavEKF3_core::verifyTiltErrorVariance()
     }
 }
 #endif
+
+/*
+  snapshot support for Replay. The state vector and covariance matrix
+  are read and restored as a flat sequence of 6-float chunks so they
+  can be carried in fixed-size log messages. The output predictor and
+  observation buffers are not included; they re-converge from the
+  logged sensor data within the fusion time horizon after a restore
+ */
+uint16_t NavEKF3_core::getSnapshotNumChunks(void) const
+{
+    const uint16_t numFloats = 24 + 24*24;
+    return (numFloats + 5) / 6;
+}
+
+bool NavEKF3_core::getSnapshotChunk(uint16_t index, float data[6]) const
+{
+    const uint16_t numFloats = 24 + 24*24;
+    if (index * 6U >= numFloats) {
+        return false;
+    }
+    for (uint8_t j=0; j<6; j++) {
+        uint16_t k = index * 6U + j;
+        if (k < 24) {
+            data[j] = statesArray[k];
+        } else {
+            k -= 24;
+            data[j] = P[k / 24][k % 24];
+        }
+    }
+    return true;
+}
+
+void NavEKF3_core::restoreSnapshotChunk(uint16_t index, const float data[6])
+{
+    const uint16_t numFloats = 24 + 24*24;
+    if (index * 6U >= numFloats) {
+        return;
+    }
+    for (uint8_t j=0; j<6; j++) {
+        uint16_t k = index * 6U + j;
+        if (k < 24) {
+            statesArray[k] = data[j];
+        } else {
+            k -= 24;
+            P[k / 24][k % 24] = data[j];
+        }
+    }
+}
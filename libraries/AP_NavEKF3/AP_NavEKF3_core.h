@@ -367,6 +367,10 @@ public:
     // critical for use by other subsystems.
     uint8_t getIMUIndex(void) const { return gyro_index_active; }
 
+    // retrieve the learned alignment states for the cross-boot
+    // alignment cache. Returns false before the filter has initialised
+    bool getAlignmentStates(Vector3f &gyroBias, Vector3f &accelBias, Vector3f &earthMag, Vector3f &bodyMag) const;
+
     // values for EK3_MAG_CAL
     enum class MagCal {
         WHEN_FLYING = 0,
@@ -399,6 +403,13 @@ public:
 
     void Log_Write(uint64_t time_us);
 
+    // state snapshot support for Replay seek. The state vector and
+    // covariance matrix are exposed as a flat sequence of 6-float
+    // chunks that fit in fixed-size log messages
+    uint16_t getSnapshotNumChunks(void) const;
+    bool getSnapshotChunk(uint16_t index, float data[6]) const;
+    void restoreSnapshotChunk(uint16_t index, const float data[6]);
+
 private:
     EKFGSF_yaw *yawEstimator;
     AP_DAL &dal;
@@ -624,6 +635,12 @@ private:
     // force symmetry on the state covariance matrix
     void ForceSymmetry();
 
+    // mark the rows of K*H*P that are structurally zero because the
+    // Kalman gain for that state is exactly zero, typically because
+    // the state group is inhibited. Flagged rows can be skipped in
+    // the covariance update
+    void calcZeroGainRows(bool *zeroRows) const;
+
     // constrain variances (diagonal terms) in the state covariance matrix
     void ConstrainVariances();
 
@@ -1074,6 +1091,7 @@ private:
     bool optFlowFusionDelayed;      // true when the optical flow fusion has been delayed
     bool airSpdFusionDelayed;       // true when the air speed fusion has been delayed
     bool sideSlipFusionDelayed;     // true when the sideslip fusion has been delayed
+    bool magFusionDelayed;          // true when the magnetometer fusion has been delayed to avoid sharing a cycle with GPS fusion
     Vector3f lastMagOffsets;        // Last magnetometer offsets from COMPASS_ parameters. Used to detect parameter changes.
     bool lastMagOffsetsValid;       // True when lastMagOffsets has been initialized
     Vector2f posResetNE;            // Change in North/East position due to last in-flight reset in metres. Returned by getLastPosNorthEastReset
@@ -1417,6 +1435,10 @@ private:
     // vehicle specific initial gyro bias uncertainty
     float InitialGyroBiasUncertainty(void) const;
 
+    // apply alignment states saved by a previous boot, shrinking the
+    // matching covariance terms
+    void restoreAlignmentStates(const Vector3f &gyroBias, const Vector3f &accelBias, const Vector3f &earthMag, const Vector3f &bodyMag);
+
     /*
       learn magnetometer biases from GPS yaw. Return true if the
       resulting mag vector is close enough to the one predicted by GPS
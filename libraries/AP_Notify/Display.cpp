@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <AP_GPS/AP_GPS.h>
 #include <AP_BattMonitor/AP_BattMonitor.h>
+#include <AP_Math/crc.h>
 
 #include <utility>
 
@@ -390,13 +391,59 @@ void Display::update()
     if (_screenpage != 2) {
         _driver->clear_screen(); //once clear screen when page changed
         _screenpage = 2;
+        _last_signature_valid = false;
     }
 
+    // skip the re-render and frame transfer when nothing on the page
+    // has changed; the signature includes the ticker state so a
+    // scrolling message still animates
+    const uint32_t signature = content_signature();
+    if (_last_signature_valid && signature == _last_signature) {
+        return;
+    }
+    _last_signature = signature;
+    _last_signature_valid = true;
+
     update_all();
     _driver->hw_update(); //update at 2 Hz in disarmed mode
 
 }
 
+// build a signature over everything drawn on the disarmed status
+// page. Any change in the inputs changes the signature, triggering a
+// redraw on the next update
+uint32_t Display::content_signature() const
+{
+    const AP_BattMonitor &battery = AP::battery();
+    struct PACKED {
+        uint8_t pre_arm_check;
+        uint8_t gps_status;
+        uint8_t gps_num_sats;
+        uint8_t ekf_bad;
+        int32_t battery_cv;   // centi-volts, the displayed resolution
+        uint8_t battery_pct;
+        char mode_str[5];
+        char text[NOTIFY_TEXT_BUFFER_SIZE];
+        uint8_t text_valid;
+        uint8_t mstartpos;
+        uint8_t movedelay;
+    } content {};
+
+    content.pre_arm_check = AP_Notify::flags.pre_arm_check;
+    content.gps_status = AP_Notify::flags.gps_status;
+    content.gps_num_sats = AP_Notify::flags.gps_num_sats;
+    content.ekf_bad = AP_Notify::flags.ekf_bad;
+    content.battery_cv = battery.voltage() * 100;
+    content.battery_pct = battery.capacity_remaining_pct();
+    strncpy(content.mode_str, pNotify->get_flight_mode_str(), sizeof(content.mode_str)-1);
+    strncpy(content.text, pNotify->get_text(), sizeof(content.text)-1);
+    content.text_valid = AP_HAL::millis() - pNotify->get_text_updated_millis() < _send_text_valid_millis;
+    content.mstartpos = _mstartpos;
+    content.movedelay = _movedelay;
+
+    return crc_crc32(0, (const uint8_t *)&content, sizeof(content));
+}
+
 void Display::update_all()
 {
     update_text(0);
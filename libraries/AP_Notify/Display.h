@@ -30,12 +30,19 @@ private:
     void update_text(uint8_t r);
     void update_text_empty(uint8_t r);
 
+    // signature of everything drawn on the disarmed status page, used
+    // to skip re-rendering and transferring unchanged frames
+    uint32_t content_signature() const;
+
     Display_Backend *_driver;
 
     uint8_t _mstartpos; // ticker shift position
     uint8_t _movedelay; // ticker delay before shifting after new message displayed
     uint8_t _screenpage;
 
+    uint32_t _last_signature;
+    bool _last_signature_valid;
+
     // stop showing text in display after this many millis:
     const uint16_t _send_text_valid_millis = 20000;
 };
@@ -23,6 +23,7 @@
 #include <AP_HAL/Semaphores.h>
 #include <AP_HAL/Scheduler.h>
 #include <AP_Filesystem/AP_Filesystem.h>
+#include <AP_Math/crc.h>
 #include <GCS_MAVLink/GCS.h>
 
 #include <utility>
@@ -117,11 +118,22 @@
 
 // time to check video signal format
 #define VIDEO_SIGNAL_CHECK_INTERVAL_MS 1000
+// time between polls of VM0 for chip stall/reboot detection. Polling
+// on every flush wastes SPI bus time shared with other sensors
+#define VIDEO_STALL_CHECK_INTERVAL_MS 200
 //time to wait for input to stabilize
 #define VIDEO_SIGNAL_DEBOUNCE_MS 100
 //time to wait nvm flash complete
 #define MAX_NVM_WAIT 10000
 
+// microSD file caching the CRC of the charset last written to NVM;
+// avoids 256 verification reads on every boot
+#define FONT_CRC_FILENAME "max7456_font.crc"
+
+// maximum number of unchanged characters to retransmit in order to keep
+// an autoincrement run going, see transfer_frame()
+#define MAX_AUTOINCREMENT_GAP 4
+
 //black and white level
 #ifndef WHITEBRIGHTNESS
 #define WHITEBRIGHTNESS 0x01
@@ -153,41 +165,105 @@ bool AP_OSD_MAX7456::init()
     if (status != 0) {
         return false;
     }
-    return update_font();
+    // the font upload runs incrementally from flush() so a charset
+    // update does not stall vehicle init, see font_update_tick()
+    return start_font_update();
 }
 
-bool AP_OSD_MAX7456::update_font()
+/*
+  begin an incremental font upload. Returns false if the font could
+  not be loaded. When the cached charset CRC matches the new font the
+  NVM is already up to date and both the upload and the per-character
+  verification reads are skipped entirely
+ */
+bool AP_OSD_MAX7456::start_font_update()
 {
-    uint8_t updated_chars = 0;
+    if (font_fd != nullptr) {
+        delete font_fd;
+        font_fd = nullptr;
+    }
+    font_update_active = false;
     last_font = get_font_num();
     FileData *fd = load_font_data(last_font);
 
     if (fd == nullptr) {
         return false;
     }
-
-    const uint8_t *font_data = fd->data;
-    uint32_t font_size = fd->length;
-    if (font_size != NVM_RAM_SIZE * 256) {
-        GCS_SEND_TEXT(MAV_SEVERITY_ERROR, "AP_OSD: bad font size %u\n", unsigned(font_size));
+    if (fd->length != NVM_RAM_SIZE * 256) {
+        GCS_SEND_TEXT(MAV_SEVERITY_ERROR, "AP_OSD: bad font size %u\n", unsigned(fd->length));
         delete fd;
         return false;
     }
+    font_crc = crc_crc32(0, fd->data, fd->length);
+    if (font_crc_is_cached(font_crc)) {
+        delete fd;
+        return true;
+    }
+    font_fd = fd;
+    font_next_chr = 0;
+    font_update_active = true;
+    return true;
+}
 
-    for (uint16_t chr=0; chr < 256; chr++) {
-        const uint8_t* chr_font_data = font_data + chr*NVM_RAM_SIZE;
+/*
+  upload the next few characters of the charset. Called from flush()
+  at OSD refresh rate; the display only comes up once the whole
+  charset is in NVM so a partially written font is never shown
+ */
+void AP_OSD_MAX7456::font_update_tick()
+{
+    const uint8_t *font_data = font_fd->data;
+    for (uint8_t n = 0; n < font_chars_per_tick && font_next_chr < 256; n++) {
+        const uint8_t* chr_font_data = font_data + font_next_chr*NVM_RAM_SIZE;
         //check if char already up to date
-        if (!check_font_char(chr, chr_font_data)) {
+        if (!check_font_char(font_next_chr, chr_font_data)) {
             //update char inside max7456 NVM
-            if (!update_font_char(chr, chr_font_data)) {
-                delete fd;
-                return false;
+            if (!update_font_char(font_next_chr, chr_font_data)) {
+                // NVM write failed; give up and leave the old charset in place
+                GCS_SEND_TEXT(MAV_SEVERITY_ERROR, "AP_OSD: font update failed at char %u", unsigned(font_next_chr));
+                finish_font_update(false);
+                return;
             }
-            updated_chars++;
         }
+        font_next_chr++;
+    }
+    if (font_next_chr >= 256) {
+        finish_font_update(true);
     }
-    delete fd;
-    return true;
+}
+
+void AP_OSD_MAX7456::finish_font_update(bool save_crc)
+{
+    if (save_crc) {
+        save_font_crc(font_crc);
+    }
+    delete font_fd;
+    font_fd = nullptr;
+    font_update_active = false;
+}
+
+// return true when the cached CRC from the last completed upload
+// matches the given charset CRC
+bool AP_OSD_MAX7456::font_crc_is_cached(uint32_t crc) const
+{
+    int fd = AP::FS().open(FONT_CRC_FILENAME, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    uint32_t cached = 0;
+    const bool ok = AP::FS().read(fd, &cached, sizeof(cached)) == sizeof(cached);
+    AP::FS().close(fd);
+    return ok && cached == crc;
+}
+
+void AP_OSD_MAX7456::save_font_crc(uint32_t crc) const
+{
+    int fd = AP::FS().open(FONT_CRC_FILENAME, O_WRONLY|O_CREAT|O_TRUNC);
+    if (fd < 0) {
+        return;
+    }
+    AP::FS().write(fd, &crc, sizeof(crc));
+    AP::FS().close(fd);
 }
 
 //compare char chr inside MAX7456 NVM with font_data
@@ -275,13 +351,20 @@ void AP_OSD_MAX7456::buffer_add_cmd(uint8_t reg, uint8_t arg)
 //Thanks to betaflight for the max stall/reboot detection approach and ntsc/pal autodetection
 void AP_OSD_MAX7456::check_reinit()
 {
+    uint32_t now = AP_HAL::millis();
+
+    // rate limit the register reads; the bus is often shared with an
+    // IMU and the checks don't need to run on every flush
+    if ((now - last_stall_check) < VIDEO_STALL_CHECK_INTERVAL_MS) {
+        return;
+    }
+    last_stall_check = now;
+
     uint8_t check = 0xFF;
     _dev->get_semaphore()->take_blocking();
 
     _dev->read_registers(MAX7456ADD_VM0|MAX7456ADD_READ, &check, 1);
 
-    uint32_t now = AP_HAL::millis();
-
     // Stall check
     if (check != video_signal_reg) {
         reinit();
@@ -359,7 +442,13 @@ void AP_OSD_MAX7456::reinit()
 void AP_OSD_MAX7456::flush()
 {
     if (last_font != get_font_num()) {
-        update_font();
+        start_font_update();
+    }
+
+    if (font_update_active) {
+        // keep streaming the charset, a few characters per refresh
+        font_update_tick();
+        return;
     }
 
     // check for offset changes
@@ -405,6 +494,19 @@ void AP_OSD_MAX7456::transfer_frame()
             uint16_t pos = y * video_columns + x;
             bool position_changed = ((previous_pos + 1) != pos);
 
+            if (position_changed && autoincrement) {
+                // bridge small gaps between dirty runs by re-sending the
+                // unchanged characters: staying in autoincrement costs 2
+                // bytes per cell while exiting and re-addressing costs 10
+                const uint16_t gap = pos - previous_pos - 1;
+                if (gap <= MAX_AUTOINCREMENT_GAP && can_fill_gap(previous_pos + 1, gap)) {
+                    for (uint16_t p = previous_pos + 1; p < pos; p++) {
+                        buffer_add_cmd(MAX7456ADD_DMDI, frame[p / video_columns][p % video_columns]);
+                    }
+                    position_changed = false;
+                }
+            }
+
             if (position_changed && autoincrement) {
                 //it is impossible to write to MAX7456ADD_DMAH/MAX7456ADD_DMAL in autoincrement mode
                 //so, exit autoincrement mode
@@ -441,6 +543,18 @@ void AP_OSD_MAX7456::transfer_frame()
     }
 }
 
+// check that a span of unchanged characters can be re-sent in
+// autoincrement mode. 0xFF is the escape character and cannot be written
+bool AP_OSD_MAX7456::can_fill_gap(uint16_t pos, uint16_t count) const
+{
+    for (uint16_t p = pos; p < pos + count; p++) {
+        if (frame[p / video_columns][p % video_columns] == 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool AP_OSD_MAX7456::is_dirty(uint8_t x, uint8_t y)
 {
     if (y>=video_lines || x>=video_columns) {
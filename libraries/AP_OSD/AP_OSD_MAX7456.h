@@ -48,7 +48,15 @@ private:
 
     void buffer_add_cmd(uint8_t reg, uint8_t arg);
 
-    bool update_font();
+    bool start_font_update();
+
+    void font_update_tick();
+
+    void finish_font_update(bool save_crc);
+
+    bool font_crc_is_cached(uint32_t crc) const;
+
+    void save_font_crc(uint32_t crc) const;
 
     bool check_font_char(uint8_t chr, const uint8_t* font_data);
 
@@ -62,6 +70,8 @@ private:
 
     bool is_dirty(uint8_t x, uint8_t y);
 
+    bool can_fill_gap(uint16_t pos, uint16_t count) const;
+
     AP_HAL::OwnPtr<AP_HAL::Device> _dev;
 
     uint8_t  video_signal_reg;
@@ -85,8 +95,18 @@ private:
     int buffer_offset;
 
     uint32_t last_signal_check;
+    uint32_t last_stall_check;
     uint32_t video_detect_time;
 
+    // incremental font upload state, see font_update_tick()
+    FileData *font_fd;
+    uint16_t font_next_chr;
+    uint32_t font_crc;
+    bool font_update_active;
+
+    // characters uploaded per flush() while a font update is active
+    static const uint8_t font_chars_per_tick = 8;
+
     uint16_t video_lines;
 };
 #endif // HAL_WITH_OSD_BITMAP
@@ -88,6 +88,43 @@ void AP_OpticalFlow_CXOF::init()
     last_frame_us = AP_HAL::micros();
 }
 
+// parse one byte from the sensor, accumulating decoded frames into the sums
+void AP_OpticalFlow_CXOF::parse_byte(uint8_t c, int32_t &x_sum, int32_t &y_sum, uint16_t &qual_sum, uint16_t &count)
+{
+    // if buffer is empty and this byte is header, add to buffer
+    if (buf_len == 0) {
+        if (c == CXOF_HEADER) {
+            buf[buf_len++] = c;
+        }
+        return;
+    }
+
+    // add character to buffer
+    buf[buf_len++] = c;
+
+    // if buffer has 9 items try to decode it
+    if (buf_len >= CXOF_FRAME_LENGTH) {
+        // check last character matches footer
+        if (buf[buf_len-1] != CXOF_FOOTER) {
+            buf_len = 0;
+            return;
+        }
+
+        // decode package
+        int16_t x_raw = (int16_t)((uint16_t)buf[3] << 8) | buf[2];
+        int16_t y_raw = (int16_t)((uint16_t)buf[5] << 8) | buf[4];
+
+        // add to sum of all readings from sensor this iteration
+        count++;
+        x_sum += x_raw;
+        y_sum += y_raw;
+        qual_sum += buf[7];
+
+        // clear buffer
+        buf_len = 0;
+    }
+}
+
 // read latest values from sensor and fill in x,y and totals.
 void AP_OpticalFlow_CXOF::update(void)
 {
@@ -111,45 +148,31 @@ void AP_OpticalFlow_CXOF::update(void)
     uint16_t qual_sum = 0;
     uint16_t count = 0;
 
-    // read any available characters in the serial buffer
+    // parse in blocks using the zero-copy uart API where the port
+    // supports it
+    uint32_t pending = uart->available();
+    while (pending > 0) {
+        uint32_t peek_len;
+        const uint8_t *block = uart->read_peek(peek_len);
+        if (block == nullptr || peek_len == 0) {
+            break;
+        }
+        const uint32_t n = MIN(peek_len, pending);
+        for (uint32_t i = 0; i < n; i++) {
+            parse_byte(block[i], x_sum, y_sum, qual_sum, count);
+        }
+        uart->read_consume(n);
+        pending -= n;
+    }
+
+    // fall back to per-byte reads for ports without read_peek()
     int16_t nbytes = uart->available();
     while (nbytes-- > 0) {
         int16_t r = uart->read();
         if (r < 0) {
             continue;
         }
-        uint8_t c = (uint8_t)r;
-        // if buffer is empty and this byte is header, add to buffer
-        if (buf_len == 0) {
-            if (c == CXOF_HEADER) {
-                buf[buf_len++] = c;
-            }
-        } else {
-            // add character to buffer
-            buf[buf_len++] = c;
-
-            // if buffer has 9 items try to decode it
-            if (buf_len >= CXOF_FRAME_LENGTH) {
-                // check last character matches footer
-                if (buf[buf_len-1] != CXOF_FOOTER) {
-                    buf_len = 0;
-                    continue;
-                }
-
-                // decode package
-                int16_t x_raw = (int16_t)((uint16_t)buf[3] << 8) | buf[2];
-                int16_t y_raw = (int16_t)((uint16_t)buf[5] << 8) | buf[4];
-
-                // add to sum of all readings from sensor this iteration
-                count++;
-                x_sum += x_raw;
-                y_sum += y_raw;
-                qual_sum += buf[7];
-
-                // clear buffer
-                buf_len = 0;
-            }
-        }
+        parse_byte((uint8_t)r, x_sum, y_sum, qual_sum, count);
     }
 
     // return without updating state if no readings
@@ -20,6 +20,9 @@ public:
 
 private:
 
+    // parse one byte from the sensor, accumulating decoded frames into the sums
+    void parse_byte(uint8_t c, int32_t &x_sum, int32_t &y_sum, uint16_t &qual_sum, uint16_t &count);
+
     AP_HAL::UARTDriver *uart;           // uart connected to flow sensor
     uint64_t last_frame_us;             // system time of last message from flow sensor
     uint8_t buf[10];                    // buff of characters received from flow sensor
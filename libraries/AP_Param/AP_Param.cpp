@@ -24,9 +24,11 @@
 #include "AP_Param.h"
 
 #include <cmath>
+#include <stdlib.h>
 #include <string.h>
 
 #include <AP_Common/AP_Common.h>
+#include <AP_Common/ExpandingString.h>
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Math/AP_Math.h>
 #include <GCS_MAVLink/GCS.h>
@@ -84,6 +86,29 @@ HAL_Semaphore AP_Param::_count_sem;
 // storage and naming information about all types that can be saved
 const AP_Param::Info *AP_Param::_var_info;
 
+// sorted-by-name parameter index for fast find()
+struct AP_Param::param_index_entry *AP_Param::_param_index;
+uint16_t AP_Param::_param_index_count;
+uint16_t AP_Param::_param_index_marker;
+
+// in-RAM map from parameter header to storage offset
+uint32_t *AP_Param::_scan_map_ids;
+uint16_t *AP_Param::_scan_map_ofs;
+uint16_t AP_Param::_scan_map_size;
+uint16_t AP_Param::_scan_map_used;
+bool AP_Param::_scan_map_valid;
+bool AP_Param::_scan_map_failed;
+HAL_Semaphore AP_Param::_scan_map_sem;
+
+// ring of recent parameter changes for @SYS/param_journal.txt
+struct AP_Param::journal_entry AP_Param::_journal[AP_Param::_journal_size];
+uint32_t AP_Param::_journal_seq;
+HAL_Semaphore AP_Param::_journal_sem;
+
+// direct map from storage key to _var_info[] index
+uint16_t *AP_Param::_key_vindex_map;
+bool AP_Param::_key_vindex_failed;
+
 struct AP_Param::param_override *AP_Param::param_overrides = nullptr;
 uint16_t AP_Param::num_param_overrides = 0;
 uint16_t AP_Param::num_read_only = 0;
@@ -143,6 +168,12 @@ void AP_Param::erase_all(void)
 {
     struct EEPROM_header hdr;
 
+    // any cached storage offsets are now meaningless
+    {
+        WITH_SEMAPHORE(_scan_map_sem);
+        _scan_map_valid = false;
+    }
+
     // write the header
     hdr.magic[0] = k_EEPROM_magic0;
     hdr.magic[1] = k_EEPROM_magic1;
@@ -466,34 +497,81 @@ const struct AP_Param::Info *AP_Param::find_by_header_group(struct Param_header
     return nullptr;
 }
 
+// check a single _var_info[] entry against a storage header. Keys are
+// unique (enforced by check_var_info) so only the entry owning the key
+// can ever match
+const struct AP_Param::Info *AP_Param::find_by_header_vindex(struct Param_header phdr, void **ptr, uint16_t vindex)
+{
+    uint8_t type = _var_info[vindex].type;
+    if (type == AP_PARAM_GROUP) {
+        const struct GroupInfo *group_info = get_group_info(_var_info[vindex]);
+        if (group_info == nullptr) {
+            return nullptr;
+        }
+        return find_by_header_group(phdr, ptr, vindex, group_info, 0, 0, 0);
+    }
+    if (type == phdr.type) {
+        // found it
+        ptrdiff_t base;
+        if (!get_base(_var_info[vindex], base)) {
+            return nullptr;
+        }
+        *ptr = (void*)base;
+        return &_var_info[vindex];
+    }
+    return nullptr;
+}
+
+/*
+  map a storage key to its _var_info[] index, building the map on first
+  use. The keys fit in 9 bits and _var_info is fixed after
+  set_var_info(), so a small direct-indexed table built once is enough.
+  Returns false on a miss or if the table could not be allocated
+ */
+bool AP_Param::key_vindex_lookup(uint16_t key, uint16_t &vindex)
+{
+    if (_key_vindex_map == nullptr) {
+        if (_key_vindex_failed) {
+            return false;
+        }
+        uint16_t *map = new uint16_t[_sentinal_key+1];
+        if (map == nullptr) {
+            _key_vindex_failed = true;
+            return false;
+        }
+        memset(map, 0xFF, (_sentinal_key+1) * sizeof(map[0]));
+        for (uint16_t i=0; i<_num_vars; i++) {
+            map[_var_info[i].key & _sentinal_key] = i;
+        }
+        _key_vindex_map = map;
+    }
+    if (key > _sentinal_key || _key_vindex_map[key] == 0xFFFF) {
+        return false;
+    }
+    vindex = _key_vindex_map[key];
+    return true;
+}
+
 // find the info structure given a header
 // return the Info structure and a pointer to the variables storage
 const struct AP_Param::Info *AP_Param::find_by_header(struct Param_header phdr, void **ptr)
 {
-    // loop over all named variables
+    uint16_t vindex;
+    if (key_vindex_lookup(get_key(phdr), vindex)) {
+        return find_by_header_vindex(phdr, ptr, vindex);
+    }
+    if (_key_vindex_map != nullptr) {
+        // the map is authoritative once built - no variable owns this key
+        return nullptr;
+    }
+    // the map could not be allocated - fall back to a linear search
+    // over all named variables
     for (uint16_t i=0; i<_num_vars; i++) {
-        uint8_t type = _var_info[i].type;
-        uint16_t key = _var_info[i].key;
-        if (key != get_key(phdr)) {
+        if (_var_info[i].key != get_key(phdr)) {
             // not the right key
             continue;
         }
-        if (type == AP_PARAM_GROUP) {
-            const struct GroupInfo *group_info = get_group_info(_var_info[i]);
-            if (group_info == nullptr) {
-                continue;
-            }
-            return find_by_header_group(phdr, ptr, i, group_info, 0, 0, 0);
-        }
-        if (type == phdr.type) {
-            // found it
-            ptrdiff_t base;
-            if (!get_base(_var_info[i], base)) {
-                return nullptr;
-            }
-            *ptr = (void*)base;
-            return &_var_info[i];
-        }
+        return find_by_header_vindex(phdr, ptr, i);
     }
     return nullptr;
 }
@@ -718,9 +796,142 @@ bool AP_Param::is_sentinal(const Param_header &phdr)
 // the variable is stored
 // if not found return the offset of the sentinal
 // if the sentinal isn't found either, the offset is set to 0xFFFF
+/*
+  map key for a storage record. Param_header packs key, type and
+  group_element into exactly 32 bits, so the raw header is its own
+  unique id. 0xFFFFFFFF marks an empty hash slot; a real header with
+  that value would carry the sentinal key and is never inserted
+ */
+uint32_t AP_Param::scan_map_id(const struct Param_header &phdr)
+{
+    uint32_t id;
+    memcpy(&id, &phdr, sizeof(id));
+    return id;
+}
+
+// clear the map ready for a rebuild. Must be called with
+// _scan_map_sem held
+void AP_Param::scan_map_reset(void)
+{
+    if (_scan_map_ids != nullptr) {
+        memset(_scan_map_ids, 0xFF, _scan_map_size * sizeof(_scan_map_ids[0]));
+    }
+    _scan_map_used = 0;
+    _scan_map_valid = false;
+}
+
+// look a header up in the map. Must be called with _scan_map_sem held
+bool AP_Param::scan_map_lookup(const struct Param_header &phdr, uint16_t &ofs)
+{
+    if (_scan_map_size == 0) {
+        return false;
+    }
+    const uint32_t id = scan_map_id(phdr);
+    const uint16_t mask = _scan_map_size - 1;
+    uint16_t slot = (id * 2654435769UL) & mask;
+    while (_scan_map_ids[slot] != 0xFFFFFFFF) {
+        if (_scan_map_ids[slot] == id) {
+            ofs = _scan_map_ofs[slot];
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+/*
+  insert a header into the map, growing it as needed. Returns false on
+  allocation failure, in which case the map is abandoned and scans
+  fall back to walking storage. Must be called with _scan_map_sem held
+ */
+bool AP_Param::scan_map_insert(const struct Param_header &phdr, uint16_t ofs)
+{
+    if (_scan_map_failed) {
+        return false;
+    }
+    if (_scan_map_used + (_scan_map_used/2) >= _scan_map_size) {
+        // grow to keep the load factor below 2/3
+        const uint16_t new_size = _scan_map_size == 0 ? 64 : _scan_map_size * 2;
+        uint32_t *new_ids = new uint32_t[new_size];
+        uint16_t *new_ofs = new uint16_t[new_size];
+        if (new_ids == nullptr || new_ofs == nullptr) {
+            delete[] new_ids;
+            delete[] new_ofs;
+            delete[] _scan_map_ids;
+            delete[] _scan_map_ofs;
+            _scan_map_ids = nullptr;
+            _scan_map_ofs = nullptr;
+            _scan_map_size = 0;
+            _scan_map_used = 0;
+            _scan_map_failed = true;
+            return false;
+        }
+        memset(new_ids, 0xFF, new_size * sizeof(new_ids[0]));
+        const uint16_t new_mask = new_size - 1;
+        for (uint16_t i=0; i<_scan_map_size; i++) {
+            if (_scan_map_ids[i] == 0xFFFFFFFF) {
+                continue;
+            }
+            uint16_t slot = (_scan_map_ids[i] * 2654435769UL) & new_mask;
+            while (new_ids[slot] != 0xFFFFFFFF) {
+                slot = (slot + 1) & new_mask;
+            }
+            new_ids[slot] = _scan_map_ids[i];
+            new_ofs[slot] = _scan_map_ofs[i];
+        }
+        delete[] _scan_map_ids;
+        delete[] _scan_map_ofs;
+        _scan_map_ids = new_ids;
+        _scan_map_ofs = new_ofs;
+        _scan_map_size = new_size;
+    }
+    const uint32_t id = scan_map_id(phdr);
+    const uint16_t mask = _scan_map_size - 1;
+    uint16_t slot = (id * 2654435769UL) & mask;
+    while (_scan_map_ids[slot] != 0xFFFFFFFF) {
+        if (_scan_map_ids[slot] == id) {
+            // already present, refresh the offset
+            _scan_map_ofs[slot] = ofs;
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    _scan_map_ids[slot] = id;
+    _scan_map_ofs[slot] = ofs;
+    _scan_map_used++;
+    return true;
+}
+
 bool AP_Param::scan(const AP_Param::Param_header *target, uint16_t *pofs)
 {
     struct Param_header phdr;
+
+    WITH_SEMAPHORE(_scan_map_sem);
+    if (_scan_map_valid) {
+        uint16_t map_ofs;
+        if (scan_map_lookup(*target, map_ofs)) {
+            *pofs = map_ofs;
+            return true;
+        }
+        // not in the map, so not in storage, and the append position
+        // is the cached sentinal. Verify it to guard against the map
+        // having gone stale
+        _storage.read_block(&phdr, sentinal_offset, sizeof(phdr));
+        if (is_sentinal(phdr)) {
+            *pofs = sentinal_offset;
+            return false;
+        }
+        _scan_map_valid = false;
+    }
+
+    // walk storage, building the map as a side effect so later saves
+    // are a hash lookup rather than a scan
+    bool building = !_scan_map_failed;
+    if (building) {
+        scan_map_reset();
+    }
+    bool found = false;
+    uint16_t found_ofs = 0;
     uint16_t ofs = sizeof(AP_Param::EEPROM_header);
     while (ofs < _storage.size()) {
         _storage.read_block(&phdr, ofs, sizeof(phdr));
@@ -728,17 +939,36 @@ bool AP_Param::scan(const AP_Param::Param_header *target, uint16_t *pofs)
             get_key(phdr) == get_key(*target) &&
             phdr.group_element == target->group_element) {
             // found it
-            *pofs = ofs;
-            return true;
+            if (!building) {
+                *pofs = ofs;
+                return true;
+            }
+            // keep walking so the map covers the whole of storage
+            found = true;
+            found_ofs = ofs;
         }
         if (is_sentinal(phdr)) {
             // we've reached the sentinal
-            *pofs = ofs;
             sentinal_offset = ofs;
+            if (building) {
+                _scan_map_valid = true;
+            }
+            if (found) {
+                *pofs = found_ofs;
+                return true;
+            }
+            *pofs = ofs;
             return false;
         }
+        if (building && !scan_map_insert(phdr, ofs)) {
+            building = false;
+        }
         ofs += type_size((enum ap_var_type)phdr.type) + sizeof(phdr);
     }
+    if (found) {
+        *pofs = found_ofs;
+        return true;
+    }
     *pofs = 0xffff;
     Debug("scan past end of eeprom");
     return false;
@@ -870,11 +1100,129 @@ AP_Param::find_group(const char *name, uint16_t vindex, ptrdiff_t group_offset,
 }
 
 
+/*
+  comparison function for sorting the parameter index by name
+ */
+int AP_Param::compare_param_index_entry(const void *a, const void *b)
+{
+    const struct param_index_entry &ea = *(const struct param_index_entry *)a;
+    const struct param_index_entry &eb = *(const struct param_index_entry *)b;
+    char name_a[AP_MAX_NAME_SIZE+1];
+    char name_b[AP_MAX_NAME_SIZE+1];
+    ea.ap->copy_name_token(ea.token, name_a, sizeof(name_a), true);
+    eb.ap->copy_name_token(eb.token, name_b, sizeof(name_b), true);
+    return strcasecmp(name_a, name_b);
+}
+
+/*
+  build the sorted-by-name parameter index if it is missing or stale.
+  Returns true if the index is usable. Must be called with _count_sem
+  held
+ */
+bool AP_Param::check_param_index(void)
+{
+    if (_param_index != nullptr && _param_index_marker == _count_marker) {
+        return true;
+    }
+    const uint16_t marker = _count_marker;
+
+    ParamToken token {};
+    enum ap_var_type type;
+    uint16_t count = 0;
+    for (AP_Param *ap = first(&token, &type);
+         ap != nullptr;
+         ap = next_scalar(&token, &type)) {
+        count++;
+    }
+
+    if (_param_index == nullptr || _param_index_count != count) {
+        delete[] _param_index;
+        _param_index = new param_index_entry[count];
+        if (_param_index == nullptr) {
+            // not enough memory for the index; callers fall back to a
+            // linear search until the marker next changes
+            _param_index_count = 0;
+            _param_index_marker = marker;
+            return false;
+        }
+        _param_index_count = count;
+    }
+
+    token = {};
+    uint16_t n = 0;
+    for (AP_Param *ap = first(&token, &type);
+         ap != nullptr && n < _param_index_count;
+         ap = next_scalar(&token, &type)) {
+        _param_index[n].ap = ap;
+        _param_index[n].token = token;
+        _param_index[n].type = (uint8_t)type;
+        n++;
+    }
+    _param_index_count = n;
+
+    qsort(_param_index, _param_index_count, sizeof(_param_index[0]), compare_param_index_entry);
+
+    _param_index_marker = marker;
+    return true;
+}
+
+/*
+  look a name up in the sorted parameter index. Returns nullptr if the
+  name is not in the index; the caller then falls back to a linear
+  search, which also finds names the scalar index does not carry such
+  as the base name of a Vector3f
+ */
+AP_Param *AP_Param::find_indexed(const char *name, enum ap_var_type *ptype,
+                                 uint16_t *flags, ParamToken *token)
+{
+    WITH_SEMAPHORE(_count_sem);
+    if (!check_param_index()) {
+        return nullptr;
+    }
+    int32_t low = 0;
+    int32_t high = (int32_t)_param_index_count - 1;
+    while (low <= high) {
+        const int32_t mid = (low + high) / 2;
+        const struct param_index_entry &e = _param_index[mid];
+        char mid_name[AP_MAX_NAME_SIZE+1];
+        e.ap->copy_name_token(e.token, mid_name, sizeof(mid_name), true);
+        const int cmp = strcasecmp(name, mid_name);
+        if (cmp == 0) {
+            *ptype = (enum ap_var_type)e.type;
+            if (token != nullptr) {
+                *token = e.token;
+            }
+            if (flags != nullptr) {
+                uint32_t group_element = 0;
+                const struct GroupInfo *ginfo;
+                struct GroupNesting group_nesting {};
+                uint8_t idx;
+                e.ap->find_var_info(&group_element, ginfo, group_nesting, &idx);
+                if (ginfo != nullptr) {
+                    *flags = ginfo->flags;
+                }
+            }
+            return e.ap;
+        }
+        if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return nullptr;
+}
+
 // Find a variable by name.
 //
 AP_Param *
 AP_Param::find(const char *name, enum ap_var_type *ptype, uint16_t *flags)
 {
+    // fast path: look the name up in the sorted index
+    AP_Param *ap_indexed = find_indexed(name, ptype, flags, nullptr);
+    if (ap_indexed != nullptr) {
+        return ap_indexed;
+    }
     for (uint16_t i=0; i<_num_vars; i++) {
         uint8_t type = _var_info[i].type;
         if (type == AP_PARAM_GROUP) {
@@ -933,6 +1281,11 @@ AP_Param::find_by_index(uint16_t idx, enum ap_var_type *ptype, ParamToken *token
 // by-name equivalent of find_by_index()
 AP_Param* AP_Param::find_by_name(const char* name, enum ap_var_type *ptype, ParamToken *token)
 {
+    // fast path: the sorted index carries the token for each scalar
+    AP_Param *ap_indexed = find_indexed(name, ptype, nullptr, token);
+    if (ap_indexed != nullptr) {
+        return ap_indexed;
+    }
     AP_Param *ap;
     uint16_t count = 0;
     for (ap = AP_Param::first(token, ptype);
@@ -1170,6 +1523,14 @@ void AP_Param::save_sync(bool force_save)
     eeprom_write_check(ap, ofs+sizeof(phdr), type_size((enum ap_var_type)phdr.type));
     eeprom_write_check(&phdr, ofs, sizeof(phdr));
 
+    // keep the scan map in step with the new record
+    {
+        WITH_SEMAPHORE(_scan_map_sem);
+        if (_scan_map_valid && !scan_map_insert(phdr, ofs)) {
+            _scan_map_valid = false;
+        }
+    }
+
     send_parameter(name, (enum ap_var_type)phdr.type, idx);
 }
 
@@ -2348,6 +2709,38 @@ float AP_Param::get_default_value(const AP_Param *vp, const float *def_value_ptr
 }
 
 
+/*
+  append a change to the parameter journal. Called from both the main
+  thread (notify) and the IO thread (save_sync) so it takes a lock
+ */
+void AP_Param::journal_append(const char *name, float value)
+{
+    WITH_SEMAPHORE(_journal_sem);
+    struct journal_entry &e = _journal[_journal_seq % _journal_size];
+    _journal_seq++;
+    e.seq = _journal_seq;
+    e.time_ms = AP_HAL::millis();
+    e.value = value;
+    strncpy(e.name, name, AP_MAX_NAME_SIZE);
+    e.name[AP_MAX_NAME_SIZE] = 0;
+}
+
+/*
+  dump the parameter change journal, oldest first. A client remembers
+  the last sequence number it saw; a gap larger than the ring means it
+  missed changes and should re-fetch the parameters it cares about
+ */
+void AP_Param::journal_info(ExpandingString &str)
+{
+    WITH_SEMAPHORE(_journal_sem);
+    str.printf("ParamJournal v1 seq=%u\n", unsigned(_journal_seq));
+    const uint32_t count = MIN(_journal_seq, uint32_t(_journal_size));
+    for (uint32_t i = _journal_seq - count; i < _journal_seq; i++) {
+        const struct journal_entry &e = _journal[i % _journal_size];
+        str.printf("%u %u %s %.6f\n", unsigned(e.seq), unsigned(e.time_ms), e.name, double(e.value));
+    }
+}
+
 void AP_Param::send_parameter(const char *name, enum ap_var_type var_type, uint8_t idx) const
 {
     if (idx != 0 && var_type == AP_PARAM_VECTOR3F) {
@@ -2359,7 +2752,9 @@ void AP_Param::send_parameter(const char *name, enum ap_var_type var_type, uint8
     }
     if (var_type != AP_PARAM_VECTOR3F) {
         // nice and simple for scalar types
-        GCS_SEND_PARAM(name, var_type, cast_to_float(var_type));
+        const float v = cast_to_float(var_type);
+        journal_append(name, v);
+        GCS_SEND_PARAM(name, var_type, v);
         return;
     }
 
@@ -2375,10 +2770,13 @@ void AP_Param::send_parameter(const char *name, enum ap_var_type var_type, uint8
     char &name_axis = name2[strlen(name)-1];
     
     name_axis = 'X';
+    journal_append(name2, v.x);
     GCS_SEND_PARAM(name2, AP_PARAM_FLOAT, v.x);
     name_axis = 'Y';
+    journal_append(name2, v.y);
     GCS_SEND_PARAM(name2, AP_PARAM_FLOAT, v.y);
     name_axis = 'Z';
+    journal_append(name2, v.z);
     GCS_SEND_PARAM(name2, AP_PARAM_FLOAT, v.z);
 #endif // HAL_NO_GCS
 }
@@ -346,6 +346,11 @@ public:
     ///
     void notify() const;
 
+    // dump the journal of recent parameter changes, used by
+    // @SYS/param_journal.txt. Each line carries a monotonic sequence
+    // number so a client can poll with a cursor and detect gaps
+    static void journal_info(class ExpandingString &str);
+
     /// Save the current value of the variable to storage, synchronous API
     ///
     /// @param  force_save     If true then force save even if default
@@ -623,6 +628,10 @@ private:
     static const struct Info *  find_by_header(
                                     struct Param_header phdr,
                                     void **ptr);
+    static const struct Info *  find_by_header_vindex(
+                                    struct Param_header phdr,
+                                    void **ptr,
+                                    uint16_t vindex);
     void                        add_vector3f_suffix(
                                     char *buffer,
                                     size_t buffer_size,
@@ -686,6 +695,78 @@ private:
     static HAL_Semaphore        _count_sem;
     static const struct Info *  _var_info;
 
+    /*
+      sorted-by-name index of all scalar parameters, built on demand
+      to give O(log n) find(). Rebuilt when the count marker changes
+      (e.g. when a pointer group or dynamic table is loaded)
+     */
+    struct param_index_entry {
+        AP_Param *ap;
+        ParamToken token;
+        uint8_t type;
+    };
+    static struct param_index_entry *_param_index;
+    static uint16_t             _param_index_count;
+    static uint16_t             _param_index_marker;
+
+    /*
+      in-RAM map from parameter header to storage offset, so save()
+      does not need to scan the EEPROM for the slot of every
+      variable. The map is a small open-addressed hash table keyed on
+      the packed 32 bit Param_header, built as a side effect of the
+      first scan() that walks to the sentinal
+     */
+    static uint32_t *           _scan_map_ids;
+    static uint16_t *           _scan_map_ofs;
+    static uint16_t             _scan_map_size;  // power of two
+    static uint16_t             _scan_map_used;
+    static bool                 _scan_map_valid;
+    static bool                 _scan_map_failed;
+    static HAL_Semaphore        _scan_map_sem;
+
+    static uint32_t scan_map_id(const struct Param_header &phdr);
+    static bool scan_map_lookup(const struct Param_header &phdr, uint16_t &ofs);
+    static bool scan_map_insert(const struct Param_header &phdr, uint16_t ofs);
+    static void scan_map_reset(void);
+
+    /*
+      small ring of recent parameter changes. Appended whenever a
+      changed value is reported to the GCS, from the main thread
+      (notify) or the IO thread (save_sync)
+     */
+    struct journal_entry {
+        uint32_t seq;
+        uint32_t time_ms;
+        float value;
+        char name[AP_MAX_NAME_SIZE+1];
+    };
+    static const uint8_t        _journal_size = 16;
+    static struct journal_entry _journal[_journal_size];
+    static uint32_t             _journal_seq;
+    static HAL_Semaphore        _journal_sem;
+
+    static void journal_append(const char *name, float value);
+
+    /*
+      direct-indexed map from the 9 bit storage key to the _var_info[]
+      entry owning it, so resolving a storage record in load_all()
+      does not walk the whole table. Keys are unique and _var_info is
+      fixed after set_var_info(), so once built the map never needs
+      invalidating
+     */
+    static uint16_t *           _key_vindex_map;
+    static bool                 _key_vindex_failed;
+    static bool key_vindex_lookup(uint16_t key, uint16_t &vindex);
+
+    // build the sorted index if missing or stale. Must be called with
+    // _count_sem held
+    static bool check_param_index(void);
+    static int compare_param_index_entry(const void *a, const void *b);
+
+    // look a name up in the sorted index, returning nullptr on a miss
+    static AP_Param *find_indexed(const char *name, enum ap_var_type *ptype,
+                                  uint16_t *flags, ParamToken *token);
+
     /*
       list of overridden values from load_defaults_file()
     */
@@ -37,24 +37,14 @@ AP_Proximity_Backend::AP_Proximity_Backend(AP_Proximity &_frontend, AP_Proximity
 //   returns true on success, false if no valid readings
 bool AP_Proximity_Backend::get_closest_object(float& angle_deg, float &distance) const
 {
-    bool sector_found = false;
-    uint8_t sector = 0;
-
-    // check all sectors for shorter distance
-    for (uint8_t i=0; i<PROXIMITY_NUM_SECTORS; i++) {
-        if (_distance_valid[i]) {
-            if (!sector_found || (_distance[i] < _distance[sector])) {
-                sector = i;
-                sector_found = true;
-            }
-        }
-    }
-
-    if (sector_found) {
-        angle_deg = _angle[sector];
-        distance = _distance[sector];
+    // the closest sector is maintained incrementally as sectors
+    // update, so this is a lookup rather than a scan
+    if (!_closest_valid) {
+        return false;
     }
-    return sector_found;
+    angle_deg = _angle[_closest_sector];
+    distance = _distance[_closest_sector];
+    return true;
 }
 
 // get number of objects, used for non-GPS avoidance
@@ -148,6 +138,24 @@ void AP_Proximity_Backend::update_boundary_for_sector(const uint8_t sector, cons
         database_push(_angle[sector], _distance[sector]);
     }
 
+    // maintain the cached closest sector used by get_closest_object().
+    // A rescan is only needed when the previously closest sector moves
+    // further away or goes invalid
+    if (_distance_valid[sector] &&
+        (!_closest_valid || _distance[sector] <= _distance[_closest_sector])) {
+        _closest_sector = sector;
+        _closest_valid = true;
+    } else if (_closest_valid && sector == _closest_sector) {
+        _closest_valid = false;
+        for (uint8_t i=0; i<PROXIMITY_NUM_SECTORS; i++) {
+            if (_distance_valid[i] &&
+                (!_closest_valid || _distance[i] < _distance[_closest_sector])) {
+                _closest_sector = i;
+                _closest_valid = true;
+            }
+        }
+    }
+
     // find adjacent sector (clockwise)
     uint8_t next_sector = sector + 1;
     if (next_sector >= PROXIMITY_NUM_SECTORS) {
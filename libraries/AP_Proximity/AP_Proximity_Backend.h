@@ -100,6 +100,8 @@ protected:
     float _angle[PROXIMITY_NUM_SECTORS];            // angle to closest object within each sector
     float _distance[PROXIMITY_NUM_SECTORS];         // distance to closest object within each sector
     bool _distance_valid[PROXIMITY_NUM_SECTORS];    // true if a valid distance received for each sector
+    uint8_t _closest_sector;                        // sector with the shortest valid distance, see update_boundary_for_sector
+    bool _closest_valid;                            // true if _closest_sector holds a valid distance
 
     // fence boundary
     Vector2f _sector_edge_vector[PROXIMITY_NUM_SECTORS];    // vector for right-edge of each sector, used to speed up calculation of boundary
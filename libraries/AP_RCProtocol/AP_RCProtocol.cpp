@@ -87,6 +87,7 @@ void AP_RCProtocol::process_pulse(uint32_t width_s0, uint32_t width_s1)
         if (backend[_detected_protocol]->new_input()) {
             _new_input = true;
             _last_input_ms = now;
+            _last_frame_time_us = AP_HAL::micros();
         }
         return;
     }
@@ -110,6 +111,7 @@ void AP_RCProtocol::process_pulse(uint32_t width_s0, uint32_t width_s1)
                     continue;
                 }
                 _new_input = (input_count != backend[i]->get_rc_input_count());
+                _last_frame_time_us = AP_HAL::micros();
                 _detected_protocol = (enum AP_RCProtocol::rcprotocol_t)i;
                 for (uint8_t j = 0; j < AP_RCProtocol::NONE; j++) {
                     if (backend[j]) {
@@ -172,6 +174,7 @@ bool AP_RCProtocol::process_byte(uint8_t byte, uint32_t baudrate)
         if (backend[_detected_protocol]->new_input()) {
             _new_input = true;
             _last_input_ms = now;
+            _last_frame_time_us = AP_HAL::micros();
         }
         return true;
     }
@@ -191,6 +194,7 @@ bool AP_RCProtocol::process_byte(uint8_t byte, uint32_t baudrate)
                     continue;
                 }
                 _new_input = (input_count != backend[i]->get_rc_input_count());
+                _last_frame_time_us = AP_HAL::micros();
                 _detected_protocol = (enum AP_RCProtocol::rcprotocol_t)i;
                 _last_input_ms = now;
                 _detected_with_bytes = true;
@@ -208,6 +212,50 @@ bool AP_RCProtocol::process_byte(uint8_t byte, uint32_t baudrate)
     return false;
 }
 
+/*
+  process a block of bytes from a single read. Once a protocol has been
+  detected the whole block is handed to that backend in one call, while
+  searching we fall back to per-byte scanning so the detection logic can
+  track frame counts as each byte arrives
+ */
+bool AP_RCProtocol::process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate)
+{
+    const uint32_t now = AP_HAL::millis();
+    const bool searching = (now - _last_input_ms >= 200);
+
+#ifndef IOMCU_FW
+    rc_protocols_mask = rc().enabled_protocols();
+#endif
+
+    if (_detected_protocol != AP_RCProtocol::NONE &&
+        !protocol_enabled(_detected_protocol)) {
+        _detected_protocol = AP_RCProtocol::NONE;
+    }
+
+    if (_detected_protocol != AP_RCProtocol::NONE && !_detected_with_bytes && !searching) {
+        // we're using pulse inputs, discard bytes
+        return false;
+    }
+
+    if (_detected_protocol != AP_RCProtocol::NONE && !searching) {
+        backend[_detected_protocol]->process_bytes(bytes, count, baudrate);
+        if (backend[_detected_protocol]->new_input()) {
+            _new_input = true;
+            _last_input_ms = now;
+            _last_frame_time_us = AP_HAL::micros();
+        }
+        return true;
+    }
+
+    bool ret = false;
+    for (uint16_t i = 0; i < count; i++) {
+        if (process_byte(bytes[i], baudrate)) {
+            ret = true;
+        }
+    }
+    return ret;
+}
+
 // handshake if nothing else has succeeded so far
 void AP_RCProtocol::process_handshake( uint32_t baudrate)
 {
@@ -281,11 +329,25 @@ void AP_RCProtocol::check_added_uart(void)
 
     uint32_t n = added.uart->available();
     n = MIN(n, 255U);
-    for (uint8_t i=0; i<n; i++) {
+    // consume the receive buffer in contiguous blocks where the driver
+    // supports zero-copy access, avoiding a read() round-trip per byte
+    while (n > 0) {
+        uint32_t peek_len = 0;
+        const uint8_t *block = added.uart->read_peek(peek_len);
+        if (block == nullptr || peek_len == 0) {
+            break;
+        }
+        const uint16_t chunk = MIN(peek_len, n);
+        process_bytes(block, chunk, added.baudrate);
+        added.uart->read_consume(chunk);
+        n -= chunk;
+    }
+    for (uint32_t i=0; i<n; i++) {
         int16_t b = added.uart->read();
-        if (b >= 0) {
-            process_byte(uint8_t(b), added.baudrate);
+        if (b < 0) {
+            break;
         }
+        process_byte(uint8_t(b), added.baudrate);
     }
     if (!_detected_with_bytes) {
         if (now - added.last_baud_change_ms > 1000) {
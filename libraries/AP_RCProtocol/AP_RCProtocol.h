@@ -52,6 +52,7 @@ public:
     void process_pulse(uint32_t width_s0, uint32_t width_s1);
     void process_pulse_list(const uint32_t *widths, uint16_t n, bool need_swap);
     bool process_byte(uint8_t byte, uint32_t baudrate);
+    bool process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate);
     void process_handshake(uint32_t baudrate);
     void update(void);
 
@@ -68,6 +69,13 @@ public:
     uint16_t read(uint8_t chan);
     void read(uint16_t *pwm, uint8_t n);
     bool new_input();
+
+    // timestamp taken as the last frame completed decoding. Sampled
+    // in the decode path rather than when the frame is consumed, so
+    // it can be used to measure stick-input latency
+    uint32_t last_frame_time_us(void) const {
+        return _last_frame_time_us;
+    }
     void start_bind(void);
     int16_t get_RSSI(void) const;
 
@@ -104,6 +112,7 @@ private:
     AP_RCProtocol_Backend *backend[NONE];
     bool _new_input;
     uint32_t _last_input_ms;
+    uint32_t _last_frame_time_us;
     bool _valid_serial_prot;
 
     enum config_phase {
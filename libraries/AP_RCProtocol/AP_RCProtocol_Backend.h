@@ -28,6 +28,14 @@ public:
     virtual ~AP_RCProtocol_Backend() {}
     virtual void process_pulse(uint32_t width_s0, uint32_t width_s1) {}
     virtual void process_byte(uint8_t byte, uint32_t baudrate) {}
+    // process a block of bytes from a single read. Backends can override
+    // this to parse the whole block in one call, the default feeds the
+    // bytes through one at a time
+    virtual void process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate) {
+        for (uint16_t i = 0; i < count; i++) {
+            process_byte(bytes[i], baudrate);
+        }
+    }
     virtual void process_handshake(uint32_t baudrate) {}
     uint16_t read(uint8_t chan);
     void read(uint16_t *pwm, uint8_t n);
@@ -303,7 +303,31 @@ bool AP_RCProtocol_CRSF::decode_csrf_packet()
     return rc_active;
 }
 
-// send out telemetry
+/*
+  number of bytes of telemetry that can be sent in one RC slot without
+  risking a collision with the next RC frame. We use at most half the
+  inter-frame time, capped to the uart transmit buffer
+ */
+uint16_t AP_RCProtocol_CRSF::telem_slot_bytes(void) const
+{
+    uint32_t slot_us;
+    switch (_link_status.rf_mode) {
+    case RFMode::CRSF_RF_MODE_250HZ:
+        slot_us = CRSF_INTER_FRAME_TIME_US_250HZ;
+        break;
+    case RFMode::CRSF_RF_MODE_150HZ:
+        slot_us = CRSF_INTER_FRAME_TIME_US_150HZ;
+        break;
+    default:
+        slot_us = CRSF_INTER_FRAME_TIME_US_50HZ;
+        break;
+    }
+    // 10 bits per byte on the wire
+    const uint32_t byte_time_us = 10000000U / CRSF_BAUDRATE;
+    return MIN((slot_us / 2) / byte_time_us, 128U);
+}
+
+// send out telemetry, coalescing as many frames as fit in the slot budget
 bool AP_RCProtocol_CRSF::process_telemetry(bool check_constraint)
 {
 
@@ -312,22 +336,37 @@ bool AP_RCProtocol_CRSF::process_telemetry(bool check_constraint)
         return false;
     }
 
-    if (!telem_available) {
 #if HAL_CRSF_TELEM_ENABLED && !APM_BUILD_TYPE(APM_BUILD_iofirmware)
-        if (AP_CRSF_Telem::get_telem_data(&_telemetry_frame)) {
+    uint16_t budget = telem_slot_bytes();
+    bool sent = false;
+
+    while (true) {
+        if (!telem_available) {
+            if (!AP_CRSF_Telem::get_telem_data(&_telemetry_frame)) {
+                break;
+            }
             telem_available = true;
-        } else {
-            return false;
         }
+        const uint16_t frame_bytes = _telemetry_frame.length + 2U;
+        if (sent && frame_bytes > budget) {
+            // keep the pending frame for the next slot
+            break;
+        }
+        // the first frame of a slot is always sent so a single oversized
+        // frame cannot stall the queue
+        write_frame(&_telemetry_frame);
+        // get fresh telem_data in the next iteration
+        telem_available = false;
+        sent = true;
+        budget -= MIN(budget, frame_bytes);
+        if (budget == 0) {
+            break;
+        }
+    }
+    return sent;
 #else
-        return false;
+    return false;
 #endif
-    }
-    write_frame(&_telemetry_frame);
-    // get fresh telem_data in the next call
-    telem_available = false;
-
-    return true;
 }
 
 // process link statistics to get RSSI
@@ -364,6 +403,25 @@ void AP_RCProtocol_CRSF::process_byte(uint8_t byte, uint32_t baudrate)
     _process_byte(AP_HAL::micros(), byte);
 }
 
+/*
+  process a block of bytes in one call. Per-byte arrival times are
+  reconstructed from the wire rate so the inter-frame gap detection in
+  _process_byte() behaves as if each byte had been timestamped on arrival
+ */
+void AP_RCProtocol_CRSF::process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate)
+{
+    // reject RC data if we have been configured for standalone mode
+    if (baudrate != CRSF_BAUDRATE || _uart || count == 0) {
+        return;
+    }
+    const uint32_t now = AP_HAL::micros();
+    // 10 bits per byte on the wire
+    const uint32_t byte_time_us = 10000000UL / baudrate;
+    for (uint16_t i = 0; i < count; i++) {
+        _process_byte(now - uint32_t(count - 1 - i) * byte_time_us, bytes[i]);
+    }
+}
+
 // start the uart if we have one
 void AP_RCProtocol_CRSF::start_uart()
 {
@@ -31,6 +31,7 @@ public:
     AP_RCProtocol_CRSF(AP_RCProtocol &_frontend);
     virtual ~AP_RCProtocol_CRSF();
     void process_byte(uint8_t byte, uint32_t baudrate) override;
+    void process_bytes(const uint8_t *bytes, uint16_t count, uint32_t baudrate) override;
     void process_pulse(uint32_t width_s0, uint32_t width_s1) override;
     void update(void) override;
     // get singleton instance
@@ -204,6 +205,7 @@ private:
     bool process_telemetry(bool check_constraint = true);
     void process_link_stats_frame(const void* data);
     void write_frame(Frame* frame);
+    uint16_t telem_slot_bytes(void) const;
     void start_uart();
     AP_HAL::UARTDriver* get_current_UART() { return (_uart ? _uart : get_available_UART()); }
 
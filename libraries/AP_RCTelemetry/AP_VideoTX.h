@@ -31,7 +31,9 @@ public:
     // init - perform required initialisation
     bool init();
 
-    // run any required updates
+    // run any required updates. This is called from the main loop, so
+    // backends pushing settings to the VTX must be non-blocking state
+    // machines - no inter-byte delays on half-duplex control links
     void update();
 
     static AP_VideoTX *get_singleton(void) {
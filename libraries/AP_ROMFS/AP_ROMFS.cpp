@@ -106,6 +106,119 @@ const uint8_t *AP_ROMFS::find_decompress(const char *name, uint32_t &size)
 #endif
 }
 
+#ifndef HAL_ROMFS_UNCOMPRESSED
+// deflate back-references can reach up to 32k behind the current
+// output position, so streaming needs a full window dictionary
+#define ROMFS_STREAM_DICT_SIZE 32768U
+#endif
+
+/*
+  per-stream decompression state. This is the whole RAM cost of a
+  streaming read: the dictionary window plus the inflate state,
+  independent of the size of the embedded file
+ */
+struct AP_ROMFS::stream {
+    const uint8_t *compressed_data;
+    uint32_t compressed_size;
+    uint32_t decompressed_size;
+    // bytes of decompressed data produced so far
+    uint32_t offset;
+#ifndef HAL_ROMFS_UNCOMPRESSED
+    TINF_DATA d;
+    uint8_t *dict;
+#endif
+};
+
+/*
+  open a file for streaming reads, filling in the decompressed size
+ */
+AP_ROMFS::stream *AP_ROMFS::stream_open(const char *name, uint32_t &size)
+{
+    uint32_t compressed_size = 0;
+    const uint8_t *compressed_data = find_file(name, compressed_size);
+    if (!compressed_data) {
+        return nullptr;
+    }
+
+    struct stream *s = (struct stream *)calloc(1, sizeof(struct stream));
+    if (!s) {
+        return nullptr;
+    }
+    s->compressed_data = compressed_data;
+    s->compressed_size = compressed_size;
+
+#ifdef HAL_ROMFS_UNCOMPRESSED
+    s->decompressed_size = compressed_size;
+#else
+    // last 4 bytes of gzip file are length of decompressed data
+    const uint8_t *p = &compressed_data[compressed_size-4];
+    s->decompressed_size = p[0] | p[1] << 8 | p[2] << 16 | p[3] << 24;
+
+    s->dict = (uint8_t *)malloc(ROMFS_STREAM_DICT_SIZE);
+    if (!s->dict) {
+        ::free(s);
+        return nullptr;
+    }
+    uzlib_uncompress_init(&s->d, s->dict, ROMFS_STREAM_DICT_SIZE);
+
+    s->d.source = compressed_data;
+    s->d.source_limit = compressed_data + compressed_size - 4;
+
+    // assume gzip format
+    if (uzlib_gzip_parse_header(&s->d) != TINF_OK) {
+        ::free(s->dict);
+        ::free(s);
+        return nullptr;
+    }
+#endif
+
+    size = s->decompressed_size;
+    return s;
+}
+
+/*
+  read the next len bytes of decompressed data
+ */
+int32_t AP_ROMFS::stream_read(struct stream *s, uint8_t *buf, uint32_t len)
+{
+    if (s->offset >= s->decompressed_size) {
+        return 0;
+    }
+    uint32_t n = len;
+    if (n > s->decompressed_size - s->offset) {
+        n = s->decompressed_size - s->offset;
+    }
+    if (n == 0) {
+        return 0;
+    }
+#ifdef HAL_ROMFS_UNCOMPRESSED
+    memcpy(buf, &s->compressed_data[s->offset], n);
+#else
+    s->d.dest = buf;
+    s->d.destSize = n;
+    int res = uzlib_uncompress(&s->d);
+    if (res != TINF_OK && res != TINF_DONE) {
+        return -1;
+    }
+#endif
+    s->offset += n;
+    return n;
+}
+
+/*
+  close a stream, freeing its state
+ */
+void AP_ROMFS::stream_close(struct stream *s)
+{
+    if (s == nullptr) {
+        return;
+    }
+#ifndef HAL_ROMFS_UNCOMPRESSED
+    ::free(s->dict);
+#endif
+    ::free(s);
+}
+
 // free returned data
 void AP_ROMFS::free(const uint8_t *data)
 {
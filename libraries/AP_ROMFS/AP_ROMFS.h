@@ -16,6 +16,27 @@ public:
     // free returned data
     static void free(const uint8_t *data);
 
+    /*
+      streaming decompression interface. This avoids the transient
+      heap cost of find_decompress() for large files by producing the
+      data in caller-sized windows. Reads are sequential only, which
+      suits consumers such as font and firmware uploads that walk the
+      file front to back
+    */
+    struct stream;
+
+    // open a file for streaming reads, filling in the decompressed
+    // size. Returns nullptr if not found or out of memory
+    static struct stream *stream_open(const char *name, uint32_t &size);
+
+    // read the next len bytes of decompressed data. Returns the
+    // number of bytes produced, 0 at end of file or -1 on a
+    // decompression error
+    static int32_t stream_read(struct stream *s, uint8_t *buf, uint32_t len);
+
+    // close a stream, freeing its state
+    static void stream_close(struct stream *s);
+
     /*
       directory listing interface. Start with ofs=0. Returns pathnames
       that match dirname prefix. Ends with nullptr return when no more
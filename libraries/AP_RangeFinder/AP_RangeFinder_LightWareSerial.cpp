@@ -23,72 +23,100 @@ extern const AP_HAL::HAL& hal;
 #define LIGHTWARE_DIST_MAX_CM           10000
 #define LIGHTWARE_OUT_OF_RANGE_ADD_CM   100
 
-// read - return last value measured by sensor
-bool AP_RangeFinder_LightWareSerial::get_reading(uint16_t &reading_cm)
+// parse one byte from the lidar, appending any completed distance in
+// metres to the current batch
+void AP_RangeFinder_LightWareSerial::parse_byte(char c, float *batch, uint8_t &batch_count, uint16_t &invalid_count)
 {
-    if (uart == nullptr) {
-        return false;
+    // use legacy protocol
+    if (protocol_state == ProtocolState::UNKNOWN || protocol_state == ProtocolState::LEGACY) {
+        if (c == '\r') {
+            linebuf[linebuf_len] = 0;
+            const float dist = strtof(linebuf, nullptr);
+            if (!is_negative(dist)) {
+                if (batch_count < DIST_BATCH_MAX) {
+                    batch[batch_count++] = dist;
+                }
+                // if still determining protocol update legacy valid count
+                if (protocol_state == ProtocolState::UNKNOWN) {
+                    legacy_valid_count++;
+                }
+            } else {
+                invalid_count++;
+            }
+            linebuf_len = 0;
+        } else if (isdigit(c) || c == '.' || c == '-') {
+            linebuf[linebuf_len++] = c;
+            if (linebuf_len == sizeof(linebuf)) {
+                // too long, discard the line
+                linebuf_len = 0;
+            }
+        }
     }
 
-    float sum = 0;              // sum of all readings taken
-    uint16_t valid_count = 0;   // number of valid readings
-    uint16_t invalid_count = 0; // number of invalid readings
-
-    // read any available lines from the lidar
-    int16_t nbytes = uart->available();
-    while (nbytes-- > 0) {
-        char c = uart->read();
-
-        // use legacy protocol
-        if (protocol_state == ProtocolState::UNKNOWN || protocol_state == ProtocolState::LEGACY) {
-            if (c == '\r') {
-                linebuf[linebuf_len] = 0;
-                const float dist = strtof(linebuf, nullptr);
+    // use binary protocol
+    if (protocol_state == ProtocolState::UNKNOWN || protocol_state == ProtocolState::BINARY) {
+        bool msb_set = BIT_IS_SET(c, 7);
+        if (msb_set) {
+            // received the high byte
+            high_byte = c;
+            high_byte_received = true;
+        } else {
+            // received the low byte which should be second
+            if (high_byte_received) {
+                const float dist = (high_byte & 0x7f) << 7 | (c & 0x7f);
                 if (!is_negative(dist)) {
-                    sum += dist;
-                    valid_count++;
-                    // if still determining protocol update legacy valid count
+                    if (batch_count < DIST_BATCH_MAX) {
+                        batch[batch_count++] = dist * 0.01f;
+                    }
+                    // if still determining protocol update binary valid count
                     if (protocol_state == ProtocolState::UNKNOWN) {
-                        legacy_valid_count++;
+                        binary_valid_count++;
                     }
                 } else {
                     invalid_count++;
                 }
-                linebuf_len = 0;
-            } else if (isdigit(c) || c == '.' || c == '-') {
-                linebuf[linebuf_len++] = c;
-                if (linebuf_len == sizeof(linebuf)) {
-                    // too long, discard the line
-                    linebuf_len = 0;
-                }
             }
+            high_byte_received = false;
         }
+    }
+}
 
-        // use binary protocol
-        if (protocol_state == ProtocolState::UNKNOWN || protocol_state == ProtocolState::BINARY) {
-            bool msb_set = BIT_IS_SET(c, 7);
-            if (msb_set) {
-                // received the high byte
-                high_byte = c;
-                high_byte_received = true;
-            } else {
-                // received the low byte which should be second
-                if (high_byte_received) {
-                    const float dist = (high_byte & 0x7f) << 7 | (c & 0x7f);
-                    if (!is_negative(dist)) {
-                        sum += dist * 0.01f;
-                        valid_count++;
-                        // if still determining protocol update binary valid count
-                        if (protocol_state == ProtocolState::UNKNOWN) {
-                            binary_valid_count++;
-                        }
-                    } else {
-                        invalid_count++;
-                    }
-                }
-                high_byte_received = false;
-            }
+// read - return last value measured by sensor
+bool AP_RangeFinder_LightWareSerial::get_reading(uint16_t &reading_cm)
+{
+    if (uart == nullptr) {
+        return false;
+    }
+
+    float batch[DIST_BATCH_MAX]; // distances parsed from this update's bytes
+    uint8_t batch_count = 0;     // number of valid readings in batch
+    uint16_t invalid_count = 0;  // number of invalid readings
+
+    // parse in blocks using the zero-copy uart API where the port
+    // supports it
+    uint32_t pending = uart->available();
+    while (pending > 0) {
+        uint32_t peek_len;
+        const uint8_t *block = uart->read_peek(peek_len);
+        if (block == nullptr || peek_len == 0) {
+            break;
+        }
+        const uint32_t n = MIN(peek_len, pending);
+        for (uint32_t i = 0; i < n; i++) {
+            parse_byte(char(block[i]), batch, batch_count, invalid_count);
         }
+        uart->read_consume(n);
+        pending -= n;
+    }
+
+    // fall back to per-byte reads for ports without read_peek()
+    int16_t nbytes = uart->available();
+    while (nbytes-- > 0) {
+        const int16_t c = uart->read();
+        if (c < 0) {
+            break;
+        }
+        parse_byte(char(c), batch, batch_count, invalid_count);
     }
 
     // protocol set after 10 successful reads
@@ -113,9 +141,20 @@ bool AP_RangeFinder_LightWareSerial::get_reading(uint16_t &reading_cm)
         uart->write('d');
     }
 
-    // return average of all valid readings
-    if (valid_count > 0) {
-        reading_cm = 100 * sum / valid_count;
+    // return the median of this update's readings. Unlike the mean
+    // this rejects single-sample glitches rather than folding them in
+    if (batch_count > 0) {
+        // insertion sort, the batch is small
+        for (uint8_t i = 1; i < batch_count; i++) {
+            const float v = batch[i];
+            int8_t j = i - 1;
+            while (j >= 0 && batch[j] > v) {
+                batch[j + 1] = batch[j];
+                j--;
+            }
+            batch[j + 1] = v;
+        }
+        reading_cm = 100 * batch[batch_count / 2];
         return true;
     }
 
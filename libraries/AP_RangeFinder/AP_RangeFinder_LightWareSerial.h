@@ -20,6 +20,12 @@ private:
     // get a reading
     bool get_reading(uint16_t &reading_cm) override;
 
+    // maximum number of distances collected from one update's bytes
+    static const uint8_t DIST_BATCH_MAX = 16;
+
+    // parse one byte, appending any completed distance in metres to batch
+    void parse_byte(char c, float *batch, uint8_t &batch_count, uint16_t &invalid_count);
+
     char linebuf[10];           // legacy protocol buffer
     uint8_t linebuf_len;        // legacy protocol buffer length
     uint32_t last_init_ms;      // init time used to switch lw20 to serial mode
@@ -79,13 +79,16 @@ AP_SBusOut::AP_SBusOut(void)
  */
 void AP_SBusOut::sbus_format_frame(uint16_t *channels, uint8_t num_channels, uint8_t buffer[SBUS_BSIZE])
 {
-    uint8_t index = 1;
-    uint8_t offset = 0;
-
     memset(buffer, 0, SBUS_BSIZE);
     buffer[0] = 0x0f;
 
-    /* construct sbus frame representing channels 1 through 16 (max) */
+    /* construct sbus frame representing channels 1 through 16 (max).
+       the 11 bit values are packed through a 32 bit accumulator so
+       each output byte is written exactly once, rather than
+       read-modify-writing three partially filled bytes per channel */
+    uint8_t index = 1;
+    uint32_t accum = 0;
+    uint8_t accum_bits = 0;
     uint8_t nchan = MIN(num_channels, SBUS_CHANNELS);
     for (unsigned i = 0; i < nchan; ++i) {
         /*protect from out of bounds values and limit to 11 bits*/
@@ -103,15 +106,16 @@ void AP_SBusOut::sbus_format_frame(uint16_t *channels, uint8_t num_channels, uin
         }
 #endif
 
-        while (offset >= 8) {
-            ++index;
-            offset -= 8;
+        accum |= uint32_t(value) << accum_bits;
+        accum_bits += 11;
+        while (accum_bits >= 8) {
+            buffer[index++] = accum & 0xff;
+            accum >>= 8;
+            accum_bits -= 8;
         }
-
-        buffer[index] |= (value << (offset)) & 0xff;
-        buffer[index + 1] |= (value >> (8 - offset)) & 0xff;
-        buffer[index + 2] |= (value >> (16 - offset)) & 0xff;
-        offset += 11;
+    }
+    if (accum_bits > 0) {
+        buffer[index] = accum & 0xff;
     }
 }
 
@@ -151,15 +155,22 @@ AP_SBusOut::update()
         }
         channels[i] = c->get_output_pwm();
     }
-    uint8_t buffer[SBUS_BSIZE];
-    sbus_format_frame(channels, nchan, buffer);
+
+    // only re-pack the persistent frame when a channel value has
+    // changed; unchanged frames are re-sent as-is to keep the
+    // receiver fed
+    if (!frame_valid || memcmp(channels, last_channels, sizeof(last_channels)) != 0) {
+        memcpy(last_channels, channels, sizeof(last_channels));
+        sbus_format_frame(channels, nchan, frame);
+        frame_valid = true;
+    }
 
 #if SBUS_DEBUG
     hal.gpio->pinMode(55, HAL_GPIO_OUTPUT);
     hal.gpio->write(55, 1);
 #endif
 
-    sbus1_uart->write(buffer, sizeof(buffer));
+    sbus1_uart->write(frame, sizeof(frame));
 
 #if SBUS_DEBUG
     hal.gpio->pinMode(55, HAL_GPIO_OUTPUT);
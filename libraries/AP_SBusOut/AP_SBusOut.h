@@ -33,6 +33,12 @@ private:
 
     uint16_t sbus_frame_interval;   // microseconds
 
+    // persistent output frame, re-packed only when a channel value
+    // changes
+    uint8_t frame[25];
+    uint16_t last_channels[16];
+    bool frame_valid;
+
     AP_Int16 sbus_rate;
     bool initialised;
 };
@@ -62,7 +62,7 @@ const AP_Param::GroupInfo AP_Scheduler::var_info[] = {
     // @Param: OPTIONS
     // @DisplayName: Scheduling options
     // @Description: This controls optional aspects of the scheduler.
-    // @Bitmask: 0:Enable per-task perf info
+    // @Bitmask: 0:Enable per-task perf info,1:Run tasks most-overdue-first (EDF)
     // @User: Advanced
     AP_GROUPINFO("OPTIONS",  2, AP_Scheduler, _options, 0),
 
@@ -127,6 +127,18 @@ void AP_Scheduler::init(const AP_Scheduler::Task *tasks, uint8_t num_tasks, uint
         perf_info.allocate_task_info(_num_tasks);
     }
 
+    if (_options & uint8_t(Options::EDF_SCHEDULING)) {
+        _edf_order = new uint8_t[_num_tasks];
+        _edf_key = new uint16_t[_num_tasks];
+        if (_edf_order == nullptr || _edf_key == nullptr) {
+            // fall back to table order scheduling
+            delete[] _edf_order;
+            delete[] _edf_key;
+            _edf_order = nullptr;
+            _edf_key = nullptr;
+        }
+    }
+
     _log_performance_bit = log_performance_bit;
 }
 
@@ -148,6 +160,49 @@ static void fill_nanf_stack(void)
 }
 #endif
 
+/*
+  return the interval in ticks between runs of a task
+ */
+uint32_t AP_Scheduler::get_interval_ticks(const Task &task) const
+{
+    // we allow 0 to mean loop rate
+    uint32_t interval_ticks = (is_zero(task.rate_hz) ? 1 : _loop_rate_hz / task.rate_hz);
+    if (interval_ticks < 1) {
+        interval_ticks = 1;
+    }
+    return interval_ticks;
+}
+
+/*
+  fill _edf_order with task indexes sorted most-overdue-first. The
+  lateness key for a task is how overdue it is relative to its own
+  interval, so a 1Hz task that has missed several intervals runs
+  before a fast task that is only just due. Ties keep table order,
+  which preserves the normal priorities when nothing has slipped
+ */
+void AP_Scheduler::update_edf_order(void)
+{
+    for (uint8_t i=0; i<_num_tasks; i++) {
+        const AP_Scheduler::Task& task = (i < _num_unshared_tasks) ? _tasks[i] : _common_tasks[i - _num_unshared_tasks];
+        const uint32_t dt = uint16_t(_tick_counter - _last_run[i]);
+        // scale by 16 so that fractional lateness still orders tasks
+        _edf_key[i] = MIN((dt * 16U) / get_interval_ticks(task), 0xFFFFU);
+        _edf_order[i] = i;
+    }
+    // insertion sort by descending key; the task table is small and
+    // almost sorted on a healthy loop, so this is cheap
+    for (uint8_t i=1; i<_num_tasks; i++) {
+        const uint8_t idx = _edf_order[i];
+        const uint16_t key = _edf_key[idx];
+        int16_t j = i - 1;
+        while (j >= 0 && _edf_key[_edf_order[j]] < key) {
+            _edf_order[j+1] = _edf_order[j];
+            j--;
+        }
+        _edf_order[j+1] = idx;
+    }
+}
+
 /*
   run one tick
   this will run as many scheduler tasks as we can in the specified time
@@ -169,15 +224,18 @@ void AP_Scheduler::run(uint32_t time_available)
         }
     }
     
-    for (uint8_t i=0; i<_num_tasks; i++) {
+    if (_edf_order != nullptr) {
+        update_edf_order();
+    }
+
+    for (uint8_t slot=0; slot<_num_tasks; slot++) {
+        // in EDF mode run the most overdue tasks first instead of
+        // walking the table in fixed priority order
+        const uint8_t i = (_edf_order != nullptr) ? _edf_order[slot] : slot;
         const AP_Scheduler::Task& task = (i < _num_unshared_tasks) ? _tasks[i] : _common_tasks[i - _num_unshared_tasks];
 
         uint32_t dt = _tick_counter - _last_run[i];
-        // we allow 0 to mean loop rate
-        uint32_t interval_ticks = (is_zero(task.rate_hz) ? 1 : _loop_rate_hz / task.rate_hz);
-        if (interval_ticks < 1) {
-            interval_ticks = 1;
-        }
+        uint32_t interval_ticks = get_interval_ticks(task);
         if (dt < interval_ticks) {
             // this task is not yet scheduled to run again
             continue;
@@ -345,6 +403,15 @@ void AP_Scheduler::loop()
     hal.scheduler->delay_microseconds(1);
 #endif
 
+    // grow the extra loop time from sustained load as well as from
+    // explicit task slips. The filtered loop time rises within a few
+    // loops of a heavy load (eg. FFT with notch active) coming on,
+    // well before tasks have slipped by max_task_slowdown ticks
+    const uint32_t filtered_loop_us = perf_info.get_filtered_time() * 1.0e6f;
+    if (filtered_loop_us > loop_us + loop_us/20) {
+        extra_loop_us = constrain_uint32(filtered_loop_us - loop_us, extra_loop_us, 5000U);
+    }
+
     if (task_not_achieved > 0) {
         // add some extra time to the budget
         extra_loop_us = MIN(extra_loop_us+100U, 5000U);
@@ -411,10 +478,68 @@ void AP_Scheduler::Log_Write_Performance()
 }
 
 // display task statistics as text buffer for @SYS/tasks.txt
+/*
+  binary variant of task_info() for @SYS/tasks.bin. The format is an
+  8 byte header of magic "TSK1", a record count, the record size and a
+  reserved word, followed by one fixed-size little-endian record per
+  task. Fleet monitoring can fetch this over MAVLink FTP without the
+  text generate/parse cost of tasks.txt
+ */
+void AP_Scheduler::task_info_bin(ExpandingString &str)
+{
+    struct PACKED task_rec {
+        char name[16];
+        uint16_t min_time_us;
+        uint16_t max_time_us;
+        uint32_t elapsed_time_us;
+        uint32_t tick_count;
+        uint16_t slip_count;
+        uint16_t overrun_count;
+        uint16_t time_hist[AP_SCHEDULER_TASK_HIST_BUCKETS];
+    };
+    const struct PACKED {
+        char magic[4];
+        uint8_t num_records;
+        uint8_t record_size;
+        uint16_t reserved;
+    } hdr { {'T','S','K','1'}, uint8_t(_num_tasks+1), sizeof(struct task_rec), 0 };
+
+    // the header is always present; a header-only file means
+    // collection has only just been enabled
+    str.append((const char *)&hdr, sizeof(hdr));
+
+    // dynamically enable statistics collection, as for tasks.txt
+    if (!(_options & uint8_t(Options::RECORD_TASK_INFO))) {
+        _options |= uint8_t(Options::RECORD_TASK_INFO);
+        return;
+    }
+
+    if (perf_info.get_task_info(0) == nullptr) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < _num_tasks + 1; i++) {
+        const char* task_name = (i < _num_unshared_tasks) ? _tasks[i].name : i == _num_tasks ? "fast_loop" : _common_tasks[i - _num_unshared_tasks].name;
+        const AP::PerfInfo::TaskInfo* ti = perf_info.get_task_info(i);
+
+        struct task_rec rec {};
+        strncpy_noterm(rec.name, task_name, sizeof(rec.name));
+        rec.min_time_us = ti->min_time_us;
+        rec.max_time_us = ti->max_time_us;
+        rec.elapsed_time_us = ti->elapsed_time_us;
+        rec.tick_count = ti->tick_count;
+        rec.slip_count = ti->slip_count;
+        rec.overrun_count = ti->overrun_count;
+        memcpy(rec.time_hist, ti->time_hist, sizeof(rec.time_hist));
+        str.append((const char *)&rec, sizeof(rec));
+    }
+}
+
 void AP_Scheduler::task_info(ExpandingString &str)
 {
-    // a header to allow for machine parsers to determine format
-    str.printf("TasksV1\n");
+    // a header to allow for machine parsers to determine format. V2
+    // adds a per-task log2 latency histogram in 1us..2048us buckets
+    str.printf("TasksV2\n");
 
     // dynamically enable statistics collection
     if (!(_options & uint8_t(Options::RECORD_TASK_INFO))) {
@@ -447,13 +572,21 @@ void AP_Scheduler::task_info(ExpandingString &str)
         }
 
 #if HAL_MINIMIZE_FEATURES
-        const char* fmt = "%-16.16s MIN=%3u MAX=%3u AVG=%3u OVR=%3u SLP=%3u, TOT=%4.1f%%\n";
+        const char* fmt = "%-16.16s MIN=%3u MAX=%3u AVG=%3u OVR=%3u SLP=%3u, TOT=%4.1f%%";
 #else
-        const char* fmt = "%-32.32s MIN=%3u MAX=%3u AVG=%3u OVR=%3u SLP=%3u, TOT=%4.1f%%\n";
+        const char* fmt = "%-32.32s MIN=%3u MAX=%3u AVG=%3u OVR=%3u SLP=%3u, TOT=%4.1f%%";
 #endif
         str.printf(fmt, task_name,
                    unsigned(MIN(ti->min_time_us, 999)), unsigned(MIN(ti->max_time_us, 999)), unsigned(avg),
                    unsigned(MIN(ti->overrun_count, 999)), unsigned(MIN(ti->slip_count, 999)), pct);
+
+        // log2 latency histogram; bucket n counts runs taking
+        // 2^n..2^(n+1)-1 microseconds
+        str.printf(" HIST=");
+        for (uint8_t b = 0; b < AP_SCHEDULER_TASK_HIST_BUCKETS; b++) {
+            str.printf(b == 0 ? "%u" : ",%u", unsigned(ti->time_hist[b]));
+        }
+        str.printf("\n");
     }
 }
 
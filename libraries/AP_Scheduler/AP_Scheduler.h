@@ -80,7 +80,8 @@ public:
     };
 
     enum class Options : uint8_t {
-        RECORD_TASK_INFO = 1 << 0
+        RECORD_TASK_INFO = 1 << 0,
+        EDF_SCHEDULING   = 1 << 1,
     };
 
     // initialise scheduler
@@ -158,6 +159,9 @@ public:
 
     void task_info(ExpandingString &str);
 
+    // binary variant of task_info() for @SYS/tasks.bin
+    void task_info_bin(ExpandingString &str);
+
     static const struct AP_Param::GroupInfo var_info[];
 
     // loop performance monitoring:
@@ -204,6 +208,21 @@ private:
     // tick counter at the time we last ran each task
     uint16_t *_last_run;
 
+    // task execution order for the EDF scheduling option. When
+    // enabled tasks are run most-overdue-first rather than in table
+    // order, so low priority tasks are not systematically starved
+    // when the loop is over budget
+    uint8_t *_edf_order;
+
+    // per-task lateness keys used to sort _edf_order
+    uint16_t *_edf_key;
+
+    // return the interval in ticks for a task
+    uint32_t get_interval_ticks(const Task &task) const;
+
+    // fill _edf_order with task indexes sorted most-overdue-first
+    void update_edf_order(void);
+
     // number of microseconds allowed for the current task
     uint32_t _task_time_allowed;
 
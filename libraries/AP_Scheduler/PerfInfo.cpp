@@ -75,6 +75,16 @@ void AP::PerfInfo::update_task_info(uint8_t task_index, uint16_t task_time_us, b
     if (overrun) {
         ti.overrun_count++;
     }
+
+    // update the log2 latency histogram. The bucket index is
+    // floor(log2(time_us)), saturating into the last bucket
+    uint8_t bucket = 0;
+    if (task_time_us > 0) {
+        bucket = MIN(uint8_t(31 - __builtin_clz(uint32_t(task_time_us))), uint8_t(AP_SCHEDULER_TASK_HIST_BUCKETS - 1));
+    }
+    if (ti.time_hist[bucket] < UINT16_MAX) {
+        ti.time_hist[bucket]++;
+    }
 }
 
 // check_loop_time - check latest loop time vs min, max and overtime threshold
@@ -2,6 +2,11 @@
 
 #include <stdint.h>
 
+// number of log2 latency histogram buckets per task. Bucket n counts
+// task runs with 2^n <= time_us < 2^(n+1); the last bucket absorbs
+// everything longer
+#define AP_SCHEDULER_TASK_HIST_BUCKETS 12
+
 namespace AP {
 
 class PerfInfo {
@@ -16,6 +21,9 @@ public:
         uint32_t tick_count;
         uint16_t slip_count;
         uint16_t overrun_count;
+        // log2 latency histogram, used to spot occasional long runs
+        // that the averages hide
+        uint16_t time_hist[AP_SCHEDULER_TASK_HIST_BUCKETS];
     };
 
     /* Do not allow copies */
@@ -0,0 +1,18 @@
+-- This script is an example of the batched nav_state() binding, which
+-- fetches attitude, velocity, position and time in a single binding
+-- crossing. Passing the table back in re-uses it, so nothing is
+-- allocated per tick.
+
+local state = nav_state()
+
+function update()
+  state = nav_state(state)
+  if state.vel_n then
+    gcs:send_text(6, string.format("yaw %.1f deg vel N %.1f m/s", math.deg(state.yaw), state.vel_n))
+  else
+    gcs:send_text(6, string.format("yaw %.1f deg (no velocity estimate)", math.deg(state.yaw)))
+  end
+  return update, 1000
+end
+
+return update()
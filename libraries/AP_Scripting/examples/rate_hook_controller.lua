@@ -0,0 +1,29 @@
+-- This script is an example of register_rate_hook(), which runs a
+-- function in the scripting thread at up to 400Hz while the scheduler
+-- is idle between scripts. The gyro and attitude are passed as plain
+-- numbers so the hook allocates nothing per call, making it suitable
+-- for prototyping rate controllers that would otherwise need C++.
+--
+-- Keep the hook short: it runs on a tenth of the normal instruction
+-- budget and is deregistered if it overruns or errors.
+
+local peak_rate = 0
+
+function rate_hook(gx, gy, gz, roll, pitch, yaw)
+  -- an experimental controller would compute its outputs here and
+  -- apply them through the usual bindings (e.g. SRV_Channels)
+  local rate = math.sqrt(gx*gx + gy*gy + gz*gz)
+  if rate > peak_rate then
+    peak_rate = rate
+  end
+end
+
+register_rate_hook(rate_hook, 400)
+
+function update()
+  gcs:send_text(6, string.format("peak rate %.2f rad/s", peak_rate))
+  peak_rate = 0
+  return update, 1000
+end
+
+return update()
@@ -1,11 +1,13 @@
 #include <AP_Common/AP_Common.h>
 #include <SRV_Channel/SRV_Channel.h>
 #include <AP_HAL/HAL.h>
+#include <AP_AHRS/AP_AHRS.h>
 #include <AP_Logger/AP_Logger.h>
 
 #include "lua_bindings.h"
 
 #include "lua_boxed_numerics.h"
+#include "lua_scripts.h"
 #include <AP_Scripting/lua_generated_bindings.h>
 
 extern const AP_HAL::HAL& hal;
@@ -45,10 +47,97 @@ static int lua_micros(lua_State *L) {
     return 1;
 }
 
+/*
+  batched navigation state snapshot. Fills and returns a table holding
+  attitude, velocity, position and time in a single binding crossing,
+  rather than one crossing (with its userdata allocation and semaphore
+  take) per field. A previously returned table can be passed in and is
+  re-used, so a periodic script allocates nothing per tick
+ */
+static int lua_nav_state(lua_State *L) {
+    const int args = lua_gettop(L);
+    if (args > 1) {
+        return luaL_error(L, "nav_state expected 0 or 1 arguments got %d", args);
+    }
+    if (args == 1) {
+        luaL_checktype(L, 1, LUA_TTABLE);
+    } else {
+        lua_createtable(L, 0, 10);
+    }
+
+    float roll, pitch, yaw;
+    Vector3f vel;
+    Location loc;
+    bool have_vel;
+    bool have_pos;
+    uint32_t now_ms;
+
+    {
+        // take the AHRS semaphore once for the whole snapshot
+        AP_AHRS &ahrs = AP::ahrs();
+        WITH_SEMAPHORE(ahrs.get_semaphore());
+        roll = ahrs.roll;
+        pitch = ahrs.pitch;
+        yaw = ahrs.yaw;
+        have_vel = ahrs.get_velocity_NED(vel);
+        have_pos = ahrs.get_position(loc);
+        now_ms = AP_HAL::millis();
+    }
+
+    lua_pushnumber(L, roll);
+    lua_setfield(L, -2, "roll");
+    lua_pushnumber(L, pitch);
+    lua_setfield(L, -2, "pitch");
+    lua_pushnumber(L, yaw);
+    lua_setfield(L, -2, "yaw");
+
+    // set unavailable fields to nil so a re-used table never carries
+    // stale values
+    if (have_vel) {
+        lua_pushnumber(L, vel.x);
+        lua_setfield(L, -2, "vel_n");
+        lua_pushnumber(L, vel.y);
+        lua_setfield(L, -2, "vel_e");
+        lua_pushnumber(L, vel.z);
+        lua_setfield(L, -2, "vel_d");
+    } else {
+        lua_pushnil(L);
+        lua_setfield(L, -2, "vel_n");
+        lua_pushnil(L);
+        lua_setfield(L, -2, "vel_e");
+        lua_pushnil(L);
+        lua_setfield(L, -2, "vel_d");
+    }
+
+    if (have_pos) {
+        lua_pushinteger(L, loc.lat);
+        lua_setfield(L, -2, "lat");
+        lua_pushinteger(L, loc.lng);
+        lua_setfield(L, -2, "lng");
+        lua_pushinteger(L, loc.alt);
+        lua_setfield(L, -2, "alt_cm");
+    } else {
+        lua_pushnil(L);
+        lua_setfield(L, -2, "lat");
+        lua_pushnil(L);
+        lua_setfield(L, -2, "lng");
+        lua_pushnil(L);
+        lua_setfield(L, -2, "alt_cm");
+    }
+
+    new_uint32_t(L);
+    *check_uint32_t(L, -1) = now_ms;
+    lua_setfield(L, -2, "time_ms");
+
+    return 1;
+}
+
 static const luaL_Reg global_functions[] =
 {
     {"millis", lua_millis},
     {"micros", lua_micros},
+    {"nav_state", lua_nav_state},
+    {"register_rate_hook", lua_scripts::lua_register_rate_hook},
     {NULL, NULL}
 };
 
@@ -119,7 +208,7 @@ static int AP_Logger_Write(lua_State *L) {
     struct AP_Logger::log_write_fmt *f;
     if (!have_units) {
         // ask for a mesage type
-        f = AP_logger->msg_fmt_for_name(name, label_cat, nullptr, nullptr, fmt_cat, true);
+        f = AP_logger->msg_fmt_for_name(name, label_cat, nullptr, nullptr, fmt_cat);
 
     } else {
         // read in units and multiplers strings
@@ -142,7 +231,7 @@ static int AP_Logger_Write(lua_State *L) {
         strcat(multipliers_cat,multipliers);
 
         // ask for a mesage type
-        f = AP_logger->msg_fmt_for_name(name, label_cat, units_cat, multipliers_cat, fmt_cat, true);
+        f = AP_logger->msg_fmt_for_name(name, label_cat, units_cat, multipliers_cat, fmt_cat);
     }
 
     if (f == nullptr) {
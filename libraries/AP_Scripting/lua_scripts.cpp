@@ -15,6 +15,7 @@
 
 #include "lua_scripts.h"
 #include <AP_HAL/AP_HAL.h>
+#include <AP_AHRS/AP_AHRS.h>
 #include <GCS_MAVLink/GCS.h>
 #include "AP_Scripting.h"
 
@@ -25,8 +26,13 @@ extern const AP_HAL::HAL& hal;
 bool lua_scripts::overtime;
 jmp_buf lua_scripts::panic_jmp;
 
+int lua_scripts::_rate_hook_ref = LUA_NOREF;
+uint32_t lua_scripts::_rate_hook_period_us;
+uint32_t lua_scripts::_rate_hook_last_us;
+
 lua_scripts::lua_scripts(const AP_Int32 &vm_steps, const AP_Int32 &heap_size, const AP_Int8 &debug_level, struct AP_Scripting::terminal_s &_terminal)
     : _vm_steps(vm_steps),
+      _heap_size(heap_size),
       _debug_level(debug_level),
      terminal(_terminal) {
     _heap = hal.util->allocate_heap_memory(heap_size);
@@ -35,8 +41,17 @@ lua_scripts::lua_scripts(const AP_Int32 &vm_steps, const AP_Int32 &heap_size, co
 void lua_scripts::hook(lua_State *L, lua_Debug *ar) {
     lua_scripts::overtime = true;
 
-    // we need to aggressively bail out as we are over time
-    // so we will aggressively trap errors until we clear out
+    if (lua_isyieldable(L)) {
+        // the script is running as a coroutine, so rather than killing
+        // it we yield its time slice back to the scheduler, which will
+        // resume it after other due scripts have run
+        lua_yield(L, 0);
+        return;
+    }
+
+    // not yieldable (main state, or mid C call such as pcall). We need
+    // to aggressively bail out as we are over time so we will
+    // aggressively trap errors until we clear out
     lua_sethook(L, hook, LUA_MASKCOUNT, 1);
 
     luaL_error(L, "Exceeded CPU time");
@@ -84,6 +99,8 @@ lua_scripts::script_info *lua_scripts::load_script(lua_State *L, char *filename)
 
     new_script->name = filename;
     new_script->next = nullptr;
+    new_script->coroutine_ref = LUA_NOREF;
+    new_script->slices = 0;
 
     create_sandbox(L);
     lua_setupvalue(L, -2, 1);
@@ -128,7 +145,7 @@ void lua_scripts::load_all_scripts_in_dir(lua_State *L, const char *dirname) {
         return;
     }
 
-    // load anything that ends in .lua
+    // load anything that ends in .lua or .luac
     for (struct dirent *de=AP::FS().readdir(d); de; de=AP::FS().readdir(d)) {
         uint8_t length = strlen(de->d_name);
         if (length < 5) {
@@ -136,8 +153,11 @@ void lua_scripts::load_all_scripts_in_dir(lua_State *L, const char *dirname) {
             continue;
         }
 
-        if (strncmp(&de->d_name[length-4], ".lua", 4)) {
-            // doesn't end in .lua
+        // accept both source (.lua) and precompiled (.luac) chunks;
+        // luaL_loadfile loads text and binary chunks alike, and
+        // precompiled chunks skip the parse and compile at boot
+        if (strncmp(&de->d_name[length-4], ".lua", 4) != 0 &&
+            (length < 6 || strncmp(&de->d_name[length-5], ".luac", 5) != 0)) {
             continue;
         }
 
@@ -168,6 +188,104 @@ void lua_scripts::reset_loop_overtime(lua_State *L) {
     lua_sethook(L, hook, LUA_MASKCOUNT, vm_steps);
 }
 
+/*
+  binding: register_rate_hook(fn, rate_hz) or register_rate_hook() to
+  clear. The function is called from the scripting thread whenever the
+  scheduler is idle between scripts, at up to 400Hz
+ */
+int lua_scripts::lua_register_rate_hook(lua_State *L) {
+    const int args = lua_gettop(L);
+    if (args == 0 || lua_isnil(L, 1)) {
+        if (_rate_hook_ref != LUA_NOREF) {
+            luaL_unref(L, LUA_REGISTRYINDEX, _rate_hook_ref);
+            _rate_hook_ref = LUA_NOREF;
+        }
+        return 0;
+    }
+    if (args != 2) {
+        return luaL_error(L, "register_rate_hook expected 2 arguments got %d", args);
+    }
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+    const float rate_hz = constrain_float(luaL_checknumber(L, 2), 1, 400);
+
+    if (_rate_hook_ref != LUA_NOREF) {
+        luaL_unref(L, LUA_REGISTRYINDEX, _rate_hook_ref);
+    }
+    lua_pushvalue(L, 1);
+    _rate_hook_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    _rate_hook_period_us = uint32_t(1e6f / rate_hz);
+    _rate_hook_last_us = AP_HAL::micros();
+    return 0;
+}
+
+/*
+  run the registered high-rate hook once on the main state. The inputs
+  (gyro and attitude) are gathered under one AHRS semaphore take and
+  pushed as plain numbers, so a call allocates nothing. The hook gets a
+  tenth of the normal instruction budget; overrunning or erroring
+  deregisters it
+ */
+void lua_scripts::run_rate_hook(lua_State *L) {
+    overtime = false;
+    const int32_t vm_steps = MAX(_vm_steps / 10, 500);
+    lua_sethook(L, hook, LUA_MASKCOUNT, vm_steps);
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, _rate_hook_ref);
+
+    Vector3f gyro;
+    float roll, pitch, yaw;
+    {
+        AP_AHRS &ahrs = AP::ahrs();
+        WITH_SEMAPHORE(ahrs.get_semaphore());
+        gyro = ahrs.get_gyro();
+        roll = ahrs.roll;
+        pitch = ahrs.pitch;
+        yaw = ahrs.yaw;
+    }
+    lua_pushnumber(L, gyro.x);
+    lua_pushnumber(L, gyro.y);
+    lua_pushnumber(L, gyro.z);
+    lua_pushnumber(L, roll);
+    lua_pushnumber(L, pitch);
+    lua_pushnumber(L, yaw);
+
+    const int status = lua_pcall(L, 6, 0, 0);
+    lua_sethook(L, nullptr, 0, 0);
+    if (status != LUA_OK) {
+        if (overtime) {
+            gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: rate hook exceeded time limit");
+        } else {
+            gcs().send_text(MAV_SEVERITY_INFO, "Lua: rate hook error: %s", lua_tostring(L, -1));
+        }
+        lua_pop(L, 1);
+        luaL_unref(L, LUA_REGISTRYINDEX, _rate_hook_ref);
+        _rate_hook_ref = LUA_NOREF;
+    }
+}
+
+/*
+  wait until wake_ms, serving the registered rate hook on its period
+  instead of sleeping through the whole gap
+ */
+void lua_scripts::serve_rate_hook(lua_State *L, uint64_t wake_ms) {
+    uint64_t now_ms;
+    while ((now_ms = AP_HAL::millis64()) < wake_ms) {
+        if (_rate_hook_ref == LUA_NOREF) {
+            hal.scheduler->delay(wake_ms - now_ms);
+            return;
+        }
+        const uint32_t now_us = AP_HAL::micros();
+        if (now_us - _rate_hook_last_us >= _rate_hook_period_us) {
+            _rate_hook_last_us = now_us;
+            run_rate_hook(L);
+            continue;
+        }
+        uint32_t sleep_us = _rate_hook_period_us - (now_us - _rate_hook_last_us);
+        sleep_us = MIN(sleep_us, uint32_t((wake_ms - now_ms) * 1000ULL));
+        hal.scheduler->delay_microseconds(MAX(sleep_us, 100U));
+    }
+}
+
 void lua_scripts::run_next_script(lua_State *L) {
     if (scripts == nullptr) {
 #if defined(AP_SCRIPTING_CHECKS) && AP_SCRIPTING_CHECKS >= 1
@@ -181,29 +299,60 @@ void lua_scripts::run_next_script(lua_State *L) {
     script_info *script = scripts;
     scripts = script->next;
 
-    // reset the hook to clear the counter
-    reset_loop_overtime(L);
+    // each script runs as a coroutine so that the instruction count
+    // hook can yield its time slice back to us rather than killing it,
+    // letting a heavy script interleave fairly with the others
+    lua_State *co;
+    if (script->coroutine_ref != LUA_NOREF) {
+        // resume a partially run script from its saved coroutine
+        lua_rawgeti(L, LUA_REGISTRYINDEX, script->coroutine_ref);
+        co = lua_tothread(L, -1);
+        lua_pop(L, 1);
+    } else {
+        co = lua_newthread(L);
+        script->coroutine_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+        // push the function to be run onto the coroutine stack
+        lua_rawgeti(co, LUA_REGISTRYINDEX, script->lua_ref);
+    }
 
-    // store top of stack so we can calculate the number of return values
-    int stack_top = lua_gettop(L);
+    // reset the hook on the coroutine to clear the counter
+    reset_loop_overtime(co);
 
-    // pop the function to the top of the stack
-    lua_rawgeti(L, LUA_REGISTRYINDEX, script->lua_ref);
+    const int status = lua_resume(co, L, 0);
 
-    if(lua_pcall(L, 0, LUA_MULTRET, 0)) {
+    if (status == LUA_YIELD) {
+        // the instruction budget for this slice was used up. Requeue
+        // at the run start time so any other due script gets a slice
+        // before this one continues
+        if (++script->slices >= max_slices) {
+            // script has consumed an excessive amount of CPU time
+            gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s exceeded time limit", script->name);
+            remove_script(L, script);
+            return;
+        }
+        script->next_run_ms = start_time_ms;
+        reschedule_script(script);
+        return;
+    }
+
+    // the run has finished, drop the coroutine
+    luaL_unref(L, LUA_REGISTRYINDEX, script->coroutine_ref);
+    script->coroutine_ref = LUA_NOREF;
+    script->slices = 0;
+
+    if (status != LUA_OK) {
         if (overtime) {
             // script has consumed an excessive amount of CPU time
             gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s exceeded time limit", script->name);
             remove_script(L, script);
         } else {
-            hal.console->printf("Lua: Error: %s\n", lua_tostring(L, -1));
-            gcs().send_text(MAV_SEVERITY_INFO, "Lua: %s", lua_tostring(L, -1));
+            hal.console->printf("Lua: Error: %s\n", lua_tostring(co, -1));
+            gcs().send_text(MAV_SEVERITY_INFO, "Lua: %s", lua_tostring(co, -1));
             remove_script(L, script);
         }
-        lua_pop(L, 1);
         return;
     } else {
-        int returned = lua_gettop(L) - stack_top;
+        int returned = lua_gettop(co);
         switch (returned) {
             case 0:
                 // no time to reschedule so bail out
@@ -212,24 +361,24 @@ void lua_scripts::run_next_script(lua_State *L) {
             case 2:
                 {
                    // sanity check the return types
-                   if (lua_type(L, -1) != LUA_TNUMBER) {
-                       gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s did not return a delay (0x%d)", script->name, lua_type(L, -1));
-                       lua_pop(L, 2);
+                   if (lua_type(co, -1) != LUA_TNUMBER) {
+                       gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s did not return a delay (0x%d)", script->name, lua_type(co, -1));
+                       lua_pop(co, 2);
                        remove_script(L, script);
                        return;
                    }
-                   if (lua_type(L, -2) != LUA_TFUNCTION) {
-                       gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s did not return a function (0x%d)", script->name, lua_type(L, -2));
-                       lua_pop(L, 2);
+                   if (lua_type(co, -2) != LUA_TFUNCTION) {
+                       gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s did not return a function (0x%d)", script->name, lua_type(co, -2));
+                       lua_pop(co, 2);
                        remove_script(L, script);
                        return;
                    }
 
                    // types match the expectations, go ahead and reschedule
-                   script->next_run_ms = start_time_ms + (uint64_t)luaL_checknumber(L, -1);
-                   lua_pop(L, 1);
+                   script->next_run_ms = start_time_ms + (uint64_t)luaL_checknumber(co, -1);
+                   lua_pop(co, 1);
                    int old_ref = script->lua_ref;
-                   script->lua_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+                   script->lua_ref = luaL_ref(co, LUA_REGISTRYINDEX);
                    luaL_unref(L, LUA_REGISTRYINDEX, old_ref);
                    reschedule_script(script);
                    break;
@@ -239,7 +388,7 @@ void lua_scripts::run_next_script(lua_State *L) {
                     gcs().send_text(MAV_SEVERITY_CRITICAL, "Lua: %s returned bad result count (%d)", script->name, returned);
                     remove_script(L, script);
                     // pop all the results we got that we didn't expect
-                    lua_pop(L, returned);
+                    lua_pop(co, returned);
                     break;
                  }
          }
@@ -268,6 +417,9 @@ void lua_scripts::remove_script(lua_State *L, script_info *script) {
     if (L != nullptr) {
         // state could be null if we are force killing all scripts
         luaL_unref(L, LUA_REGISTRYINDEX, script->lua_ref);
+        if (script->coroutine_ref != LUA_NOREF) {
+            luaL_unref(L, LUA_REGISTRYINDEX, script->coroutine_ref);
+        }
     }
     hal.util->heap_realloc(_heap, script->name, 0);
     hal.util->heap_realloc(_heap, script, 0);
@@ -350,6 +502,8 @@ void lua_scripts::run(void) {
         }
         scripts = nullptr;
         overtime = false;
+        // the registry holding the rate hook died with the state
+        _rate_hook_ref = LUA_NOREF;
         // end any open REPL sessions
         repl_cleanup();
     }
@@ -411,7 +565,7 @@ void lua_scripts::run(void) {
             // compute delay time
             uint64_t now_ms = AP_HAL::millis64();
             if (now_ms < scripts->next_run_ms) {
-                hal.scheduler->delay(scripts->next_run_ms - now_ms);
+                serve_rate_hook(L, scripts->next_run_ms);
             }
 
             if (_debug_level > 1) {
@@ -432,14 +586,23 @@ void lua_scripts::run(void) {
                                                     (int)(endMem - startMem));
             }
 
-            // garbage collect after each script, this shouldn't matter, but seems to resolve a memory leak
-            lua_gc(L, LUA_GCCOLLECT, 0);
+            // garbage collect after each script. An incremental step
+            // sized to what the script just allocated keeps the
+            // collector paced with allocation while bounding the pause
+            // length; fall back to a full collection when over half of
+            // the heap is in use so we never let garbage accumulate to
+            // the point of allocation failure
+            if (endMem * 2 > _heap_size) {
+                lua_gc(L, LUA_GCCOLLECT, 0);
+            } else {
+                lua_gc(L, LUA_GCSTEP, MAX((endMem - startMem) / 1024, 0) + 1);
+            }
 
         } else {
             if (_debug_level > 0) {
                 gcs().send_text(MAV_SEVERITY_DEBUG, "Lua: No scripts to run");
             }
-            hal.scheduler->delay(1000);
+            serve_rate_hook(L, AP_HAL::millis64() + 1000);
         }
 
     }
@@ -62,19 +62,43 @@ public:
     void run(void);
 
     static bool overtime; // script exceeded it's execution slot, and we are bailing out
+
+    // binding: register_rate_hook(fn, rate_hz) registers a function
+    // called from the scripting thread at up to 400Hz while the
+    // scheduler is idle between scripts; register_rate_hook() clears it
+    static int lua_register_rate_hook(lua_State *L);
+
 private:
 
+    /*
+      high-rate hook. Inputs are pushed as plain numbers (no userdata,
+      no allocation) so the per-call cost is a stack fill and a pcall,
+      bounded by the same instruction-count hook that polices scripts
+     */
+    static int _rate_hook_ref;        // LUA_NOREF when not registered
+    static uint32_t _rate_hook_period_us;
+    static uint32_t _rate_hook_last_us;
+
+    void run_rate_hook(lua_State *L);
+    void serve_rate_hook(lua_State *L, uint64_t wake_ms);
+
     void create_sandbox(lua_State *L);
 
     void repl_cleanup(void);
 
     typedef struct script_info {
        int lua_ref;          // reference to the loaded script object
+       int coroutine_ref;    // reference to the coroutine of a partially run script, or LUA_NOREF
+       uint16_t slices;      // number of instruction budget slices used by the current run
        uint64_t next_run_ms; // time (in milliseconds) the script should next be run at
        char *name;           // filename for the script // FIXME: This information should be available from Lua
        script_info *next;
     } script_info;
 
+    // maximum number of instruction budget slices a single scheduled
+    // run may use before the script is considered runaway and removed
+    static const uint16_t max_slices = 100;
+
     script_info *load_script(lua_State *L, char *filename);
 
     void reset_loop_overtime(lua_State *L);
@@ -115,6 +139,7 @@ private:
     lua_State *lua_state;
 
     const AP_Int32 & _vm_steps;
+    const AP_Int32 & _heap_size;
     const AP_Int8 & _debug_level;
 
     static void *alloc(void *ud, void *ptr, size_t osize, size_t nsize);
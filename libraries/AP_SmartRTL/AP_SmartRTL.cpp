@@ -19,6 +19,8 @@
 
 extern const AP_HAL::HAL& hal;
 
+static bool segments_may_be_close(const Vector3f &p1, const Vector3f &p2, const Vector3f &p3, const Vector3f &p4, float margin);
+
 const AP_Param::GroupInfo AP_SmartRTL::var_info[] = {
     // @Param: ACCURACY
     // @DisplayName: SmartRTL accuracy
@@ -31,7 +33,7 @@ const AP_Param::GroupInfo AP_SmartRTL::var_info[] = {
     // @Param: POINTS
     // @DisplayName: SmartRTL maximum number of points on path
     // @Description: SmartRTL maximum number of points on path. Set to 0 to disable SmartRTL.  100 points consumes about 3k of memory.
-    // @Range: 0 500
+    // @Range: 0 2000
     // @User: Advanced
     // @RebootRequired: True
     AP_GROUPINFO("POINTS", 1, AP_SmartRTL, _points_max, SMARTRTL_POINTS_DEFAULT),
@@ -558,6 +560,11 @@ void AP_SmartRTL::detect_loops()
             }
         }
 
+        // cheap bounding box rejection before the expensive distance calculation
+        if (!segments_may_be_close(_path[_prune.i], _path[_prune.i-1], _path[_prune.j-1], _path[_prune.j], SMARTRTL_PRUNING_DELTA)) {
+            continue;
+        }
+
         // find the closest distance between two line segments and the mid-point
         dist_point dp = segment_segment_dist(_path[_prune.i], _path[_prune.i-1], _path[_prune.j-1], _path[_prune.j]);
         if (dp.distance < SMARTRTL_PRUNING_DELTA) {
@@ -780,6 +787,24 @@ bool AP_SmartRTL::add_loop(uint16_t start_index, uint16_t end_index, const Vecto
     return true;
 }
 
+/**
+*  Returns true if the bounding boxes of two segments (p1 to p2, and p3 to p4) come within margin of each other.
+*  This is a cheap over-estimate used to reject segment pairs before paying for the full segment_segment_dist calculation.
+*/
+static bool segments_may_be_close(const Vector3f &p1, const Vector3f &p2, const Vector3f &p3, const Vector3f &p4, float margin)
+{
+    float dist_sq = 0.0f;
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        // gap between the two bounding boxes on this axis (negative if they overlap)
+        const float gap = MAX(MIN(p1[axis], p2[axis]) - MAX(p3[axis], p4[axis]),
+                              MIN(p3[axis], p4[axis]) - MAX(p1[axis], p2[axis]));
+        if (is_positive(gap)) {
+            dist_sq += sq(gap);
+        }
+    }
+    return dist_sq <= sq(margin);
+}
+
 /**
 *  Returns the closest distance in 3D space between any part of two input segments, defined from p1 to p2 and from p3 to p4.
 *  Also returns the point which is halfway between
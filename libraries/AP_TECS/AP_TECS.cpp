@@ -244,8 +244,8 @@ const AP_Param::GroupInfo AP_TECS::var_info[] = {
 
     // @Param: OPTIONS
     // @DisplayName: Extra TECS options
-    // @Description: This allows the enabling of special features in the speed/height controller
-    // @Bitmask: 0:GliderOnly
+    // @Description: This allows the enabling of special features in the speed/height controller. Setting DecimateEnergyPath runs the demand shaping and energy estimation calculations at one quarter of the normal rate, reclaiming loop budget on slower autopilots; the throttle and pitch demand loops still run at the full rate.
+    // @Bitmask: 0:GliderOnly,1:DecimateEnergyPath
     // @User: Advanced
     AP_GROUPINFO("OPTIONS", 28, AP_TECS, _options, 0),
 
@@ -437,8 +437,9 @@ void AP_TECS::_update_speed_demand(void)
     const float velRateMin = 0.5f * _STEdot_min / _TAS_state;
     const float TAS_dem_previous = _TAS_dem_adj;
 
-    // assume fixed 10Hz call rate
-    const float dt = 0.1;
+    // demand shaping interval; the fixed 10Hz call rate unless the
+    // energy path is being decimated
+    const float dt = _dt_demand;
 
     // Apply rate limit
     if ((_TAS_dem - TAS_dem_previous) > (velRateMax * dt))
@@ -477,18 +478,20 @@ void AP_TECS::_update_height_demand(void)
     }
 
     // Limit height rate of change
-    if ((_hgt_dem - _hgt_dem_prev) > (_maxClimbRate * 0.1f))
+    if ((_hgt_dem - _hgt_dem_prev) > (_maxClimbRate * _dt_demand))
     {
-        _hgt_dem = _hgt_dem_prev + _maxClimbRate * 0.1f;
+        _hgt_dem = _hgt_dem_prev + _maxClimbRate * _dt_demand;
     }
-    else if ((_hgt_dem - _hgt_dem_prev) < (-max_sink_rate * 0.1f))
+    else if ((_hgt_dem - _hgt_dem_prev) < (-max_sink_rate * _dt_demand))
     {
-        _hgt_dem = _hgt_dem_prev - max_sink_rate * 0.1f;
+        _hgt_dem = _hgt_dem_prev - max_sink_rate * _dt_demand;
     }
     _hgt_dem_prev = _hgt_dem;
 
-    // Apply first order lag to height demand
-    _hgt_dem_adj = 0.05f * _hgt_dem + 0.95f * _hgt_dem_adj_last;
+    // Apply first order lag to height demand. The coefficient is 0.05
+    // at the normal 10Hz rate, equivalent to a 1.9 second time constant
+    const float hgt_dem_alpha = _dt_demand / (_dt_demand + 1.9f);
+    _hgt_dem_adj = hgt_dem_alpha * _hgt_dem + (1.0f - hgt_dem_alpha) * _hgt_dem_adj_last;
 
     // when flaring force height rate demand to the
     // configured sink rate and adjust the demanded height to
@@ -510,10 +513,10 @@ void AP_TECS::_update_height_demand(void)
         } else {
             _hgt_rate_dem = - land_sink_rate_adj;
         }
-        _land_hgt_dem += 0.1f * _hgt_rate_dem;
+        _land_hgt_dem += _dt_demand * _hgt_rate_dem;
         _hgt_dem_adj = _land_hgt_dem;
     } else {
-        _hgt_rate_dem = (_hgt_dem_adj - _hgt_dem_adj_last) / 0.1f;
+        _hgt_rate_dem = (_hgt_dem_adj - _hgt_dem_adj_last) / _dt_demand;
         _flare_counter = 0;
     }
 
@@ -525,11 +528,11 @@ void AP_TECS::_update_height_demand(void)
     float new_hgt_dem = _hgt_dem_adj;
     if (_flags.is_doing_auto_land) {
         if (hgt_dem_lag_filter_slew < 1) {
-            hgt_dem_lag_filter_slew += 0.1f; // increment at 10Hz to gradually apply the compensation at first
+            hgt_dem_lag_filter_slew += _dt_demand; // gradually apply the compensation over the first second
         } else {
             hgt_dem_lag_filter_slew = 1;
         }
-        new_hgt_dem += hgt_dem_lag_filter_slew*(_hgt_dem_adj - _hgt_dem_adj_last)*10.0f*(timeConstant()+1);
+        new_hgt_dem += hgt_dem_lag_filter_slew*(_hgt_dem_adj - _hgt_dem_adj_last)*(timeConstant()+1)/_dt_demand;
     } else {
         hgt_dem_lag_filter_slew = 0;
     }
@@ -1130,20 +1133,41 @@ void AP_TECS::update_pitch_throttle(int32_t hgt_dem_cm,
     // initialise selected states and variables if DT > 1 second or in climbout
     _initialise_states(ptchMinCO_cd, hgt_afe);
 
-    // Calculate Specific Total Energy Rate Limits
-    _update_STE_rate_lim();
+    // the demand shaping and energy estimation path can be decimated
+    // to reclaim loop budget on slower autopilots. The throttle and
+    // pitch loops below still run every call; between energy updates
+    // they integrate against the last computed energy errors, which
+    // move slowly relative to the call rate. Landing and takeoff
+    // always run the full rate path as the flare and climbout shaping
+    // is tuned for 10Hz
+    bool run_energy_path = true;
+    if ((_options & OPTION_DECIMATE_ENERGY) &&
+        !_flags.is_doing_auto_land &&
+        flight_stage != AP_Vehicle::FixedWing::FLIGHT_TAKEOFF &&
+        flight_stage != AP_Vehicle::FixedWing::FLIGHT_ABORT_LAND) {
+        run_energy_path = (_energy_path_counter++ & 0x03U) == 0;
+        _dt_demand = 0.4f;
+    } else {
+        _energy_path_counter = 0;
+        _dt_demand = 0.1f;
+    }
 
-    // Calculate the speed demand
-    _update_speed_demand();
+    if (run_energy_path) {
+        // Calculate Specific Total Energy Rate Limits
+        _update_STE_rate_lim();
 
-    // Calculate the height demand
-    _update_height_demand();
+        // Calculate the speed demand
+        _update_speed_demand();
 
-    // Detect underspeed condition
-    _detect_underspeed();
+        // Calculate the height demand
+        _update_height_demand();
 
-    // Calculate specific energy quantitiues
-    _update_energies();
+        // Detect underspeed condition
+        _detect_underspeed();
+
+        // Calculate specific energy quantitiues
+        _update_energies();
+    }
 
     // Calculate throttle demand - use simple pitch to throttle if no
     // airspeed sensor.
@@ -185,6 +185,7 @@ private:
 
     enum {
         OPTION_GLIDER_ONLY=(1<<0),
+        OPTION_DECIMATE_ENERGY=(1<<1),
     };
 
     AP_Float _pitch_ff_v0;
@@ -337,6 +338,15 @@ private:
     // Time since last update of main TECS loop (seconds)
     float _DT;
 
+    // Time between demand shaping and energy estimation updates
+    // (seconds). This is the fixed 10Hz call interval unless the
+    // energy path is being decimated via TECS_OPTIONS
+    float _dt_demand = 0.1f;
+
+    // counter used to decimate the demand shaping and energy
+    // estimation path when enabled in TECS_OPTIONS
+    uint8_t _energy_path_counter;
+
     // counter for demanded sink rate on land final
     uint8_t _flare_counter;
 
@@ -296,6 +296,35 @@ float AP_Terrain::lookahead(float bearing, float distance, float climb_ratio)
 }
 
 
+/*
+  pre-load grid blocks along the velocity vector into the cache. By
+  touching the blocks the vehicle is about to fly over we get the disk
+  reads started well before height_amsl() needs the data, avoiding
+  terrain status dropouts when crossing block boundaries at speed
+ */
+void AP_Terrain::prefetch_path(const Location &loc)
+{
+    const Vector2f vel = AP::ahrs().groundspeed_vector();
+    if (vel.length() < 2) {
+        // too slow for the predicted position to differ usefully from
+        // the current one
+        return;
+    }
+
+    // look at the mid-point as well as the full horizon so we don't
+    // skip over a block on a diagonal crossing
+    const float horizons[] { TERRAIN_PREFETCH_SECONDS * 0.5f, TERRAIN_PREFETCH_SECONDS };
+    for (uint8_t i=0; i<ARRAY_SIZE(horizons); i++) {
+        Location ploc = loc;
+        ploc.offset(vel.x * horizons[i], vel.y * horizons[i]);
+        struct grid_info info;
+        calculate_grid_info(ploc, info);
+        // this marks the block as waiting for disk read if we don't
+        // already have it, and refreshes its LRU timestamp if we do
+        find_grid_cache(info);
+    }
+}
+
 /*
   1hz update function. This is here to ensure progress is made on disk
   IO even if no MAVLink send_request() operations are called for a
@@ -322,6 +351,11 @@ void AP_Terrain::update(void)
         have_current_loc_height = true;
     }
 
+    // warm the cache along the flight path
+    if (pos_valid && allocate()) {
+        prefetch_path(loc);
+    }
+
     // check for pending mission data
     update_mission_data();
 
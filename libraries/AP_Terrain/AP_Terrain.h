@@ -51,8 +51,16 @@
 #define TERRAIN_GRID_BLOCK_SIZE_X (TERRAIN_GRID_MAVLINK_SIZE*TERRAIN_GRID_BLOCK_MUL_X)
 #define TERRAIN_GRID_BLOCK_SIZE_Y (TERRAIN_GRID_MAVLINK_SIZE*TERRAIN_GRID_BLOCK_MUL_Y)
 
-// number of grid_blocks in the LRU memory cache
+// number of grid_blocks in the LRU memory cache. Each block costs a
+// little over 2k of memory; boards with more memory can override this
+// in their hwdef to reduce cache misses in fast terrain following
+#ifndef TERRAIN_GRID_BLOCK_CACHE_SIZE
 #define TERRAIN_GRID_BLOCK_CACHE_SIZE 12
+#endif
+
+// how many seconds along the velocity vector to warm the cache in
+// update(), so block boundary crossings don't stall height_amsl()
+#define TERRAIN_PREFETCH_SECONDS 15
 
 // format of grid on disk
 #define TERRAIN_GRID_FORMAT_VERSION 1
@@ -79,6 +87,8 @@
   file:        first entries increase east, then north
  */
 
+class ExpandingString;
+
 class AP_Terrain {
 public:
     AP_Terrain(const AP_Mission &_mission);
@@ -186,6 +196,15 @@ public:
      */
     void get_statistics(uint16_t &pending, uint16_t &loaded) const;
 
+    /*
+      generate a manifest of the on-disk terrain tiles (name, size and
+      CRC32 of each degree file) for @SYS/terrain.txt. A GCS can fetch
+      this over MAVLink FTP, diff it against locally generated tiles
+      and upload only the missing or stale files, instead of streaming
+      tiles one 4x4 block at a time over TERRAIN_REQUEST
+     */
+    void tile_manifest(ExpandingString &str);
+
     /*
       returns true if initialisation failed because out-of-memory
      */
@@ -294,6 +313,11 @@ private:
     */
     struct grid_cache &find_grid_cache(const struct grid_info &info);
 
+    /*
+      pre-load grid blocks along the velocity vector into the cache
+    */
+    void prefetch_path(const Location &loc);
+
     /*
       calculate bit number in grid_block bitmap. This corresponds to a
       bit representing a 4x4 mavlink transmitted block
@@ -364,6 +388,10 @@ private:
     uint8_t cache_size = 0;
     struct grid_cache *cache = nullptr;
 
+    // index of the last cache hit. Consecutive lookups almost always
+    // land in the same block, so this slot is checked before scanning
+    uint8_t cache_last_hit;
+
     // a grid_cache block waiting for disk IO
     enum DiskIoState {
         DiskIoIdle      = 0,
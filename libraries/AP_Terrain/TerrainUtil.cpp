@@ -26,6 +26,7 @@
 #if AP_TERRAIN_AVAILABLE
 
 #include <AP_Filesystem/AP_Filesystem.h>
+#include <AP_Common/ExpandingString.h>
 
 extern const AP_HAL::HAL& hal;
 
@@ -111,12 +112,23 @@ AP_Terrain::grid_cache &AP_Terrain::find_grid_cache(const struct grid_info &info
 {
     uint16_t oldest_i = 0;
 
+    // consecutive lookups almost always hit the same block, so check
+    // the last hit before scanning the whole cache
+    if (cache_last_hit < cache_size &&
+        TERRAIN_LATLON_EQUAL(cache[cache_last_hit].grid.lat,info.grid_lat) &&
+        TERRAIN_LATLON_EQUAL(cache[cache_last_hit].grid.lon,info.grid_lon) &&
+        cache[cache_last_hit].grid.spacing == grid_spacing) {
+        cache[cache_last_hit].last_access_ms = AP_HAL::millis();
+        return cache[cache_last_hit];
+    }
+
     // see if we have that grid
     for (uint16_t i=0; i<cache_size; i++) {
         if (TERRAIN_LATLON_EQUAL(cache[i].grid.lat,info.grid_lat) &&
             TERRAIN_LATLON_EQUAL(cache[i].grid.lon,info.grid_lon) &&
             cache[i].grid.spacing == grid_spacing) {
             cache[i].last_access_ms = AP_HAL::millis();
+            cache_last_hit = i;
             return cache[i];
         }
         if (cache[i].last_access_ms < cache[oldest_i].last_access_ms) {
@@ -126,6 +138,7 @@ AP_Terrain::grid_cache &AP_Terrain::find_grid_cache(const struct grid_info &info
 
     // Not found. Use the oldest grid and make it this grid,
     // initially unpopulated
+    cache_last_hit = oldest_i;
     struct grid_cache &grid = cache[oldest_i];
     memset(&grid, 0, sizeof(grid));
 
@@ -180,4 +193,51 @@ uint16_t AP_Terrain::get_block_crc(struct grid_block &block)
     return ret;
 }
 
+/*
+  generate a manifest of the on-disk terrain tiles for
+  @SYS/terrain.txt. Format is one header line giving the grid spacing,
+  then one line per degree file with name, size in bytes and CRC32 of
+  the file contents.
+
+  This is read over MAVLink FTP so it runs in the FTP thread, not the
+  terrain IO thread. Tiles are read via a private descriptor so the IO
+  thread file state is not disturbed; a tile being written while it is
+  hashed will show a mismatched CRC and simply be re-sent by the GCS
+ */
+void AP_Terrain::tile_manifest(ExpandingString &str)
+{
+    const char *terrain_dir = hal.util->get_custom_terrain_directory();
+    if (terrain_dir == nullptr) {
+        terrain_dir = HAL_BOARD_TERRAIN_DIRECTORY;
+    }
+    str.printf("TerrainManifest v1 spacing=%u\n", unsigned(grid_spacing.get()));
+    auto *d = AP::FS().opendir(terrain_dir);
+    if (d == nullptr) {
+        return;
+    }
+    for (struct dirent *de = AP::FS().readdir(d); de != nullptr; de = AP::FS().readdir(d)) {
+        const char *dot = strrchr(de->d_name, '.');
+        if (dot == nullptr || strcasecmp(dot, ".DAT") != 0) {
+            continue;
+        }
+        char path[100];
+        hal.util->snprintf(path, sizeof(path), "%s/%s", terrain_dir, de->d_name);
+        const int tile_fd = AP::FS().open(path, O_RDONLY);
+        if (tile_fd == -1) {
+            continue;
+        }
+        uint32_t crc = 0;
+        uint32_t size = 0;
+        uint8_t buf[256];
+        int32_t n;
+        while ((n = AP::FS().read(tile_fd, buf, sizeof(buf))) > 0) {
+            crc = crc_crc32(crc, buf, n);
+            size += n;
+        }
+        AP::FS().close(tile_fd);
+        str.printf("%s %u %08x\n", de->d_name, unsigned(size), unsigned(crc));
+    }
+    AP::FS().closedir(d);
+}
+
 #endif // AP_TERRAIN_AVAILABLE
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+'''
+sync locally generated terrain tiles to a vehicle over MAVLink FTP
+
+The vehicle publishes a manifest of its on-disk tiles at
+@SYS/terrain.txt (name, size and CRC32 per degree file). This tool
+compares that manifest against a local directory of .DAT tiles (as
+produced by create_terrain.py) and reports which tiles need to be
+uploaded, so a pre-mission terrain load only transfers the missing or
+stale files instead of streaming 4x4 blocks over TERRAIN_REQUEST.
+
+Typical use with MAVProxy:
+
+  ftp get @SYS/terrain.txt manifest.txt
+  terrain_sync.py manifest.txt terrain/ --mavproxy-cmds > upload.scr
+  script upload.scr
+'''
+
+import argparse
+import binascii
+import os
+import sys
+
+
+def crc32_file(path):
+    crc = 0
+    with open(path, 'rb') as f:
+        while True:
+            chunk = f.read(65536)
+            if not chunk:
+                break
+            crc = binascii.crc32(chunk, crc)
+    return crc & 0xFFFFFFFF
+
+
+def parse_manifest(path):
+    '''return dict of name -> (size, crc32) from a @SYS/terrain.txt dump'''
+    tiles = {}
+    with open(path, 'r') as f:
+        header = f.readline().split()
+        if not header or header[0] != 'TerrainManifest':
+            print("%s does not look like a @SYS/terrain.txt dump" % path)
+            sys.exit(1)
+        for line in f:
+            fields = line.split()
+            if len(fields) != 3:
+                continue
+            tiles[fields[0].upper()] = (int(fields[1]), int(fields[2], 16))
+    return tiles
+
+
+def local_tiles(directory):
+    '''return dict of name -> path for all .DAT files in directory'''
+    tiles = {}
+    for name in os.listdir(directory):
+        if name.upper().endswith('.DAT'):
+            tiles[name.upper()] = os.path.join(directory, name)
+    return tiles
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('manifest', help='manifest fetched from @SYS/terrain.txt')
+    parser.add_argument('tiledir', help='directory of locally generated .DAT tiles')
+    parser.add_argument('--destdir', default='APM/TERRAIN',
+                        help='terrain directory on the vehicle')
+    parser.add_argument('--mavproxy-cmds', action='store_true',
+                        help='print MAVProxy ftp put commands instead of a report')
+    args = parser.parse_args()
+
+    vehicle = parse_manifest(args.manifest)
+    local = local_tiles(args.tiledir)
+
+    to_upload = []
+    for name, path in sorted(local.items()):
+        have = vehicle.get(name)
+        if have is not None and have == (os.path.getsize(path), crc32_file(path)):
+            continue
+        to_upload.append((name, path, have is None))
+
+    if args.mavproxy_cmds:
+        for name, path, missing in to_upload:
+            print("ftp put %s %s/%s" % (path, args.destdir, name))
+        return
+
+    for name, path, missing in to_upload:
+        print("%s: %s" % (name, "missing" if missing else "stale"))
+    print("%u of %u local tiles need upload" % (len(to_upload), len(local)))
+
+
+if __name__ == '__main__':
+    main()
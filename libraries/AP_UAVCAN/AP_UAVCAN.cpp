@@ -16,6 +16,7 @@
  */
 
 #include <AP_Common/AP_Common.h>
+#include <AP_Common/ExpandingString.h>
 #include <AP_HAL/AP_HAL.h>
 
 #if HAL_MAX_CAN_PROTOCOL_DRIVERS
@@ -342,6 +343,17 @@ void AP_UAVCAN::init(uint8_t driver_index, bool enable_filters)
 }
 #pragma GCC diagnostic pop
 
+// report the state of the memory pool, for @SYS/uavcan_stats.txt
+void AP_UAVCAN::get_pool_stats(ExpandingString &str)
+{
+    str.printf("UAVCAN%u pool: block_size=%u capacity=%u used=%u peak=%u\n",
+               unsigned(_driver_index),
+               unsigned(UAVCAN_NODE_POOL_BLOCK_SIZE),
+               unsigned(_node_allocator.getBlockCapacity()),
+               unsigned(_node_allocator.getNumUsedBlocks()),
+               unsigned(_node_allocator.getPeakNumUsedBlocks()));
+}
+
 // send ESC telemetry messages over MAVLink
 void AP_UAVCAN::send_esc_telemetry_mavlink(uint8_t mav_chan)
 {
@@ -423,13 +435,9 @@ void AP_UAVCAN::loop(void)
             continue;
         }
 
-        const int error = _node->spin(uavcan::MonotonicDuration::fromMSec(1));
-
-        if (error < 0) {
-            hal.scheduler->delay_microseconds(100);
-            continue;
-        }
-
+        // service actuator output before spinning the node, so ESC and
+        // servo commands reach the wire ahead of the up-to-1ms spin spent
+        // on lower priority traffic (parameter and node info bursts)
         if (_SRV_armed) {
             bool sent_servos = false;
 
@@ -457,6 +465,13 @@ void AP_UAVCAN::loop(void)
             }
         }
 
+        const int error = _node->spin(uavcan::MonotonicDuration::fromMSec(1));
+
+        if (error < 0) {
+            hal.scheduler->delay_microseconds(100);
+            continue;
+        }
+
         led_out_send();
         buzzer_send();
         rtcm_stream_send();
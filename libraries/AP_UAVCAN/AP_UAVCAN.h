@@ -30,6 +30,8 @@
 
 #include <uavcan/helpers/heap_based_pool_allocator.hpp>
 
+class ExpandingString;
+
 
 #ifndef UAVCAN_NODE_POOL_SIZE
 #define UAVCAN_NODE_POOL_SIZE 8192
@@ -99,7 +101,10 @@ public:
 
     // send ESC telemetry messages over MAVLink
     void send_esc_telemetry_mavlink(uint8_t mav_chan);
-    
+
+    // report the state of the memory pool, for @SYS/uavcan_stats.txt
+    void get_pool_stats(ExpandingString &str);
+
     uavcan::Node<0>* get_node() { return _node; }
     uint8_t get_driver_index() { return _driver_index; }
 
@@ -103,26 +103,23 @@ void AP_UAVCAN_DNA_Server::getHash(NodeData &node_data, const uint8_t unique_id[
     }
 }
 
-//Read Node Data from Storage Region
+//Read Node Data from the record table cache
 bool AP_UAVCAN_DNA_Server::readNodeData(NodeData &data, uint8_t node_id)
 {
     if (node_id > MAX_NODE_ID) {
         return false;
     }
-    if (!storage.read_block(&data, (node_id * sizeof(struct NodeData)) + NODEDATA_MAGIC_LEN, sizeof(struct NodeData))) {
-        //This will fall through to Prearm Check
-        server_state = STORAGE_FAILURE;
-        return false;
-    }
+    data = node_cache[node_id];
     return true;
 }
 
-//Write Node Data to Storage Region
+//Write Node Data to the cache and through to the Storage Region
 bool AP_UAVCAN_DNA_Server::writeNodeData(const NodeData &data, uint8_t node_id)
 {
     if (node_id > MAX_NODE_ID) {
         return false;
     }
+    node_cache[node_id] = data;
     if (!storage.write_block((node_id * sizeof(struct NodeData)) + NODEDATA_MAGIC_LEN,
                              &data, sizeof(struct NodeData))) {
         server_state = STORAGE_FAILURE;
@@ -300,6 +297,13 @@ bool AP_UAVCAN_DNA_Server::init(AP_UAVCAN *ap_uavcan)
 
     getNodeInfo_client[driver_index]->setCallback(trampoline_handleNodeInfo);
 
+    /* Read the whole record table in a single storage transaction
+    and serve all further lookups from the cache */
+    if (!storage.read_block(node_cache, NODEDATA_MAGIC_LEN, sizeof(node_cache))) {
+        //This will fall through to Prearm Check
+        server_state = STORAGE_FAILURE;
+    }
+
     /* Go through our records and look for valid NodeData, to initialise
     occupation mask */
     for (uint8_t i = 0; i <= MAX_NODE_ID; i++) {
@@ -358,13 +362,12 @@ bool AP_UAVCAN_DNA_Server::init(AP_UAVCAN *ap_uavcan)
 //Reset the Server Records
 void AP_UAVCAN_DNA_Server::reset()
 {
-    NodeData node_data;
-    memset(&node_data, 0, sizeof(node_data));
+    memset(node_cache, 0, sizeof(node_cache));
     occupation_mask.clearall();
 
-    //Just write empty Node Data to the Records
-    for (uint8_t i = 0; i <= MAX_NODE_ID; i++) {
-        writeNodeData(node_data, i);
+    //Write the whole empty record table in a single transaction
+    if (!storage.write_block(NODEDATA_MAGIC_LEN, node_cache, sizeof(node_cache))) {
+        server_state = STORAGE_FAILURE;
     }
     //Ensure we mark magic at the end
     uint16_t magic = NODEDATA_MAGIC;
@@ -22,6 +22,12 @@ class AP_UAVCAN_DNA_Server
         uint8_t crc;
     };
 
+    // cache of the whole record table, read from storage in one
+    // transaction at init and kept in sync as records are written.
+    // Serving lookups from RAM avoids per-node storage reads during
+    // allocation storms at boot
+    NodeData node_cache[126];
+
     enum ServerState {
         STORAGE_FAILURE = -3,
         DUPLICATE_NODES = -2,
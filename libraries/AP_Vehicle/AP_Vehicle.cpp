@@ -73,6 +73,8 @@ extern AP_Vehicle& vehicle;
  */
 void AP_Vehicle::setup()
 {
+    AP_BoardConfig::boot_stage("setup_start");
+
     // load the default values of variables listed in var_info[]
     AP_Param::setup_sketch_defaults();
 
@@ -85,6 +87,7 @@ void AP_Vehicle::setup()
                         (unsigned)hal.util->available_memory());
 
     load_parameters();
+    AP_BoardConfig::boot_stage("params");
 
     // initialise the main loop scheduler
     const AP_Scheduler::Task *tasks;
@@ -92,6 +95,7 @@ void AP_Vehicle::setup()
     uint32_t log_bit;
     get_scheduler_tasks(tasks, task_count, log_bit);
     AP::scheduler().init(tasks, task_count, log_bit);
+    AP_BoardConfig::boot_stage("scheduler");
 
     // time per loop - this gets updated in the main loop() based on
     // actual loop rate
@@ -111,6 +115,7 @@ void AP_Vehicle::setup()
     // initialise serial ports
     serial_manager.init();
     gcs().setup_console();
+    AP_BoardConfig::boot_stage("serial");
 
     // Register scheduler_delay_cb, which will run anytime you have
     // more than 5ms remaining in your call to hal.scheduler->delay
@@ -128,6 +133,7 @@ void AP_Vehicle::setup()
     
     // init_ardupilot is where the vehicle does most of its initialisation.
     init_ardupilot();
+    AP_BoardConfig::boot_stage("init_ardupilot");
     gcs().send_text(MAV_SEVERITY_INFO, "ArduPilot Ready");
 
     // gyro FFT needs to be initialized really late
@@ -155,6 +161,8 @@ void AP_Vehicle::setup()
 #if GENERATOR_ENABLED
     generator.init();
 #endif
+
+    AP_BoardConfig::boot_stage("setup_done");
 }
 
 void AP_Vehicle::loop()
@@ -199,6 +207,9 @@ const AP_Scheduler::Task AP_Vehicle::scheduler_tasks[] = {
     SCHED_TASK_CLASS(AP_GyroFFT,   &vehicle.gyro_fft,       update_parameters,         1, 50),
 #endif
     SCHED_TASK(update_dynamic_notch,                   200,    200),
+#if HAL_VISUALODOM_ENABLED
+    SCHED_TASK_CLASS(AP_VisualOdom, &vehicle.visual_odom,    update,                  400, 50),
+#endif
     SCHED_TASK_CLASS(AP_VideoTX,   &vehicle.vtx,            update,                    2, 100),
     SCHED_TASK(send_watchdog_reset_statustext,         0.1,     20),
 #if GENERATOR_ENABLED
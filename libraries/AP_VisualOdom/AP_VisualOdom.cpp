@@ -156,6 +156,19 @@ bool AP_VisualOdom::healthy() const
     return _driver->healthy();
 }
 
+// deliver measurements staged by the MAVLink thread to the EKF.
+// called at loop rate from the scheduler
+void AP_VisualOdom::update()
+{
+    if (!enabled()) {
+        return;
+    }
+
+    if (_driver != nullptr) {
+        _driver->update();
+    }
+}
+
 // consume vision_position_delta mavlink messages
 void AP_VisualOdom::handle_vision_position_delta_msg(const mavlink_message_t &msg)
 {
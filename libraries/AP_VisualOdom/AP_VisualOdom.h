@@ -59,6 +59,10 @@ public:
     // return true if sensor is basically healthy (we are receiving data)
     bool healthy() const;
 
+    // deliver measurements staged by the MAVLink thread to the EKF.
+    // called at loop rate from the scheduler
+    void update();
+
     // get user defined orientation
     enum Rotation get_orientation() const { return (enum Rotation)_orientation.get(); }
 
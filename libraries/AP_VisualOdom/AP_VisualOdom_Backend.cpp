@@ -17,6 +17,7 @@
 
 #if HAL_VISUALODOM_ENABLED
 
+#include <AP_AHRS/AP_AHRS.h>
 #include <AP_Logger/AP_Logger.h>
 #include <GCS_MAVLink/GCS.h>
 
@@ -38,6 +39,83 @@ bool AP_VisualOdom_Backend::healthy() const
     return ((AP_HAL::millis() - _last_update_ms) < AP_VISUALODOM_TIMEOUT_MS);
 }
 
+// queue a corrected pose measurement for delivery to the EKF from update()
+void AP_VisualOdom_Backend::stage_pose(const Vector3f &pos, const Quaternion &att, float posErr, float angErr, uint32_t time_ms, uint32_t reset_ms)
+{
+    WITH_SEMAPHORE(_staging_sem);
+    if (_staged_count >= VISUALODOM_STAGING_LEN) {
+        // ring full; drop the oldest entry so the freshest data wins
+        memmove(&_staged[0], &_staged[1], (VISUALODOM_STAGING_LEN-1)*sizeof(_staged[0]));
+        _staged_count = VISUALODOM_STAGING_LEN-1;
+    }
+    StagedMeasurement &m = _staged[_staged_count++];
+    m.type = StagedMeasurement::Type::POSE;
+    m.time_ms = time_ms;
+    m.reset_ms = reset_ms;
+    m.vec = pos;
+    m.att = att;
+    m.err1 = posErr;
+    m.err2 = angErr;
+}
+
+// queue a corrected velocity measurement for delivery to the EKF from update()
+void AP_VisualOdom_Backend::stage_velocity(const Vector3f &vel, float vel_noise, uint32_t time_ms)
+{
+    WITH_SEMAPHORE(_staging_sem);
+    if (_staged_count >= VISUALODOM_STAGING_LEN) {
+        memmove(&_staged[0], &_staged[1], (VISUALODOM_STAGING_LEN-1)*sizeof(_staged[0]));
+        _staged_count = VISUALODOM_STAGING_LEN-1;
+    }
+    StagedMeasurement &m = _staged[_staged_count++];
+    m.type = StagedMeasurement::Type::VELOCITY;
+    m.time_ms = time_ms;
+    m.vec = vel;
+    m.err1 = vel_noise;
+}
+
+/*
+  deliver staged measurements to the EKF. Called at loop rate from the
+  main thread, so the semaphore is taken once per EKF cycle rather
+  than once per incoming message, and measurements that arrived out of
+  order are handed over sorted by sensor timestamp
+ */
+void AP_VisualOdom_Backend::update()
+{
+    StagedMeasurement staged[VISUALODOM_STAGING_LEN];
+    uint8_t count;
+    {
+        WITH_SEMAPHORE(_staging_sem);
+        count = _staged_count;
+        memcpy(staged, _staged, count*sizeof(staged[0]));
+        _staged_count = 0;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // insertion sort by sensor timestamp; the batch is small
+    for (uint8_t i=1; i<count; i++) {
+        const StagedMeasurement m = staged[i];
+        int8_t j = i-1;
+        while (j >= 0 && staged[j].time_ms > m.time_ms) {
+            staged[j+1] = staged[j];
+            j--;
+        }
+        staged[j+1] = m;
+    }
+
+    auto &ahrs = AP::ahrs();
+    const uint16_t delay_ms = _frontend.get_delay_ms();
+    for (uint8_t i=0; i<count; i++) {
+        const StagedMeasurement &m = staged[i];
+        if (m.type == StagedMeasurement::Type::POSE) {
+            ahrs.writeExtNavData(m.vec, m.att, m.err1, m.err2, m.time_ms, delay_ms, m.reset_ms);
+        } else {
+            ahrs.writeExtNavVelData(m.vec, m.err1, m.time_ms, delay_ms);
+        }
+    }
+}
+
 // consume vision_position_delta mavlink messages
 void AP_VisualOdom_Backend::handle_vision_position_delta_msg(const mavlink_message_t &msg)
 {
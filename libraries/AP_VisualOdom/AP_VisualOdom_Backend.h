@@ -18,6 +18,10 @@
 
 #if HAL_VISUALODOM_ENABLED
 
+// number of measurements that can be queued between the MAVLink
+// thread and delivery to the EKF in update()
+#define VISUALODOM_STAGING_LEN 10
+
 class AP_VisualOdom_Backend
 {
 public:
@@ -45,8 +49,18 @@ public:
     // arming check - by default no checks performed
     virtual bool pre_arm_check(char *failure_msg, uint8_t failure_msg_len) const { return true; }
 
+    // deliver staged measurements to the EKF in timestamp order.
+    // called at loop rate from the main thread
+    void update();
+
 protected:
 
+    // queue a corrected pose measurement for delivery to the EKF from update()
+    void stage_pose(const Vector3f &pos, const Quaternion &att, float posErr, float angErr, uint32_t time_ms, uint32_t reset_ms);
+
+    // queue a corrected velocity measurement for delivery to the EKF from update()
+    void stage_velocity(const Vector3f &vel, float vel_noise, uint32_t time_ms);
+
     // returns the system time of the last reset if reset_counter has not changed
     // updates the reset timestamp to the current system time if the reset_counter has changed
     uint32_t get_reset_timestamp_ms(uint8_t reset_counter);
@@ -57,6 +71,28 @@ protected:
     // reset counter handling
     uint8_t _last_reset_counter;    // last sensor reset counter received
     uint32_t _reset_timestamp_ms;   // time reset counter was received
+
+private:
+
+    // measurements staged by the MAVLink thread, consumed in one
+    // semaphore acquisition per loop by update(). this keeps the EKF
+    // handoff off the MAVLink thread and tolerates out-of-order
+    // arrival of pose and velocity messages
+    struct StagedMeasurement {
+        enum class Type : uint8_t {
+            POSE = 0,
+            VELOCITY = 1,
+        } type;
+        uint32_t time_ms;       // sensor timestamp
+        uint32_t reset_ms;      // pose only: system time of last sensor reset
+        Vector3f vec;           // position in m or velocity in m/s
+        Quaternion att;         // pose only: corrected attitude
+        float err1;             // position error in m or velocity noise in m/s
+        float err2;             // pose only: angular error in rad
+    };
+    StagedMeasurement _staged[VISUALODOM_STAGING_LEN];
+    uint8_t _staged_count;
+    HAL_Semaphore _staging_sem;
 };
 
 #endif
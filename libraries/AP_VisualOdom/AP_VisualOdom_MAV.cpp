@@ -37,8 +37,8 @@ void AP_VisualOdom_MAV::handle_vision_position_estimate(uint64_t remote_time_us,
 
     posErr = constrain_float(posErr, _frontend.get_pos_noise(), 100.0f);
     angErr = constrain_float(angErr, _frontend.get_yaw_noise(), 1.5f);
-    // send attitude and position to EKF
-    AP::ahrs().writeExtNavData(pos, attitude, posErr, angErr, time_ms, _frontend.get_delay_ms(), get_reset_timestamp_ms(reset_counter));
+    // queue attitude and position for the EKF; delivered from update()
+    stage_pose(pos, attitude, posErr, angErr, time_ms, get_reset_timestamp_ms(reset_counter));
 
     // calculate euler orientation for logging
     float roll;
@@ -55,8 +55,8 @@ void AP_VisualOdom_MAV::handle_vision_position_estimate(uint64_t remote_time_us,
 
 void AP_VisualOdom_MAV::handle_vision_speed_estimate(uint64_t remote_time_us, uint32_t time_ms, const Vector3f &vel, uint8_t reset_counter)
 {
-    // send velocity to EKF
-    AP::ahrs().writeExtNavVelData(vel, _frontend.get_vel_noise(), time_ms, _frontend.get_delay_ms());
+    // queue velocity for the EKF; delivered from update()
+    stage_velocity(vel, _frontend.get_vel_noise(), time_ms);
 
     // record time for health monitoring
     _last_update_ms = AP_HAL::millis();
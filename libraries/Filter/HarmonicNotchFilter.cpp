@@ -129,6 +129,10 @@ void HarmonicNotchFilter<T>::init(float sample_freq_hz, float center_freq_hz, fl
     }
 
     _initialised = true;
+    // force the coefficients to be recomputed whatever the previous
+    // center frequencies were
+    _last_center_freq_hz = -1;
+    _last_num_centers = 0;
     update(center_freq_hz);
 }
 
@@ -174,6 +178,14 @@ void HarmonicNotchFilter<T>::update(float center_freq_hz)
     const float nyquist_limit = _sample_freq_hz * 0.48f;
     center_freq_hz = constrain_float(center_freq_hz, 1.0f, nyquist_limit);
 
+    // incremental update: skip the coefficient recompute if the
+    // frequency has not moved meaningfully since the last update
+    if (fabsf(center_freq_hz - _last_center_freq_hz) < _update_epsilon_hz) {
+        return;
+    }
+    _last_center_freq_hz = center_freq_hz;
+    _last_num_centers = 0;
+
     _num_enabled_filters = 0;
     // update all of the filters using the new center frequency and existing A & Q
     for (uint8_t i = 0; i < HNF_MAX_HARMONICS && _num_enabled_filters < _num_filters; i++) {
@@ -215,6 +227,27 @@ void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq
     // adjust the frequencies to be in the allowable range
     const float nyquist_limit = _sample_freq_hz * 0.48f;
 
+    // incremental update: skip the coefficient recompute if none of
+    // the center frequencies has moved meaningfully
+    const uint8_t ncenters = MIN(num_centers, (uint8_t)HNF_MAX_HARMONICS);
+    if (ncenters == _last_num_centers && ncenters > 0) {
+        bool moved = false;
+        for (uint8_t i = 0; i < ncenters; i++) {
+            if (fabsf(constrain_float(center_freq_hz[i], 1.0f, nyquist_limit) - _last_multi_center_freq_hz[i]) >= _update_epsilon_hz) {
+                moved = true;
+                break;
+            }
+        }
+        if (!moved) {
+            return;
+        }
+    }
+    _last_num_centers = ncenters;
+    for (uint8_t i = 0; i < ncenters; i++) {
+        _last_multi_center_freq_hz[i] = constrain_float(center_freq_hz[i], 1.0f, nyquist_limit);
+    }
+    _last_center_freq_hz = -1;
+
     _num_enabled_filters = 0;
     // update all of the filters using the new center frequencies and existing A & Q
     for (uint8_t i = 0; i < HNF_MAX_HARMONICS && i < num_centers && _num_enabled_filters < _num_filters; i++) {
@@ -240,22 +273,8 @@ void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq
     }
 }
 
-/*
-  apply a sample to each of the underlying filters in turn and return the output
- */
-template <class T>
-T HarmonicNotchFilter<T>::apply(const T &sample)
-{
-    if (!_initialised) {
-        return sample;
-    }
-
-    T output = sample;
-    for (uint8_t i = 0; i < _num_enabled_filters; i++) {
-        output = _filters[i].apply(output);
-    }
-    return output;
-}
+// apply() is defined in the header so it can inline into the gyro
+// filter chain
 
 /*
   reset all of the underlying filters
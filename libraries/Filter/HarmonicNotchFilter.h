@@ -22,6 +22,13 @@
 #define HNF_MAX_HARMONICS 8
 #define HNF_MAX_HMNC_BITSET 0xF
 
+// minimum movement of the center frequency in Hz before the biquad
+// coefficients are recomputed. Dynamic tracking sources such as ESC
+// telemetry can move the center by fractions of a Hz hundreds of
+// times a second; recomputing the whole filter bank for those
+// changes costs real CPU on smaller boards for no filtering benefit
+#define HNF_UPDATE_EPSILON_HZ 0.1f
+
 /*
   a filter that manages a set of notch filters targetted at a fundamental center frequency
   and multiples of that fundamental frequency
@@ -42,6 +49,9 @@ public:
     T apply(const T &sample);
     // reset each of the underlying filters
     void reset();
+    // set the minimum center frequency movement that triggers a
+    // coefficient recompute
+    void set_update_epsilon_hz(float epsilon_hz) { _update_epsilon_hz = epsilon_hz; }
 
 private:
     // underlying bank of notch filters
@@ -63,8 +73,34 @@ private:
     // number of enabled filters
     uint8_t _num_enabled_filters;
     bool _initialised;
+
+    // center frequencies the coefficients were last computed for,
+    // used to skip recomputes for sub-epsilon frequency movement
+    float _last_center_freq_hz = -1;
+    float _last_multi_center_freq_hz[HNF_MAX_HARMONICS];
+    uint8_t _last_num_centers;
+    float _update_epsilon_hz = HNF_UPDATE_EPSILON_HZ;
 };
 
+/*
+  apply a sample to each of the underlying filters in turn and return
+  the output. Defined in the header so the whole gyro filter chain can
+  inline into a single pass over the sample
+ */
+template <class T>
+T HarmonicNotchFilter<T>::apply(const T &sample)
+{
+    if (!_initialised) {
+        return sample;
+    }
+
+    T output = sample;
+    for (uint8_t i = 0; i < _num_enabled_filters; i++) {
+        output = _filters[i].apply(output);
+    }
+    return output;
+}
+
 // Harmonic notch update mode
 enum class HarmonicNotchDynamicMode {
     Fixed           = 0,
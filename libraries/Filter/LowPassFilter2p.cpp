@@ -11,28 +11,11 @@ DigitalBiquadFilter<T>::DigitalBiquadFilter() {
   _delay_element_2 = T();
 }
 
-template <class T>
-T DigitalBiquadFilter<T>::apply(const T &sample, const struct biquad_params &params) {
-    if(is_zero(params.cutoff_freq) || is_zero(params.sample_freq)) {
-        return sample;
-    }
-
-    if (!initialised) {
-        reset(sample);
-        initialised = true;
-    }
-
-    T delay_element_0 = sample - _delay_element_1 * params.a1 - _delay_element_2 * params.a2;
-    T output = delay_element_0 * params.b0 + _delay_element_1 * params.b1 + _delay_element_2 * params.b2;
-
-    _delay_element_2 = _delay_element_1;
-    _delay_element_1 = delay_element_0;
-
-    return output;
-}
+// apply() is defined in the header so it can inline into the gyro
+// filter chain
 
 template <class T>
-void DigitalBiquadFilter<T>::reset() { 
+void DigitalBiquadFilter<T>::reset() {
     _delay_element_1 = _delay_element_2 = T();
     initialised = false;
 }
@@ -97,15 +80,6 @@ float LowPassFilter2p<T>::get_sample_freq(void) const {
     return _params.sample_freq;
 }
 
-template <class T>
-T LowPassFilter2p<T>::apply(const T &sample) {
-    if (!is_positive(_params.cutoff_freq)) {
-        // zero cutoff means pass-thru
-        return sample;
-    }
-    return _filter.apply(sample, _params);
-}
-
 template <class T>
 void LowPassFilter2p<T>::reset(void) {
     return _filter.reset();
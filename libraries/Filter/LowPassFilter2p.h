@@ -73,8 +73,8 @@ private:
 // Uncomment this, if you decide to remove the instantiations in the implementation file
 /*
 template <class T>
-LowPassFilter2p<T>::LowPassFilter2p() { 
-    memset(&_params, 0, sizeof(_params) ); 
+LowPassFilter2p<T>::LowPassFilter2p() {
+    memset(&_params, 0, sizeof(_params) );
 }
 
 // constructor
@@ -85,6 +85,39 @@ LowPassFilter2p<T>::LowPassFilter2p(float sample_freq, float cutoff_freq) {
 }
 */
 
+// the per-sample apply() paths are defined here rather than in the
+// implementation file so the whole gyro filter chain can inline into
+// a single pass over the sample
+
+template <class T>
+T DigitalBiquadFilter<T>::apply(const T &sample, const struct biquad_params &params) {
+    if(is_zero(params.cutoff_freq) || is_zero(params.sample_freq)) {
+        return sample;
+    }
+
+    if (!initialised) {
+        reset(sample);
+        initialised = true;
+    }
+
+    T delay_element_0 = sample - _delay_element_1 * params.a1 - _delay_element_2 * params.a2;
+    T output = delay_element_0 * params.b0 + _delay_element_1 * params.b1 + _delay_element_2 * params.b2;
+
+    _delay_element_2 = _delay_element_1;
+    _delay_element_1 = delay_element_0;
+
+    return output;
+}
+
+template <class T>
+T LowPassFilter2p<T>::apply(const T &sample) {
+    if (!is_positive(_params.cutoff_freq)) {
+        // zero cutoff means pass-thru
+        return sample;
+    }
+    return _filter.apply(sample, _params);
+}
+
 typedef LowPassFilter2p<int>      LowPassFilter2pInt;
 typedef LowPassFilter2p<long>     LowPassFilter2pLong;
 typedef LowPassFilter2p<float>    LowPassFilter2pFloat;
@@ -15,6 +15,54 @@
 
 #include "NotchFilter.h"
 
+/*
+  number of entries in the sin lookup table used for computing the
+  notch coefficients. The table covers [0, pi] with linear
+  interpolation, giving a worst case error below 2e-5 which moves the
+  effective notch center by a negligible fraction of the bandwidth
+ */
+#define NOTCH_SIN_TABLE_SIZE 256
+
+static float notch_sin_table[NOTCH_SIN_TABLE_SIZE+1];
+static bool notch_sin_table_filled;
+
+/*
+  fast sin/cos of omega in [0, pi) via table lookup. Dynamic harmonic
+  notch tracking recomputes the coefficients of every notch in the
+  bank each time the center frequency moves, so avoiding two libm
+  calls per notch matters on smaller boards
+ */
+static void calc_fast_sincos(float omega, float &sin_omega, float &cos_omega)
+{
+    if (!notch_sin_table_filled) {
+        // filled on first coefficient computation; concurrent fills
+        // write identical values so are benign
+        for (uint16_t i = 0; i <= NOTCH_SIN_TABLE_SIZE; i++) {
+            notch_sin_table[i] = sinf(M_PI * i / NOTCH_SIN_TABLE_SIZE);
+        }
+        notch_sin_table_filled = true;
+    }
+
+    const float scale = NOTCH_SIN_TABLE_SIZE / M_PI;
+
+    float idx_f = omega * scale;
+    uint16_t idx = MIN((uint16_t)idx_f, (uint16_t)(NOTCH_SIN_TABLE_SIZE-1));
+    float frac = idx_f - idx;
+    sin_omega = notch_sin_table[idx] + (notch_sin_table[idx+1] - notch_sin_table[idx]) * frac;
+
+    // cos comes from the same table with a quarter wave shift
+    float com = omega + M_PI_2;
+    float sign = 1.0f;
+    if (com >= M_PI) {
+        com -= M_PI;
+        sign = -1.0f;
+    }
+    idx_f = com * scale;
+    idx = MIN((uint16_t)idx_f, (uint16_t)(NOTCH_SIN_TABLE_SIZE-1));
+    frac = idx_f - idx;
+    cos_omega = sign * (notch_sin_table[idx] + (notch_sin_table[idx+1] - notch_sin_table[idx]) * frac);
+}
+
 /*
    calculate the attenuation and quality factors of the filter
  */
@@ -50,9 +98,11 @@ void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_h
 {
     if ((center_freq_hz > 0.0) && (center_freq_hz < 0.5 * sample_freq_hz) && (Q > 0.0)) {
         float omega = 2.0 * M_PI * center_freq_hz / sample_freq_hz;
-        float alpha = sinf(omega) / (2 * Q);
+        float sin_omega, cos_omega;
+        calc_fast_sincos(omega, sin_omega, cos_omega);
+        float alpha = sin_omega / (2 * Q);
         b0 =  1.0 + alpha*sq(A);
-        b1 = -2.0 * cosf(omega);
+        b1 = -2.0 * cos_omega;
         b2 =  1.0 - alpha*sq(A);
         a0_inv =  1.0/(1.0 + alpha);
         a1 = b1;
@@ -63,30 +113,8 @@ void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_h
     }
 }
 
-/*
-  apply a new input sample, returning new output
- */
-template <class T>
-T NotchFilter<T>::apply(const T &sample)
-{
-    if (!initialised) {
-        // if we have not been initialised when return the input
-        // sample as output and update delayed samples
-        ntchsig2 = ntchsig1;
-        ntchsig1 = ntchsig;
-        ntchsig = sample;
-        signal2 = signal1;
-        signal1 = sample;
-        return sample;
-    }
-    ntchsig2 = ntchsig1;
-    ntchsig1 = ntchsig;
-    ntchsig = sample;
-    T output = (ntchsig*b0 + ntchsig1*b1 + ntchsig2*b2 - signal1*a1 - signal2*a2) * a0_inv;
-    signal2 = signal1;
-    signal1 = output;
-    return output;
-}
+// apply() is defined in the header so it can inline into the gyro
+// filter chain
 
 template <class T>
 void NotchFilter<T>::reset()
@@ -45,6 +45,33 @@ private:
     T ntchsig, ntchsig1, ntchsig2, signal2, signal1;
 };
 
+/*
+  apply a new input sample, returning new output. Defined in the
+  header so the whole gyro filter chain can inline into a single pass
+  over the sample
+ */
+template <class T>
+T NotchFilter<T>::apply(const T &sample)
+{
+    if (!initialised) {
+        // if we have not been initialised when return the input
+        // sample as output and update delayed samples
+        ntchsig2 = ntchsig1;
+        ntchsig1 = ntchsig;
+        ntchsig = sample;
+        signal2 = signal1;
+        signal1 = sample;
+        return sample;
+    }
+    ntchsig2 = ntchsig1;
+    ntchsig1 = ntchsig;
+    ntchsig = sample;
+    T output = (ntchsig*b0 + ntchsig1*b1 + ntchsig2*b2 - signal1*a1 - signal2*a2) * a0_inv;
+    signal2 = signal1;
+    signal1 = output;
+    return output;
+}
+
 /*
   notch filter enable and filter parameters
  */
@@ -119,7 +119,13 @@ public:
         // there were concerns over return a too-large value for
         // txspace (in case we tried to do too much with the space in
         // a single loop):
-        return MIN(_port->txspace(), 8192U);
+        const uint16_t space = MIN(_port->txspace(), 8192U);
+        // bytes staged for a batched send haven't reached the UART yet
+        const uint16_t staged = comm_staged_bytes(chan);
+        if (staged >= space) {
+            return 0;
+        }
+        return space - staged;
     }
 
     // this is called when we discover we'd like to send something but can't:
@@ -417,6 +423,11 @@ protected:
     void handle_vision_position_delta(const mavlink_message_t &msg);
 
     void handle_common_message(const mavlink_message_t &msg);
+    void handle_log_message(const mavlink_message_t &msg);
+    void handle_gps_message(const mavlink_message_t &msg);
+    void handle_camera_message(const mavlink_message_t &msg);
+    void handle_led_control(const mavlink_message_t &msg);
+    void handle_play_tune(const mavlink_message_t &msg);
     void handle_set_gps_global_origin(const mavlink_message_t &msg);
     void handle_setup_signing(const mavlink_message_t &msg);
     virtual MAV_RESULT handle_preflight_reboot(const mavlink_command_long_t &packet);
@@ -457,6 +468,7 @@ protected:
 
     MAV_RESULT handle_command_preflight_set_sensor_offsets(const mavlink_command_long_t &packet);
     MAV_RESULT handle_command_flash_bootloader(const mavlink_command_long_t &packet);
+    MAV_RESULT handle_command_flash_bank_update(void);
 
     // generally this should not be overridden; Plane overrides it to ensure
     // failsafe isn't triggered during calibration
@@ -609,6 +621,17 @@ private:
         uint16_t last_sent_ms; // from AP_HAL::millis16()
     };
     deferred_message_bucket_t deferred_message_bucket[10];
+
+    // priority class of an ap_message, used to order sends when the
+    // link is congested. Numerically lower is more important
+    enum class stream_priority : uint8_t {
+        HIGH = 0,    // flight-critical state
+        NORMAL = 1,
+        BULK = 2,    // bulk transfers which can use left-over bandwidth
+    };
+    static stream_priority ap_message_priority(ap_message id);
+    // most important class present in a bucket
+    static stream_priority bucket_priority(const deferred_message_bucket_t &bucket);
     static const uint8_t no_bucket_to_send = -1;
     static const ap_message no_message_to_send = (ap_message)-1;
     uint8_t sending_bucket_id = no_bucket_to_send;
@@ -656,6 +679,11 @@ private:
     // When sending parameters and waypoints this may be longer than
     // the interval specified in "deferred"
     uint16_t get_reschedule_interval_ms(const deferred_message_bucket_t &deferred) const;
+    // deterministic phase offset for a bucket's schedule.  Buckets
+    // with equal intervals would otherwise all become due in the
+    // same tick, creating a periodic transmit burst which can
+    // overflow slow links
+    uint16_t bucket_phase_ms(uint8_t bucket_id, uint16_t interval_ms) const;
 
     bool do_try_send_message(const ap_message id);
 
@@ -889,6 +917,10 @@ public:
     virtual void send_textv(MAV_SEVERITY severity, const char *fmt, va_list arg_list, uint8_t mask);
     uint8_t statustext_send_channel_mask() const;
 
+    // generate @SYS/statustext.txt from the statustext history ring,
+    // letting a late-connecting GCS recover early-boot messages
+    void statustext_history(class ExpandingString &str);
+
     virtual GCS_MAVLINK *chan(const uint8_t ofs) = 0;
     virtual const GCS_MAVLINK *chan(const uint8_t ofs) const = 0;
     // return the number of valid GCS objects
@@ -1005,6 +1037,32 @@ private:
     // queue of outgoing statustext messages
     ObjectArray<statustext_t> _statustext_queue{_status_capacity};
 
+    // history ring of recent statustext messages. Unlike the send
+    // queue this survives queue overflow, so early-boot messages can
+    // be recovered from @SYS/statustext.txt after the fact. The
+    // buffer is allocated on the first message; appends are a single
+    // memcpy so the send path cost is negligible
+    void statustext_history_add(MAV_SEVERITY severity, const char *text);
+#if HAL_MEM_CLASS <= HAL_MEM_CLASS_192
+    static const uint16_t _statustext_history_size = 1024;
+#else
+    static const uint16_t _statustext_history_size = 4096;
+#endif
+    char *_statustext_history_buf;
+    uint16_t _statustext_history_ofs;
+    bool _statustext_history_wrapped;
+
+    // token bucket rate limiting for the routine severities (WARNING
+    // through DEBUG), so a burst of warnings cannot flood the queue or
+    // add work in the calling context. Emergency through error are
+    // never limited. Drop counts are reported in @SYS/statustext.txt
+    bool statustext_rate_allow(MAV_SEVERITY severity);
+    struct statustext_rate_t {
+        uint32_t last_refill_ms;
+        uint32_t dropped;
+        uint8_t tokens;
+    } _statustext_rate[4];
+
     // true if we have already allocated protocol objects:
     bool initialised_missionitemprotocol_objects;
 
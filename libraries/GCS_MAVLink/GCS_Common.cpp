@@ -18,6 +18,7 @@
 
 #include <AC_Fence/AC_Fence.h>
 #include <AP_AHRS/AP_AHRS.h>
+#include <AP_Common/ExpandingString.h>
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Arming/AP_Arming.h>
 #include <AP_InternalError/AP_InternalError.h>
@@ -46,6 +47,9 @@
 #include <AP_Winch/AP_Winch.h>
 #include <AP_OSD/AP_OSD.h>
 #include <AP_RCTelemetry/AP_CRSF_Telem.h>
+#include <AP_Filesystem/AP_Filesystem.h>
+#include <AP_Flash/AP_Flash.h>
+#include <AP_Math/crc.h>
 
 #include <stdio.h>
 
@@ -900,6 +904,69 @@ uint16_t GCS_MAVLINK::get_reschedule_interval_ms(const deferred_message_bucket_t
     return interval_ms;
 }
 
+/*
+  phase offset applied to a bucket's schedule.  All buckets are
+  typically created in the same scheduler tick when stream rates are
+  initialised, so buckets sharing an interval become due together and
+  the whole second's worth of telemetry goes out in one burst.
+  Offsetting each bucket by a different fraction of its interval
+  spreads the transmit load without changing any message's rate
+ */
+uint16_t GCS_MAVLINK::bucket_phase_ms(uint8_t bucket_id, uint16_t interval_ms) const
+{
+    return (uint32_t(bucket_id) * interval_ms) / ARRAY_SIZE(deferred_message_bucket);
+}
+
+/*
+  priority class of an ap_message. When the link is congested the
+  more important class is sent first so flight-critical state keeps
+  low latency while bulk items use the remaining bandwidth
+ */
+GCS_MAVLINK::stream_priority GCS_MAVLINK::ap_message_priority(const ap_message id)
+{
+    switch (id) {
+    case MSG_HEARTBEAT:
+    case MSG_ATTITUDE:
+    case MSG_LOCATION:
+    case MSG_SYS_STATUS:
+    case MSG_NAV_CONTROLLER_OUTPUT:
+    case MSG_VFR_HUD:
+    case MSG_AHRS:
+    case MSG_EKF_STATUS_REPORT:
+        return stream_priority::HIGH;
+    case MSG_NEXT_PARAM:
+    case MSG_NEXT_MISSION_REQUEST_WAYPOINTS:
+    case MSG_NEXT_MISSION_REQUEST_RALLY:
+    case MSG_NEXT_MISSION_REQUEST_FENCE:
+    case MSG_SENSOR_OFFSETS:
+    case MSG_TERRAIN:
+    case MSG_ADSB_VEHICLE:
+    case MSG_AUTOPILOT_VERSION:
+        return stream_priority::BULK;
+    default:
+        return stream_priority::NORMAL;
+    }
+}
+
+// most important class present in a bucket
+GCS_MAVLINK::stream_priority GCS_MAVLINK::bucket_priority(const deferred_message_bucket_t &bucket)
+{
+    stream_priority best = stream_priority::BULK;
+    for (uint16_t i=0; i<MSG_LAST; i++) {
+        if (!bucket.ap_message_ids.get(i)) {
+            continue;
+        }
+        const stream_priority p = ap_message_priority((ap_message)i);
+        if ((uint8_t)p < (uint8_t)best) {
+            best = p;
+            if (best == stream_priority::HIGH) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
 // typical runtime on fmuv3: 5 microseconds for 3 buckets
 void GCS_MAVLINK::find_next_bucket_to_send(uint16_t now16_ms)
 {
@@ -911,6 +978,7 @@ void GCS_MAVLINK::find_next_bucket_to_send(uint16_t now16_ms)
     // all done sending this bucket... find another bucket...
     sending_bucket_id = no_bucket_to_send;
     uint16_t ms_before_send_next_bucket_to_send = UINT16_MAX;
+    stream_priority chosen_priority = stream_priority::BULK;
     for (uint8_t i=0; i<ARRAY_SIZE(deferred_message_bucket); i++) {
         if (deferred_message_bucket[i].ap_message_ids.count() == 0) {
             // no entries
@@ -925,9 +993,28 @@ void GCS_MAVLINK::find_next_bucket_to_send(uint16_t now16_ms)
         } else {
             ms_before_send_this_bucket = interval - ms_since_last_sent;
         }
-        if (ms_before_send_this_bucket < ms_before_send_next_bucket_to_send) {
+        stream_priority this_priority = bucket_priority(deferred_message_bucket[i]);
+        if (ms_before_send_this_bucket == 0 &&
+            ms_since_last_sent > uint32_t(interval)*4) {
+            // this bucket has fallen a long way behind; promote it so
+            // low priority buckets are not starved on a congested link
+            this_priority = stream_priority::HIGH;
+        }
+        bool choose;
+        if (sending_bucket_id == no_bucket_to_send) {
+            choose = true;
+        } else if (ms_before_send_this_bucket == 0 &&
+                   ms_before_send_next_bucket_to_send == 0) {
+            // several buckets are overdue, so the link is congested;
+            // let priority decide rather than bucket ordering
+            choose = (uint8_t)this_priority < (uint8_t)chosen_priority;
+        } else {
+            choose = ms_before_send_this_bucket < ms_before_send_next_bucket_to_send;
+        }
+        if (choose) {
             sending_bucket_id = i;
             ms_before_send_next_bucket_to_send = ms_before_send_this_bucket;
+            chosen_priority = this_priority;
         }
     }
     if (sending_bucket_id != no_bucket_to_send) {
@@ -958,7 +1045,24 @@ ap_message GCS_MAVLINK::next_deferred_bucket_message_to_send(uint16_t now16_ms)
         return no_message_to_send;
     }
 
-    const int16_t next = bucket_message_ids_to_send.first_set();
+    // send the most important id remaining in the bucket first so
+    // flight-critical messages aren't delayed behind bulk items when
+    // the transmit buffer runs out part way through the bucket
+    int16_t next = -1;
+    stream_priority next_priority = stream_priority::BULK;
+    for (uint16_t i=0; i<MSG_LAST; i++) {
+        if (!bucket_message_ids_to_send.get(i)) {
+            continue;
+        }
+        const stream_priority p = ap_message_priority((ap_message)i);
+        if (next == -1 || (uint8_t)p < (uint8_t)next_priority) {
+            next = i;
+            next_priority = p;
+            if (p == stream_priority::HIGH) {
+                break;
+            }
+        }
+    }
     if (next == -1) {
         // should not happen
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
@@ -1058,6 +1162,10 @@ int8_t GCS_MAVLINK::deferred_message_to_send_index(uint16_t now16_ms)
 
 void GCS_MAVLINK::update_send()
 {
+    // pack this tick's messages into the channel staging buffer so
+    // the UART sees a few large writes rather than one per message
+    comm_send_batch_begin(chan);
+
     if (!hal.scheduler->in_delay_callback()) {
         // AP_Logger will not send log data if we are armed.
         AP::logger().handle_log_send();
@@ -1148,9 +1256,12 @@ void GCS_MAVLINK::update_send()
                 // user support questions:
                 const uint16_t interval_ms = get_reschedule_interval_ms(deferred_message_bucket[sending_bucket_id]);
                 deferred_message_bucket[sending_bucket_id].last_sent_ms += interval_ms;
-                // but we do not want to try to catch up too much:
+                // but we do not want to try to catch up too much.
+                // re-apply the bucket's phase offset when resetting
+                // the schedule so buckets which fell behind together
+                // do not come due together again:
                 if (uint16_t(start16 - deferred_message_bucket[sending_bucket_id].last_sent_ms) > interval_ms) {
-                    deferred_message_bucket[sending_bucket_id].last_sent_ms = start16;
+                    deferred_message_bucket[sending_bucket_id].last_sent_ms = start16 - bucket_phase_ms(sending_bucket_id, interval_ms);
                 }
                 find_next_bucket_to_send(start16);
             }
@@ -1183,6 +1294,8 @@ void GCS_MAVLINK::update_send()
         send_packet_count += uint8_t(status->current_tx_seq - last_tx_seq);
         last_tx_seq = status->current_tx_seq;
     }
+
+    comm_send_batch_end(chan);
 }
 
 void GCS_MAVLINK::remove_message_from_bucket(int8_t bucket, ap_message id)
@@ -1305,7 +1418,9 @@ bool GCS_MAVLINK::set_ap_message_interval(enum ap_message id, uint16_t interval_
         empty_bucket_id != -1) {
         // allocate a bucket for this interval
         deferred_message_bucket[empty_bucket_id].interval_ms = interval_ms;
-        deferred_message_bucket[empty_bucket_id].last_sent_ms = AP_HAL::millis16();
+        // start the bucket part-way through its interval so
+        // same-interval buckets don't all become due in the same tick
+        deferred_message_bucket[empty_bucket_id].last_sent_ms = AP_HAL::millis16() - bucket_phase_ms(empty_bucket_id, interval_ms);
         closest_bucket = empty_bucket_id;
     }
 
@@ -1866,11 +1981,20 @@ void GCS::send_textv(MAV_SEVERITY severity, const char *fmt, va_list arg_list, u
 
     do {
         WITH_SEMAPHORE(_statustext_sem);
+        if (!statustext_rate_allow(severity)) {
+            // over the per-severity rate limit; drop before formatting
+            // so a burst costs the caller almost nothing
+            return;
+        }
         // send_text can be called from multiple threads; we must
         // protect the "text" member with _statustext_sem
         hal.util->vsnprintf(statustext_printf_buffer, sizeof(statustext_printf_buffer), fmt, arg_list);
         memcpy(first_piece_of_text, statustext_printf_buffer, ARRAY_SIZE(first_piece_of_text)-1);
 
+        // record in the history ring for @SYS/statustext.txt; queue
+        // overflow or a late-connecting GCS no longer loses the message
+        statustext_history_add(severity, statustext_printf_buffer);
+
         // filter destination ports to only allow active ports.
         statustext_t statustext{};
         if (update_send_has_been_called) {
@@ -1926,8 +2050,11 @@ void GCS::send_textv(MAV_SEVERITY severity, const char *fmt, va_list arg_list, u
             }
         }
 
-        // try and send immediately if possible
-        if (hal.scheduler->in_main_thread()) {
+        // try and send immediately if possible. Only error and above
+        // get the immediate push; routine messages wait for the next
+        // update_send() so a burst adds no channel fan-out work in the
+        // calling context
+        if (severity < MAV_SEVERITY_WARNING && hal.scheduler->in_main_thread()) {
             service_statustext();
         }
     } while (false);
@@ -2009,6 +2136,112 @@ void GCS::service_statustext(void)
     }
 }
 
+// sustained statustext rate per routine severity, and the burst
+// allowed on top of it
+#define STATUSTEXT_RATE_REFILL_MS 100
+#define STATUSTEXT_RATE_BURST 10
+
+/*
+  token bucket rate limiter for the routine severities. Emergency
+  through error always pass; WARNING through DEBUG each get a bucket
+  of STATUSTEXT_RATE_BURST messages refilled at one per
+  STATUSTEXT_RATE_REFILL_MS. Caller must hold _statustext_sem
+ */
+bool GCS::statustext_rate_allow(MAV_SEVERITY severity)
+{
+    if (severity < MAV_SEVERITY_WARNING) {
+        return true;
+    }
+    statustext_rate_t &r = _statustext_rate[severity - MAV_SEVERITY_WARNING];
+    const uint32_t now_ms = AP_HAL::millis();
+    if (r.last_refill_ms == 0) {
+        // first use; start with a full bucket
+        r.tokens = STATUSTEXT_RATE_BURST;
+        r.last_refill_ms = now_ms;
+    }
+    const uint32_t refills = (now_ms - r.last_refill_ms) / STATUSTEXT_RATE_REFILL_MS;
+    if (refills > 0) {
+        r.tokens = MIN(uint32_t(STATUSTEXT_RATE_BURST), r.tokens + refills);
+        r.last_refill_ms = now_ms;
+    }
+    if (r.tokens == 0) {
+        r.dropped++;
+        return false;
+    }
+    r.tokens--;
+    return true;
+}
+
+/*
+  append one message to the statustext history ring. Caller must hold
+  _statustext_sem
+ */
+void GCS::statustext_history_add(MAV_SEVERITY severity, const char *text)
+{
+    if (_statustext_history_buf == nullptr) {
+        _statustext_history_buf = new char[_statustext_history_size];
+        if (_statustext_history_buf == nullptr) {
+            // allocation failed; the history is best-effort
+            return;
+        }
+    }
+    char line[sizeof(statustext_printf_buffer)+32];
+    const uint32_t now_ms = AP_HAL::millis();
+    hal.util->snprintf(line, sizeof(line), "%u.%03u [%u] %s\n",
+                       unsigned(now_ms/1000U), unsigned(now_ms%1000U),
+                       unsigned(severity), text);
+    const uint16_t len = strlen(line);
+    const uint16_t room = _statustext_history_size - _statustext_history_ofs;
+    if (len <= room) {
+        memcpy(&_statustext_history_buf[_statustext_history_ofs], line, len);
+        _statustext_history_ofs += len;
+        if (_statustext_history_ofs == _statustext_history_size) {
+            _statustext_history_ofs = 0;
+            _statustext_history_wrapped = true;
+        }
+    } else {
+        memcpy(&_statustext_history_buf[_statustext_history_ofs], line, room);
+        memcpy(_statustext_history_buf, &line[room], len - room);
+        _statustext_history_ofs = len - room;
+        _statustext_history_wrapped = true;
+    }
+}
+
+/*
+  generate @SYS/statustext.txt from the history ring, oldest message
+  first. When the ring has wrapped the partial line at the start of
+  the oldest region is dropped
+ */
+void GCS::statustext_history(ExpandingString &str)
+{
+    WITH_SEMAPHORE(_statustext_sem);
+    if (_statustext_history_buf == nullptr) {
+        return;
+    }
+    if (_statustext_history_wrapped) {
+        const uint16_t start = _statustext_history_ofs;
+        const uint16_t tail_len = _statustext_history_size - start;
+        const char *nl = (const char *)memchr(&_statustext_history_buf[start], '\n', tail_len);
+        if (nl != nullptr) {
+            const uint16_t skip = (nl - &_statustext_history_buf[start]) + 1;
+            str.append(&_statustext_history_buf[start+skip], tail_len - skip);
+        }
+    }
+    str.append(_statustext_history_buf, _statustext_history_ofs);
+    // account for anything the rate limiter threw away
+    uint32_t total_dropped = 0;
+    for (uint8_t i=0; i<ARRAY_SIZE(_statustext_rate); i++) {
+        total_dropped += _statustext_rate[i].dropped;
+    }
+    if (total_dropped != 0) {
+        str.printf("dropped: warning=%u notice=%u info=%u debug=%u\n",
+                   unsigned(_statustext_rate[0].dropped),
+                   unsigned(_statustext_rate[1].dropped),
+                   unsigned(_statustext_rate[2].dropped),
+                   unsigned(_statustext_rate[3].dropped));
+    }
+}
+
 void GCS::send_message(enum ap_message id)
 {
     for (uint8_t i=0; i<num_gcs(); i++) {
@@ -3234,198 +3467,142 @@ void GCS_MAVLINK::handle_osd_param_config(const mavlink_message_t &msg)
 #endif
 }
 
-/*
-  handle messages which don't require vehicle specific data
- */
-void GCS_MAVLINK::handle_common_message(const mavlink_message_t &msg)
+// forward log transfer messages to the logger
+void GCS_MAVLINK::handle_log_message(const mavlink_message_t &msg)
 {
-    switch (msg.msgid) {
-    case MAVLINK_MSG_ID_COMMAND_ACK: {
-        handle_command_ack(msg);
-        break;
-    }
+    AP::logger().handle_mavlink_msg(*this, msg);
+}
 
-    case MAVLINK_MSG_ID_SETUP_SIGNING:
-        handle_setup_signing(msg);
-        break;
+// forward GPS correction and injection messages to the GPS library
+void GCS_MAVLINK::handle_gps_message(const mavlink_message_t &msg)
+{
+    AP::gps().handle_msg(msg);
+}
 
-    case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
-    case MAVLINK_MSG_ID_PARAM_SET:
-    case MAVLINK_MSG_ID_PARAM_REQUEST_READ:
-        handle_common_param_message(msg);
-        break;
+void GCS_MAVLINK::handle_camera_message(const mavlink_message_t &msg)
+{
+    AP_Camera *camera = AP::camera();
+    if (camera == nullptr) {
+        return;
+    }
+    camera->handle_message(chan, msg);
+}
 
-    case MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN:
-        handle_set_gps_global_origin(msg);
-        break;
+// send message to Notify
+void GCS_MAVLINK::handle_led_control(const mavlink_message_t &msg)
+{
+    AP_Notify::handle_led_control(msg);
+}
 
-    case MAVLINK_MSG_ID_DEVICE_OP_READ:
-        handle_device_op_read(msg);
-        break;
-    case MAVLINK_MSG_ID_DEVICE_OP_WRITE:
-        handle_device_op_write(msg);
-        break;
-    case MAVLINK_MSG_ID_TIMESYNC:
-        handle_timesync(msg);
-        break;
-    case MAVLINK_MSG_ID_LOG_REQUEST_LIST:
-    case MAVLINK_MSG_ID_LOG_REQUEST_DATA:
-    case MAVLINK_MSG_ID_LOG_ERASE:
-    case MAVLINK_MSG_ID_LOG_REQUEST_END:
-    case MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS:
-        AP::logger().handle_mavlink_msg(*this, msg);
-        break;
+// send message to Notify
+void GCS_MAVLINK::handle_play_tune(const mavlink_message_t &msg)
+{
+    AP_Notify::handle_play_tune(msg);
+}
 
-    case MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL:
-        handle_file_transfer_protocol(msg);
-        break;
+/*
+  handle messages which don't require vehicle specific data. Dispatch
+  is via a table sorted by message ID and searched with a binary
+  search, replacing the old switch; the ordering is checked once at
+  startup on SITL
+ */
+void GCS_MAVLINK::handle_common_message(const mavlink_message_t &msg)
+{
+    struct common_message_handler {
+        uint32_t msgid;
+        void (GCS_MAVLINK::*handler)(const mavlink_message_t &msg);
+    };
+    static const common_message_handler handler_table[] = {
+        { MAVLINK_MSG_ID_SYSTEM_TIME, &GCS_MAVLINK::handle_system_time_message },
+        { MAVLINK_MSG_ID_SET_MODE, &GCS_MAVLINK::handle_set_mode },
+        { MAVLINK_MSG_ID_PARAM_REQUEST_READ, &GCS_MAVLINK::handle_common_param_message },
+        { MAVLINK_MSG_ID_PARAM_REQUEST_LIST, &GCS_MAVLINK::handle_common_param_message },
+        { MAVLINK_MSG_ID_PARAM_VALUE, &GCS_MAVLINK::handle_param_value },
+        { MAVLINK_MSG_ID_PARAM_SET, &GCS_MAVLINK::handle_common_param_message },
+        { MAVLINK_MSG_ID_MISSION_WRITE_PARTIAL_LIST, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_ITEM, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_REQUEST, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_SET_CURRENT, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_REQUEST_LIST, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_COUNT, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_CLEAR_ALL, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_MISSION_ACK, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN, &GCS_MAVLINK::handle_set_gps_global_origin },
+        { MAVLINK_MSG_ID_MISSION_REQUEST_INT, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_REQUEST_DATA_STREAM, &GCS_MAVLINK::handle_request_data_stream },
+        { MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE, &GCS_MAVLINK::handle_rc_channels_override },
+        { MAVLINK_MSG_ID_MISSION_ITEM_INT, &GCS_MAVLINK::handle_common_mission_message },
+        { MAVLINK_MSG_ID_COMMAND_INT, &GCS_MAVLINK::handle_command_int },
+        { MAVLINK_MSG_ID_COMMAND_LONG, &GCS_MAVLINK::handle_command_long },
+        { MAVLINK_MSG_ID_COMMAND_ACK, &GCS_MAVLINK::handle_command_ack },
+        { MAVLINK_MSG_ID_OPTICAL_FLOW, &GCS_MAVLINK::handle_optical_flow },
+        { MAVLINK_MSG_ID_GLOBAL_VISION_POSITION_ESTIMATE, &GCS_MAVLINK::handle_global_vision_position_estimate },
+        { MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE, &GCS_MAVLINK::handle_vision_position_estimate },
+        { MAVLINK_MSG_ID_VISION_SPEED_ESTIMATE, &GCS_MAVLINK::handle_vision_speed_estimate },
+        { MAVLINK_MSG_ID_VICON_POSITION_ESTIMATE, &GCS_MAVLINK::handle_vicon_position_estimate },
+        { MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL, &GCS_MAVLINK::handle_file_transfer_protocol },
+        { MAVLINK_MSG_ID_TIMESYNC, &GCS_MAVLINK::handle_timesync },
+        { MAVLINK_MSG_ID_HIL_GPS, &GCS_MAVLINK::handle_gps_message },
+        { MAVLINK_MSG_ID_LOG_REQUEST_LIST, &GCS_MAVLINK::handle_log_message },
+        { MAVLINK_MSG_ID_LOG_REQUEST_DATA, &GCS_MAVLINK::handle_log_message },
+        { MAVLINK_MSG_ID_LOG_ERASE, &GCS_MAVLINK::handle_log_message },
+        { MAVLINK_MSG_ID_LOG_REQUEST_END, &GCS_MAVLINK::handle_log_message },
+        { MAVLINK_MSG_ID_GPS_INJECT_DATA, &GCS_MAVLINK::handle_gps_message },
+        { MAVLINK_MSG_ID_SERIAL_CONTROL, &GCS_MAVLINK::handle_serial_control },
+        { MAVLINK_MSG_ID_DISTANCE_SENSOR, &GCS_MAVLINK::handle_distance_sensor },
+        { MAVLINK_MSG_ID_ATT_POS_MOCAP, &GCS_MAVLINK::handle_att_pos_mocap },
+        { MAVLINK_MSG_ID_DIGICAM_CONTROL, &GCS_MAVLINK::handle_camera_message },
+        { MAVLINK_MSG_ID_MOUNT_CONFIGURE, &GCS_MAVLINK::handle_mount_message }, // deprecated. Use MAV_CMD_DO_MOUNT_CONFIGURE
+        { MAVLINK_MSG_ID_MOUNT_CONTROL, &GCS_MAVLINK::handle_mount_message }, // deprecated. Use MAV_CMD_DO_MOUNT_CONTROL
+        { MAVLINK_MSG_ID_FENCE_POINT, &GCS_MAVLINK::handle_fence_message },
+        { MAVLINK_MSG_ID_FENCE_FETCH_POINT, &GCS_MAVLINK::handle_fence_message },
+        { MAVLINK_MSG_ID_DATA96, &GCS_MAVLINK::handle_data_packet },
+        { MAVLINK_MSG_ID_RALLY_POINT, &GCS_MAVLINK::handle_common_rally_message },
+        { MAVLINK_MSG_ID_RALLY_FETCH_POINT, &GCS_MAVLINK::handle_common_rally_message },
+        { MAVLINK_MSG_ID_AUTOPILOT_VERSION_REQUEST, &GCS_MAVLINK::handle_send_autopilot_version },
+        { MAVLINK_MSG_ID_REMOTE_LOG_BLOCK_STATUS, &GCS_MAVLINK::handle_log_message },
+        { MAVLINK_MSG_ID_LED_CONTROL, &GCS_MAVLINK::handle_led_control },
+        { MAVLINK_MSG_ID_GIMBAL_REPORT, &GCS_MAVLINK::handle_mount_message },
+        { MAVLINK_MSG_ID_GOPRO_HEARTBEAT, &GCS_MAVLINK::handle_camera_message }, // heartbeat from a GoPro in Solo gimbal
+        { MAVLINK_MSG_ID_GPS_INPUT, &GCS_MAVLINK::handle_gps_message },
+        { MAVLINK_MSG_ID_GPS_RTCM_DATA, &GCS_MAVLINK::handle_gps_message },
+        { MAVLINK_MSG_ID_STATUSTEXT, &GCS_MAVLINK::handle_statustext },
+        { MAVLINK_MSG_ID_SETUP_SIGNING, &GCS_MAVLINK::handle_setup_signing },
+        { MAVLINK_MSG_ID_PLAY_TUNE, &GCS_MAVLINK::handle_play_tune },
+        { MAVLINK_MSG_ID_OBSTACLE_DISTANCE, &GCS_MAVLINK::handle_obstacle_distance },
+        { MAVLINK_MSG_ID_DEVICE_OP_READ, &GCS_MAVLINK::handle_device_op_read },
+        { MAVLINK_MSG_ID_DEVICE_OP_WRITE, &GCS_MAVLINK::handle_device_op_write },
+        { MAVLINK_MSG_ID_VISION_POSITION_DELTA, &GCS_MAVLINK::handle_vision_position_delta },
+        { MAVLINK_MSG_ID_OSD_PARAM_CONFIG, &GCS_MAVLINK::handle_osd_param_config },
+        { MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG, &GCS_MAVLINK::handle_osd_param_config },
+    };
 
-    case MAVLINK_MSG_ID_DIGICAM_CONTROL:
-    case MAVLINK_MSG_ID_GOPRO_HEARTBEAT: // heartbeat from a GoPro in Solo gimbal
-        {
-            AP_Camera *camera = AP::camera();
-            if (camera == nullptr) {
-                return;
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
+    static bool table_checked;
+    if (!table_checked) {
+        for (uint16_t i=1; i<ARRAY_SIZE(handler_table); i++) {
+            if (handler_table[i-1].msgid >= handler_table[i].msgid) {
+                AP_HAL::panic("handler_table must be sorted by message ID (entry %u)", unsigned(i));
             }
-            camera->handle_message(chan, msg);
         }
-        break;
-
-    case MAVLINK_MSG_ID_SET_MODE:
-        handle_set_mode(msg);
-        break;
-
-    case MAVLINK_MSG_ID_AUTOPILOT_VERSION_REQUEST:
-        handle_send_autopilot_version(msg);
-        break;
-
-    case MAVLINK_MSG_ID_MISSION_WRITE_PARTIAL_LIST:
-    case MAVLINK_MSG_ID_MISSION_REQUEST_LIST:
-    case MAVLINK_MSG_ID_MISSION_COUNT:
-    case MAVLINK_MSG_ID_MISSION_CLEAR_ALL:
-    case MAVLINK_MSG_ID_MISSION_ITEM:
-    case MAVLINK_MSG_ID_MISSION_ITEM_INT:
-    case MAVLINK_MSG_ID_MISSION_REQUEST_INT:
-    case MAVLINK_MSG_ID_MISSION_REQUEST:
-    case MAVLINK_MSG_ID_MISSION_ACK:
-    case MAVLINK_MSG_ID_MISSION_SET_CURRENT:
-        handle_common_mission_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_COMMAND_LONG:
-        handle_command_long(msg);
-        break;
-
-    case MAVLINK_MSG_ID_COMMAND_INT:
-        handle_command_int(msg);
-        break;
-
-    case MAVLINK_MSG_ID_FENCE_POINT:
-    case MAVLINK_MSG_ID_FENCE_FETCH_POINT:
-        handle_fence_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_GIMBAL_REPORT:
-        handle_mount_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_PARAM_VALUE:
-        handle_param_value(msg);
-        break;
-
-    case MAVLINK_MSG_ID_SERIAL_CONTROL:
-        handle_serial_control(msg);
-        break;
-
-    case MAVLINK_MSG_ID_GPS_RTCM_DATA:
-    case MAVLINK_MSG_ID_GPS_INPUT:
-    case MAVLINK_MSG_ID_HIL_GPS:
-    case MAVLINK_MSG_ID_GPS_INJECT_DATA:
-        AP::gps().handle_msg(msg);
-        break;
-
-    case MAVLINK_MSG_ID_STATUSTEXT:
-        handle_statustext(msg);
-        break;
-
-    case MAVLINK_MSG_ID_LED_CONTROL:
-        // send message to Notify
-        AP_Notify::handle_led_control(msg);
-        break;
-
-    case MAVLINK_MSG_ID_MOUNT_CONFIGURE: // deprecated. Use MAV_CMD_DO_MOUNT_CONFIGURE
-    case MAVLINK_MSG_ID_MOUNT_CONTROL: // deprecated. Use MAV_CMD_DO_MOUNT_CONTROL
-        handle_mount_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_PLAY_TUNE:
-        // send message to Notify
-        AP_Notify::handle_play_tune(msg);
-        break;
-
-    case MAVLINK_MSG_ID_RALLY_POINT:
-    case MAVLINK_MSG_ID_RALLY_FETCH_POINT:
-        handle_common_rally_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_REQUEST_DATA_STREAM:
-        handle_request_data_stream(msg);
-        break;
-
-    case MAVLINK_MSG_ID_DATA96:
-        handle_data_packet(msg);
-        break;        
-
-    case MAVLINK_MSG_ID_VISION_POSITION_DELTA:
-        handle_vision_position_delta(msg);
-        break;
-
-    case MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE:
-        handle_vision_position_estimate(msg);
-        break;
-
-    case MAVLINK_MSG_ID_GLOBAL_VISION_POSITION_ESTIMATE:
-        handle_global_vision_position_estimate(msg);
-        break;
-
-    case MAVLINK_MSG_ID_VICON_POSITION_ESTIMATE:
-        handle_vicon_position_estimate(msg);
-        break;
-
-    case MAVLINK_MSG_ID_ATT_POS_MOCAP:
-        handle_att_pos_mocap(msg);
-        break;
-
-    case MAVLINK_MSG_ID_VISION_SPEED_ESTIMATE:
-        handle_vision_speed_estimate(msg);
-        break;
-
-    case MAVLINK_MSG_ID_SYSTEM_TIME:
-        handle_system_time_message(msg);
-        break;
-
-    case MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE:
-        handle_rc_channels_override(msg);
-        break;
-
-    case MAVLINK_MSG_ID_OPTICAL_FLOW:
-        handle_optical_flow(msg);
-        break;
-
-    case MAVLINK_MSG_ID_DISTANCE_SENSOR:
-        handle_distance_sensor(msg);
-        break;
-
-    case MAVLINK_MSG_ID_OBSTACLE_DISTANCE:
-        handle_obstacle_distance(msg);
-        break;
-
-    case MAVLINK_MSG_ID_OSD_PARAM_CONFIG:
-    case MAVLINK_MSG_ID_OSD_PARAM_SHOW_CONFIG:
-        handle_osd_param_config(msg);
-        break;
+        table_checked = true;
     }
+#endif
 
+    uint16_t low = 0;
+    uint16_t high = ARRAY_SIZE(handler_table);
+    while (low < high) {
+        const uint16_t mid = (low + high) / 2;
+        if (handler_table[mid].msgid == msg.msgid) {
+            (this->*handler_table[mid].handler)(msg);
+            return;
+        }
+        if (handler_table[mid].msgid < msg.msgid) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
 }
 
 void GCS_MAVLINK::handle_common_mission_message(const mavlink_message_t &msg)
@@ -3552,8 +3729,67 @@ void GCS_MAVLINK::send_sim_state() const
 #endif
 }
 
+/*
+  stream a firmware image staged on the SD card into the inactive
+  flash bank and arm the bank swap for the next reset. The current
+  firmware keeps running until then, so a bad image can be abandoned
+  by deleting the file and never arming the swap
+ */
+MAV_RESULT GCS_MAVLINK::handle_command_flash_bank_update(void)
+{
+    static const char *path = HAL_BOARD_STORAGE_DIRECTORY "/bank_update.bin";
+    struct stat st;
+    if (AP::FS().stat(path, &st) != 0 || st.st_size == 0) {
+        gcs().send_text(MAV_SEVERITY_WARNING, "No image at %s", path);
+        return MAV_RESULT_FAILED;
+    }
+    const int fd = AP::FS().open(path, O_RDONLY);
+    if (fd == -1) {
+        return MAV_RESULT_FAILED;
+    }
+
+    AP_Flash flash;
+    if (!flash.start_update(st.st_size)) {
+        AP::FS().close(fd);
+        gcs().send_text(MAV_SEVERITY_WARNING, "Image does not fit inactive bank");
+        return MAV_RESULT_FAILED;
+    }
+
+    // the image CRC is accumulated while streaming and checked by
+    // finish_update() against the mapped bank after the last write
+    uint32_t crc = 0;
+    bool ok = true;
+    uint8_t buf[256];
+    while (true) {
+        const int32_t n = AP::FS().read(fd, buf, sizeof(buf));
+        if (n <= 0) {
+            ok = (n == 0);
+            break;
+        }
+        crc = crc_crc32(crc, buf, n);
+        if (!flash.write(buf, n)) {
+            ok = false;
+            break;
+        }
+    }
+    AP::FS().close(fd);
+
+    if (!ok || !flash.finish_update(crc)) {
+        flash.abort_update();
+        gcs().send_text(MAV_SEVERITY_WARNING, "Bank update failed");
+        return MAV_RESULT_FAILED;
+    }
+    gcs().send_text(MAV_SEVERITY_INFO, "Bank update armed, reboot to swap");
+    return MAV_RESULT_ACCEPTED;
+}
+
 MAV_RESULT GCS_MAVLINK::handle_command_flash_bootloader(const mavlink_command_long_t &packet)
 {
+    if (uint32_t(packet.param5) == 290877) {
+        // alternate magic: flash the inactive bank from the SD card
+        // rather than the bootloader
+        return handle_command_flash_bank_update();
+    }
     if (uint32_t(packet.param5) != 290876) {
         gcs().send_text(MAV_SEVERITY_INFO, "Magic not set");
         return MAV_RESULT_FAILED;
@@ -29,27 +29,39 @@ struct GCS_MAVLINK::ftp_state GCS_MAVLINK::ftp;
 // timeout for session inactivity
 #define FTP_SESSION_TIMEOUT 3000
 
+// queue depths, overridable in hwdef for boards with unusual memory budgets
+#ifndef AP_FTP_REQUEST_QUEUE_SIZE
+#define AP_FTP_REQUEST_QUEUE_SIZE 5
+#endif
+#ifndef AP_FTP_REPLY_QUEUE_SIZE
+#define AP_FTP_REPLY_QUEUE_SIZE 30
+#endif
+
 bool GCS_MAVLINK::ftp_init(void) {
 
+    // the queues are backed by statically reserved storage so that a GCS
+    // opening FTP mid-mission can never fragment the heap under users that
+    // later need contiguous allocations (scripting, EKF replay buffers)
+    static uint8_t request_storage[(AP_FTP_REQUEST_QUEUE_SIZE+1) * sizeof(pending_ftp)];
+    static uint8_t reply_storage[(AP_FTP_REPLY_QUEUE_SIZE+1) * sizeof(pending_ftp)];
+    static ByteBuffer request_bytes{request_storage, sizeof(request_storage)};
+    static ByteBuffer reply_bytes{reply_storage, sizeof(reply_storage)};
+    static ObjectBuffer<pending_ftp> requests{&request_bytes};
+    static ObjectBuffer<pending_ftp> replies{&reply_bytes};
+
     // check if ftp is disabled for memory savings
     if (AP_BoardConfig::ftp_disabled()) {
         goto failed;
     }
 
-    // we can simply check if we allocated everything we need
+    // we can simply check if we attached everything we need
 
     if (ftp.requests != nullptr) {
         return true;
     }
 
-    ftp.requests = new ObjectBuffer<pending_ftp>(5);
-    if (ftp.requests == nullptr) {
-        goto failed;
-    }
-    ftp.replies = new ObjectBuffer<pending_ftp>(30);
-    if (ftp.replies == nullptr) {
-        goto failed;
-    }
+    ftp.requests = &requests;
+    ftp.replies = &replies;
 
     if (!hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&GCS_MAVLINK::ftp_worker, void),
                                       "FTP", 2560, AP_HAL::Scheduler::PRIORITY_IO, 0)) {
@@ -59,9 +71,7 @@ bool GCS_MAVLINK::ftp_init(void) {
     return true;
 
 failed:
-    delete ftp.requests;
     ftp.requests = nullptr;
-    delete ftp.replies;
     ftp.replies = nullptr;
 
     return false;
@@ -503,8 +513,12 @@ void GCS_MAVLINK::ftp_worker(void) {
                             break;
                         }
 
-                        const uint32_t transfer_size = 100;
-                        for (uint32_t i = 0; (i < transfer_size); i++) {
+                        // stream the file until EOF rather than in fixed
+                        // windows, so high latency links don't pay a round
+                        // trip per window. The client aborts or re-windows
+                        // a burst simply by sending its next command, which
+                        // ends the stream at the next packet boundary
+                        for (uint32_t i = 0; ; i++) {
                             // fill the buffer
                             const ssize_t read_bytes = AP::FS().read(ftp.fd, reply.data, max_read);
                             if (read_bytes == -1) {
@@ -524,7 +538,9 @@ void GCS_MAVLINK::ftp_worker(void) {
 
                             reply.opcode = FTP_OP::Ack;
                             reply.offset = request.offset + i * max_read;
-                            reply.burst_complete = (i == (transfer_size - 1));
+                            // end the burst when the client has another
+                            // command queued so the worker stays responsive
+                            reply.burst_complete = !ftp.requests->is_empty();
                             reply.size = (uint8_t)read_bytes;
 
                             ftp_push_replies(reply);
@@ -536,6 +552,10 @@ void GCS_MAVLINK::ftp_worker(void) {
 
                             // prep the reply to be used again
                             reply.seq_number++;
+
+                            if (reply.burst_complete) {
+                                break;
+                            }
                         }
 
                         if (reply.opcode != FTP_OP::Nack) {
@@ -39,9 +39,54 @@ extern const AP_HAL::HAL& hal;
 AP_HAL::UARTDriver	*mavlink_comm_port[MAVLINK_COMM_NUM_BUFFERS];
 bool gcs_alternative_active[MAVLINK_COMM_NUM_BUFFERS];
 
+/*
+  per-channel parser state, allocated on first use so channels that
+  never receive MAVLink traffic cost no RAM. Once allocated the state
+  is retained for the life of the boot - a parse buffer cannot be
+  safely reclaimed while its stream may resume - so it comes from the
+  permanent arena
+ */
+extern "C" mavlink_status_t* mavlink_get_channel_status(uint8_t chan)
+{
+    static mavlink_status_t *statuses[MAVLINK_COMM_NUM_BUFFERS];
+    if (chan >= MAVLINK_COMM_NUM_BUFFERS) {
+        return nullptr;
+    }
+    if (statuses[chan] == nullptr) {
+        statuses[chan] = (mavlink_status_t *)hal.util->malloc_type(sizeof(mavlink_status_t), AP_HAL::Util::MEM_PERMANENT);
+    }
+    return statuses[chan];
+}
+
+extern "C" mavlink_message_t* mavlink_get_channel_buffer(uint8_t chan)
+{
+    static mavlink_message_t *buffers[MAVLINK_COMM_NUM_BUFFERS];
+    if (chan >= MAVLINK_COMM_NUM_BUFFERS) {
+        return nullptr;
+    }
+    if (buffers[chan] == nullptr) {
+        buffers[chan] = (mavlink_message_t *)hal.util->malloc_type(sizeof(mavlink_message_t), AP_HAL::Util::MEM_PERMANENT);
+    }
+    return buffers[chan];
+}
+
 // per-channel lock
 static HAL_Semaphore chan_locks[MAVLINK_COMM_NUM_BUFFERS];
 
+// size of the per-channel staging buffer used for batched sends
+#ifndef MAVLINK_STAGING_BUF_SIZE
+#define MAVLINK_STAGING_BUF_SIZE 1024
+#endif
+
+// per-channel staging state for batched sends. The buffer is
+// allocated on first use so channels that never batch cost nothing
+static struct mavlink_stage {
+    uint8_t *buf;       // staging buffer, allocated on first batch
+    uint16_t len;       // bytes currently staged
+    bool open;          // a batch is open on this channel
+    bool failed_alloc;  // allocation failed, batching permanently disabled
+} chan_stage[MAVLINK_COMM_NUM_BUFFERS];
+
 mavlink_system_t mavlink_system = {7,1};
 
 // routing table
@@ -85,6 +130,27 @@ uint16_t comm_get_txspace(mavlink_channel_t chan)
     return link->txspace();
 }
 
+/*
+  write staged bytes to the UART as a single contiguous write. Must be
+  called with the channel lock held
+ */
+static void comm_flush_staged(mavlink_channel_t chan)
+{
+    struct mavlink_stage &stage = chan_stage[(uint8_t)chan];
+    if (stage.len == 0) {
+        return;
+    }
+    const size_t written = mavlink_comm_port[chan]->write(stage.buf, stage.len);
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL
+    if (written < stage.len) {
+        AP_HAL::panic("Short write on UART: %lu < %u", (unsigned long)written, stage.len);
+    }
+#else
+    (void)written;
+#endif
+    stage.len = 0;
+}
+
 /*
   send a buffer out a MAVLink channel
  */
@@ -97,6 +163,15 @@ void comm_send_buffer(mavlink_channel_t chan, const uint8_t *buf, uint8_t len)
         // an alternative protocol is active
         return;
     }
+    struct mavlink_stage &stage = chan_stage[(uint8_t)chan];
+    if (stage.open && stage.buf != nullptr) {
+        if (stage.len + len > MAVLINK_STAGING_BUF_SIZE) {
+            comm_flush_staged(chan);
+        }
+        memcpy(&stage.buf[stage.len], buf, len);
+        stage.len += len;
+        return;
+    }
     const size_t written = mavlink_comm_port[chan]->write(buf, len);
 #if CONFIG_HAL_BOARD == HAL_BOARD_SITL
     if (written < len) {
@@ -107,6 +182,63 @@ void comm_send_buffer(mavlink_channel_t chan, const uint8_t *buf, uint8_t len)
 #endif
 }
 
+/*
+  open a batch on a channel. Until the matching
+  comm_send_batch_end() all sends on the channel are packed into the
+  staging buffer, flushed to the UART only when it fills or when the
+  batch ends
+ */
+void comm_send_batch_begin(mavlink_channel_t chan)
+{
+    if (!valid_channel(chan)) {
+        return;
+    }
+    struct mavlink_stage &stage = chan_stage[(uint8_t)chan];
+    if (stage.buf == nullptr) {
+        if (stage.failed_alloc) {
+            return;
+        }
+        stage.buf = new uint8_t[MAVLINK_STAGING_BUF_SIZE];
+        if (stage.buf == nullptr) {
+            stage.failed_alloc = true;
+            return;
+        }
+    }
+    comm_send_lock(chan);
+    stage.open = true;
+    comm_send_unlock(chan);
+}
+
+/*
+  close a batch on a channel, handing any staged bytes to the UART
+ */
+void comm_send_batch_end(mavlink_channel_t chan)
+{
+    if (!valid_channel(chan)) {
+        return;
+    }
+    struct mavlink_stage &stage = chan_stage[(uint8_t)chan];
+    if (!stage.open) {
+        return;
+    }
+    comm_send_lock(chan);
+    stage.open = false;
+    comm_flush_staged(chan);
+    comm_send_unlock(chan);
+}
+
+/*
+  number of bytes staged but not yet handed to the UART. Used to
+  discount staged bytes from the reported transmit space
+ */
+uint16_t comm_staged_bytes(mavlink_channel_t chan)
+{
+    if (!valid_channel(chan)) {
+        return 0;
+    }
+    return chan_stage[(uint8_t)chan].len;
+}
+
 /*
   lock a channel for send
  */
@@ -40,6 +40,14 @@
 
 #include "include/mavlink/v2.0/mavlink_types.h"
 
+// per-channel parser state is allocated on first use rather than
+// statically for every channel, so ports that never see MAVLink
+// traffic don't pay for a parse buffer and status
+#define MAVLINK_GET_CHANNEL_STATUS 1
+#define MAVLINK_GET_CHANNEL_BUFFER 1
+extern "C" mavlink_status_t* mavlink_get_channel_status(uint8_t chan);
+extern "C" mavlink_message_t* mavlink_get_channel_buffer(uint8_t chan);
+
 /// MAVLink stream used for uartA
 extern AP_HAL::UARTDriver	*mavlink_comm_port[MAVLINK_COMM_NUM_BUFFERS];
 extern bool gcs_alternative_active[MAVLINK_COMM_NUM_BUFFERS];
@@ -73,4 +81,14 @@ uint16_t comm_get_txspace(mavlink_channel_t chan);
 void comm_send_lock(mavlink_channel_t chan);
 void comm_send_unlock(mavlink_channel_t chan);
 
+// batched sends: while a batch is open on a channel, serialized
+// messages are packed into a per-channel staging buffer and the UART
+// gets one contiguous write per flush instead of one per message
+// fragment
+void comm_send_batch_begin(mavlink_channel_t chan);
+void comm_send_batch_end(mavlink_channel_t chan);
+
+// number of bytes staged but not yet handed to the UART on a channel
+uint16_t comm_staged_bytes(mavlink_channel_t chan);
+
 #pragma GCC diagnostic pop
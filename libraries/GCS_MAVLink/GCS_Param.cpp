@@ -47,18 +47,26 @@ GCS_MAVLINK::queued_param_send()
     const uint32_t tnow = AP_HAL::millis();
     const uint32_t tstart = AP_HAL::micros();
 
-    // use at most 30% of bandwidth on parameters. The constant 26 is
-    // 1/(1000 * 1/8 * 0.001 * 0.3)
-    const uint32_t link_bw = _port->bw_in_kilobytes_per_second();
-
-    uint32_t bytes_allowed = link_bw * (tnow - _queued_parameter_send_time_ms) * 26;
     const uint16_t size_for_one_param_value_msg = MAVLINK_MSG_ID_PARAM_VALUE_LEN + packet_overhead();
+    uint32_t bytes_allowed;
+    if (have_flow_control()) {
+        // on links with flow control the transport tells us when to
+        // stop, so fill the transmit buffer, keeping half back for
+        // other traffic
+        bytes_allowed = txspace() / 2;
+    } else {
+        // use at most 30% of bandwidth on parameters. The constant 26 is
+        // 1/(1000 * 1/8 * 0.001 * 0.3)
+        const uint32_t link_bw = _port->bw_in_kilobytes_per_second();
+
+        bytes_allowed = link_bw * (tnow - _queued_parameter_send_time_ms) * 26;
+        if (bytes_allowed > txspace()) {
+            bytes_allowed = txspace();
+        }
+    }
     if (bytes_allowed < size_for_one_param_value_msg) {
         bytes_allowed = size_for_one_param_value_msg;
     }
-    if (bytes_allowed > txspace()) {
-        bytes_allowed = txspace();
-    }
     uint32_t count = bytes_allowed / size_for_one_param_value_msg;
 
     // when we don't have flow control we really need to keep the
@@ -66,6 +74,13 @@ GCS_MAVLINK::queued_param_send()
     if (!have_flow_control() && count > 5) {
         count = 5;
     }
+
+    // if the link is reporting congestion via RADIO_STATUS txbuf then
+    // back off to give the buffer a chance to drain; the loop below
+    // stops entirely below 50%
+    if (get_last_txbuf() < 80 && count > 1) {
+        count /= 2;
+    }
     if (async_replies_sent_count >= count) {
         return;
     }
@@ -86,8 +101,11 @@ GCS_MAVLINK::queued_param_send()
         _queued_parameter = AP_Param::next_scalar(&_queued_parameter_token, &_queued_parameter_type);
         _queued_parameter_index++;
 
-        if (AP_HAL::micros() - tstart > 1000) {
-            // don't use more than 1ms sending blocks of parameters
+        // don't spend too long sending blocks of parameters; with
+        // flow control we allow a larger slice as the bytes are just
+        // going into the transmit buffer
+        const uint32_t max_slice_us = have_flow_control() ? 2000 : 1000;
+        if (AP_HAL::micros() - tstart > max_slice_us) {
             break;
         }
         count--;
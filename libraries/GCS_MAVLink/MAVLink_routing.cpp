@@ -169,7 +169,7 @@ bool MAVLink_routing::check_and_forward(mavlink_channel_t in_channel, const mavl
                              (int)target_system,
                              (int)target_component);
 #endif
-                    _mavlink_resend_uart(routes[i].channel, &msg);
+                    forward_frame(routes[i].channel, msg);
                 }
                 sent_to_chan[routes[i].channel] = true;
                 forwarded = true;
@@ -185,6 +185,28 @@ bool MAVLink_routing::check_and_forward(mavlink_channel_t in_channel, const mavl
     return process_locally;
 }
 
+/*
+  forward a message by copying the already-framed bytes to the
+  channel. The original sequence number, checksum and signature are
+  preserved, so no CRC or signature needs to be recomputed for
+  traffic we merely pass through
+*/
+void MAVLink_routing::forward_frame(mavlink_channel_t channel, const mavlink_message_t &msg)
+{
+    uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+    const uint16_t len = mavlink_msg_to_send_buffer(buf, &msg);
+    comm_send_lock(channel);
+    // comm_send_buffer takes a uint8_t length, and a signed MAVLink2
+    // frame can be up to 280 bytes
+    uint16_t ofs = 0;
+    while (ofs < len) {
+        const uint8_t n = MIN(uint16_t(len - ofs), uint16_t(255));
+        comm_send_buffer(channel, &buf[ofs], n);
+        ofs += n;
+    }
+    comm_send_unlock(channel);
+}
+
 /*
   send a MAVLink message to all components with this vehicle's system id
 
@@ -352,7 +374,7 @@ void MAVLink_routing::handle_heartbeat(mavlink_channel_t in_channel, const mavli
                          (unsigned)msg.sysid,
                          (unsigned)msg.compid);
 #endif
-                _mavlink_resend_uart(channel, &msg);
+                forward_frame(channel, msg);
             }
         }
     }
@@ -67,5 +67,9 @@ private:
     // special handling for heartbeat messages
     void handle_heartbeat(mavlink_channel_t in_channel, const mavlink_message_t &msg);
 
+    // forward a message by copying the already-framed bytes to the
+    // channel, avoiding a re-encode
+    void forward_frame(mavlink_channel_t channel, const mavlink_message_t &msg);
+
     void send_to_components(const char *pkt, const mavlink_msg_entry_t *entry, uint8_t pkt_len);
 };
@@ -12,6 +12,7 @@ void MissionItemProtocol::init_send_requests(GCS_MAVLINK &_link,
     receiving = true;              // record that we expect to receive commands
     request_i = _request_first;                 // reset the next expected command number to zero
     request_last = _request_last;         // record how many commands we expect to receive
+    request_sent_max = (int32_t)_request_first - 1;  // no requests in flight yet
 
     dest_sysid = msg.sysid;       // record system id of GCS who wants to upload the mission
     dest_compid = msg.compid;     // record component id of GCS who wants to upload the mission
@@ -220,6 +221,23 @@ void MissionItemProtocol::handle_mission_item(const mavlink_message_t &msg, cons
 
     // check if this is the requested waypoint
     if (cmd.seq != request_i) {
+        if (cmd.seq > request_i && (int32_t)cmd.seq <= request_sent_max) {
+            // an item we requested ahead arrived but the one before
+            // it was lost. Drop it and re-request the missing item;
+            // the GCS will send the later items again when they are
+            // re-requested
+            request_sent_max = (int32_t)request_i - 1;
+            if (HAVE_PAYLOAD_SPACE(link->get_chan(), MISSION_REQUEST)) {
+                queued_request_send();
+            } else {
+                link->send_message(next_item_ap_message_id());
+            }
+            return;
+        }
+        if (cmd.seq < request_i) {
+            // duplicate of an item we have already stored; ignore it
+            return;
+        }
         send_mission_ack(msg, MAV_MISSION_INVALID_SEQUENCE);
         return;
     }
@@ -262,9 +280,14 @@ void MissionItemProtocol::handle_mission_item(const mavlink_message_t &msg, cons
         transfer_is_complete(*link, msg);
         return;
     }
-    // if we have enough space, then send the next WP request immediately
+    // if we have enough space, then send the next WP request
+    // immediately. A second call tops the pipeline window back up to
+    // two requests in flight
     if (HAVE_PAYLOAD_SPACE(link->get_chan(), MISSION_REQUEST)) {
         queued_request_send();
+        if (HAVE_PAYLOAD_SPACE(link->get_chan(), MISSION_REQUEST)) {
+            queued_request_send();
+        }
     } else {
         link->send_message(next_item_ap_message_id());
     }
@@ -315,11 +338,25 @@ void MissionItemProtocol::queued_request_send()
         INTERNAL_ERROR(AP_InternalError::error_t::gcs_bad_missionprotocol_link);
         return;
     }
+    // request the next unrequested item in the window. GCS
+    // implementations answer each MISSION_REQUEST individually, so a
+    // GCS that serialises the transfer still works, just without the
+    // round trip overlap
+    const int32_t window_tail = MIN((int32_t)request_i + 1, (int32_t)request_last);
+    if (request_sent_max < (int32_t)request_i) {
+        // the item we are waiting for; also the retransmit path
+        request_sent_max = request_i;
+    } else if (request_sent_max < window_tail) {
+        request_sent_max++;
+    } else {
+        // window is full
+        return;
+    }
     mavlink_msg_mission_request_send(
         link->get_chan(),
         dest_sysid,
         dest_compid,
-        request_i,
+        request_sent_max,
         mission_type());
     timelast_request_ms = AP_HAL::millis();
 }
@@ -352,6 +389,9 @@ void MissionItemProtocol::update()
     const uint32_t wp_recv_timeout_ms = 1000U + link->get_stream_slowdown_ms();
     if (tnow - timelast_request_ms > wp_recv_timeout_ms) {
         timelast_request_ms = tnow;
+        // re-request the item we are waiting for; requests beyond it
+        // are re-issued as items arrive
+        request_sent_max = (int32_t)request_i - 1;
         link->send_message(next_item_ap_message_id());
     }
 }
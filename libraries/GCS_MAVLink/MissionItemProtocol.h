@@ -79,6 +79,11 @@ private:
 
     uint16_t        request_i; // request index
 
+    // highest item index requested so far. We keep up to two
+    // requests in flight so the link round trip overlaps the GCS
+    // send of the previous item
+    int32_t         request_sent_max;
+
     // waypoints
     uint8_t         dest_sysid;  // where to send requests
     uint8_t         dest_compid; // "
@@ -102,6 +102,20 @@ static MAV_MISSION_RESULT convert_MISSION_ITEM_INT_to_AC_PolyFenceItem(const mav
 
 MAV_MISSION_RESULT MissionItemProtocol_Fence::replace_item(const mavlink_mission_item_int_t &mission_item_int)
 {
+    if (_streaming) {
+        // items arrive strictly in sequence, so they can be validated
+        // and written to storage as they come in rather than being
+        // buffered in RAM
+        AC_PolyFenceItem fence_item {};
+        const MAV_MISSION_RESULT ret = convert_MISSION_ITEM_INT_to_AC_PolyFenceItem(mission_item_int, fence_item);
+        if (ret != MAV_MISSION_ACCEPTED) {
+            return ret;
+        }
+        if (!_fence.polyfence().upload_fence_item(fence_item)) {
+            return MAV_MISSION_ERROR;
+        }
+        return MAV_MISSION_ACCEPTED;
+    }
     if (_new_items == nullptr) {
         INTERNAL_ERROR(AP_InternalError::error_t::flow_of_control);
         return MAV_MISSION_ERROR;
@@ -131,10 +145,24 @@ void MissionItemProtocol_Fence::free_upload_resources()
     _new_items = nullptr;
     delete[] _updated_mask;
     _updated_mask = nullptr;
+    if (_streaming) {
+        // a streaming upload which did not complete; the partially
+        // written storage must be discarded
+        _streaming = false;
+        _fence.polyfence().abort_fence_upload();
+    }
 }
 
 MAV_MISSION_RESULT MissionItemProtocol_Fence::complete(const GCS_MAVLINK &_link)
 {
+    if (_streaming) {
+        _streaming = false;
+        if (!_fence.polyfence().complete_fence_upload()) {
+            return MAV_MISSION_ERROR;
+        }
+        return MAV_MISSION_ACCEPTED;
+    }
+
     if (_updated_mask != nullptr) {
         // get any points that weren't filled in
         for (uint16_t i=0; i<_new_items_count; i++) {
@@ -177,37 +205,45 @@ bool MissionItemProtocol_Fence::clear_all_items()
 
 MAV_MISSION_RESULT MissionItemProtocol_Fence::allocate_receive_resources(const uint16_t count)
 {
-    if (_new_items != nullptr) {
+    if (_new_items != nullptr || _streaming) {
         // this is an error - the base class should have called
         // free_upload_resources first
         INTERNAL_ERROR(AP_InternalError::error_t::flow_of_control);
         return MAV_MISSION_ERROR;
     }
 
-    const uint16_t allocation_size = count * sizeof(AC_PolyFenceItem);
-    if (allocation_size != 0) {
-        _new_items = (AC_PolyFenceItem*)malloc(allocation_size);
-        if (_new_items == nullptr) {
-            gcs().send_text(MAV_SEVERITY_WARNING, "Out of memory for upload");
-            return MAV_MISSION_ERROR;
-        }
+    // fresh uploads are streamed straight into fence storage as the
+    // items arrive, so no RAM buffer is required
+    if (!_fence.polyfence().start_fence_upload(count)) {
+        return MAV_MISSION_ERROR;
     }
+    _streaming = true;
     _new_items_count = count;
     return MAV_MISSION_ACCEPTED;
 }
 
 MAV_MISSION_RESULT MissionItemProtocol_Fence::allocate_update_resources()
 {
+    // partial updates must merge incoming items with the stored
+    // fence, so this path still buffers the fence in RAM
+    if (_new_items != nullptr) {
+        INTERNAL_ERROR(AP_InternalError::error_t::flow_of_control);
+        return MAV_MISSION_ERROR;
+    }
     const uint16_t _item_count = _fence.polyfence().num_stored_items();
     _updated_mask = new uint8_t[(_item_count+7/8)];
     if (_updated_mask == nullptr) {
         return MAV_MISSION_ERROR;
     }
-    MAV_MISSION_RESULT ret = allocate_receive_resources(_item_count);
-    if (ret != MAV_MISSION_ACCEPTED) {
-        delete[] _updated_mask;
-        _updated_mask = nullptr;
-        return ret;
+    const uint16_t allocation_size = _item_count * sizeof(AC_PolyFenceItem);
+    if (allocation_size != 0) {
+        _new_items = (AC_PolyFenceItem*)malloc(allocation_size);
+        if (_new_items == nullptr) {
+            gcs().send_text(MAV_SEVERITY_WARNING, "Out of memory for upload");
+            delete[] _updated_mask;
+            _updated_mask = nullptr;
+            return MAV_MISSION_ERROR;
+        }
     }
     _new_items_count = _item_count;
     return MAV_MISSION_ACCEPTED;
@@ -42,6 +42,10 @@ private:
     MAV_MISSION_RESULT allocate_receive_resources(const uint16_t count) override WARN_IF_UNUSED;
     MAV_MISSION_RESULT allocate_update_resources() override WARN_IF_UNUSED;
 
+    // fresh uploads are streamed into fence storage one item at a
+    // time; only partial updates buffer the fence in _new_items
+    bool _streaming;
+
     class AC_PolyFenceItem *_new_items;
     uint16_t _new_items_count;
     uint8_t *_updated_mask;
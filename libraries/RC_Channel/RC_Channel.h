@@ -200,6 +200,7 @@ public:
         EKF_LANE_SWITCH =    103, // trigger lane switch attempt
         EKF_YAW_RESET =      104, // trigger yaw reset attempt
         GPS_DISABLE_YAW =    105, // disable GPS yaw for testing
+        PID_BURST =          106, // trigger high-rate PID burst capture (for tuning)
         // if you add something here, make sure to update the documentation of the parameter in RC_Channel.cpp!
         // also, if you add an option >255, you will need to fix duplicate_options_exist
 
@@ -466,6 +467,15 @@ public:
 
     uint32_t last_input_ms() const { return last_update_ms; };
 
+    // microsecond timestamp taken when the last RC frame completed
+    // decoding, for stick-input latency measurement. Zero if no
+    // frame has been received
+    uint32_t last_frame_time_us() const;
+
+    // age of the current RC input in microseconds. UINT32_MAX if no
+    // frame has ever been received
+    uint32_t input_age_us() const;
+
 protected:
 
     enum class Option {
@@ -96,6 +96,20 @@ int16_t RC_Channels::get_receiver_rssi(void)
     return hal.rcin->get_rssi();
 }
 
+uint32_t RC_Channels::last_frame_time_us(void) const
+{
+    return hal.rcin->last_input_us();
+}
+
+uint32_t RC_Channels::input_age_us(void) const
+{
+    const uint32_t frame_us = last_frame_time_us();
+    if (frame_us == 0) {
+        return UINT32_MAX;
+    }
+    return AP_HAL::micros() - frame_us;
+}
+
 void RC_Channels::clear_overrides(void)
 {
     RC_Channels &_rc = rc();
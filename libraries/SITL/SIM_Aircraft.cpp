@@ -274,12 +274,31 @@ void Aircraft::sync_frame_time(void)
 /* add noise based on throttle level (from 0..1) */
 void Aircraft::add_noise(float throttle)
 {
+    const float throttle_scale = fabsf(throttle);
     gyro += Vector3f(rand_normal(0, 1),
                      rand_normal(0, 1),
-                     rand_normal(0, 1)) * gyro_noise * fabsf(throttle);
+                     rand_normal(0, 1)) * gyro_noise * throttle_scale;
     accel_body += Vector3f(rand_normal(0, 1),
                            rand_normal(0, 1),
-                           rand_normal(0, 1)) * accel_noise * fabsf(throttle);
+                           rand_normal(0, 1)) * accel_noise * throttle_scale;
+}
+
+/*
+  fast uniform random numbers on [0,1). the libc rand() previously used
+  for the sensor noise takes a lock on glibc and dominates the noise
+  generation cost when many instances share a CI box; xorshift128+ is a
+  handful of register operations and keeps runs reproducible in the same
+  way the unseeded rand() did
+*/
+static double rand_uniform(void)
+{
+    static uint64_t seed[2] = { 0x9E3779B97F4A7C15ULL, 0xBF58476D1CE4E5B9ULL };
+    uint64_t x = seed[0];
+    const uint64_t y = seed[1];
+    seed[0] = y;
+    x ^= x << 23;
+    seed[1] = x ^ y ^ (x >> 17) ^ (y >> 26);
+    return ((seed[1] + y) >> 11) * (1.0 / (1ULL << 53));
 }
 
 /*
@@ -295,8 +314,8 @@ double Aircraft::rand_normal(double mean, double stddev)
         double x, y, r;
         do
         {
-            x = 2.0 * rand()/RAND_MAX - 1;
-            y = 2.0 * rand()/RAND_MAX - 1;
+            x = 2.0 * rand_uniform() - 1;
+            y = 2.0 * rand_uniform() - 1;
             r = x*x + y*y;
         } while (is_zero(r) || r > 1.0);
         const double d = sqrt(-2.0 * log(r)/r);
@@ -540,9 +559,12 @@ void Aircraft::update_dynamics(const Vector3f &rot_accel)
         accel_earth.z = 0;
     }
 
+    // body<->earth conversions below share the same transpose
+    const Matrix3f dcm_transposed = dcm.transposed();
+
     // work out acceleration as seen by the accelerometers. It sees the kinematic
     // acceleration (ie. real movement), plus gravity
-    accel_body = dcm.transposed() * (accel_earth + Vector3f(0.0f, 0.0f, -GRAVITY_MSS));
+    accel_body = dcm_transposed * (accel_earth + Vector3f(0.0f, 0.0f, -GRAVITY_MSS));
 
     // new velocity vector
     velocity_ef += accel_earth * delta_time;
@@ -555,7 +577,7 @@ void Aircraft::update_dynamics(const Vector3f &rot_accel)
     velocity_air_ef = velocity_ef + wind_ef;
 
     // velocity relative to airmass in body frame
-    velocity_air_bf = dcm.transposed() * velocity_air_ef;
+    velocity_air_bf = dcm_transposed * velocity_air_ef;
 
     // airspeed
     airspeed = velocity_air_ef.length();
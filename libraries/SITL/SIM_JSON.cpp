@@ -128,12 +128,22 @@ uint16_t JSON::parse_sensors(const char *json)
 {
     uint16_t received_bitmask = 0;
 
+    // sensor data is usually written in keytable order, so a
+    // progressive scan touches each byte of the packet roughly once
+    // instead of restarting strstr from the beginning for every key
+    const char *cursor = json;
+
     //printf("%s\n", json);
     for (uint16_t i=0; i<ARRAY_SIZE(keytable); i++) {
         struct keytable &key = keytable[i];
 
-        /* look for section header */
-        const char *p = strstr(json, key.section);
+        /* look for section header, from the cursor first and falling
+           back to the start of the packet for senders using another
+           key order */
+        const char *p = strstr(cursor, key.section);
+        if (!p) {
+            p = strstr(json, key.section);
+        }
         if (!p) {
             // we don't have this sensor
             if (key.required) {
@@ -158,6 +168,7 @@ uint16_t JSON::parse_sensors(const char *json)
         received_bitmask |= 1U << i;
 
         p += strlen(key.key)+2;
+        cursor = p;
         switch (key.type) {
             case DATA_UINT64:
                 *((uint64_t *)key.ptr) = strtoull(p, nullptr, 10);
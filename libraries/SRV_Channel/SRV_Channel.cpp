@@ -120,12 +120,39 @@ void SRV_Channel::calc_pwm(int16_t output_scaled)
         force = true;
     }
 
+    // skip the scaling maths when nothing it depends on has changed
+    // since the last loop
+    if (calc_cache.valid &&
+        output_scaled == calc_cache.output_scaled &&
+        force == calc_cache.force &&
+        type_angle == calc_cache.type_angle &&
+        high_out == calc_cache.high_out &&
+        servo_min == calc_cache.servo_min &&
+        servo_max == calc_cache.servo_max &&
+        servo_trim == calc_cache.servo_trim &&
+        (reversed != 0) == calc_cache.reversed) {
+        set_output_pwm(calc_cache.pwm, force);
+        return;
+    }
+
     uint16_t pwm;
     if (type_angle) {
         pwm = pwm_from_angle(output_scaled);
     } else {
         pwm = pwm_from_range(output_scaled);
     }
+
+    calc_cache.output_scaled = output_scaled;
+    calc_cache.force = force;
+    calc_cache.type_angle = type_angle;
+    calc_cache.high_out = high_out;
+    calc_cache.servo_min = servo_min;
+    calc_cache.servo_max = servo_max;
+    calc_cache.servo_trim = servo_trim;
+    calc_cache.reversed = (reversed != 0);
+    calc_cache.pwm = pwm;
+    calc_cache.valid = true;
+
     set_output_pwm(pwm,force);
 }
 
@@ -273,6 +273,23 @@ private:
     // high point of angle or range output
     uint16_t high_out;
 
+    // cached result of the last calc_pwm scaling, re-used while all
+    // of its inputs are unchanged, which is the common case at loop
+    // rate. The servo parameters are part of the key so a parameter
+    // change takes effect immediately
+    struct {
+        int16_t output_scaled;
+        int16_t servo_min;
+        int16_t servo_max;
+        int16_t servo_trim;
+        uint16_t high_out;
+        uint16_t pwm;
+        bool reversed:1;
+        bool type_angle:1;
+        bool force:1;
+        bool valid:1;
+    } calc_cache;
+
     // convert a 0..range_max to a pwm
     uint16_t pwm_from_range(int16_t scaled_value) const;
 
@@ -304,6 +321,11 @@ private:
     // previous radio_in during pass-thru
     int16_t previous_radio_in;
 
+    // RC input channel this output passes through, -1 for none.
+    // Derived from the function in update_aux_servo_function() so
+    // output_ch() does not re-derive it every cycle
+    int8_t passthrough_source = -1;
+
     // specify that small rcinput changes should be ignored during passthrough
     // used by DO_SET_SERVO commands
     bool ign_small_rcin_changes;
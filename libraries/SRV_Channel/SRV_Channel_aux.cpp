@@ -27,18 +27,9 @@ extern const AP_HAL::HAL& hal;
 void SRV_Channel::output_ch(void)
 {
 #ifndef HAL_BUILD_AP_PERIPH
-    int8_t passthrough_from = -1;
+    // passthrough source is precomputed in update_aux_servo_function()
+    const int8_t passthrough_from = passthrough_source;
 
-    // take care of special function cases
-    switch(function)
-    {
-    case k_manual:              // manual
-        passthrough_from = ch_num;
-        break;
-    case k_rcin1 ... k_rcin16: // rc pass-thru
-        passthrough_from = int8_t(function - k_rcin1);
-        break;
-    }
     if (passthrough_from != -1) {
         // we are doing passthrough from input to output for this channel
         RC_Channel *c = rc().channel(passthrough_from);
@@ -182,6 +173,16 @@ void SRV_Channels::update_aux_servo_function(void)
             function_mask.set((uint8_t)channels[i].function.get());
             functions[channels[i].function.get()].channel_mask |= 1U<<i;
         }
+
+        // precompute the RC passthrough source for output_ch()
+        const int16_t fn = channels[i].function.get();
+        if (fn == SRV_Channel::k_manual) {
+            channels[i].passthrough_source = channels[i].ch_num;
+        } else if (fn >= SRV_Channel::k_rcin1 && fn <= SRV_Channel::k_rcin16) {
+            channels[i].passthrough_source = int8_t(fn - SRV_Channel::k_rcin1);
+        } else {
+            channels[i].passthrough_source = -1;
+        }
     }
     initialised = true;
 }
@@ -83,6 +83,7 @@ const StorageManager::StorageArea StorageManager::layout[STORAGE_NUM_AREAS] = {
     { StorageParam,    16384, 1280},
     { StorageMission,  17664, 9842},
     { StorageParamBak, 27506, 5376},
+    { StorageEKF,      16256,  128}, // EKF alignment cache, in the gap at the end of the first 16k
 #endif
 };
 
@@ -126,6 +127,7 @@ const StorageManager::StorageArea StorageManager::layout[STORAGE_NUM_AREAS] = {
     { StorageParam,    16384, 1280},
     { StorageMission,  17664, 9842},
     { StorageParamBak, 27506, 5376},
+    { StorageEKF,      16256,  128}, // EKF alignment cache, in the gap at the end of the first 16k
 #endif
 };
 #endif // STORAGE_NUM_AREAS == 1